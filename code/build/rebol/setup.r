@@ -12,7 +12,7 @@ extern:         %extern/
 cache:          %cache/
 temp:           %.temp/
 premake-root:   dirize %extern/premake/bin
-builds:         [code %code/build tutorial %tutorial/build orxfontgen %tools/orxFontGen/build orxcrypt %tools/orxCrypt/build]
+builds:         [code %code/build tutorial %tutorial/build orxfontgen %tools/orxFontGen/build orxcrypt %tools/orxCrypt/build orxbench %tools/orxBench/build]
 hg:             %.hg/
 hg-hook:        {update.orx}
 git:            %.git/
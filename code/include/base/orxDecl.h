@@ -134,6 +134,23 @@
 
 #endif /* __BYTE_ORDER__ && __ORDER_BIG_ENDIAN__ */
 
+/* No SIMD defines? */
+#if !defined(__orxSSE2__) && !defined(__orxNEON__) && !defined(__orxNO_SIMD__)
+
+  /* SSE2? */
+  #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+
+    #define __orxSSE2__
+
+  /* NEON? */
+  #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+
+    #define __orxNEON__
+
+  #endif
+
+#endif /* !__orxSSE2__ && !__orxNEON__ && !__orxNO_SIMD__ */
+
 /* No compiler defines? */
 #if !defined(__orxLLVM__) && !defined(__orxGCC__) && !defined(__orxMSVC__)
 
@@ -60,6 +60,10 @@ typedef enum __orxCONFIG_EVENT_t
 {
   orxCONFIG_EVENT_RELOAD_START = 0,                     /**< Event sent when reloading config starts */
   orxCONFIG_EVENT_RELOAD_STOP,                          /**< Event sent when reloading config stops */
+  orxCONFIG_EVENT_KEY_ADD,                              /**< Event sent when a key has been added by a file reload */
+  orxCONFIG_EVENT_KEY_UPDATE,                           /**< Event sent when a key's value has been modified by a file reload */
+  orxCONFIG_EVENT_KEY_REMOVE,                           /**< Event sent when a key has been removed by a file reload */
+  orxCONFIG_EVENT_SECTION_UPDATE,                       /**< Event sent once per modified section, after all its key events, when a file reload is complete */
 
   orxCONFIG_EVENT_NUMBER,
 
@@ -67,6 +71,16 @@ typedef enum __orxCONFIG_EVENT_t
 
 } orxCONFIG_EVENT;
 
+/** Config event payload
+ */
+typedef struct __orxCONFIG_EVENT_PAYLOAD_t
+{
+  const orxSTRING zSectionName;                         /**< Section name : 4 / 8 */
+  const orxSTRING zKey;                                 /**< Key, orxNULL for section events : 8 / 16 */
+  const orxSTRING zFileName;                            /**< Reloaded file name : 12 / 24 */
+
+} orxCONFIG_EVENT_PAYLOAD;
+
 
 /** Config callback function type to use with Save */
 typedef orxBOOL (orxFASTCALL *orxCONFIG_SAVE_FUNCTION)(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption);
@@ -104,6 +118,34 @@ extern orxDLLAPI void orxFASTCALL             orxConfig_EnableTypoCheck(orxBOOL
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxConfig_IsTypoCheckEnabled();
 
+/** Enables/disables resolved value cache, which stores the result of inherited lookups per section until any section gets modified
+ * @param[in] _bEnable          Enable / disable
+ */
+extern orxDLLAPI void orxFASTCALL             orxConfig_EnableResolveCache(orxBOOL _bEnable);
+
+/** Is resolved value cache enabled?
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxConfig_IsResolveCacheEnabled();
+
+/** Gets resolved value cache usage
+ * @param[out] _pu32HitCount    Number of lookups served by the cache, orxNULL to ignore
+ * @param[out] _pu32MissCount   Number of lookups that had to walk the inheritance chain, orxNULL to ignore
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_GetResolveCacheUsage(orxU32 *_pu32HitCount, orxU32 *_pu32MissCount);
+
+/** Gets config generation, which changes every time any section or value gets modified, can be used to validate data derived from config
+ * @return Current config generation
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxConfig_GetGeneration();
+
+/** Gets section generation, which changes every time the section or one of its ancestors (default parent included) gets modified, can be used to validate data derived from a section
+ * @param[in] _zSectionName     Concerned section
+ * @return Section generation
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxConfig_GetSectionGeneration(const orxSTRING _zSectionName);
+
 
 /** Sets encryption key
  * @param[in] _zEncryptionKey  Encryption key to use, orxNULL to clear
@@ -162,6 +204,15 @@ extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_ReloadHistory();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEncryption, const orxCONFIG_SAVE_FUNCTION _pfnSaveCallback);
 
+/** Writes config to given file as a binary image, which will be loaded without any parsing by orxConfig_Load. Will overwrite any existing file.
+ * Includes, conditionals and commands evaluated at load time are baked in the image, which isn't portable across endianness or engine versions.
+ * @param[in] _zFileName        File name, if null or empty the default file name will be used
+ * @param[in] _bUseEncryption   Use file encryption to make it human non-readable?
+ * @param[in] _pfnSaveCallback  Callback used to filter sections/keys to save, it has to be deterministic as it's called twice per section/key. If null, all sections/keys will be saved
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_SaveBinary(const orxSTRING _zFileName, orxBOOL _bUseEncryption, const orxCONFIG_SAVE_FUNCTION _pfnSaveCallback);
+
 /** Copies a file with optional encryption
  * @param[in] _zDstFileName     Name of the destination file
  * @param[in] _zSrcFileName     Name of the source file
@@ -231,6 +282,13 @@ extern orxDLLAPI const orxSTRING orxFASTCALL  orxConfig_GetParent(const orxSTRIN
  */
 extern orxDLLAPI orxU32 orxFASTCALL           orxConfig_GetParentDistance(const orxSTRING _zSectionName, const orxSTRING _zParentName);
 
+/** Is section affected by an update of another section, ie. is the updated section the section itself or one of its ancestors (default parent included)?
+ * @param[in] _zSectionName     Concerned section
+ * @param[in] _zUpdatedSectionName Updated section name, as sent with orxCONFIG_EVENT_SECTION_UPDATE
+ * @return orxTRUE if affected, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxConfig_IsSectionAffected(const orxSTRING _zSectionName, const orxSTRING _zUpdatedSectionName);
+
 /** Sets default parent for all sections
  * @param[in] _zSectionName     Section name that will be used as an implicit default parent section for all config sections, if orxNULL is provided, default parent will be removed
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
@@ -337,6 +395,18 @@ extern orxDLLAPI orxBOOL orxFASTCALL          orxConfig_IsCommandValue(const orx
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxConfig_HasValue(const orxSTRING _zKey);
 
+/** Gets a key ID that can be used with all the orxConfig_*ByID functions, best retrieved once and kept for repeated queries
+ * @param[in] _zKey             Key name
+ * @return Key ID
+ */
+extern orxDLLAPI orxSTRINGID orxFASTCALL      orxConfig_GetKeyID(const orxSTRING _zKey);
+
+/** Has specified value for the given key ID?
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxConfig_HasValueByID(orxSTRINGID _stKeyID);
+
 /** Has specified value for the given key (no check for typos)?
  * @param[in] _zKey             Key name
  * @return orxTRUE / orxFALSE
@@ -407,6 +477,64 @@ extern orxDLLAPI orxVECTOR *orxFASTCALL       orxConfig_GetVector(const orxSTRIN
  */
 extern orxDLLAPI orxVECTOR *orxFASTCALL       orxConfig_GetColorVector(const orxSTRING _zKey, orxCOLORSPACE _eColorSpace, orxVECTOR *_pvVector);
 
+/** Reads a signed integer value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return The value
+ */
+extern orxDLLAPI orxS32 orxFASTCALL           orxConfig_GetS32ByID(orxSTRINGID _stKeyID);
+
+/** Reads an unsigned integer value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return The value
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxConfig_GetU32ByID(orxSTRINGID _stKeyID);
+
+/** Reads a signed integer value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return The value
+ */
+extern orxDLLAPI orxS64 orxFASTCALL           orxConfig_GetS64ByID(orxSTRINGID _stKeyID);
+
+/** Reads an unsigned integer value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return The value
+ */
+extern orxDLLAPI orxU64 orxFASTCALL           orxConfig_GetU64ByID(orxSTRINGID _stKeyID);
+
+/** Reads a float value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return The value
+ */
+extern orxDLLAPI orxFLOAT orxFASTCALL         orxConfig_GetFloatByID(orxSTRINGID _stKeyID);
+
+/** Reads a string value from config, using a key ID (will take a random value if a list is provided for this key)
+ * Beware: result might not persist through any subsequent orxConfig_Get* calls
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return The value
+ */
+extern orxDLLAPI const orxSTRING orxFASTCALL  orxConfig_GetStringByID(orxSTRINGID _stKeyID);
+
+/** Reads a boolean value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return The value
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxConfig_GetBoolByID(orxSTRINGID _stKeyID);
+
+/** Reads a vector value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in]   _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @param[out]  _pvVector         Storage for vector value
+ * @return The value if valid, orxNULL otherwise
+ */
+extern orxDLLAPI orxVECTOR *orxFASTCALL       orxConfig_GetVectorByID(orxSTRINGID _stKeyID, orxVECTOR *_pvVector);
+
+/** Reads a vector value from config, using a key ID, and interpret any color literals in the given color space (will take a random value if a list is provided for this key)
+ * @param[in]   _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @param[in]   _eColorSpace      Color space to use when translating color literals (NONE: no literal, COMPONENT: 0-255 RGB values, all others: normalized spaces)
+ * @param[out]  _pvVector         Storage for vector value
+ * @return The value if valid, orxNULL otherwise
+ */
+extern orxDLLAPI orxVECTOR *orxFASTCALL       orxConfig_GetColorVectorByID(orxSTRINGID _stKeyID, orxCOLORSPACE _eColorSpace, orxVECTOR *_pvVector);
+
 /** Duplicates a raw value (string) from config
  * @param[in] _zKey             Key name
  * @return The value. If non-null, needs to be deleted by the caller with orxString_Delete()
@@ -557,6 +685,27 @@ extern orxDLLAPI orxVECTOR *orxFASTCALL       orxConfig_GetListVector(const orxS
  */
 extern orxDLLAPI orxVECTOR *orxFASTCALL       orxConfig_GetListColorVector(const orxSTRING _zKey, orxS32 _s32ListIndex, orxCOLORSPACE _eColorSpace, orxVECTOR *_pvVector);
 
+/** Gets list count for a given key ID
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return List count if it's a valid list, 0 otherwise
+ */
+extern orxDLLAPI orxS32 orxFASTCALL           orxConfig_GetListCountByID(orxSTRINGID _stKeyID);
+
+/** Reads a string value from config list, using a key ID
+ * Beware: result might not persist through any subsequent orxConfig_Get* calls
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @param[in] _s32ListIndex     Index of desired item in list / -1 for random
+ * @return The value
+ */
+extern orxDLLAPI const orxSTRING orxFASTCALL  orxConfig_GetListStringByID(orxSTRINGID _stKeyID, orxS32 _s32ListIndex);
+
+/** Reads a boolean value from config list, using a key ID
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @param[in] _s32ListIndex     Index of desired item in list / -1 for random
+ * @return The value
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL          orxConfig_GetListBoolByID(orxSTRINGID _stKeyID, orxS32 _s32ListIndex);
+
 /** Writes a list of string values to config
  * @param[in] _zKey             Key name
  * @param[in] _azValue          Values
@@ -201,6 +201,13 @@ extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_SendShort(orxEVENT_TYPE _eEvent
  */
 extern orxDLLAPI orxBOOL orxFASTCALL    orxEvent_IsSending();
 
+/** Has an event type/ID any handler? Can be used to skip building an event payload that no-one would receive
+ * @param[in] _eEventType           Event type
+ * @param[in] _eEventID             Event ID
+ * @return orxTRUE / orxFALSE
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL    orxEvent_HasHandler(orxEVENT_TYPE _eEventType, orxENUM _eEventID);
+
 #endif /*_orxEVENT_H_*/
 
 /** @} */
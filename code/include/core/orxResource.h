@@ -48,6 +48,8 @@
  */
 #define orxRESOURCE_KZ_CONFIG_SECTION                     "Resource"
 #define orxRESOURCE_KZ_CONFIG_WATCH_LIST                  "WatchList"
+#define orxRESOURCE_KZ_CONFIG_LOOKUP_CACHE                "LookupCache"
+#define orxRESOURCE_KZ_CONFIG_WORKER_COUNT                "WorkerCount"
 
 #define orxRESOURCE_KC_LOCATION_SEPARATOR                 ':'
 
@@ -60,6 +62,10 @@
  */
 typedef void (orxFASTCALL *orxRESOURCE_OP_FUNCTION)(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer, void *_pContext);
 
+/** Resource prefetch completion callback function
+ */
+typedef void (orxFASTCALL *orxRESOURCE_PREFETCH_FUNCTION)(const orxSTRING _zSet, orxU32 _u32LoadCount, orxU32 _u32TotalCount, void *_pContext);
+
 
 /** Resource handlers
  */
@@ -73,6 +79,8 @@ typedef orxS64          (orxFASTCALL *orxRESOURCE_FUNCTION_TELL)(orxHANDLE _hRes
 typedef orxS64          (orxFASTCALL *orxRESOURCE_FUNCTION_READ)(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer);
 typedef orxS64          (orxFASTCALL *orxRESOURCE_FUNCTION_WRITE)(orxHANDLE _hResource, orxS64 _s64Size, const void *_pBuffer);
 typedef orxSTATUS       (orxFASTCALL *orxRESOURCE_FUNCTION_DELETE)(const orxSTRING _zLocation);
+typedef const void *    (orxFASTCALL *orxRESOURCE_FUNCTION_MAP)(orxHANDLE _hResource, orxS64 *_ps64Size);
+typedef void            (orxFASTCALL *orxRESOURCE_FUNCTION_UNMAP)(orxHANDLE _hResource, const void *_pMap, orxS64 _s64Size);
 
 /** Resource type info
  */
@@ -89,6 +97,8 @@ typedef struct __orxRESOURCE_TYPE_INFO_t
   orxRESOURCE_FUNCTION_READ     pfnRead;                  /**< Read function, mandatory */
   orxRESOURCE_FUNCTION_WRITE    pfnWrite;                 /**< Write function, optional, for write support */
   orxRESOURCE_FUNCTION_DELETE   pfnDelete;                /**< Delete function, optional, for deletion support */
+  orxRESOURCE_FUNCTION_MAP      pfnMap;                   /**< Map function, optional, for zero-copy read support */
+  orxRESOURCE_FUNCTION_UNMAP    pfnUnmap;                 /**< Unmap function, optional, for zero-copy read support */
 
 } orxRESOURCE_TYPE_INFO;
 
@@ -99,6 +109,7 @@ typedef enum __orxRESOURCE_EVENT_t
   orxRESOURCE_EVENT_UPDATE = 0,
   orxRESOURCE_EVENT_ADD,
   orxRESOURCE_EVENT_REMOVE,
+  orxRESOURCE_EVENT_PREFETCH,
 
   orxRESOURCE_EVENT_NUMBER,
 
@@ -116,9 +127,40 @@ typedef struct __orxRESOURCE_EVENT_PAYLOAD_t
   orxSTRINGID                   stGroupID;                /**< Group ID : 24 / 32 */
   orxSTRINGID                   stStorageID;              /**< Storage ID : 32 / 40 */
   orxSTRINGID                   stNameID;                 /**< Name ID : 40 / 48 */
+  const orxSTRING               zPrefetchSet;             /**< Prefetch set, orxRESOURCE_EVENT_PREFETCH only : 44 / 56 */
+  orxU32                        u32PrefetchCount;         /**< Processed resource count in prefetch set, orxRESOURCE_EVENT_PREFETCH only : 48 / 60 */
+  orxU32                        u32PrefetchTotal;         /**< Total resource count in prefetch set, orxRESOURCE_EVENT_PREFETCH only : 52 / 64 */
 
 } orxRESOURCE_EVENT_PAYLOAD;
 
+/** Request priority enum
+ */
+typedef enum __orxRESOURCE_PRIORITY_t
+{
+  orxRESOURCE_PRIORITY_CRITICAL = 0,
+  orxRESOURCE_PRIORITY_NORMAL,
+  orxRESOURCE_PRIORITY_BACKGROUND,
+
+  orxRESOURCE_PRIORITY_NUMBER,
+
+  orxRESOURCE_PRIORITY_NONE = orxENUM_NONE
+
+} orxRESOURCE_PRIORITY;
+
+/** Asynchronous request statistics
+ */
+typedef struct __orxRESOURCE_STATS_t
+{
+  orxU64                        u64ReadSize;              /**< Read size, in bytes : 8 */
+  orxU64                        u64WriteSize;             /**< Written size, in bytes : 16 */
+  orxDOUBLE                     dServiceTime;             /**< Time spent by workers servicing requests, in seconds (throughput = size / service time) : 24 */
+  orxDOUBLE                     dLatency;                 /**< Cumulated latency, from request to completion, in seconds : 32 */
+  orxDOUBLE                     dMaxLatency;              /**< Max latency, in seconds : 40 */
+  orxU32                        u32RequestCount;          /**< Completed request count : 44 */
+  orxU32                        u32CancelCount;           /**< Cancelled request count : 48 */
+
+} orxRESOURCE_STATS;
+
 
 /** Resource module setup
  */
@@ -272,6 +314,19 @@ extern orxDLLAPI orxS64 orxFASTCALL                       orxResource_Read(orxHA
  */
 extern orxDLLAPI orxS64 orxFASTCALL                       orxResource_Write(orxHANDLE _hResource, orxS64 _s64Size, const void *_pBuffer, orxRESOURCE_OP_FUNCTION _pfnCallback, void *_pContext);
 
+/** Maps the whole content of a resource in memory, read-only, without copying it, if supported by its type
+ * The mapping remains valid until orxResource_Unmap or orxResource_Close is called on that resource
+ * @param[in] _hResource        Concerned resource
+ * @param[out] _ps64Size        Size of the mapped content, in bytes, if not null
+ * @return Pointer to the mapped content if successful, orxNULL otherwise (caller should then use orxResource_Read)
+ */
+extern orxDLLAPI const void *orxFASTCALL                  orxResource_Map(orxHANDLE _hResource, orxS64 *_ps64Size);
+
+/** Unmaps the content of a resource previously mapped with orxResource_Map
+ * @param[in] _hResource        Concerned resource
+ */
+extern orxDLLAPI void orxFASTCALL                         orxResource_Unmap(orxHANDLE _hResource);
+
 /** Deletes a resource, given its location
  * @param[in] _zLocation        Location of the resource to delete
  * @return orxSTATUS_SUCCESS upon success, orxSTATUS_FAILURE otherwise
@@ -285,11 +340,43 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                    orxResource_Delete(con
  */
 extern orxDLLAPI orxU32 orxFASTCALL                       orxResource_GetPendingOpCount(const orxHANDLE _hResource);
 
+/** Sets the priority of the asynchronous operations that will be issued on a given resource; requests of a same resource are always processed in order
+ * @param[in] _hResource        Concerned resource
+ * @param[in] _ePriority        Priority to use for the resource's upcoming asynchronous operations, defaults to orxRESOURCE_PRIORITY_NORMAL
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxResource_SetPriority(orxHANDLE _hResource, orxRESOURCE_PRIORITY _ePriority);
+
+/** Gets the priority of the asynchronous operations issued on a given resource
+ * @param[in] _hResource        Concerned resource
+ * @return orxRESOURCE_PRIORITY
+ */
+extern orxDLLAPI orxRESOURCE_PRIORITY orxFASTCALL         orxResource_GetPriority(const orxHANDLE _hResource);
+
+/** Cancels all the pending asynchronous read/write operations of a given resource that haven't been started yet; their callbacks will still be called, with a size of 0
+ * @param[in] _hResource        Concerned resource
+ * @return Number of cancelled operations
+ */
+extern orxDLLAPI orxU32 orxFASTCALL                       orxResource_Cancel(orxHANDLE _hResource);
+
 /** Gets total pending operation count
  * @return Number of total pending asynchronous operations
  */
 extern orxDLLAPI orxU32 orxFASTCALL                       orxResource_GetTotalPendingOpCount();
 
+/** Gets asynchronous request statistics for specific resource group(s)
+ * @param[in] _zGroup           Concerned resource group, orxNULL for all requests
+ * @param[out] _pstStats        Statistics
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxResource_GetStats(const orxSTRING _zGroup, orxRESOURCE_STATS *_pstStats);
+
+/** Resets asynchronous request statistics for specific resource group(s)
+ * @param[in] _zGroup           Concerned resource group, orxNULL for all groups
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxResource_ResetStats(const orxSTRING _zGroup);
+
 
 /** Registers a new resource type
  * @param[in] _pstInfo          Info describing the new resource type and how to handle it
@@ -354,6 +441,21 @@ extern orxDLLAPI orxHANDLE orxFASTCALL                    orxResource_GetNextCac
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                    orxResource_SetMemoryResource(const orxSTRING _zGroup, const orxSTRING _zStorage, const orxSTRING _zName, orxS64 _s64Size, const void *_pBuffer);
 
+/** Prefetches a set of resources in memory: the set is a config section where each key is a resource group and its values are the names of the resources to prefetch for that group
+ * Resources are read asynchronously with a background priority and then served as memory resources, in their original storage, until the set is released. An orxRESOURCE_EVENT_PREFETCH event is sent for every processed resource.
+ * @param[in] _zSet             Name of the config section defining the set
+ * @param[in] _pfnCallback      Function called once all the resources of the set have been processed, orxNULL to ignore
+ * @param[in] _pContext         Context that will be transmitted to the callback when called
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxResource_Prefetch(const orxSTRING _zSet, orxRESOURCE_PREFETCH_FUNCTION _pfnCallback, void *_pContext);
+
+/** Releases a set of prefetched resources: their memory is freed and their locations will point again to their original types
+ * @param[in] _zSet             Name of the config section defining the set
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE, if any of those resources is still in use
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxResource_ReleasePrefetch(const orxSTRING _zSet);
+
 #endif /* _orxRESOURCE_H_ */
 
 /** @} */
@@ -67,6 +67,9 @@ typedef struct __orxTHREAD_SEMAPHORE_t                orxTHREAD_SEMAPHORE;
 /** Thread run function type */
 typedef orxSTATUS (orxFASTCALL *orxTHREAD_FUNCTION)(void *_pContext);
 
+/** Parallel for function type, processes items in [_u32Begin, _u32End) */
+typedef void (orxFASTCALL *orxTHREAD_FOR_FUNCTION)(orxU32 _u32Begin, orxU32 _u32End, void *_pContext);
+
 
 /** Thread module setup
  */
@@ -167,6 +170,16 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_RunTask(const or
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_RunTaskLinear(const orxTHREAD_FUNCTION _pfnRun, const orxTHREAD_FUNCTION _pfnThen, const orxTHREAD_FUNCTION _pfnElse, void *_pContext);
 
+/** Runs a data-parallel job, splitting its items in chunks processed by all the workers as well as the calling thread, which blocks until all the items have been processed.
+ * Idle participants steal half of the remaining items of busy ones. Calls made from within a running parallel job are processed sequentially on the calling thread.
+ * @param[in]   _u32Count                             Number of items to process
+ * @param[in]   _u32Grain                             Max number of items processed in a single call to _pfnRun, 0 for automatic
+ * @param[in]   _pfnRun                               Function to run on each chunk, can be called concurrently from different threads
+ * @param[in]   _pContext                             Context that will be transmitted to the function when called
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_ParallelFor(orxU32 _u32Count, orxU32 _u32Grain, const orxTHREAD_FOR_FUNCTION _pfnRun, void *_pContext);
+
 /** Gets number of pending asynchronous tasks awaiting full completion (might pump task notifications if called from main thread)
  * @return      Number of pending asynchronous tasks
  */
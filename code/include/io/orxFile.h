@@ -195,6 +195,19 @@ extern orxDLLAPI orxS64 orxFASTCALL         orxFile_GetSize(const orxFILE *_pstF
  */
 extern orxDLLAPI orxS64 orxFASTCALL         orxFile_GetTime(const orxFILE *_pstFile);
 
+/** Maps the full content of an opened file in memory, read-only
+ * @param[in] _pstFile              Concerned file
+ * @param[in] _s64Size              Size of the file, in bytes
+ * @return Pointer to the mapped content if supported & successful, orxNULL otherwise
+ */
+extern orxDLLAPI const void *orxFASTCALL    orxFile_Map(orxFILE *_pstFile, orxS64 _s64Size);
+
+/** Unmaps a file content previously mapped with orxFile_Map
+ * @param[in] _pMap                 Mapped content
+ * @param[in] _s64Size              Size of the mapped content, in bytes
+ */
+extern orxDLLAPI void orxFASTCALL           orxFile_Unmap(const void *_pMap, orxS64 _s64Size);
+
 /** Prints a formatted string to a file
  * @param[in] _pstFile             Pointer to the file descriptor
  * @param[in] _zString             Formatted string
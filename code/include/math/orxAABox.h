@@ -291,6 +291,18 @@ static orxINLINE orxVECTOR *                  orxAABox_GetCenter(const orxAABOX
   return _pvRes;
 }
 
+
+/* *** AABox batch functions *** */
+
+/** Tests an axis aligned box against an array of axis aligned boxes, in 2D (see orxAABox_Test2DIntersection, uses SSE2/NEON when available)
+ * @param[in]   _pstBox                       Box to test
+ * @param[in]   _astBoxList                   Array of boxes to test against
+ * @param[in]   _u32Count                     Number of boxes in the array
+ * @param[out]  _abResult                     Per-box results: orxTRUE if that box intersects the tested one in 2D, orxFALSE otherwise
+ * @return      Number of intersecting boxes
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxAABox_Test2DIntersectionArray(const orxAABOX *_pstBox, const orxAABOX *_astBoxList, orxU32 _u32Count, orxBOOL *_abResult);
+
 #endif /* _orxAABOX_H_ */
 
 /** @} */
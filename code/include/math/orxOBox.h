@@ -378,6 +378,27 @@ static orxINLINE orxBOOL                      orxOBox_ZAlignedTestIntersection(c
   return bResult;
 }
 
+
+/* *** OBox batch functions *** */
+
+/** Tests a position against an array of 2D oriented boxes (see orxOBox_2DIsInside, uses SSE2/NEON when available)
+ * @param[in]   _astBoxList                   Array of boxes to test
+ * @param[in]   _u32Count                     Number of boxes
+ * @param[in]   _pvPosition                   Position to test
+ * @param[out]  _abResult                     Per-box results: orxTRUE if the position is inside that box, orxFALSE otherwise
+ * @return      Number of boxes containing the position
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxOBox_2DIsInsideArray(const orxOBOX *_astBoxList, orxU32 _u32Count, const orxVECTOR *_pvPosition, orxBOOL *_abResult);
+
+/** Tests an oriented box against an array of oriented boxes (see orxOBox_ZAlignedTestIntersection, uses SSE2/NEON when available)
+ * @param[in]   _pstBox                       Box to test
+ * @param[in]   _astBoxList                   Array of boxes to test against
+ * @param[in]   _u32Count                     Number of boxes in the array
+ * @param[out]  _abResult                     Per-box results: orxTRUE if that box intersects the tested one, orxFALSE otherwise
+ * @return      Number of intersecting boxes
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxOBox_ZAlignedTestIntersectionArray(const orxOBOX *_pstBox, const orxOBOX *_astBoxList, orxU32 _u32Count, orxBOOL *_abResult);
+
 #endif /* _orxOBOX_H_ */
 
 /** @} */
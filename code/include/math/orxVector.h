@@ -998,6 +998,17 @@ extern orxDLLAPI orxVECTOR *orxFASTCALL orxVector_Bezier(orxVECTOR *_pvRes, cons
  */
 extern orxDLLAPI orxVECTOR *orxFASTCALL orxVector_CatmullRom(orxVECTOR *_pvRes, const orxVECTOR *_pvPoint1, const orxVECTOR *_pvPoint2, const orxVECTOR *_pvPoint3, const orxVECTOR *_pvPoint4, orxFLOAT _fT);
 
+/** Transforms an array of vectors: scales them, rotates them in 2D (along Z-axis), then translates them, same results as orxVector_Mul() + orxVector_2DRotate() + orxVector_Add() (uses SSE2/NEON when available)
+ * @param[out]  _avRes                      Array where to store the results (can be the operand array)
+ * @param[in]   _avOp                       Array of vectors to transform
+ * @param[in]   _u32Count                   Number of vectors
+ * @param[in]   _pvScale                    Scale to apply
+ * @param[in]   _fRotation                  Rotation to apply (radians)
+ * @param[in]   _pvTranslation              Translation to apply
+ * @return      Array of transformed vectors
+ */
+extern orxDLLAPI orxVECTOR *orxFASTCALL orxVector_2DTransformArray(orxVECTOR *_avRes, const orxVECTOR *_avOp, orxU32 _u32Count, const orxVECTOR *_pvScale, orxFLOAT _fRotation, const orxVECTOR *_pvTranslation);
+
 
 /* *** Vector constants *** */
 
@@ -58,6 +58,24 @@ typedef struct __orxBANK_t orxBANK;
 /* Define flags */
 #define orxBANK_KU32_FLAG_NONE              0x00000000  /**< No flags (default behaviour) */
 #define orxBANK_KU32_FLAG_NOT_EXPANDABLE    0x00000001  /**< The bank will not be expandable */
+#define orxBANK_KU32_FLAG_RELEASE_SEGMENTS  0x00000002  /**< The bank will release its trailing empty segments, keeping a single spare one */
+
+
+/** Bank stats
+ */
+typedef struct __orxBANK_STATS_t
+{
+  orxU64  u64Size;                          /**< Total allocated segment size, in bytes : 0 */
+  orxFLOAT fFragmentation;                  /**< Fragmentation, ie. ratio of free cells inside used segments : 8 */
+  orxU32  u32CellCount;                     /**< Live cell count : 12 */
+  orxU32  u32PeakCellCount;                 /**< Peak cell count : 16 */
+  orxU32  u32CellSize;                      /**< Cell size, in bytes : 20 */
+  orxU32  u32SegmentSize;                   /**< Cell count per segment : 24 */
+  orxU32  u32SegmentCount;                  /**< Segment count : 28 */
+  orxU32  u32UsedSegmentCount;              /**< Non-empty segment count : 32 */
+
+} orxBANK_STATS;
+
 
 /** Setups the bank module
  */
@@ -153,6 +171,19 @@ extern orxDLLAPI void *orxFASTCALL          orxBank_GetAtIndex(const orxBANK *_p
  */
 extern orxDLLAPI orxU32 orxFASTCALL         orxBank_GetCount(const orxBANK *_pstBank);
 
+/** Gets a bank stats
+ * @param[in] _pstBank    Concerned bank
+ * @param[out] _pstStats  Stats to fill
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL      orxBank_GetStats(const orxBANK *_pstBank, orxBANK_STATS *_pstStats);
+
+/** Gets the next bank, used to iterate over all the existing banks
+ * @param[in] _pstBank    Current bank, orxNULL to get the first one
+ * @return The next bank if found, orxNULL otherwise
+ */
+extern orxDLLAPI orxBANK *orxFASTCALL       orxBank_GetNextBank(const orxBANK *_pstBank);
+
 #endif /* _orxBANK_H_ */
 
 /** @} */
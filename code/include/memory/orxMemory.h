@@ -59,7 +59,17 @@
   #define orxMEMORY_ATOMIC_DEC32(ADDRESS)                 __atomic_sub_fetch((ADDRESS), 1, __ATOMIC_SEQ_CST)
   #define orxMEMORY_ATOMIC_INC64(ADDRESS)                 __atomic_add_fetch((ADDRESS), 1, __ATOMIC_SEQ_CST)
   #define orxMEMORY_ATOMIC_DEC64(ADDRESS)                 __atomic_sub_fetch((ADDRESS), 1, __ATOMIC_SEQ_CST)
+  #define orxMEMORY_ATOMIC_ADD32(ADDRESS, VALUE)          __atomic_add_fetch((ADDRESS), (VALUE), __ATOMIC_SEQ_CST)
+  #define orxMEMORY_ATOMIC_CAS32(ADDRESS, OLD, NEW)       ((__sync_bool_compare_and_swap((ADDRESS), (OLD), (NEW)) != 0) ? orxTRUE : orxFALSE)
+  #define orxMEMORY_ATOMIC_CAS64(ADDRESS, OLD, NEW)       ((__sync_bool_compare_and_swap((ADDRESS), (OLD), (NEW)) != 0) ? orxTRUE : orxFALSE)
   #define orxHAS_ATOMICS
+  #if defined(__i386__) || defined(__x86_64__)
+    #define orxMEMORY_PAUSE()                             __builtin_ia32_pause()
+  #elif defined(__aarch64__) || (defined(__arm__) && (__ARM_ARCH >= 7))
+    #define orxMEMORY_PAUSE()                             __asm__ __volatile__("yield")
+  #else
+    #define orxMEMORY_PAUSE()
+  #endif
   #if defined(__orxGCC__)
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Wstringop-overflow"
@@ -79,13 +89,27 @@
   #define orxMEMORY_ATOMIC_DEC32(ADDRESS)                 ((orxU32)_InterlockedDecrement((volatile long *)(ADDRESS)))
   #define orxMEMORY_ATOMIC_INC64(ADDRESS)                 ((orxU64)_InterlockedIncrement64((volatile __int64 *)(ADDRESS)))
   #define orxMEMORY_ATOMIC_DEC64(ADDRESS)                 ((orxU64)_InterlockedDecrement64((volatile __int64 *)(ADDRESS)))
+  #define orxMEMORY_ATOMIC_ADD32(ADDRESS, VALUE)          ((orxU32)_InterlockedExchangeAdd((volatile long *)(ADDRESS), (long)(VALUE)) + (orxU32)(VALUE))
+  #define orxMEMORY_ATOMIC_CAS32(ADDRESS, OLD, NEW)       ((_InterlockedCompareExchange((volatile long *)(ADDRESS), (long)(NEW), (long)(OLD)) == (long)(OLD)) ? orxTRUE : orxFALSE)
+  #define orxMEMORY_ATOMIC_CAS64(ADDRESS, OLD, NEW)       ((_InterlockedCompareExchange64((volatile __int64 *)(ADDRESS), (__int64)(NEW), (__int64)(OLD)) == (__int64)(OLD)) ? orxTRUE : orxFALSE)
   #define orxHAS_ATOMICS
+  #if defined(_M_IX86) || defined(_M_X64)
+    #define orxMEMORY_PAUSE()                             _mm_pause()
+  #elif defined(_M_ARM) || defined(_M_ARM64)
+    #define orxMEMORY_PAUSE()                             __yield()
+  #else
+    #define orxMEMORY_PAUSE()
+  #endif
 #else
   #define orxMEMORY_BARRIER()
   #define orxMEMORY_ATOMIC_INC32(ADDRESS)                 (++(*(ADDRESS)))
   #define orxMEMORY_ATOMIC_DEC32(ADDRESS)                 (--(*(ADDRESS)))
   #define orxMEMORY_ATOMIC_INC64(ADDRESS)                 (++(*(ADDRESS)))
   #define orxMEMORY_ATOMIC_DEC64(ADDRESS)                 (--(*(ADDRESS)))
+  #define orxMEMORY_ATOMIC_ADD32(ADDRESS, VALUE)          ((*(ADDRESS)) += (VALUE))
+  #define orxMEMORY_ATOMIC_CAS32(ADDRESS, OLD, NEW)       ((*(ADDRESS) == (OLD)) ? ((*(ADDRESS) = (NEW)), orxTRUE) : orxFALSE)
+  #define orxMEMORY_ATOMIC_CAS64(ADDRESS, OLD, NEW)       ((*(ADDRESS) == (OLD)) ? ((*(ADDRESS) = (NEW)), orxTRUE) : orxFALSE)
+  #define orxMEMORY_PAUSE()
   #undef orxHAS_MEMORY_BARRIER
   #undef orxHAS_ATOMICS
 
@@ -121,6 +145,7 @@ typedef enum __orxMEMORY_TYPE_t
   orxMEMORY_TYPE_TEMP,                                    /**< Temporary / scratch memory */
   orxMEMORY_TYPE_TEXT,                                    /**< Text memory */
   orxMEMORY_TYPE_VIDEO,                                   /**< Video memory type */
+  orxMEMORY_TYPE_FRAME,                                   /**< Frame memory (orxMemory_AllocateFrame), usage is reset every core clock tick */
 
   orxMEMORY_TYPE_NUMBER,                                  /**< Number of memory type */
 
@@ -173,6 +198,16 @@ extern orxDLLAPI void *orxFASTCALL                        orxMemory_Reallocate(v
  */
 extern orxDLLAPI void orxFASTCALL                         orxMemory_Free(void *_pMem);
 
+/** Allocates some frame memory from the current thread's arena: it is only valid until the end of the current core clock tick and should never be freed
+ * @param[in]  _u32Size  Size of the memory to allocate
+ * @return  returns a pointer to the memory allocated (16 bytes aligned), or orxNULL if an error has occurred
+ */
+extern orxDLLAPI void *orxFASTCALL                        orxMemory_AllocateFrame(orxU32 _u32Size);
+
+/** Resets frame memory for all threads, called by the clock module at the end of each core clock tick, *do not* call it unless you know what you're doing
+ */
+extern orxDLLAPI void orxFASTCALL                         orxMemory_ResetFrame();
+
 
 /** Copies a part of memory into another one
  * @param[out] _pDest    Destination pointer
@@ -105,6 +105,10 @@ typedef enum __orxFRAME_SPACE_t
  */
 typedef struct __orxFRAME_t                   orxFRAME;
 
+/** Moved frame callback
+ */
+typedef void (orxFASTCALL *orxFRAME_MOVED_FUNCTION)(orxFRAME *_pstFrame, void *_pContext);
+
 
 /** Get ignore flag values
  * @param[in]   _zFlags         Literal ignore flags
@@ -176,6 +180,34 @@ extern orxDLLAPI orxFRAME *orxFASTCALL        orxFrame_GetSibling(const orxFRAME
  */
 extern orxDLLAPI orxBOOL orxFASTCALL          orxFrame_IsRootChild(const orxFRAME *_pstFrame);
 
+/** Gets frame module update count, increased every time the global data of any frame is modified
+ * @return Update count
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxFrame_GetUpdateCount();
+
+/** Gets frame update stamp: value of the module update count when the frame global data was last modified
+ * @param[in]   _pstFrame       Concerned frame
+ * @return Update stamp
+ */
+extern orxDLLAPI orxU32 orxFASTCALL           orxFrame_GetUpdateStamp(const orxFRAME *_pstFrame);
+
+/** Processes all dirty frames, parents before children, in a single pass (only needed when LazyUpdate is enabled),
+ * independent root hierarchies being processed in parallel on task workers when [Frame] ParallelUpdate is enabled
+ */
+extern orxDLLAPI void orxFASTCALL             orxFrame_ProcessAll();
+
+/** Enables / disables moved frame tracking: when enabled, frames whose global data get modified are recorded until the next orxFrame_FlushMovedList call
+ * @param[in]   _bEnable        Enable / disable
+ */
+extern orxDLLAPI void orxFASTCALL             orxFrame_TrackMoved(orxBOOL _bEnable);
+
+/** Flushes the moved frame list (only filled when tracking is enabled with orxFrame_TrackMoved)
+ * @param[in]   _pfnCallback    Function called for every frame whose global data got modified since last flush, must not modify any frame
+ * @param[in]   _pContext       Context transmitted to the callback
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE if some moves couldn't be recorded, in which case all frames should be considered as moved
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxFrame_FlushMovedList(orxFRAME_MOVED_FUNCTION _pfnCallback, void *_pContext);
+
 
 /** Sets frame position
  * @param[in]   _pstFrame       Concerned frame
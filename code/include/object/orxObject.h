@@ -877,6 +877,11 @@ extern orxDLLAPI const orxSTRING orxFASTCALL orxObject_GetTextString(const orxOB
  * @return      Bounding box / orxNULL
  */
 extern orxDLLAPI orxOBOX *orxFASTCALL       orxObject_GetBoundingBox(const orxOBJECT *_pstObject, orxOBOX *_pstBoundingBox);
+
+/** Notifies that a graphic's size or pivot changed, so as to refresh the bounding box of the objects using it, in group spatial indices.
+ * @param[in]   _pstGraphic     Concerned graphic
+ */
+extern orxDLLAPI void orxFASTCALL           orxObject_NotifyGraphicChange(const orxGRAPHIC *_pstGraphic);
 /** @} */
 
 
@@ -291,6 +291,19 @@ extern orxDLLAPI orxSTRUCTURE *orxFASTCALL              orxStructure_Create(orxS
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                  orxStructure_Delete(void *_pStructure);
 
+/** Renews a structure's GUID, all the GUIDs previously retrieved for this structure will become invalid
+ * @param[in]   _pStructure    Concerned structure
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                  orxStructure_RenewGUID(void *_pStructure);
+
+/** Hides a structure from its storage or shows it back: hidden structures are skipped by orxStructure_GetFirst/GetLast/GetNext/GetPrevious and aren't counted by orxStructure_GetCount, only works with link list storage
+ * @param[in]   _pStructure    Concerned structure
+ * @param[in]   _bHide         Hide / show it back
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                  orxStructure_Hide(void *_pStructure, orxBOOL _bHide);
+
 
 /** Gets structure storage type
  * @param[in]   _eStructureID   Concerned structure ID
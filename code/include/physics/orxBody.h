@@ -98,6 +98,12 @@ extern orxDLLAPI orxBODY *orxFASTCALL         orxBody_CreateFromConfig(const orx
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxBody_Delete(orxBODY *_pstBody);
 
+/** Resets a body created from config to its config state (dynamic, fixed rotation, allow moving, damping, custom gravity & parts), speeds are cleared. Parts are kept and get their properties restored, unless the config part list changed
+ * @param[in]   _pstBody        Concerned body
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxBody_ResetFromConfig(orxBODY *_pstBody);
+
 /** Gets body config name
  * @param[in]   _pstBody        Concerned body
  * @return      orxSTRING / orxSTRING_EMPTY
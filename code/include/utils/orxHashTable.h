@@ -53,6 +53,7 @@ typedef struct __orxHASHTABLE_t orxHASHTABLE;
 /* Define flags */
 #define orxHASHTABLE_KU32_FLAG_NONE             0x00000000  /**< No flags (default behaviour) */
 #define orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE   0x00000001  /**< The Hash table will not be expandable */
+#define orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING  0x00000002  /**< The Hash table will use open addressing (flat storage, faster lookups) instead of chaining */
 
 
 /** @name HashTable creation/destruction.
@@ -97,6 +98,7 @@ extern orxDLLAPI void *orxFASTCALL              orxHashTable_Get(const orxHASHTA
  * @param[in] _pstHashTable     Concerned hashtable
  * @param[in] _u64Key           Key to find
  * @return The bucket associated to the given key if success, orxNULL otherwise
+ * @note With orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, the bucket is only valid until the next insertion in the hash table
  */
 extern orxDLLAPI void **orxFASTCALL             orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u64Key);
 
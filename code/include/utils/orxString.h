@@ -1578,7 +1578,7 @@ extern orxDLLAPI orxSTRINGID orxFASTCALL                  orxString_NHash(const
  */
 extern orxDLLAPI orxSTRINGID orxFASTCALL                  orxString_Hash(const orxSTRING _zString);
 
-/** Gets a string's ID (and stores the string internally to prevent duplication)
+/** Gets a string's ID (and stores the string internally to prevent duplication), can be called from any thread
  * @param[in]   _zString        Concerned string
  * @return      String's ID
  */
@@ -1590,7 +1590,7 @@ extern orxDLLAPI orxSTRINGID orxFASTCALL                  orxString_GetID(const
  */
 extern orxDLLAPI const orxSTRING orxFASTCALL              orxString_GetFromID(orxSTRINGID _stID);
 
-/** Stores a string internally: equivalent to an optimized call to orxString_GetFromID(orxString_GetID(_zString))
+/** Stores a string internally: equivalent to an optimized call to orxString_GetFromID(orxString_GetID(_zString)), can be called from any thread
  * @param[in]   _zString        Concerned string
  * @return      Stored orxSTRING
  */
@@ -470,6 +470,7 @@ typedef struct __orxDISPLAY_LOAD_INFO_t
   orxU8      *pu8ImageBuffer;
   orxU8      *pu8ImageSource;
   orxS64      s64Size;
+  orxHANDLE   hMappedResource;
   orxBITMAP  *pstBitmap;
   orxU32      u32DataSize;
   GLuint      uiWidth;
@@ -2135,6 +2136,14 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pCo
     }
   }
 
+  /* Was mapped? */
+  if(pstInfo->hMappedResource != orxNULL)
+  {
+    /* Closes resource */
+    orxResource_Close(pstInfo->hMappedResource);
+    pstInfo->hMappedResource = orxNULL;
+  }
+
   /* Frees load info */
   orxMemory_Free(pstInfo);
 
@@ -2142,6 +2151,25 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pCo
   return eResult;
 }
 
+static orxINLINE void orxDisplay_GLFW_ReleaseImageSource(orxDISPLAY_LOAD_INFO *_pstInfo)
+{
+  /* Mapped? */
+  if(_pstInfo->hMappedResource != orxNULL)
+  {
+    /* Unmaps it, resource will get closed from main thread */
+    orxResource_Unmap(_pstInfo->hMappedResource);
+  }
+  else
+  {
+    /* Frees it */
+    orxMemory_Free(_pstInfo->pu8ImageSource);
+  }
+  _pstInfo->pu8ImageSource = orxNULL;
+
+  /* Done! */
+  return;
+}
+
 static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
 {
   orxDISPLAY_LOAD_INFO *pstInfo;
@@ -2269,8 +2297,8 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
       pstInfo->uiRealWidth  = pstInfo->uiWidth;
       pstInfo->uiRealHeight = pstInfo->uiHeight;
 
-      /* Frees original source from resource */
-      orxMemory_Free(pstInfo->pu8ImageSource);
+      /* Releases original source from resource */
+      orxDisplay_GLFW_ReleaseImageSource(pstInfo);
 
       /* Stores uncompressed data as new source */
       pstInfo->pu8ImageSource = pu8ImageData;
@@ -2283,9 +2311,8 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
       pstInfo->uiRealWidth  =
       pstInfo->uiRealHeight = 1;
 
-      /* Frees original source from resource */
-      orxMemory_Free(pstInfo->pu8ImageSource);
-      pstInfo->pu8ImageSource = orxNULL;
+      /* Releases original source from resource */
+      orxDisplay_GLFW_ReleaseImageSource(pstInfo);
     }
 
     /* Updates result */
@@ -2293,9 +2320,15 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
   }
   else
   {
-    /* Frees original source from resource */
-    orxMemory_Free(pstInfo->pu8ImageSource);
-    pstInfo->pu8ImageSource = orxNULL;
+    /* Releases original source from resource */
+    orxDisplay_GLFW_ReleaseImageSource(pstInfo);
+
+    /* Was mapped? */
+    if(pstInfo->hMappedResource != orxNULL)
+    {
+      /* Closes resource */
+      orxResource_Close(pstInfo->hMappedResource);
+    }
 
     /* Frees load info */
     orxMemory_Free(pstInfo);
@@ -2628,7 +2661,7 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_ProcessFont(void *_pContext)
   return eResult;
 }
 
-static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer, void *_pContext)
+static void orxFASTCALL orxDisplay_GLFW_ProcessImageSource(orxBITMAP *_pstBitmap, orxU8 *_pu8Source, orxS64 _s64Size, orxHANDLE _hMappedResource)
 {
   orxDISPLAY_LOAD_INFO *pstInfo;
 
@@ -2640,9 +2673,10 @@ static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResourc
 
   /* Inits it */
   orxMemory_Zero(pstInfo, sizeof(orxDISPLAY_LOAD_INFO));
-  pstInfo->pu8ImageSource = (orxU8 *)_pBuffer;
-  pstInfo->s64Size        = _s64Size;
-  pstInfo->pstBitmap      = (orxBITMAP *)_pContext;
+  pstInfo->pu8ImageSource   = _pu8Source;
+  pstInfo->s64Size          = _s64Size;
+  pstInfo->hMappedResource  = _hMappedResource;
+  pstInfo->pstBitmap        = _pstBitmap;
 
   /* Asynchronous? */
   if(orxFLAG_TEST(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
@@ -2650,6 +2684,13 @@ static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResourc
     /* Runs asynchronous task */
     if(orxThread_RunTask(&orxDisplay_GLFW_DecompressBitmap, &orxDisplay_GLFW_DecompressBitmapCallback, orxNULL, (void *)pstInfo) == orxSTATUS_FAILURE)
     {
+      /* Was mapped? */
+      if(_hMappedResource != orxNULL)
+      {
+        /* Closes resource */
+        orxResource_Close(_hMappedResource);
+      }
+
       /* Frees load info */
       orxMemory_Free(pstInfo);
     }
@@ -2664,6 +2705,15 @@ static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResourc
     }
   }
 
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer, void *_pContext)
+{
+  /* Processes read data */
+  orxDisplay_GLFW_ProcessImageSource((orxBITMAP *)_pContext, (orxU8 *)_pBuffer, _s64Size, orxNULL);
+
   /* Closes resource */
   orxResource_Close(_hResource);
 }
@@ -2767,8 +2817,9 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
   /* Success? */
   if(hResource != orxHANDLE_UNDEFINED)
   {
-    orxS64  s64Size;
-    orxU8  *pu8Buffer;
+    orxS64        s64Size;
+    const orxU8  *pu8Map;
+    orxU8        *pu8Buffer;
 
     /* Gets its size */
     s64Size = orxResource_GetSize(hResource);
@@ -2776,11 +2827,14 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
     /* Checks */
     orxASSERT((s64Size > 0) && (s64Size < 0xFFFFFFFF));
 
-    /* Allocates buffer */
-    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_TEMP);
+    /* Maps it */
+    pu8Map = (const orxU8 *)orxResource_Map(hResource, orxNULL);
+
+    /* Allocates buffer if it couldn't be mapped */
+    pu8Buffer = (pu8Map == orxNULL) ? (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_TEMP) : orxNULL;
 
     /* Success? */
-    if(pu8Buffer != orxNULL)
+    if((pu8Map != orxNULL) || (pu8Buffer != orxNULL))
     {
       /* Asynchronous? */
       if(sstDisplay.pstTempBitmap != orxNULL)
@@ -2811,8 +2865,20 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
           /* Updates asynchronous loading flag */
           orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
 
-          /* Loads data from resource */
-          s64Size = orxResource_Read(hResource, s64Size, pu8Buffer, orxDisplay_GLFW_ReadResourceCallback, (void *)_pstBitmap);
+          /* Mapped? */
+          if(pu8Map != orxNULL)
+          {
+            /* Processes mapped data, resource will get closed once done */
+            orxDisplay_GLFW_ProcessImageSource(_pstBitmap, (orxU8 *)pu8Map, s64Size, hResource);
+
+            /* Updates status */
+            s64Size = -1;
+          }
+          else
+          {
+            /* Loads data from resource */
+            s64Size = orxResource_Read(hResource, s64Size, pu8Buffer, orxDisplay_GLFW_ReadResourceCallback, (void *)_pstBitmap);
+          }
 
           /* Successful asynchronous call? */
           if(s64Size < 0)
@@ -2856,6 +2922,15 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
           orxResource_Close(hResource);
         }
       }
+      /* Mapped? */
+      else if(pu8Map != orxNULL)
+      {
+        /* Processes mapped data, resource will get closed once done */
+        orxDisplay_GLFW_ProcessImageSource(_pstBitmap, (orxU8 *)pu8Map, s64Size, hResource);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
       else
       {
         /* Loads data from resource */
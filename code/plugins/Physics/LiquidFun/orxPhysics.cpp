@@ -334,8 +334,10 @@ static void orxFASTCALL orxPhysics_LiquidFun_SendContactEvent(b2Contact *_poCont
   pstSourceBodyPart       = (orxBODY_PART *)_poContact->GetFixtureA()->GetUserData();
   pstDestinationBodyPart  = (orxBODY_PART *)_poContact->GetFixtureB()->GetUserData();
 
-  /* Valid? */
-  if((pstSourceBodyPart != orxNULL) && (pstDestinationBodyPart != orxNULL))
+  /* Valid and has listeners? */
+  if((pstSourceBodyPart != orxNULL)
+  && (pstDestinationBodyPart != orxNULL)
+  && (orxEvent_HasHandler(orxEVENT_TYPE_PHYSICS, _eEventID) != orxFALSE))
   {
     orxPHYSICS_EVENT_STORAGE *pstEventStorage;
 
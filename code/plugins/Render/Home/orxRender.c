@@ -61,7 +61,7 @@
 
 /** Defines
  */
-#define orxRENDER_KU32_ORDER_BANK_SIZE              1024
+#define orxRENDER_KU32_NODE_LIST_SIZE               1024
 #define orxRENDER_KST_DEFAULT_COLOR                 orx2RGBA(255, 0, 0, 255)
 #define orxRENDER_KZ_FPS_FORMAT                     "FPS: %u"
 #define orxRENDER_KF_CONSOLE_BLINK_DELAY            orx2F(0.5f)
@@ -111,6 +111,22 @@
 
 #define orxRENDER_KZ_PORTRAIT                       "portrait"
 
+#define orxRENDER_KU32_SORT_RADIX_BITS              8
+#define orxRENDER_KU32_SORT_RADIX_SIZE              (1 << orxRENDER_KU32_SORT_RADIX_BITS)
+#define orxRENDER_KU32_SORT_RADIX_MASK              (orxRENDER_KU32_SORT_RADIX_SIZE - 1)
+#define orxRENDER_KU32_SORT_PASS_NUMBER             (64 / orxRENDER_KU32_SORT_RADIX_BITS)
+
+#define orxRENDER_KU32_SORT_SHIFT_DEPTH             32
+#define orxRENDER_KU32_SORT_SHIFT_TEXTURE           16
+#define orxRENDER_KU32_SORT_SHIFT_SHADER            6
+#define orxRENDER_KU32_SORT_SHIFT_BLEND_MODE        2
+#define orxRENDER_KU32_SORT_SHIFT_SMOOTHING         0
+
+#define orxRENDER_KU64_SORT_MASK_TEXTURE            0x000000000000FFFFULL
+#define orxRENDER_KU64_SORT_MASK_SHADER             0x00000000000003FFULL
+#define orxRENDER_KU64_SORT_MASK_BLEND_MODE         0x000000000000000FULL
+#define orxRENDER_KU64_SORT_MASK_SMOOTHING          0x0000000000000003ULL
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -118,34 +134,43 @@
 
 typedef struct __orxRENDER_RENDER_NODE_t
 {
-  orxLINKLIST_NODE        stNode;                   /**< Linklist node : 12 */
-  orxTEXTURE             *pstTexture;               /**< Texture pointer : 16 */
-  const orxSHADER        *pstShader;                /**< Shader pointer : 20 */
-  orxOBJECT              *pstObject;                /**< Object pointer : 24 */
-  orxGRAPHIC             *pstGraphic;               /**< Graphic pointer : 28 */
-  orxFLOAT                fZ;                       /**< Z coordinate : 32 */
-  orxDISPLAY_BLEND_MODE   eBlendMode;               /**< Blend mode : 36 */
-  orxDISPLAY_SMOOTHING    eSmoothing;               /**< Smoothing : 40 */
-  orxFLOAT                fDepthCoef;               /**< Depth coef : 44 */
+  orxTEXTURE             *pstTexture;               /**< Texture pointer : 4 */
+  const orxSHADER        *pstShader;                /**< Shader pointer : 8 */
+  orxOBJECT              *pstObject;                /**< Object pointer : 12 */
+  orxGRAPHIC             *pstGraphic;               /**< Graphic pointer : 16 */
+  orxFLOAT                fZ;                       /**< Z coordinate : 20 */
+  orxDISPLAY_BLEND_MODE   eBlendMode;               /**< Blend mode : 24 */
+  orxDISPLAY_SMOOTHING    eSmoothing;               /**< Smoothing : 28 */
+  orxFLOAT                fDepthCoef;               /**< Depth coef : 32 */
 
 } orxRENDER_NODE;
 
+/** Render sort entry
+ */
+typedef struct __orxRENDER_SORT_ENTRY_t
+{
+  orxU64                  u64Key;                   /**< Sort key : 8 */
+  orxU32                  u32Index;                 /**< Render node index : 12 */
+
+} orxRENDER_SORT_ENTRY;
+
 /** Static structure
  */
 typedef struct __orxRENDER_STATIC_t
 {
-  orxU32        u32Flags;                           /**< Control flags */
-  orxCLOCK     *pstClock;                           /**< Rendering clock pointer */
-  orxFRAME     *pstFrame;                           /**< Conversion frame */
-  orxBANK      *pstRenderBank;                      /**< Rendering bank */
-  orxLINKLIST   stRenderList;                       /**< Rendering list */
-  orxFLOAT      fDefaultConsoleOffset;              /**< Default console offset */
-  orxFLOAT      fConsoleOffset;                     /**< Console offset */
-  orxFLOAT      fConsoleFontScale;                  /**< Console font scale */
-  orxU32        u32SelectedFrame;                   /**< Selected frame */
-  orxU32        u32SelectedThread;                  /**< Selected thread */
-  orxU32        u32SelectedMarkerDepth;             /**< Selected marker depth */
-  orxU32        u32MaxMarkerDepth;                  /**< Maximum marker depth */
+  orxU32                 u32Flags;                  /**< Control flags */
+  orxCLOCK              *pstClock;                  /**< Rendering clock pointer */
+  orxFRAME              *pstFrame;                  /**< Conversion frame */
+  orxRENDER_NODE        *astNodeList;               /**< Render node list */
+  orxU32                 u32NodeCount;              /**< Render node count */
+  orxU32                 u32NodeListSize;           /**< Render node list size */
+  orxFLOAT               fDefaultConsoleOffset;     /**< Default console offset */
+  orxFLOAT               fConsoleOffset;            /**< Console offset */
+  orxFLOAT               fConsoleFontScale;         /**< Console font scale */
+  orxU32                 u32SelectedFrame;          /**< Selected frame */
+  orxU32                 u32SelectedThread;         /**< Selected thread */
+  orxU32                 u32SelectedMarkerDepth;    /**< Selected marker depth */
+  orxU32                 u32MaxMarkerDepth;         /**< Maximum marker depth */
 
 } orxRENDER_STATIC;
 
@@ -1157,12 +1182,16 @@ static orxINLINE void orxRender_Home_RenderProfiler()
         /* Gets its usage info */
         orxMemory_GetUsage((orxMEMORY_TYPE)i, &u64Count, &u64PeakCount, &u64Size, &u64PeakSize, &u64OperationCount);
 
-        /* Updates totals */
-        u64TotalCount            += u64Count;
-        u64TotalPeakCount        += u64PeakCount;
-        u64TotalSize             += u64Size;
-        u64TotalPeakSize         += u64PeakSize;
-        u64TotalOperationCount   += u64OperationCount;
+        /* Not frame memory? (already accounted for as temp memory) */
+        if(i != orxMEMORY_TYPE_FRAME)
+        {
+          /* Updates totals */
+          u64TotalCount          += u64Count;
+          u64TotalPeakCount      += u64PeakCount;
+          u64TotalSize           += u64Size;
+          u64TotalPeakSize       += u64PeakSize;
+          u64TotalOperationCount += u64OperationCount;
+        }
       }
 
       /* Finds best unit */
@@ -1205,6 +1234,29 @@ static orxINLINE void orxRender_Home_RenderProfiler()
       orxString_NPrint(acLabel, sizeof(acLabel), "%-12s[%llu|%llux] [%.2f|%.2f%s] [%llu#]", zType, u64Count, u64PeakCount, fSize, fPeakSize, sazUnitList[u32UnitIndex], u64OperationCount);
       orxDisplay_TransformText(acLabel, pstFontBitmap, orxFont_GetMap(pstFont), &stTransform, orxColor_ToRGBA(&stColor), orxDISPLAY_SMOOTHING_NONE, orxDISPLAY_BLEND_MODE_ALPHA);
     }
+
+    /* Uses config resolve cache? */
+    if(orxConfig_IsResolveCacheEnabled() != orxFALSE)
+    {
+      orxU32 u32HitCount, u32MissCount;
+
+      /* Updates position */
+      if(bLandscape != orxFALSE)
+      {
+        stTransform.fDstY += 20.0f;
+      }
+      else
+      {
+        stTransform.fDstX += 20.0f;
+      }
+
+      /* Gets its usage */
+      orxConfig_GetResolveCacheUsage(&u32HitCount, &u32MissCount);
+
+      /* Draws it */
+      orxString_NPrint(acLabel, sizeof(acLabel), "%-12s[%u|%u]", "CFG_CACHE", u32HitCount, u32MissCount);
+      orxDisplay_TransformText(acLabel, pstFontBitmap, orxFont_GetMap(pstFont), &stTransform, orx2RGBA(0xFF, 0xFF, 0xFF, 0xCC), orxDISPLAY_SMOOTHING_NONE, orxDISPLAY_BLEND_MODE_ALPHA);
+    }
   }
 
 #endif /* __orxPROFILER__ */
@@ -1461,6 +1513,176 @@ static orxINLINE void orxRender_Home_RenderConsole()
   return;
 }
 
+/** Gets a render node sort key
+ * @param[in]   _pstRenderNode    Render node
+ * @return      Sort key (ascending key order <=> ascending depth/texture/shader/blend mode/smoothing order)
+ */
+static orxINLINE orxU64 orxRender_Home_GetSortKey(const orxRENDER_NODE *_pstRenderNode)
+{
+  union
+  {
+    orxFLOAT  fValue;
+    orxU32    u32Value;
+  }       uDepth;
+  orxU64  u64Result;
+  orxU32  u32Depth, u32Texture, u32Shader;
+
+  /* Gets depth bits (positive & negative zeros are considered equal) */
+  uDepth.fValue = (_pstRenderNode->fZ != orxFLOAT_0) ? _pstRenderNode->fZ : orxFLOAT_0;
+  u32Depth      = uDepth.u32Value;
+
+  /* Makes them sortable as unsigned integer (lossless) */
+  u32Depth = (u32Depth & 0x80000000) ? ~u32Depth : (u32Depth | 0x80000000);
+
+  /* Gets texture & shader IDs */
+  u32Texture  = (orxU32)((orxStructure_GetGUID(_pstRenderNode->pstTexture) & orxSTRUCTURE_GUID_MASK_ITEM_ID) >> orxSTRUCTURE_GUID_SHIFT_ITEM_ID);
+  u32Shader   = (_pstRenderNode->pstShader != orxNULL) ? (orxU32)((orxStructure_GetGUID(_pstRenderNode->pstShader) & orxSTRUCTURE_GUID_MASK_ITEM_ID) >> orxSTRUCTURE_GUID_SHIFT_ITEM_ID) + 1 : 0;
+
+  /* Packs key */
+  u64Result = ((orxU64)u32Depth << orxRENDER_KU32_SORT_SHIFT_DEPTH)
+            | (((orxU64)u32Texture & orxRENDER_KU64_SORT_MASK_TEXTURE) << orxRENDER_KU32_SORT_SHIFT_TEXTURE)
+            | (((orxU64)u32Shader & orxRENDER_KU64_SORT_MASK_SHADER) << orxRENDER_KU32_SORT_SHIFT_SHADER)
+            | (((orxU64)_pstRenderNode->eBlendMode & orxRENDER_KU64_SORT_MASK_BLEND_MODE) << orxRENDER_KU32_SORT_SHIFT_BLEND_MODE)
+            | (((orxU64)_pstRenderNode->eSmoothing & orxRENDER_KU64_SORT_MASK_SMOOTHING) << orxRENDER_KU32_SORT_SHIFT_SMOOTHING);
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Adds a render node
+ * @return      orxRENDER_NODE / orxNULL
+ */
+static orxINLINE orxRENDER_NODE *orxRender_Home_AddNode()
+{
+  orxRENDER_NODE *pstResult = orxNULL;
+
+  /* List full? */
+  if(sstRender.u32NodeCount == sstRender.u32NodeListSize)
+  {
+    orxRENDER_NODE *astNodeList;
+    orxU32          u32NewSize;
+
+    /* Gets new size */
+    u32NewSize = sstRender.u32NodeListSize << 1;
+
+    /* Grows list */
+    if((astNodeList = (orxRENDER_NODE *)orxMemory_Reallocate(sstRender.astNodeList, u32NewSize * sizeof(orxRENDER_NODE), orxMEMORY_TYPE_MAIN)) != orxNULL)
+    {
+      /* Stores it */
+      sstRender.astNodeList     = astNodeList;
+      sstRender.u32NodeListSize = u32NewSize;
+    }
+  }
+
+  /* Has room? */
+  if(sstRender.u32NodeCount < sstRender.u32NodeListSize)
+  {
+    /* Gets node */
+    pstResult = &(sstRender.astNodeList[sstRender.u32NodeCount++]);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Couldn't grow render node list beyond %u nodes.", sstRender.u32NodeListSize);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Sorts render nodes (stable LSD radix sort on their sort keys), using frame memory for its buffers
+ * @return      Sorted entry list, in ascending key order / orxNULL if buffers couldn't be allocated
+ */
+static orxINLINE const orxRENDER_SORT_ENTRY *orxRender_Home_SortNodes()
+{
+  orxRENDER_SORT_ENTRY *astSrc, *astDst, *astTemp;
+  orxU32                au32Histogram[orxRENDER_KU32_SORT_PASS_NUMBER][orxRENDER_KU32_SORT_RADIX_SIZE];
+  orxU32                u32Count, i, j;
+
+  /* Checks */
+  orxASSERT(sstRender.u32NodeCount > 0);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxRender_SortNodes");
+
+  /* Gets buffers */
+  u32Count  = sstRender.u32NodeCount;
+  astSrc    = (orxRENDER_SORT_ENTRY *)orxMemory_AllocateFrame(2 * u32Count * sizeof(orxRENDER_SORT_ENTRY));
+
+  /* Success? */
+  if(astSrc != orxNULL)
+  {
+    /* Gets destination buffer */
+    astDst = astSrc + u32Count;
+
+    /* Clears histograms */
+    orxMemory_Zero(au32Histogram, sizeof(au32Histogram));
+
+    /* For all nodes */
+    for(i = 0; i < u32Count; i++)
+    {
+      orxU64 u64Key;
+
+      /* Gets its key */
+      u64Key = orxRender_Home_GetSortKey(&(sstRender.astNodeList[i]));
+
+      /* Stores entry */
+      astSrc[i].u64Key    = u64Key;
+      astSrc[i].u32Index  = i;
+
+      /* Updates all histograms */
+      for(j = 0; j < orxRENDER_KU32_SORT_PASS_NUMBER; j++)
+      {
+        au32Histogram[j][(u64Key >> (j * orxRENDER_KU32_SORT_RADIX_BITS)) & orxRENDER_KU32_SORT_RADIX_MASK]++;
+      }
+    }
+
+    /* For all passes */
+    for(j = 0; j < orxRENDER_KU32_SORT_PASS_NUMBER; j++)
+    {
+      orxU32 *au32Offset, u32Shift, u32Sum;
+
+      /* Gets its histogram & shift */
+      au32Offset  = au32Histogram[j];
+      u32Shift    = j * orxRENDER_KU32_SORT_RADIX_BITS;
+
+      /* All entries share the same digit? */
+      if(au32Offset[(astSrc[0].u64Key >> u32Shift) & orxRENDER_KU32_SORT_RADIX_MASK] == u32Count)
+      {
+        /* Skips pass */
+        continue;
+      }
+
+      /* Computes offsets */
+      for(i = 0, u32Sum = 0; i < orxRENDER_KU32_SORT_RADIX_SIZE; i++)
+      {
+        orxU32 u32Value;
+
+        u32Value      = au32Offset[i];
+        au32Offset[i] = u32Sum;
+        u32Sum       += u32Value;
+      }
+
+      /* Scatters entries (stable) */
+      for(i = 0; i < u32Count; i++)
+      {
+        astDst[au32Offset[(astSrc[i].u64Key >> u32Shift) & orxRENDER_KU32_SORT_RADIX_MASK]++] = astSrc[i];
+      }
+
+      /* Swaps buffers */
+      astTemp = astSrc;
+      astSrc  = astDst;
+      astDst  = astTemp;
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return astSrc;
+}
+
 /** Renders a viewport
  * @param[in]   _pstRenderNode    Render node
  * @param[in]   _pstTransform     Rendering transform
@@ -1839,12 +2061,13 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
             if((fCameraWidth > orxFLOAT_0)
             && (fCameraHeight > orxFLOAT_0))
             {
-              orxU32          u32Number;
-              orxOBJECT      *pstObject;
-              orxFRAME       *pstCameraFrame;
-              orxRENDER_NODE *pstRenderNode;
-              orxVECTOR       vCameraScale, vCameraCenter, vCameraPosition;
-              orxFLOAT        fCameraDepth, fRenderScaleX, fRenderScaleY, fRecZoom, fRenderRotation, fCameraBoundingRadius;
+              orxU32                      u32Number, j;
+              orxOBJECT                  *pstObject;
+              orxFRAME                   *pstCameraFrame;
+              orxRENDER_NODE             *pstRenderNode;
+              const orxRENDER_SORT_ENTRY *pstSortList;
+              orxVECTOR                   vCameraScale, vCameraCenter, vCameraPosition;
+              orxFLOAT                    fCameraDepth, fRenderScaleX, fRenderScaleY, fRecZoom, fRenderRotation, fCameraBoundingRadius;
 
               /* Gets camera frame */
               pstCameraFrame = orxCamera_GetFrame(pstCamera);
@@ -2063,58 +2286,20 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                           }
 
                           /* Creates a render node */
-                          pstRenderNode = (orxRENDER_NODE *)orxBank_Allocate(sstRender.pstRenderBank);
-
-                          /* Cleans its internal node */
-                          orxMemory_Zero(pstRenderNode, sizeof(orxLINKLIST_NODE));
-
-                          /* Updates render node */
-                          pstRenderNode->pstObject    = pstObject;
-                          pstRenderNode->pstTexture   = pstTexture;
-                          pstRenderNode->pstShader    = pstShader;
-                          pstRenderNode->pstGraphic   = pstGraphic;
-                          pstRenderNode->eSmoothing   = eSmoothing;
-                          pstRenderNode->eBlendMode   = eBlendMode;
-                          pstRenderNode->fZ           = vObjectPos.fZ;
-                          pstRenderNode->fDepthCoef   = fDepthCoef;
-
-                          /* No sorting or empty list? */
-                          if((bSorting == orxFALSE)
-                          || (orxLinkList_GetCount(&(sstRender.stRenderList)) == 0))
-                          {
-                            /* Adds node at beginning */
-                            orxLinkList_AddStart(&(sstRender.stRenderList), (orxLINKLIST_NODE *)pstRenderNode);
-                          }
-                          else
+                          pstRenderNode = orxRender_Home_AddNode();
+
+                          /* Valid? */
+                          if(pstRenderNode != orxNULL)
                           {
-                            orxRENDER_NODE *pstNode;
-
-                            /* Finds correct node position */
-                            for(pstNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                                (pstNode != orxNULL)
-                             && ((vObjectPos.fZ < pstNode->fZ)
-                              || ((vObjectPos.fZ == pstNode->fZ)
-                               && ((pstTexture < pstNode->pstTexture)
-                                || ((pstTexture == pstNode->pstTexture)
-                                 && ((pstShader < pstNode->pstShader)
-                                  || ((pstShader == pstNode->pstShader)
-                                   && ((eBlendMode < pstNode->eBlendMode)
-                                    || ((eBlendMode == pstNode->eBlendMode)
-                                     && (eSmoothing < pstNode->eSmoothing)))))))));
-                                pstNode = (orxRENDER_NODE *)orxLinkList_GetNext(&(pstNode->stNode)))
-                              ;
-
-                            /* End of list reached? */
-                            if(pstNode == orxNULL)
-                            {
-                              /* Adds it at end */
-                              orxLinkList_AddEnd(&(sstRender.stRenderList), &(pstRenderNode->stNode));
-                            }
-                            else
-                            {
-                              /* Adds it before found node */
-                              orxLinkList_AddBefore(&(pstNode->stNode), &(pstRenderNode->stNode));
-                            }
+                            /* Updates render node */
+                            pstRenderNode->pstObject    = pstObject;
+                            pstRenderNode->pstTexture   = pstTexture;
+                            pstRenderNode->pstShader    = pstShader;
+                            pstRenderNode->pstGraphic   = pstGraphic;
+                            pstRenderNode->eSmoothing   = eSmoothing;
+                            pstRenderNode->eBlendMode   = eBlendMode;
+                            pstRenderNode->fZ           = vObjectPos.fZ;
+                            pstRenderNode->fDepthCoef   = fDepthCoef;
                           }
                         }
                       }
@@ -2122,10 +2307,21 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                   }
                 }
 
-                /* For all render nodes */
-                for(pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                    pstRenderNode != orxNULL;
-                    pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetNext((orxLINKLIST_NODE *)pstRenderNode))
+                /* Sorting and has nodes? */
+                if((bSorting != orxFALSE)
+                && (sstRender.u32NodeCount != 0))
+                {
+                  /* Sorts them */
+                  pstSortList = orxRender_Home_SortNodes();
+                }
+                else
+                {
+                  /* Keeps insertion order */
+                  pstSortList = orxNULL;
+                }
+
+                /* For all render nodes, from back to front (reverse key order, most recent first among equals) */
+                for(j = sstRender.u32NodeCount; j > 0; j--)
                 {
                   orxFRAME             *pstFrame;
                   orxVECTOR             vObjectPos, vRenderPos, vObjectScale, vPivot;
@@ -2133,6 +2329,9 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                   orxBOOL               bFlipX, bFlipY;
                   orxDISPLAY_TRANSFORM  stTransform;
 
+                  /* Gets render node */
+                  pstRenderNode = &(sstRender.astNodeList[(pstSortList != orxNULL) ? pstSortList[j - 1].u32Index : j - 1]);
+
                   /* Gets object */
                   pstObject = pstRenderNode->pstObject;
 
@@ -2255,11 +2454,8 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                   }
                 }
 
-                /* Cleans rendering bank */
-                orxBank_Clear(sstRender.pstRenderBank);
-
-                /* Cleans rendering list */
-                orxMemory_Zero(&(sstRender.stRenderList), sizeof(orxLINKLIST));
+                /* Cleans render nodes */
+                sstRender.u32NodeCount = 0;
               }
             }
             else
@@ -3006,11 +3202,12 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     /* Cleans static controller */
     orxMemory_Zero(&sstRender, sizeof(orxRENDER_STATIC));
 
-    /* Creates rendering bank */
-    sstRender.pstRenderBank = orxBank_Create(orxRENDER_KU32_ORDER_BANK_SIZE, sizeof(orxRENDER_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    /* Creates render node list */
+    sstRender.astNodeList     = (orxRENDER_NODE *)orxMemory_Allocate(orxRENDER_KU32_NODE_LIST_SIZE * sizeof(orxRENDER_NODE), orxMEMORY_TYPE_MAIN);
+    sstRender.u32NodeListSize = orxRENDER_KU32_NODE_LIST_SIZE;
 
     /* Valid? */
-    if(sstRender.pstRenderBank != orxNULL)
+    if(sstRender.astNodeList != orxNULL)
     {
       /* Gets core clock */
       sstRender.pstClock = orxClock_Get(orxCLOCK_KZ_CORE);
@@ -3092,14 +3289,14 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
             /* Deletes frame */
             orxFrame_Delete(sstRender.pstFrame);
 
-            /* Deletes bank */
-            orxBank_Delete(sstRender.pstRenderBank);
+            /* Deletes render node list */
+            orxMemory_Free(sstRender.astNodeList);
           }
         }
         else
         {
-          /* Deletes bank */
-          orxBank_Delete(sstRender.pstRenderBank);
+          /* Deletes render node list */
+          orxMemory_Free(sstRender.astNodeList);
 
           /* Updates result */
           eResult = orxSTATUS_FAILURE;
@@ -3107,8 +3304,8 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
       }
       else
       {
-        /* Deletes bank */
-        orxBank_Delete(sstRender.pstRenderBank);
+        /* Deletes render node list */
+        orxMemory_Free(sstRender.astNodeList);
 
         /* Updates result */
         eResult = orxSTATUS_FAILURE;
@@ -3158,8 +3355,8 @@ void orxFASTCALL orxRender_Home_Exit()
     /* Deletes conversion frame */
     orxFrame_Delete(sstRender.pstFrame);
 
-    /* Deletes rendering bank */
-    orxBank_Delete(sstRender.pstRenderBank);
+    /* Deletes render node list */
+    orxMemory_Free(sstRender.astNodeList);
 
     /* Updates flags */
     sstRender.u32Flags &= ~(orxRENDER_KU32_STATIC_FLAG_READY | orxRENDER_KU32_STATIC_FLAG_REGISTERED);
@@ -95,6 +95,8 @@
 
 #define orxCLOCK_KU32_BANK_SIZE                 8           /**< Bank size */
 
+#define orxCLOCK_KU32_TIMER_LIST_SIZE           16          /**< Initial timer heap size */
+
 #define orxCLOCK_KF_DELAY_THRESHOLD             orx2F(0.005f)
 #define orxCLOCK_KF_DELAY                       orx2F(0.001f)
 #define orxCLOCK_KF_DEFAULT_MODIFIER_FIXED      (-orxFLOAT_1)
@@ -119,14 +121,17 @@ typedef struct __orxCLOCK_FUNCTION_STORAGE_t
 
 } orxCLOCK_FUNCTION_STORAGE;
 
+/** Clock timer storage structure
+ */
 typedef struct __orxCLOCK_TIMER_STORAGE_t
 {
-  orxLINKLIST_NODE            stNode;           /**< Linklist node : 12 */
-  orxCLOCK_FUNCTION           pfnCallback;      /**< Timer function pointer : 16 */
-  orxFLOAT                    fDelay;           /**< Timer delay : 20 */
-  void                       *pContext;         /**< Timer function context : 24 */
-  orxS32                      s32Repetition;    /**< Timer repetition : 28 */
-  orxFLOAT                    fTimeStamp;       /**< Next call time stamp : 32 */
+  orxCLOCK_FUNCTION           pfnCallback;      /**< Timer function pointer : 4 */
+  orxFLOAT                    fDelay;           /**< Timer delay : 8 */
+  void                       *pContext;         /**< Timer function context : 12 */
+  orxS32                      s32Repetition;    /**< Timer repetition : 16 */
+  orxFLOAT                    fTimeStamp;       /**< Next call time stamp : 20 */
+  orxU32                      u32Sequence;      /**< Creation sequence, used to order timers sharing the same time stamp : 24 */
+  struct __orxCLOCK_TIMER_STORAGE_t *pstNext;   /**< Next fired timer waiting to be rescheduled : 28 */
 
 } orxCLOCK_TIMER_STORAGE;
 
@@ -139,10 +144,14 @@ struct __orxCLOCK_t
   orxFLOAT          fPartialDT;                 /**< Clock partial DT : 64 */
   orxBANK          *pstFunctionBank;            /**< Function bank : 68 */
   orxLINKLIST       stFunctionList;             /**< Function list : 80 */
-  orxLINKLIST       stTimerList;                /**< Timer list : 92 */
-  const orxSTRING   zReference;                 /**< Reference : 96 */
-  orxU32            u32HistoryIndex;            /**< Average history index : 100 */
-  orxFLOAT         *afHistory;                  /**< Average history : 104 */
+  orxCLOCK_TIMER_STORAGE **apstTimerList;      /**< Timer heap, ordered by time stamp : 84 */
+  orxCLOCK_TIMER_STORAGE *pstCurrentTimer;      /**< Timer currently being called : 88 */
+  orxCLOCK_TIMER_STORAGE *pstFiredTimerList;    /**< Timers fired during the current update, waiting to be rescheduled : 92 */
+  orxU32            u32TimerCount;              /**< Timer count : 96 */
+  orxU32            u32TimerSize;               /**< Timer heap size : 100 */
+  const orxSTRING   zReference;                 /**< Reference : 104 */
+  orxU32            u32HistoryIndex;            /**< Average history index : 108 */
+  orxFLOAT         *afHistory;                  /**< Average history : 112 */
 };
 
 
@@ -156,6 +165,7 @@ typedef struct __orxCLOCK_STATIC_t
   orxDOUBLE         dNextTime;                  /**< Next time */
   orxHASHTABLE     *pstReferenceTable;          /**< Table to avoid clock duplication when creating through config file */
   orxFLOAT          fDisplayTickSize;           /**< Display tick size */
+  orxU32            u32TimerSequence;           /**< Timer creation sequence */
   orxU32            u32Flags;                   /**< Control flags */
 
 } orxCLOCK_STATIC;
@@ -197,6 +207,154 @@ static orxSTATUS orxFASTCALL orxClock_EventHandler(const orxEVENT *_pstEvent)
   return eResult;
 }
 
+/** Is a timer due before another one?
+ * @param[in]   _pstTimer1                    First timer
+ * @param[in]   _pstTimer2                    Second timer
+ * @return      orxTRUE if the first timer is due before the second one, orxFALSE otherwise
+ */
+static orxINLINE orxBOOL orxClock_IsTimerBefore(const orxCLOCK_TIMER_STORAGE *_pstTimer1, const orxCLOCK_TIMER_STORAGE *_pstTimer2)
+{
+  orxBOOL bResult;
+
+  /* Updates result */
+  bResult = ((_pstTimer1->fTimeStamp < _pstTimer2->fTimeStamp)
+          || ((_pstTimer1->fTimeStamp == _pstTimer2->fTimeStamp)
+           && ((orxS32)(_pstTimer1->u32Sequence - _pstTimer2->u32Sequence) < 0))) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Moves a timer down the heap of a clock until it's at its place
+ * @param[in]   _pstClock                     Concerned clock
+ * @param[in]   _u32Index                     Index of the timer
+ */
+static void orxFASTCALL orxClock_SiftTimerDown(orxCLOCK *_pstClock, orxU32 _u32Index)
+{
+  orxCLOCK_TIMER_STORAGE *pstTimerStorage;
+  orxU32                  u32Child;
+
+  /* Gets timer */
+  pstTimerStorage = _pstClock->apstTimerList[_u32Index];
+
+  /* While it has children */
+  for(u32Child = (_u32Index << 1) + 1; u32Child < _pstClock->u32TimerCount; u32Child = (_u32Index << 1) + 1)
+  {
+    /* Right child is due first? */
+    if((u32Child + 1 < _pstClock->u32TimerCount)
+    && (orxClock_IsTimerBefore(_pstClock->apstTimerList[u32Child + 1], _pstClock->apstTimerList[u32Child]) != orxFALSE))
+    {
+      /* Uses it */
+      u32Child++;
+    }
+
+    /* Timer isn't due after child? */
+    if(orxClock_IsTimerBefore(_pstClock->apstTimerList[u32Child], pstTimerStorage) == orxFALSE)
+    {
+      /* Stops */
+      break;
+    }
+
+    /* Moves child up */
+    _pstClock->apstTimerList[_u32Index] = _pstClock->apstTimerList[u32Child];
+    _u32Index = u32Child;
+  }
+
+  /* Stores timer */
+  _pstClock->apstTimerList[_u32Index] = pstTimerStorage;
+
+  /* Done! */
+  return;
+}
+
+/** Adds a timer to the heap of a clock
+ * @param[in]   _pstClock                     Concerned clock
+ * @param[in]   _pstTimerStorage              Timer to add
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxClock_PushTimer(orxCLOCK *_pstClock, orxCLOCK_TIMER_STORAGE *_pstTimerStorage)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Full? */
+  if(_pstClock->u32TimerCount == _pstClock->u32TimerSize)
+  {
+    orxCLOCK_TIMER_STORAGE  **apstTimerList;
+    orxU32                    u32NewSize;
+
+    /* Gets new size */
+    u32NewSize = (_pstClock->u32TimerSize != 0) ? _pstClock->u32TimerSize << 1 : orxCLOCK_KU32_TIMER_LIST_SIZE;
+
+    /* Grows heap */
+    apstTimerList = (orxCLOCK_TIMER_STORAGE **)orxMemory_Reallocate(_pstClock->apstTimerList, u32NewSize * sizeof(orxCLOCK_TIMER_STORAGE *), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(apstTimerList != orxNULL)
+    {
+      /* Stores it */
+      _pstClock->apstTimerList  = apstTimerList;
+      _pstClock->u32TimerSize   = u32NewSize;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CLOCK, "Couldn't grow timer list to %u entries.", u32NewSize);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    orxU32 u32Index;
+
+    /* For all parents due after the new timer */
+    for(u32Index = _pstClock->u32TimerCount++;
+        (u32Index > 0) && (orxClock_IsTimerBefore(_pstTimerStorage, _pstClock->apstTimerList[(u32Index - 1) >> 1]) != orxFALSE);
+        u32Index = (u32Index - 1) >> 1)
+    {
+      /* Moves parent down */
+      _pstClock->apstTimerList[u32Index] = _pstClock->apstTimerList[(u32Index - 1) >> 1];
+    }
+
+    /* Stores timer */
+    _pstClock->apstTimerList[u32Index] = _pstTimerStorage;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Removes the first due timer from the heap of a clock
+ * @param[in]   _pstClock                     Concerned clock
+ * @return      orxCLOCK_TIMER_STORAGE
+ */
+static orxINLINE orxCLOCK_TIMER_STORAGE *orxClock_PopTimer(orxCLOCK *_pstClock)
+{
+  orxCLOCK_TIMER_STORAGE *pstResult;
+
+  /* Checks */
+  orxASSERT(_pstClock->u32TimerCount > 0);
+
+  /* Gets first timer */
+  pstResult = _pstClock->apstTimerList[0];
+
+  /* Has remaining timers? */
+  if(--_pstClock->u32TimerCount > 0)
+  {
+    /* Moves last one on top */
+    _pstClock->apstTimerList[0] = _pstClock->apstTimerList[_pstClock->u32TimerCount];
+
+    /* Restores heap */
+    orxClock_SiftTimerDown(_pstClock, 0);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Deletes all the clocks
  */
 static orxINLINE void orxClock_DeleteAll()
@@ -910,6 +1068,7 @@ orxSTATUS orxFASTCALL orxClock_Update()
     orxDOUBLE dNewTime;
     orxCLOCK *pstClock;
     orxFLOAT  fDT, fDelay;
+    orxBOOL   bCoreTick = orxFALSE;
 
     /* Lock clocks */
     sstClock.u32Flags |= orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK;
@@ -965,8 +1124,8 @@ orxSTATUS orxFASTCALL orxClock_Update()
         if(pstClock->fPartialDT >= pstClock->stClockInfo.fTickSize)
         {
           orxFLOAT                    fClockDT;
-          orxCLOCK_TIMER_STORAGE     *pstTimerStorage, *pstNextTimerStorage;
           orxCLOCK_FUNCTION_STORAGE  *pstFunctionStorage, *pstNextFunctionStorage;
+          orxCLOCK_TIMER_STORAGE     *pstTimerStorage, *pstNextTimerStorage;
 
           /* Gets clock modified DT */
           fClockDT = orxClock_ComputeDT(pstClock, pstClock->fPartialDT);
@@ -977,20 +1136,25 @@ orxSTATUS orxFASTCALL orxClock_Update()
           /* Updates clock time */
           pstClock->stClockInfo.fTime += fClockDT;
 
-          /* For all timers */
-          for(pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(pstClock->stTimerList));
-              pstTimerStorage != orxNULL;
-              pstTimerStorage = pstNextTimerStorage)
+          /* For all due timers */
+          while((pstClock->u32TimerCount > 0)
+             && (pstClock->apstTimerList[0]->fTimeStamp <= pstClock->stClockInfo.fTime))
           {
-            /* Gets the next timer */
-            pstNextTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetNext(&(pstTimerStorage->stNode));
+            /* Removes it from heap */
+            pstTimerStorage = orxClock_PopTimer(pstClock);
 
             /* Should call it? */
-            if((pstTimerStorage->fTimeStamp <= pstClock->stClockInfo.fTime) && (pstTimerStorage->s32Repetition != 0))
+            if(pstTimerStorage->s32Repetition != 0)
             {
+              /* Stores it as current */
+              pstClock->pstCurrentTimer = pstTimerStorage;
+
               /* Calls it */
               pstTimerStorage->pfnCallback(&(pstClock->stClockInfo), pstTimerStorage->pContext);
 
+              /* Clears current */
+              pstClock->pstCurrentTimer = orxNULL;
+
               /* Updates its time stamp */
               pstTimerStorage->fTimeStamp = pstClock->stClockInfo.fTime + pstTimerStorage->fDelay;
 
@@ -1005,9 +1169,29 @@ orxSTATUS orxFASTCALL orxClock_Update()
             /* Should delete it? */
             if(pstTimerStorage->s32Repetition == 0)
             {
-              /* Removes current timer */
-              orxLinkList_Remove(&(pstTimerStorage->stNode));
+              /* Deletes it */
+              orxBank_Free(sstClock.pstTimerBank, pstTimerStorage);
+            }
+            else
+            {
+              /* Defers its rescheduling, as it could be due again right away (null delay or time stamp precision loss) */
+              pstTimerStorage->pstNext    = pstClock->pstFiredTimerList;
+              pstClock->pstFiredTimerList = pstTimerStorage;
+            }
+          }
 
+          /* For all fired timers */
+          for(pstTimerStorage = pstClock->pstFiredTimerList, pstClock->pstFiredTimerList = orxNULL;
+              pstTimerStorage != orxNULL;
+              pstTimerStorage = pstNextTimerStorage)
+          {
+            /* Gets next timer */
+            pstNextTimerStorage = pstTimerStorage->pstNext;
+
+            /* Should delete it or can't reschedule it? */
+            if((pstTimerStorage->s32Repetition == 0)
+            || (orxClock_PushTimer(pstClock, pstTimerStorage) == orxSTATUS_FAILURE))
+            {
               /* Deletes it */
               orxBank_Free(sstClock.pstTimerBank, pstTimerStorage);
             }
@@ -1041,10 +1225,17 @@ orxSTATUS orxFASTCALL orxClock_Update()
 
           /* Updates partial DT */
           pstClock->fPartialDT = orxFLOAT_0;
+
+          /* Core clock? */
+          if(pstClock == sstClock.pstCore)
+          {
+            /* Updates status */
+            bCoreTick = orxTRUE;
+          }
         }
 
         /* Is clock in use? */
-        if((orxLinkList_GetCount(&(pstClock->stTimerList)) > 0)
+        if((pstClock->u32TimerCount > 0)
         || (orxLinkList_GetCount(&(pstClock->stFunctionList)) > 0))
         {
           orxFLOAT fClockDelay;
@@ -1068,6 +1259,13 @@ orxSTATUS orxFASTCALL orxClock_Update()
     /* Unlocks clocks */
     sstClock.u32Flags &= ~orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK;
 
+    /* Core clock ticked? */
+    if(bCoreTick != orxFALSE)
+    {
+      /* Resets frame memory */
+      orxMemory_ResetFrame();
+    }
+
     /* Sets next tick time */
     sstClock.dNextTime = sstClock.dTime + (orxDOUBLE)fDelay;
 
@@ -1331,18 +1529,20 @@ orxSTATUS orxFASTCALL orxClock_Delete(orxCLOCK *_pstClock)
     /* Not locked? */
     if(!orxStructure_TestFlags(_pstClock, orxCLOCK_KU32_FLAG_UPDATE_LOCK))
     {
-      orxCLOCK_TIMER_STORAGE *pstTimerStorage;
+      orxU32 i;
 
       /* For all stored timers */
-      for(pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(_pstClock->stTimerList));
-          pstTimerStorage != orxNULL;
-          pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(_pstClock->stTimerList)))
+      for(i = 0; i < _pstClock->u32TimerCount; i++)
       {
-        /* Removes it */
-        orxLinkList_Remove(&(pstTimerStorage->stNode));
+        /* Deletes it */
+        orxBank_Free(sstClock.pstTimerBank, _pstClock->apstTimerList[i]);
+      }
 
+      /* Has timer heap? */
+      if(_pstClock->apstTimerList != orxNULL)
+      {
         /* Deletes it */
-        orxBank_Free(sstClock.pstTimerBank, pstTimerStorage);
+        orxMemory_Free(_pstClock->apstTimerList);
       }
 
       /* Deletes function bank */
@@ -1866,23 +2066,25 @@ orxSTATUS orxFASTCALL orxClock_AddTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNC
     /* Valid? */
     if(pstTimerStorage != orxNULL)
     {
-      /* Clears it */
-      orxMemory_Zero(pstTimerStorage, sizeof(orxCLOCK_TIMER_STORAGE));
-
-      /* Adds it to clock timer list */
-      orxLinkList_AddEnd(&(_pstClock->stTimerList), &(pstTimerStorage->stNode));
-
       /* Inits it */
       pstTimerStorage->pfnCallback    = _pfnCallback;
       pstTimerStorage->pContext       = _pContext;
       pstTimerStorage->fDelay         = _fDelay;
       pstTimerStorage->s32Repetition  = _s32Repetition;
+      pstTimerStorage->u32Sequence    = sstClock.u32TimerSequence++;
 
       /* Gets it next call time stamp */
       pstTimerStorage->fTimeStamp = _pstClock->stClockInfo.fTime + _fDelay;
 
-      /* Updates result */
-      eResult = orxSTATUS_SUCCESS;
+      /* Adds it to clock timer heap */
+      eResult = orxClock_PushTimer(_pstClock, pstTimerStorage);
+
+      /* Failure? */
+      if(eResult == orxSTATUS_FAILURE)
+      {
+        /* Deletes it */
+        orxBank_Free(sstClock.pstTimerBank, pstTimerStorage);
+      }
     }
   }
 
@@ -1900,16 +2102,15 @@ orxSTATUS orxFASTCALL orxClock_AddTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNC
 orxSTATUS orxFASTCALL orxClock_RemoveTimer(orxCLOCK *_pstClock, const orxCLOCK_FUNCTION _pfnCallback, orxFLOAT _fDelay, void *_pContext)
 {
   orxCLOCK_TIMER_STORAGE *pstTimerStorage;
+  orxU32                  i, u32Count;
   orxSTATUS               eResult = orxSTATUS_FAILURE;
 
   /* Checks */
   orxASSERT(sstClock.u32Flags & orxCLOCK_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstClock);
 
-  /* For all stored timers */
-  for(pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetFirst(&(_pstClock->stTimerList));
-      pstTimerStorage != orxNULL;
-      pstTimerStorage = (orxCLOCK_TIMER_STORAGE *)orxLinkList_GetNext(&(pstTimerStorage->stNode)))
+  /* Has current timer? */
+  if((pstTimerStorage = _pstClock->pstCurrentTimer) != orxNULL)
   {
     /* Matches criteria? */
     if(((_pfnCallback == orxNULL)
@@ -1927,6 +2128,65 @@ orxSTATUS orxFASTCALL orxClock_RemoveTimer(orxCLOCK *_pstClock, const orxCLOCK_F
     }
   }
 
+  /* For all fired timers waiting to be rescheduled */
+  for(pstTimerStorage = _pstClock->pstFiredTimerList; pstTimerStorage != orxNULL; pstTimerStorage = pstTimerStorage->pstNext)
+  {
+    /* Matches criteria? */
+    if(((_pfnCallback == orxNULL)
+     || (pstTimerStorage->pfnCallback == _pfnCallback))
+    && ((_fDelay < orxFLOAT_0)
+     || (pstTimerStorage->fDelay == _fDelay))
+    && ((_pContext == orxNULL)
+     || (pstTimerStorage->pContext == _pContext)))
+    {
+      /* Marks it for deletion */
+      pstTimerStorage->s32Repetition = 0;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+
+  /* For all stored timers */
+  for(i = 0, u32Count = 0; i < _pstClock->u32TimerCount; i++)
+  {
+    /* Gets it */
+    pstTimerStorage = _pstClock->apstTimerList[i];
+
+    /* Matches criteria? */
+    if(((_pfnCallback == orxNULL)
+     || (pstTimerStorage->pfnCallback == _pfnCallback))
+    && ((_fDelay < orxFLOAT_0)
+     || (pstTimerStorage->fDelay == _fDelay))
+    && ((_pContext == orxNULL)
+     || (pstTimerStorage->pContext == _pContext)))
+    {
+      /* Deletes it */
+      orxBank_Free(sstClock.pstTimerBank, pstTimerStorage);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Keeps it */
+      _pstClock->apstTimerList[u32Count++] = pstTimerStorage;
+    }
+  }
+
+  /* Removed any stored timer? */
+  if(u32Count != _pstClock->u32TimerCount)
+  {
+    /* Updates count */
+    _pstClock->u32TimerCount = u32Count;
+
+    /* Rebuilds heap */
+    for(i = u32Count >> 1; i-- > 0;)
+    {
+      orxClock_SiftTimerDown(_pstClock, i);
+    }
+  }
+
   /* Done! */
   return eResult;
 }
@@ -44,6 +44,7 @@
 #include "object/orxTimeLine.h"
 #include "object/orxTrigger.h"
 #include "plugin/orxPlugin.h"
+#include "utils/orxHashTable.h"
 #include "utils/orxString.h"
 #include "utils/orxTree.h"
 
@@ -61,10 +62,29 @@
 #define orxCOMMAND_KU32_STATIC_FLAG_NONE              0x00000000                      /**< No flags */
 
 #define orxCOMMAND_KU32_STATIC_FLAG_READY             0x00000001                      /**< Ready flag */
+#define orxCOMMAND_KU32_STATIC_FLAG_FLUSH             0x00000002                      /**< Program flush pending flag */
 
 #define orxCOMMAND_KU32_STATIC_MASK_ALL               0xFFFFFFFF                      /**< All mask */
 
 
+/** Program flags
+ */
+#define orxCOMMAND_PROGRAM_KU32_FLAG_NONE             0x00000000                      /**< No flags */
+
+#define orxCOMMAND_PROGRAM_KU32_FLAG_VALID            0x00000001                      /**< Valid flag (compiled successfully) */
+#define orxCOMMAND_PROGRAM_KU32_FLAG_GUID             0x00000002                      /**< GUID flag (needs a valid GUID) */
+
+
+/** Instruction flags
+ */
+#define orxCOMMAND_INSTRUCTION_KU32_FLAG_NONE         0x00000000                      /**< No flags */
+
+#define orxCOMMAND_INSTRUCTION_KU32_FLAG_NAMED_PUSH   0x00000001                      /**< Named push flag */
+#define orxCOMMAND_INSTRUCTION_KU32_FLAG_PUSH_CURRENT 0x00000002                      /**< Named push in current section flag */
+#define orxCOMMAND_INSTRUCTION_KU32_FLAG_PUSH_GUID    0x00000004                      /**< Named push in GUID section flag */
+#define orxCOMMAND_INSTRUCTION_KU32_FLAG_OPERANDS     0x00000008                      /**< Has runtime operands (GUID / pop) flag */
+
+
 /** Misc
  */
 #define orxCOMMAND_KU32_BANK_SIZE                     512
@@ -72,6 +92,13 @@
 #define orxCOMMAND_KU32_RESULT_BANK_SIZE              32
 #define orxCOMMAND_KU32_RESULT_BUFFER_SIZE            256
 #define orxCOMMAND_KU32_NAME_BUFFER_SIZE              256
+#define orxCOMMAND_KU32_ALIAS_MAX_DEPTH               32
+
+#define orxCOMMAND_KU32_PROGRAM_TABLE_SIZE            256
+#define orxCOMMAND_KU32_PROGRAM_MAX_NUMBER            4096
+#define orxCOMMAND_KU32_PROGRAM_INSTRUCTION_NUMBER    16
+#define orxCOMMAND_KU32_PROGRAM_ARG_NUMBER            64
+#define orxCOMMAND_KU32_PROGRAM_POOL_SIZE             4096
 
 #define orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE       256
 
@@ -137,6 +164,47 @@ typedef struct __orxCOMMAND_t
 
 } orxCOMMAND;
 
+/** Command operand
+ */
+typedef enum __orxCOMMAND_OPERAND_t
+{
+  orxCOMMAND_OPERAND_LITERAL = 0,
+  orxCOMMAND_OPERAND_GUID,
+  orxCOMMAND_OPERAND_POP,
+
+  orxCOMMAND_OPERAND_NUMBER,
+
+  orxCOMMAND_OPERAND_NONE = orxENUM_NONE
+
+} orxCOMMAND_OPERAND;
+
+/** Compiled command instruction
+ */
+typedef struct __orxCOMMAND_INSTRUCTION_t
+{
+  const orxCOMMAND         *pstCommand;                                               /**< Resolved command : 4 */
+  const orxCOMMAND_VAR     *astArgList;                                               /**< Pre-parsed argument list : 8 */
+  const orxU8              *au8OperandList;                                           /**< Argument operand list : 12 */
+  const orxCHAR            *zPushSection;                                             /**< Named push section : 16 */
+  const orxCHAR            *zPushKey;                                                 /**< Named push key : 20 */
+  orxSTRINGID               stNameID;                                                 /**< Command name ID : 24 */
+  orxU32                    u32ArgNumber;                                             /**< Argument number : 28 */
+  orxU32                    u32PushCount;                                             /**< Push count : 32 */
+  orxU32                    u32Flags;                                                 /**< Flags : 36 */
+
+} orxCOMMAND_INSTRUCTION;
+
+/** Compiled command program
+ */
+typedef struct __orxCOMMAND_PROGRAM_t
+{
+  const orxCOMMAND_INSTRUCTION *astInstructionList;                                   /**< Instruction list : 4 */
+  orxU32                    u32InstructionNumber;                                     /**< Instruction number : 8 */
+  orxU32                    u32Flags;                                                 /**< Flags : 12 */
+  const orxCHAR            *zSource;                                                  /**< Source command line : 16 */
+
+} orxCOMMAND_PROGRAM;
+
 /** Command trie node
  */
 typedef struct __orxCOMMAND_TRIE_NODE_t
@@ -155,6 +223,7 @@ typedef struct __orxCOMMAND_STATIC_t
   orxBANK                  *pstTrieBank;                                              /**< Command trie bank */
   orxTREE                   stCommandTrie;                                            /**< Command trie */
   orxBANK                  *pstResultBank;                                            /**< Command result bank */
+  orxHASHTABLE             *pstProgramTable;                                          /**< Compiled program table */
   orxCHAR                   acEvaluateBuffer[orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE];   /**< Evaluate buffer */
   orxCHAR                   acProcessBuffer[orxCOMMAND_KU32_PROCESS_BUFFER_SIZE];     /**< Process buffer */
   orxCHAR                   acPrototypeBuffer[orxCOMMAND_KU32_PROTOTYPE_BUFFER_SIZE]; /**< Prototype buffer */
@@ -162,6 +231,7 @@ typedef struct __orxCOMMAND_STATIC_t
   orxCHAR                   acResultBuffer[orxCOMMAND_KU32_RESULT_BUFFER_SIZE];       /**< Result buffer */
   orxS32                    s32EvaluateOffset;                                        /**< Evaluate buffer offset */
   orxS32                    s32ProcessOffset;                                         /**< Process buffer offset */
+  orxU32                    u32ProgramDepth;                                          /**< Running program depth */
   orxU32                    u32Flags;                                                 /**< Control flags */
 
 } orxCOMMAND_STATIC;
@@ -572,860 +642,1966 @@ static orxSTATUS orxFASTCALL orxCommand_PopValue(orxSTRING *_pzDestination, orxU
   return eResult;
 }
 
-static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandLine, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+/** Parses the arguments of a command from a processed buffer
+ * @param[in]   _pstCommand                   Concerned command
+ * @param[in]   _pcBuffer                     Processed buffer, will get modified
+ * @param[out]  _astArgList                   Parsed arguments
+ * @param[out]  _pu32ArgNumber                Number of parsed arguments
+ * @param[out]  _apcArgList                   Start of every argument in the buffer, as it was before getting modified, orxNULL to ignore
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxCommand_ParseArgList(const orxCOMMAND *_pstCommand, orxCHAR *_pcBuffer, orxCOMMAND_VAR *_astArgList, orxU32 *_pu32ArgNumber, const orxCHAR **_apcArgList)
 {
-  const orxSTRING zCommand;
-  orxBOOL         bProcessed = orxFALSE;
-  orxCOMMAND_VAR *pstResult = orxNULL;
-
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxCommand_Process");
-
-  /* Gets start of command */
-  zCommand = orxString_SkipWhiteSpaces(_zCommandLine);
-
-  /* For all commands */
-  while(*zCommand != orxCHAR_NULL)
+  const orxCHAR  *pcSrc;
+  const orxSTRING zArg;
+  orxS32          s32VectorDepth;
+  orxU32          u32ArgNumber, u32ParamNumber, u32EraseCount = 0;
+  orxSTATUS       eResult;
+
+  /* Gets param number */
+  u32ParamNumber = (orxU32)_pstCommand->u16RequiredParamNumber + (orxU32)_pstCommand->u16OptionalParamNumber;
+
+  /* For all characters in the buffer */
+  for(pcSrc = _pcBuffer, eResult = orxSTATUS_SUCCESS, zArg = orxSTRING_EMPTY, u32ArgNumber = 0;
+      (u32ArgNumber < u32ParamNumber) && (*pcSrc != orxCHAR_NULL);
+      pcSrc++, u32ArgNumber++)
   {
-    const orxCHAR  *pcCommandEnd;
-    orxCOMMAND     *pstCommand;
-    const orxCHAR  *pcSection = orxNULL;
-    orxCHAR        *pcValue = orxNULL;
-    orxCHAR         acNameBuffer[orxCOMMAND_KU32_NAME_BUFFER_SIZE];
-    orxCHAR         acGUID[20];
-    orxS32          s32GUIDLength = 0;
-    orxU32          u32PushCount = 0;
-    orxCHAR         cBackupChar;
+    /* Skips all whitespaces */
+    pcSrc = orxString_SkipWhiteSpaces(pcSrc);
 
-    /* Updates status */
-    bProcessed = orxTRUE;
-
-    /* Is GUID valid? */
-    if(_u64GUID != orxU64_UNDEFINED)
+    /* Valid? */
+    if(*pcSrc != orxCHAR_NULL)
     {
-      /* Gets owner's GUID */
-      s32GUIDLength = orxString_NPrint(acGUID, sizeof(acGUID), "0x%016llX", _u64GUID);
-    }
+      orxBOOL bInBlock = orxFALSE, bUseDefault = orxFALSE;
 
-    /* Named push? */
-    zCommand = orxString_SkipWhiteSpaces(zCommand);
-    if((*zCommand == orxCOMMAND_KC_PUSH_MARKER)
-    && (*(zCommand + 1) != orxCOMMAND_KC_PUSH_MARKER)
-    && (orxCommand_IsWhiteSpace(*(zCommand + 1)) == orxFALSE))
-    {
-      orxCHAR *pc;
+      /* Stores its start? */
+      if(_apcArgList != orxNULL)
+      {
+        /* Stores it */
+        _apcArgList[u32ArgNumber] = pcSrc + u32EraseCount;
+      }
 
-      /* Copies names */
-      for(pc = pcValue = acNameBuffer, zCommand++;
-          ((pc - acNameBuffer) < sizeof(acNameBuffer) - 1) && (orxCommand_IsWhiteSpace(*zCommand) == orxFALSE);
-          zCommand++)
+      /* Inits vector depth */
+      s32VectorDepth = ((*pcSrc == orxSTRING_KC_VECTOR_START) || (*pcSrc == orxSTRING_KC_VECTOR_START_ALT)) ? 0 : -1;
+
+      /* Gets arg's beginning */
+      zArg = pcSrc;
+
+      /* Is a block marker? */
+      if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
       {
-        /* No section and is a separator? */
-        if((pcSection == orxNULL) && (*zCommand == orxCOMMAND_KC_CONFIG_SECTION_SEPARATOR))
+        /* Updates arg pointer */
+        zArg++;
+        pcSrc++;
+
+        /* Is an empty block? */
+        if((*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
+        && (*(pcSrc + 1) != orxCOMMAND_KC_BLOCK_MARKER))
         {
-          /* Empty or inheritance? */
-          if((pc == acNameBuffer)
-          || ((pc == acNameBuffer + 1)
-          && (*(zCommand - 1) == orxCOMMAND_KC_CONFIG_INHERITANCE_MARKER)))
-          {
-            /* Updates section */
-            pcSection = orxConfig_GetCurrentSection();
-          }
-          /* GUID? */
-          else if((pc == acNameBuffer + 1) && (*(zCommand - 1) == orxCOMMAND_KC_GUID_MARKER))
-          {
-            /* Updates section */
-            pcSection = acGUID;
-          }
-          else
-          {
-            /* Updates section */
-            pcSection = pcValue;
-          }
+          /* Uses default */
+          bUseDefault = orxTRUE;
 
-          /* Terminates section buffer */
-          *pc++   = orxCHAR_NULL;
-          pcValue = pc;
+          /* Updates arg pointer */
+          zArg++;
+          pcSrc++;
         }
-        /* Should pop? */
-        else if(*zCommand == orxCOMMAND_KC_POP_MARKER)
+        else
         {
-          orxU32 u32Size;
+          /* Updates block status */
+          bInBlock = orxTRUE;
+        }
+      }
 
-          /* Gets remaining size */
-          u32Size = orxCOMMAND_KU32_NAME_BUFFER_SIZE - 1 - (orxU32)(pc - acNameBuffer);
+      /* Stores its type */
+      _astArgList[u32ArgNumber].eType = _pstCommand->astParamList[u32ArgNumber].eType;
 
-          /* Pops value */
-          if(orxCommand_PopValue(&pc, u32Size, orxFALSE) == orxSTATUS_FAILURE)
+      /* Depending on its type */
+      switch(_pstCommand->astParamList[u32ArgNumber].eType)
+      {
+        case orxCOMMAND_VAR_TYPE_NUMERIC:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
           {
-            orxU32 u32Length;
-
-            /* Logs message */
-            orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
+            /* Replaces block end marker with 0 */
+            pcSrc--;
+            zArg--;
+            *((orxCHAR *)pcSrc) = '0';
 
-            /* Gets error length */
-            u32Length = orxString_GetLength(orxCOMMAND_KZ_ERROR_VALUE);
+            /* Falls through */
+          }
+          /* Not in block? */
+          else if(bInBlock == orxFALSE)
+          {
+            orxVECTOR vValue;
 
-            /* Has room? */
-            if(u32Length <= u32Size)
+            /* Is a vector */
+            if(orxString_ToVector(zArg, &vValue, &pcSrc) != orxSTATUS_FAILURE)
             {
-              /* Replaces marker with stack error */
-              orxString_NCopy(pc, orxCOMMAND_KZ_STACK_ERROR_VALUE, u32Size);
+              /* Stores its value */
+              _astArgList[u32ArgNumber].zValue = zArg;
 
-              /* Updates pointers */
-              pc += u32Length;
+              /* Stops */
+              break;
+            }
+            else
+            {
+              /* Falls through */
             }
           }
         }
-        else
+
+        default:
+        case orxCOMMAND_VAR_TYPE_STRING:
         {
-          /* Copies character */
-          *pc++ = *zCommand;
-        }
-      }
+          /* For all argument characters */
+          for(; *pcSrc != orxCHAR_NULL; pcSrc++)
+          {
+            orxCHAR *pcTemp;
 
-      /* Terminates buffer */
-      *pc = orxCHAR_NULL;
+            /* Depending on character */
+            switch(*pcSrc)
+            {
+              case orxSTRING_KC_VECTOR_START:
+              case orxSTRING_KC_VECTOR_START_ALT:
+              {
+                /* Should update? */
+                if(s32VectorDepth >= 0)
+                {
+                  /* Increments vector depth */
+                  s32VectorDepth++;
+                }
+                break;
+              }
 
-      /* Skips remaining white spaces */
-      zCommand = orxString_SkipWhiteSpaces(zCommand + 1);
-    }
-    else
-    {
-      /* For all push markers / spaces */
-      for(u32PushCount = 0; (*zCommand == orxCOMMAND_KC_PUSH_MARKER) || (orxCommand_IsWhiteSpace(*zCommand) != orxFALSE); zCommand++)
-      {
-        /* Is a push marker? */
-        if(*zCommand == orxCOMMAND_KC_PUSH_MARKER)
-        {
-          /* Updates push count */
-          u32PushCount++;
-        }
-      }
-    }
+              case orxSTRING_KC_VECTOR_END:
+              case orxSTRING_KC_VECTOR_END_ALT:
+              {
+                /* Should update? */
+                if(s32VectorDepth >= 0)
+                {
+                  /* Decrements vector depth */
+                  s32VectorDepth--;
+                }
+                break;
+              }
 
-    /* Finds end of command */
-    for(pcCommandEnd = zCommand + 1; (*pcCommandEnd != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*pcCommandEnd) == orxFALSE) && (*pcCommandEnd != orxCHAR_CR) && (*pcCommandEnd != orxCHAR_LF) && (*pcCommandEnd != orxCOMMAND_KC_SEPARATOR); pcCommandEnd++)
-      ;
+              case orxCOMMAND_KC_BLOCK_MARKER:
+              {
+                /* Erases it */
+                for(pcTemp = (orxCHAR *)pcSrc; *pcTemp != orxCHAR_NULL; pcTemp++)
+                {
+                  *pcTemp = *(pcTemp + 1);
+                }
+                u32EraseCount++;
 
-    /* Ends command */
-    cBackupChar               = *pcCommandEnd;
-    *(orxCHAR *)pcCommandEnd  = orxCHAR_NULL;
+                /* Not double marker? */
+                if(*pcSrc != orxCOMMAND_KC_BLOCK_MARKER)
+                {
+                  /* Updates block status */
+                  bInBlock = !bInBlock;
 
-    /* Gets it */
-    pstCommand = orxCommand_FindNoAlias(zCommand);
+                  /* Handles current character in new mode */
+                  pcSrc--;
+                }
+                continue;
+              }
+              default:
+              {
+                break;
+              }
+            }
 
-    /* Found? */
-    if(pstCommand != orxNULL)
-    {
-#define orxCOMMAND_KU32_ALIAS_MAX_DEPTH             32
-      orxSTATUS             eStatus;
-      orxS32                s32BufferCount = 0, s32VectorDepth = 0, s32Offset, i;
-      orxBOOL               bInBlock = orxFALSE;
-      orxCOMMAND_TRIE_NODE *pstCommandNode;
-      const orxCHAR        *pcSrc;
-      orxCHAR              *pcDst;
-      const orxSTRING       zArg;
-      const orxSTRING       azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
-      orxU32                u32ArgNumber, u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
-      orxCOMMAND_VAR       *astArgList = (orxCOMMAND_VAR *)orxMemory_StackAllocate(u32ParamNumber * sizeof(orxCOMMAND_VAR));
+            /* Not in block or in vector? */
+            if((bInBlock == orxFALSE) && (s32VectorDepth <= 0))
+            {
+              /* End of string? */
+              if(orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE)
+              {
+                /* Stops */
+                break;
+              }
+            }
+          }
 
-      /* Adds input to the buffer list */
-      azBufferList[s32BufferCount++] = pcCommandEnd;
+          /* Stores its value */
+          _astArgList[u32ArgNumber].zValue = zArg;
 
-      /* For all alias nodes */
-      for(pstCommandNode = orxCommand_FindTrieNode(zCommand, orxFALSE);
-          (pstCommandNode->pstCommand->bIsAlias != orxFALSE) && (s32BufferCount < orxCOMMAND_KU32_ALIAS_MAX_DEPTH);
-          pstCommandNode = orxCommand_FindTrieNode(pstCommandNode->pstCommand->zAliasedCommandName, orxFALSE))
-      {
-        /* Has args? */
-        if(pstCommandNode->pstCommand->zArgs != orxNULL)
-        {
-          /* Adds it to the buffer list */
-          azBufferList[s32BufferCount++] = pstCommandNode->pstCommand->zArgs;
+          break;
         }
-      }
 
-      /* Restores command end */
-      *(orxCHAR *)pcCommandEnd = cBackupChar;
+        case orxCOMMAND_VAR_TYPE_FLOAT:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].fValue = orxFLOAT_0;
+          }
+          else
+          {
+            /* Gets its value */
+            eResult = orxString_ToFloat(zArg, &(_astArgList[u32ArgNumber].fValue), &pcSrc);
+          }
 
-      /* For all stacked buffers */
-      for(i = s32BufferCount - 1, pcDst = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset; i >= 0; i--)
-      {
-        orxBOOL bStop;
+          break;
+        }
 
-        /* Has room for next buffer? */
-        if((i != s32BufferCount - 1) && (*azBufferList[i] != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2))
+        case orxCOMMAND_VAR_TYPE_S32:
         {
-          /* Inserts space */
-          *pcDst++ = ' ';
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].s32Value = 0;
+          }
+          else
+          {
+            /* Gets its value */
+            eResult = orxString_ToS32(zArg, &(_astArgList[u32ArgNumber].s32Value), &pcSrc);
+          }
+
+          break;
         }
 
-        /* For all characters */
-        for(pcSrc = azBufferList[i], bStop = orxFALSE; (bStop == orxFALSE) && (*pcSrc != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2); pcSrc++)
+        case orxCOMMAND_VAR_TYPE_U32:
         {
-          /* Depending on character */
-          switch(*pcSrc)
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
           {
-            case orxCOMMAND_KC_GUID_MARKER:
-            {
-              /* Has valid GUID? */
-              if(s32GUIDLength != 0)
-              {
-                /* Replaces it with GUID */
-                orxString_NCopy(pcDst, acGUID, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
+            /* Uses default value */
+            _astArgList[u32ArgNumber].u32Value = 0;
+          }
+          else
+          {
+            /* Gets its value */
+            eResult = orxString_ToU32(zArg, &(_astArgList[u32ArgNumber].u32Value), &pcSrc);
+          }
 
-                /* Updates pointer */
-                pcDst += s32GUIDLength;
+          break;
+        }
+
+        case orxCOMMAND_VAR_TYPE_S64:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].s64Value = 0;
+          }
+          else
+          {
+            /* Gets its value */
+            eResult = orxString_ToS64(zArg, &(_astArgList[u32ArgNumber].s64Value), &pcSrc);
+          }
+
+          break;
+        }
+
+        case orxCOMMAND_VAR_TYPE_U64:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].u64Value = 0;
+          }
+          else
+          {
+            /* Gets its value */
+            eResult = orxString_ToU64(zArg, &(_astArgList[u32ArgNumber].u64Value), &pcSrc);
+          }
+
+          break;
+        }
+
+        case orxCOMMAND_VAR_TYPE_BOOL:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            _astArgList[u32ArgNumber].bValue = orxFALSE;
+          }
+          else
+          {
+            /* Gets its value */
+            eResult = orxString_ToBool(zArg, &(_astArgList[u32ArgNumber].bValue), &pcSrc);
+          }
+
+          break;
+        }
+
+        case orxCOMMAND_VAR_TYPE_VECTOR:
+        {
+          /* Should use default? */
+          if(bUseDefault != orxFALSE)
+          {
+            /* Uses default value */
+            orxVector_Copy(&(_astArgList[u32ArgNumber].vValue), &orxVECTOR_0);
+          }
+          else
+          {
+            /* Gets its value */
+            eResult = orxString_ToVector(zArg, &(_astArgList[u32ArgNumber].vValue), &pcSrc);
+          }
+
+          break;
+        }
+      }
+
+      /* Interrupted? */
+      if((eResult == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
+      {
+        /* Updates argument count */
+        u32ArgNumber++;
+
+        /* Stops processing */
+        break;
+      }
+      else
+      {
+        /* Ends current argument */
+        *(orxCHAR *)pcSrc = orxCHAR_NULL;
+      }
+    }
+    else
+    {
+      /* Stops */
+      break;
+    }
+  }
+
+  /* Stores argument number */
+  *_pu32ArgNumber = u32ArgNumber;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stores the result of a command, either in config (named push) or on the stack
+ * @param[in]   _zSection                     Named push section, orxNULL for default
+ * @param[in]   _zKey                         Named push key, orxNULL for stack push
+ * @param[in]   _u32PushCount                 Number of stack pushes
+ * @param[in]   _pstResult                    Result to store
+ */
+static void orxFASTCALL orxCommand_StoreResult(const orxSTRING _zSection, const orxSTRING _zKey, orxU32 _u32PushCount, const orxCOMMAND_VAR *_pstResult)
+{
+  /* Has named push? */
+  if(_zKey != orxNULL)
+  {
+    /* Pushes section */
+    orxConfig_PushSection((_zSection != orxNULL) ? _zSection : orxCOMMAND_KZ_PUSH_SECTION);
+
+    /* Depending on type */
+    switch(_pstResult->eType)
+    {
+      default:
+      case orxCOMMAND_VAR_TYPE_STRING:
+      case orxCOMMAND_VAR_TYPE_NUMERIC:
+      {
+        /* Stores it */
+        orxConfig_SetString(_zKey, _pstResult->zValue);
+
+        break;
+      }
+      case orxCOMMAND_VAR_TYPE_FLOAT:
+      {
+        /* Stores it */
+        orxConfig_SetFloat(_zKey, _pstResult->fValue);
+
+        break;
+      }
+      case orxCOMMAND_VAR_TYPE_S32:
+      {
+        /* Stores it */
+        orxConfig_SetS32(_zKey, _pstResult->s32Value);
+
+        break;
+      }
+      case orxCOMMAND_VAR_TYPE_U32:
+      {
+        /* Stores it */
+        orxConfig_SetU32(_zKey, _pstResult->u32Value);
+
+        break;
+      }
+      case orxCOMMAND_VAR_TYPE_S64:
+      {
+        /* Stores it */
+        orxConfig_SetS64(_zKey, _pstResult->s64Value);
+
+        break;
+      }
+      case orxCOMMAND_VAR_TYPE_U64:
+      {
+        /* Stores it */
+        orxConfig_SetU64(_zKey, _pstResult->u64Value);
+
+        break;
+      }
+      case orxCOMMAND_VAR_TYPE_BOOL:
+      {
+        /* Stores it */
+        orxConfig_SetBool(_zKey, _pstResult->bValue);
+
+        break;
+      }
+      case orxCOMMAND_VAR_TYPE_VECTOR:
+      {
+        /* Stores it */
+        orxConfig_SetVector(_zKey, &(_pstResult->vValue));
+
+        break;
+      }
+    }
+
+    /* Pops section */
+    orxConfig_PopSection();
+  }
+  else
+  {
+    /* For all requested pushes */
+    while(_u32PushCount > 0)
+    {
+      orxCOMMAND_STACK_ENTRY *pstEntry;
+
+      /* Allocates stack entry */
+      pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_Allocate(sstCommand.pstResultBank);
+
+      /* Checks */
+      orxASSERT(pstEntry != orxNULL);
+
+      /* Is a string or numeric value? */
+      if((_pstResult->eType == orxCOMMAND_VAR_TYPE_STRING)
+      || (_pstResult->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
+      {
+        /* Checks */
+        orxASSERT(orxString_GetLength(_pstResult->zValue) < orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE);
+
+        /* Duplicates it */
+        pstEntry->stValue.eType   = _pstResult->eType;
+        pstEntry->stValue.zValue  = pstEntry->acBuffer;
+        orxString_NCopy(pstEntry->acBuffer, _pstResult->zValue, sizeof(pstEntry->acBuffer) - 1);
+        pstEntry->acBuffer[sizeof(pstEntry->acBuffer) - 1] = orxCHAR_NULL;
+      }
+      else
+      {
+        /* Stores value */
+        orxMemory_Copy(&(pstEntry->stValue), _pstResult, sizeof(orxCOMMAND_VAR));
+      }
+
+      /* Updates push count */
+      _u32PushCount--;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandLine, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+{
+  const orxSTRING zCommand;
+  orxBOOL         bProcessed = orxFALSE;
+  orxCOMMAND_VAR *pstResult = orxNULL;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxCommand_Process");
+
+  /* Gets start of command */
+  zCommand = orxString_SkipWhiteSpaces(_zCommandLine);
+
+  /* For all commands */
+  while(*zCommand != orxCHAR_NULL)
+  {
+    const orxCHAR  *pcCommandEnd;
+    orxCOMMAND     *pstCommand;
+    const orxCHAR  *pcSection = orxNULL;
+    orxCHAR        *pcValue = orxNULL;
+    orxCHAR         acNameBuffer[orxCOMMAND_KU32_NAME_BUFFER_SIZE];
+    orxCHAR         acGUID[20];
+    orxS32          s32GUIDLength = 0;
+    orxU32          u32PushCount = 0;
+    orxCHAR         cBackupChar;
+
+    /* Updates status */
+    bProcessed = orxTRUE;
+
+    /* Is GUID valid? */
+    if(_u64GUID != orxU64_UNDEFINED)
+    {
+      /* Gets owner's GUID */
+      s32GUIDLength = orxString_NPrint(acGUID, sizeof(acGUID), "0x%016llX", _u64GUID);
+    }
+
+    /* Named push? */
+    zCommand = orxString_SkipWhiteSpaces(zCommand);
+    if((*zCommand == orxCOMMAND_KC_PUSH_MARKER)
+    && (*(zCommand + 1) != orxCOMMAND_KC_PUSH_MARKER)
+    && (orxCommand_IsWhiteSpace(*(zCommand + 1)) == orxFALSE))
+    {
+      orxCHAR *pc;
+
+      /* Copies names */
+      for(pc = pcValue = acNameBuffer, zCommand++;
+          ((pc - acNameBuffer) < sizeof(acNameBuffer) - 1) && (orxCommand_IsWhiteSpace(*zCommand) == orxFALSE);
+          zCommand++)
+      {
+        /* No section and is a separator? */
+        if((pcSection == orxNULL) && (*zCommand == orxCOMMAND_KC_CONFIG_SECTION_SEPARATOR))
+        {
+          /* Empty or inheritance? */
+          if((pc == acNameBuffer)
+          || ((pc == acNameBuffer + 1)
+          && (*(zCommand - 1) == orxCOMMAND_KC_CONFIG_INHERITANCE_MARKER)))
+          {
+            /* Updates section */
+            pcSection = orxConfig_GetCurrentSection();
+          }
+          /* GUID? */
+          else if((pc == acNameBuffer + 1) && (*(zCommand - 1) == orxCOMMAND_KC_GUID_MARKER))
+          {
+            /* Updates section */
+            pcSection = acGUID;
+          }
+          else
+          {
+            /* Updates section */
+            pcSection = pcValue;
+          }
+
+          /* Terminates section buffer */
+          *pc++   = orxCHAR_NULL;
+          pcValue = pc;
+        }
+        /* Should pop? */
+        else if(*zCommand == orxCOMMAND_KC_POP_MARKER)
+        {
+          orxU32 u32Size;
+
+          /* Gets remaining size */
+          u32Size = orxCOMMAND_KU32_NAME_BUFFER_SIZE - 1 - (orxU32)(pc - acNameBuffer);
+
+          /* Pops value */
+          if(orxCommand_PopValue(&pc, u32Size, orxFALSE) == orxSTATUS_FAILURE)
+          {
+            orxU32 u32Length;
+
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
+
+            /* Gets error length */
+            u32Length = orxString_GetLength(orxCOMMAND_KZ_ERROR_VALUE);
+
+            /* Has room? */
+            if(u32Length <= u32Size)
+            {
+              /* Replaces marker with stack error */
+              orxString_NCopy(pc, orxCOMMAND_KZ_STACK_ERROR_VALUE, u32Size);
+
+              /* Updates pointers */
+              pc += u32Length;
+            }
+          }
+        }
+        else
+        {
+          /* Copies character */
+          *pc++ = *zCommand;
+        }
+      }
+
+      /* Terminates buffer */
+      *pc = orxCHAR_NULL;
+
+      /* Skips remaining white spaces */
+      zCommand = orxString_SkipWhiteSpaces(zCommand + 1);
+    }
+    else
+    {
+      /* For all push markers / spaces */
+      for(u32PushCount = 0; (*zCommand == orxCOMMAND_KC_PUSH_MARKER) || (orxCommand_IsWhiteSpace(*zCommand) != orxFALSE); zCommand++)
+      {
+        /* Is a push marker? */
+        if(*zCommand == orxCOMMAND_KC_PUSH_MARKER)
+        {
+          /* Updates push count */
+          u32PushCount++;
+        }
+      }
+    }
+
+    /* Finds end of command */
+    for(pcCommandEnd = zCommand + 1; (*pcCommandEnd != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*pcCommandEnd) == orxFALSE) && (*pcCommandEnd != orxCHAR_CR) && (*pcCommandEnd != orxCHAR_LF) && (*pcCommandEnd != orxCOMMAND_KC_SEPARATOR); pcCommandEnd++)
+      ;
+
+    /* Ends command */
+    cBackupChar               = *pcCommandEnd;
+    *(orxCHAR *)pcCommandEnd  = orxCHAR_NULL;
+
+    /* Gets it */
+    pstCommand = orxCommand_FindNoAlias(zCommand);
+
+    /* Found? */
+    if(pstCommand != orxNULL)
+    {
+      orxSTATUS             eStatus;
+      orxS32                s32BufferCount = 0, s32VectorDepth = 0, s32Offset, i;
+      orxBOOL               bInBlock = orxFALSE;
+      orxCOMMAND_TRIE_NODE *pstCommandNode;
+      const orxCHAR        *pcSrc;
+      orxCHAR              *pcDst;
+      const orxSTRING       azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
+      orxU32                u32ArgNumber, u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
+      orxCOMMAND_VAR       *astArgList = (orxCOMMAND_VAR *)orxMemory_StackAllocate(u32ParamNumber * sizeof(orxCOMMAND_VAR));
+
+      /* Adds input to the buffer list */
+      azBufferList[s32BufferCount++] = pcCommandEnd;
+
+      /* For all alias nodes */
+      for(pstCommandNode = orxCommand_FindTrieNode(zCommand, orxFALSE);
+          (pstCommandNode->pstCommand->bIsAlias != orxFALSE) && (s32BufferCount < orxCOMMAND_KU32_ALIAS_MAX_DEPTH);
+          pstCommandNode = orxCommand_FindTrieNode(pstCommandNode->pstCommand->zAliasedCommandName, orxFALSE))
+      {
+        /* Has args? */
+        if(pstCommandNode->pstCommand->zArgs != orxNULL)
+        {
+          /* Adds it to the buffer list */
+          azBufferList[s32BufferCount++] = pstCommandNode->pstCommand->zArgs;
+        }
+      }
+
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+      /* For all stacked buffers */
+      for(i = s32BufferCount - 1, pcDst = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset; i >= 0; i--)
+      {
+        orxBOOL bStop;
+
+        /* Has room for next buffer? */
+        if((i != s32BufferCount - 1) && (*azBufferList[i] != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2))
+        {
+          /* Inserts space */
+          *pcDst++ = ' ';
+        }
+
+        /* For all characters */
+        for(pcSrc = azBufferList[i], bStop = orxFALSE; (bStop == orxFALSE) && (*pcSrc != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2); pcSrc++)
+        {
+          /* Depending on character */
+          switch(*pcSrc)
+          {
+            case orxCOMMAND_KC_GUID_MARKER:
+            {
+              /* Has valid GUID? */
+              if(s32GUIDLength != 0)
+              {
+                /* Replaces it with GUID */
+                orxString_NCopy(pcDst, acGUID, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
+
+                /* Updates pointer */
+                pcDst += s32GUIDLength;
+              }
+              else
+              {
+                /* Copies character */
+                *pcDst++ = *pcSrc;
+              }
+
+              break;
+            }
+
+            case orxCOMMAND_KC_VARIABLE_MARKER:
+            {
+              /* Not doubled? */
+              if(*++pcSrc != orxCOMMAND_KC_VARIABLE_MARKER)
+              {
+                orxCOMMAND_VAR  astNameArgList[2], stNameResult;
+                const orxCHAR  *pcSection = orxNULL;
+                orxCHAR        *pcValue;
+                orxCHAR        *pc;
+                const orxSTRING zVariable;
+                orxCHAR         acNameBuffer[orxCOMMAND_KU32_NAME_BUFFER_SIZE];
+                orxU32          u32Length;
+                orxBOOL         bStop, bUseStringMarker = orxFALSE;
+
+                /* Skips white spaces */
+                pcSrc = orxString_SkipWhiteSpaces(pcSrc);
+
+                /* Copies names */
+                for(pc = pcValue = acNameBuffer, bStop = orxFALSE;
+                    ((pc - acNameBuffer) < sizeof(acNameBuffer) - 1) && (bStop == orxFALSE);
+                    pcSrc++)
+                {
+                  /* Depending on character */
+                  switch(*pcSrc)
+                  {
+                    case ' ':
+                    case '\t':
+                    case orxCHAR_CR:
+                    case orxCHAR_LF:
+                    case orxCHAR_NULL:
+                    case orxCOMMAND_KC_BLOCK_MARKER:
+                    case orxCOMMAND_KC_VARIABLE_MARKER:
+                    case orxSTRING_KC_VECTOR_START:
+                    case orxSTRING_KC_VECTOR_START_ALT:
+                    case orxSTRING_KC_VECTOR_SEPARATOR:
+                    case orxSTRING_KC_VECTOR_END:
+                    case orxSTRING_KC_VECTOR_END_ALT:
+                    {
+                      /* Stops */
+                      bStop = orxTRUE;
+                      pcSrc--;
+
+                      break;
+                    }
+
+                    case orxCOMMAND_KC_POP_MARKER:
+                    {
+                      orxU32 u32Size;
+
+                      /* Gets remaining size */
+                      u32Size = orxCOMMAND_KU32_NAME_BUFFER_SIZE - 1 - (orxU32)(pc - acNameBuffer);
+
+                      /* Pops value */
+                      if(orxCommand_PopValue(&pc, u32Size, orxFALSE) == orxSTATUS_FAILURE)
+                      {
+                        orxU32 u32Length;
+
+                        /* Logs message */
+                        orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
+
+                        /* Gets error length */
+                        u32Length = orxString_GetLength(orxCOMMAND_KZ_ERROR_VALUE);
+
+                        /* Has room? */
+                        if(u32Length <= u32Size)
+                        {
+                          /* Replaces marker with stack error */
+                          orxString_NCopy(pc, orxCOMMAND_KZ_STACK_ERROR_VALUE, u32Size);
+
+                          /* Updates pointers */
+                          pc += u32Length;
+                        }
+                      }
+
+                      break;
+                    }
+
+                    default:
+                    {
+                      /* No section and is a separator? */
+                      if((pcSection == orxNULL) && (*pcSrc == orxCOMMAND_KC_CONFIG_SECTION_SEPARATOR))
+                      {
+                        /* Empty or inheritance? */
+                        if((pc == acNameBuffer)
+                        || ((pc == acNameBuffer + 1)
+                        && (*(pcSrc - 1) == orxCOMMAND_KC_CONFIG_INHERITANCE_MARKER)))
+                        {
+                          /* Updates section */
+                          pcSection = orxConfig_GetCurrentSection();
+                        }
+                        /* GUID? */
+                        else if((pc == acNameBuffer + 1) && (*(pcSrc - 1) == orxCOMMAND_KC_GUID_MARKER))
+                        {
+                          /* Updates section */
+                          pcSection = acGUID;
+                        }
+                        else
+                        {
+                          /* Updates section */
+                          pcSection = pcValue;
+                        }
+
+                        /* Terminates section buffer */
+                        *pc++   = orxCHAR_NULL;
+                        pcValue = pc;
+                      }
+                      else
+                      {
+                        /* Copies character */
+                        *pc++ = *pcSrc;
+                      }
+
+                      break;
+                    }
+                  }
+                }
+
+                /* Terminates buffer */
+                *pc = orxCHAR_NULL;
+
+                /* Resets source */
+                pcSrc--;
+
+                /* Retrieves variable while protecting current processing buffer to support lazy commands */
+                s32Offset = (orxS32)(pcDst + 1 - sstCommand.acProcessBuffer - sstCommand.s32ProcessOffset);
+                sstCommand.s32ProcessOffset += s32Offset;
+                astNameArgList[0].eType   = astNameArgList[1].eType = orxCOMMAND_VAR_TYPE_STRING;
+                astNameArgList[0].zValue  = (pcSection != orxNULL) ? pcSection : orxCOMMAND_KZ_PUSH_SECTION;
+                astNameArgList[1].zValue  = pcValue;
+                zVariable = (orxCommand_Execute("Config.GetValue", 2, astNameArgList, &stNameResult) != orxNULL) ? stNameResult.zValue : orxSTRING_EMPTY;
+                sstCommand.s32ProcessOffset -= s32Offset;
+
+                /* Not in block? */
+                if(bInBlock == orxFALSE)
+                {
+                  const orxCHAR *pc = zVariable;
+
+                  /* For all characters */
+                  do
+                  {
+                    /* Is a white space? */
+                    if((*pc == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*pc) != orxFALSE))
+                    {
+                      /* Has room? */
+                      if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
+                      {
+                        /* Adds block marker */
+                        *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
+
+                        /* Updates string marker status */
+                        bUseStringMarker = orxTRUE;
+                      }
+
+                      break;
+                    }
+
+                    /* Gets next character */
+                    pc++;
+
+                  } while(*pc != orxCHAR_NULL);
+                }
+
+                /* Gets its length */
+                u32Length = orxString_GetLength(zVariable);
+
+                /* Has room? */
+                if (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxS32)u32Length)
+                {
+                  /* Moves it (buffers can overlap if variable used a lazy command) */
+                  orxMemory_Move(pcDst, zVariable, u32Length);
+
+                  /* Updates pointer */
+                  pcDst += u32Length;
+                }
+
+                /* Should add string marker */
+                if(bUseStringMarker != orxFALSE)
+                {
+                  /* Has room? */
+                  if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
+                  {
+                    *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
+                  }
+                }
+              }
+              else
+              {
+                /* Copies it */
+                *pcDst++ = orxCOMMAND_KC_VARIABLE_MARKER;
+              }
+
+              break;
+            }
+
+            case orxCOMMAND_KC_POP_MARKER:
+            {
+              orxU32 u32Size;
+
+              /* Gets remaining size */
+              u32Size = orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer);
+
+              /* Pops value */
+              if(orxCommand_PopValue(&pcDst, u32Size, bInBlock) == orxSTATUS_FAILURE)
+              {
+                orxU32 u32Length;
+
+                /* Logs message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
+
+                /* Gets error length */
+                u32Length = orxString_GetLength(orxCOMMAND_KZ_ERROR_VALUE);
+
+                /* Has room? */
+                if(u32Length <= u32Size)
+                {
+                  /* Replaces marker with stack error */
+                  orxString_NCopy(pcDst, orxCOMMAND_KZ_STACK_ERROR_VALUE, u32Size);
+
+                  /* Updates pointers */
+                  pcDst += u32Length;
+                }
+              }
+
+              break;
+            }
+
+            case orxCOMMAND_KC_SEPARATOR:
+            case orxCHAR_CR:
+            case orxCHAR_LF:
+            {
+              /* Not in block or in vector? */
+              if((bInBlock == orxFALSE)
+              && (s32VectorDepth == 0))
+              {
+                /* Stops */
+                bStop = orxTRUE;
               }
               else
               {
-                /* Copies character */
-                *pcDst++ = *pcSrc;
+                /* Copies it */
+                *pcDst++ = *pcSrc;
+              }
+
+              break;
+            }
+
+            case orxSTRING_KC_VECTOR_START:
+            case orxSTRING_KC_VECTOR_START_ALT:
+            {
+              /* Increments vector depth */
+              s32VectorDepth++;
+
+              /* Copies it */
+              *pcDst++ = *pcSrc;
+
+              break;
+            }
+
+            case orxSTRING_KC_VECTOR_END:
+            case orxSTRING_KC_VECTOR_END_ALT:
+            {
+              /* Decrements vector depth */
+              s32VectorDepth--;
+
+              /* Copies it */
+              *pcDst++ = *pcSrc;
+
+              break;
+            }
+
+            case orxCOMMAND_KC_BLOCK_MARKER:
+            {
+              /* Toggles block status */
+              bInBlock = !bInBlock;
+
+              /* Falls through */
+            }
+
+            default:
+            {
+              /* Copies it */
+              *pcDst++ = *pcSrc;
+
+              break;
+            }
+          }
+        }
+      }
+
+      /* Copies end of string */
+      *pcDst = orxCHAR_NULL;
+
+      /* Gets new additional offset */
+      s32Offset = (orxS32)(pcDst + 1 - sstCommand.acProcessBuffer - sstCommand.s32ProcessOffset);
+
+      /* Updates next command expression */
+      zCommand = orxString_SkipWhiteSpaces(pcSrc);
+
+      /* Parses arguments */
+      eStatus = orxCommand_ParseArgList(pstCommand, sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset, astArgList, &u32ArgNumber, orxNULL);
+
+      /* Error? */
+      if((eStatus == orxSTATUS_FAILURE) || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber))
+      {
+        /* Incorrect parameter? */
+        if(eStatus == orxSTATUS_FAILURE)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], invalid argument #%d for command [%s].", _zCommandLine, u32ArgNumber, orxString_GetFromID(pstCommand->stNameID));
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], expected %d[+%d] arguments for command [%s], found %d.", _zCommandLine, (orxU32)pstCommand->u16RequiredParamNumber, (orxU32)pstCommand->u16OptionalParamNumber, orxString_GetFromID(pstCommand->stNameID), u32ArgNumber);
+        }
+      }
+      else
+      {
+        /* Runs it */
+        sstCommand.s32ProcessOffset += s32Offset;
+        pstResult = orxCommand_Run(pstCommand, orxFALSE, u32ArgNumber, astArgList, _pstResult);
+        sstCommand.s32ProcessOffset -= s32Offset;
+      }
+    }
+    else
+    {
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+      /* Not silent? */
+      if(_bSilent == orxFALSE)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+      }
+
+      /* Stops */
+      zCommand = orxSTRING_EMPTY;
+    }
+
+    /* Failure? */
+    if(pstResult == orxNULL)
+    {
+      /* Stores error */
+      _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
+      _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
+    }
+
+    /* Stores result */
+    orxCommand_StoreResult(pcSection, pcValue, u32PushCount, _pstResult);
+  }
+
+  /* Unprocessed? */
+  if(bProcessed == orxFALSE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Flushes all compiled programs, deferred until no program is running
+ */
+static void orxFASTCALL orxCommand_FlushPrograms()
+{
+  /* Has program table? */
+  if(sstCommand.pstProgramTable != orxNULL)
+  {
+    /* No running program? */
+    if(sstCommand.u32ProgramDepth == 0)
+    {
+      orxHANDLE           hIterator;
+      orxCOMMAND_PROGRAM *pstProgram;
+
+      /* For all programs */
+      for(hIterator = orxHashTable_GetNext(sstCommand.pstProgramTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstProgram);
+          hIterator != orxHANDLE_UNDEFINED;
+          hIterator = orxHashTable_GetNext(sstCommand.pstProgramTable, hIterator, orxNULL, (void **)&pstProgram))
+      {
+        /* Deletes it */
+        orxMemory_Free(pstProgram);
+      }
+
+      /* Clears table */
+      orxHashTable_Clear(sstCommand.pstProgramTable);
+
+      /* Updates status */
+      orxFLAG_SET(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_NONE, orxCOMMAND_KU32_STATIC_FLAG_FLUSH);
+    }
+    else
+    {
+      /* Defers it */
+      orxFLAG_SET(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_FLUSH, orxCOMMAND_KU32_STATIC_FLAG_NONE);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Compiles a command line into a program: commands & aliases get resolved and arguments pre-parsed, only standalone GUID & pop markers are kept as runtime operands
+ * @param[in]   _zCommandLine                 Command line to compile
+ * @return      orxCOMMAND_PROGRAM (not valid if the command line can only be interpreted) / orxNULL
+ */
+static orxCOMMAND_PROGRAM *orxFASTCALL orxCommand_Compile(const orxSTRING _zCommandLine)
+{
+  orxCOMMAND_INSTRUCTION  astInstructionList[orxCOMMAND_KU32_PROGRAM_INSTRUCTION_NUMBER];
+  orxCOMMAND_VAR          astArgList[orxCOMMAND_KU32_PROGRAM_ARG_NUMBER];
+  orxU8                   au8OperandList[orxCOMMAND_KU32_PROGRAM_ARG_NUMBER];
+  const orxCHAR          *apcArgList[orxCOMMAND_KU32_PROGRAM_ARG_NUMBER];
+  const orxCHAR          *apcSlotList[orxCOMMAND_KU32_PROGRAM_ARG_NUMBER];
+  orxU8                   au8SlotList[orxCOMMAND_KU32_PROGRAM_ARG_NUMBER];
+  orxCHAR                *pcPool, *pcPoolEnd, *pcDst;
+  const orxSTRING         zCommand;
+  orxU32                  u32InstructionNumber = 0, u32ArgCount = 0, u32Flags = orxCOMMAND_PROGRAM_KU32_FLAG_NONE, u32SourceSize;
+  orxBOOL                 bValid = orxTRUE;
+  orxCOMMAND_PROGRAM     *pstResult;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxCommand_Compile");
+
+  /* Uses the free part of the process buffer as string pool */
+  pcPool    = pcDst = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset;
+  pcPoolEnd = pcPool + orxMIN(orxCOMMAND_KU32_PROGRAM_POOL_SIZE, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - sstCommand.s32ProcessOffset);
+
+  /* For all commands */
+  for(zCommand = orxString_SkipWhiteSpaces(_zCommandLine); (bValid != orxFALSE) && (*zCommand != orxCHAR_NULL);)
+  {
+    orxCOMMAND_INSTRUCTION *pstInstruction;
+    orxCOMMAND_TRIE_NODE   *pstCommandNode;
+    const orxCOMMAND       *pstCommand;
+    const orxCHAR          *pcCommandEnd, *pcSrc = orxNULL;
+    const orxSTRING         azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
+    orxCHAR                 acNameBuffer[orxCOMMAND_KU32_NAME_BUFFER_SIZE];
+    orxCHAR                *pcArgs;
+    orxU32                  u32SlotNumber = 0, u32ArgNumber, u32ParamNumber, i;
+    orxS32                  s32BufferCount = 0, s32VectorDepth = 0, j;
+    orxBOOL                 bInBlock = orxFALSE;
+
+    /* Too many commands? */
+    if(u32InstructionNumber == orxCOMMAND_KU32_PROGRAM_INSTRUCTION_NUMBER)
+    {
+      /* Updates status */
+      bValid = orxFALSE;
+      break;
+    }
+
+    /* Inits instruction */
+    pstInstruction = &astInstructionList[u32InstructionNumber];
+    orxMemory_Zero(pstInstruction, sizeof(orxCOMMAND_INSTRUCTION));
+
+    /* Named push? */
+    if((*zCommand == orxCOMMAND_KC_PUSH_MARKER)
+    && (*(zCommand + 1) != orxCOMMAND_KC_PUSH_MARKER)
+    && (orxCommand_IsWhiteSpace(*(zCommand + 1)) == orxFALSE))
+    {
+      orxCHAR *pcKey;
+      orxBOOL  bHasSection = orxFALSE;
+
+      /* Copies names */
+      for(pcKey = pcDst, zCommand++;
+          (*zCommand != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*zCommand) == orxFALSE) && (pcDst < pcPoolEnd - 1);
+          zCommand++)
+      {
+        /* No section and is a separator? */
+        if((bHasSection == orxFALSE) && (*zCommand == orxCOMMAND_KC_CONFIG_SECTION_SEPARATOR))
+        {
+          /* Empty or inheritance? */
+          if((pcDst == pcKey)
+          || ((pcDst == pcKey + 1)
+          && (*(zCommand - 1) == orxCOMMAND_KC_CONFIG_INHERITANCE_MARKER)))
+          {
+            /* Uses current section */
+            pstInstruction->u32Flags |= orxCOMMAND_INSTRUCTION_KU32_FLAG_PUSH_CURRENT;
+          }
+          /* GUID? */
+          else if((pcDst == pcKey + 1) && (*(zCommand - 1) == orxCOMMAND_KC_GUID_MARKER))
+          {
+            /* Uses GUID section */
+            pstInstruction->u32Flags |= orxCOMMAND_INSTRUCTION_KU32_FLAG_PUSH_GUID;
+            u32Flags |= orxCOMMAND_PROGRAM_KU32_FLAG_GUID;
+          }
+          else
+          {
+            /* Stores section */
+            pstInstruction->zPushSection = pcKey;
+          }
+
+          /* Terminates section */
+          *pcDst++    = orxCHAR_NULL;
+          pcKey       = pcDst;
+          bHasSection = orxTRUE;
+        }
+        /* Pop? */
+        else if(*zCommand == orxCOMMAND_KC_POP_MARKER)
+        {
+          /* Can only be interpreted */
+          bValid = orxFALSE;
+          break;
+        }
+        else
+        {
+          /* Copies character */
+          *pcDst++ = *zCommand;
+        }
+      }
+
+      /* Valid? */
+      if((bValid != orxFALSE) && (*zCommand != orxCHAR_NULL) && (pcDst < pcPoolEnd - 1))
+      {
+        /* Stores key */
+        *pcDst++                  = orxCHAR_NULL;
+        pstInstruction->zPushKey  = pcKey;
+        pstInstruction->u32Flags |= orxCOMMAND_INSTRUCTION_KU32_FLAG_NAMED_PUSH;
+
+        /* Skips remaining white spaces */
+        zCommand = orxString_SkipWhiteSpaces(zCommand + 1);
+      }
+      else
+      {
+        /* Updates status */
+        bValid = orxFALSE;
+        break;
+      }
+    }
+    else
+    {
+      /* For all push markers / spaces */
+      for(; (*zCommand == orxCOMMAND_KC_PUSH_MARKER) || (orxCommand_IsWhiteSpace(*zCommand) != orxFALSE); zCommand++)
+      {
+        /* Is a push marker? */
+        if(*zCommand == orxCOMMAND_KC_PUSH_MARKER)
+        {
+          /* Updates push count */
+          pstInstruction->u32PushCount++;
+        }
+      }
+    }
+
+    /* No command? */
+    if(*zCommand == orxCHAR_NULL)
+    {
+      /* Updates status */
+      bValid = orxFALSE;
+      break;
+    }
+
+    /* Finds end of command */
+    for(pcCommandEnd = zCommand + 1; (*pcCommandEnd != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*pcCommandEnd) == orxFALSE) && (*pcCommandEnd != orxCHAR_CR) && (*pcCommandEnd != orxCHAR_LF) && (*pcCommandEnd != orxCOMMAND_KC_SEPARATOR); pcCommandEnd++)
+      ;
+
+    /* Name too long? */
+    if(pcCommandEnd - zCommand >= (orxS32)sizeof(acNameBuffer))
+    {
+      /* Updates status */
+      bValid = orxFALSE;
+      break;
+    }
+
+    /* Copies name */
+    orxMemory_Copy(acNameBuffer, zCommand, (orxU32)(pcCommandEnd - zCommand));
+    acNameBuffer[pcCommandEnd - zCommand] = orxCHAR_NULL;
+
+    /* Resolves it */
+    pstCommand = orxCommand_FindNoAlias(acNameBuffer);
+
+    /* Not found? */
+    if(pstCommand == orxNULL)
+    {
+      /* Updates status */
+      bValid = orxFALSE;
+      break;
+    }
+
+    /* Adds input to the buffer list */
+    azBufferList[s32BufferCount++] = pcCommandEnd;
+
+    /* For all alias nodes */
+    for(pstCommandNode = orxCommand_FindTrieNode(acNameBuffer, orxFALSE);
+        (pstCommandNode->pstCommand->bIsAlias != orxFALSE) && (s32BufferCount < orxCOMMAND_KU32_ALIAS_MAX_DEPTH);
+        pstCommandNode = orxCommand_FindTrieNode(pstCommandNode->pstCommand->zAliasedCommandName, orxFALSE))
+    {
+      /* Has args? */
+      if(pstCommandNode->pstCommand->zArgs != orxNULL)
+      {
+        /* Adds it to the buffer list */
+        azBufferList[s32BufferCount++] = pstCommandNode->pstCommand->zArgs;
+      }
+    }
+
+    /* For all stacked buffers */
+    for(j = s32BufferCount - 1, pcArgs = pcDst; (bValid != orxFALSE) && (j >= 0); j--)
+    {
+      orxBOOL bStop;
+
+      /* Has room for next buffer? */
+      if((j != s32BufferCount - 1) && (*azBufferList[j] != orxCHAR_NULL) && (pcDst < pcPoolEnd - 2))
+      {
+        /* Inserts space */
+        *pcDst++ = ' ';
+      }
+
+      /* For all characters */
+      for(pcSrc = azBufferList[j], bStop = orxFALSE; (bStop == orxFALSE) && (*pcSrc != orxCHAR_NULL); pcSrc++)
+      {
+        /* Out of room? */
+        if(pcDst >= pcPoolEnd - 2)
+        {
+          /* Updates status */
+          bValid = orxFALSE;
+          break;
+        }
+
+        /* Depending on character */
+        switch(*pcSrc)
+        {
+          case orxCOMMAND_KC_GUID_MARKER:
+          case orxCOMMAND_KC_POP_MARKER:
+          {
+            /* Standalone, outside of any block or vector? */
+            if((bInBlock == orxFALSE)
+            && (s32VectorDepth == 0)
+            && (u32SlotNumber < orxCOMMAND_KU32_PROGRAM_ARG_NUMBER)
+            && ((pcSrc == azBufferList[j]) || (orxCommand_IsWhiteSpace(*(pcSrc - 1)) != orxFALSE))
+            && ((*(pcSrc + 1) == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*(pcSrc + 1)) != orxFALSE) || (*(pcSrc + 1) == orxCOMMAND_KC_SEPARATOR) || (*(pcSrc + 1) == orxCHAR_CR) || (*(pcSrc + 1) == orxCHAR_LF)))
+            {
+              /* Stores slot */
+              apcSlotList[u32SlotNumber]  = pcDst;
+              au8SlotList[u32SlotNumber]  = (*pcSrc == orxCOMMAND_KC_GUID_MARKER) ? (orxU8)orxCOMMAND_OPERAND_GUID : (orxU8)orxCOMMAND_OPERAND_POP;
+              u32SlotNumber++;
+
+              /* Uses GUID? */
+              if(*pcSrc == orxCOMMAND_KC_GUID_MARKER)
+              {
+                /* Updates flags */
+                u32Flags |= orxCOMMAND_PROGRAM_KU32_FLAG_GUID;
               }
 
-              break;
+              /* Replaces it with an empty block (default value) */
+              *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
+              *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
+            }
+            else
+            {
+              /* Can only be interpreted */
+              bValid  = orxFALSE;
+              bStop   = orxTRUE;
             }
 
-            case orxCOMMAND_KC_VARIABLE_MARKER:
+            break;
+          }
+
+          case orxCOMMAND_KC_VARIABLE_MARKER:
+          {
+            /* Doubled? */
+            if(*(pcSrc + 1) == orxCOMMAND_KC_VARIABLE_MARKER)
             {
-              /* Not doubled? */
-              if(*++pcSrc != orxCOMMAND_KC_VARIABLE_MARKER)
+              /* Copies it */
+              *pcDst++ = *pcSrc++;
+            }
+            else
+            {
+              /* Can only be interpreted */
+              bValid  = orxFALSE;
+              bStop   = orxTRUE;
+            }
+
+            break;
+          }
+
+          case orxCOMMAND_KC_SEPARATOR:
+          case orxCHAR_CR:
+          case orxCHAR_LF:
+          {
+            /* Not in block or in vector? */
+            if((bInBlock == orxFALSE)
+            && (s32VectorDepth == 0))
+            {
+              /* Not in input? */
+              if(j != 0)
               {
-                orxCOMMAND_VAR  astNameArgList[2], stNameResult;
-                const orxCHAR  *pcSection = orxNULL;
-                orxCHAR        *pcValue;
-                orxCHAR        *pc;
-                const orxSTRING zVariable;
-                orxCHAR         acNameBuffer[orxCOMMAND_KU32_NAME_BUFFER_SIZE];
-                orxU32          u32Length;
-                orxBOOL         bStop, bUseStringMarker = orxFALSE;
+                /* Can only be interpreted */
+                bValid = orxFALSE;
+              }
 
-                /* Skips white spaces */
-                pcSrc = orxString_SkipWhiteSpaces(pcSrc);
+              /* Stops */
+              bStop = orxTRUE;
+            }
+            else
+            {
+              /* Copies it */
+              *pcDst++ = *pcSrc;
+            }
 
-                /* Copies names */
-                for(pc = pcValue = acNameBuffer, bStop = orxFALSE;
-                    ((pc - acNameBuffer) < sizeof(acNameBuffer) - 1) && (bStop == orxFALSE);
-                    pcSrc++)
-                {
-                  /* Depending on character */
-                  switch(*pcSrc)
-                  {
-                    case ' ':
-                    case '\t':
-                    case orxCHAR_CR:
-                    case orxCHAR_LF:
-                    case orxCHAR_NULL:
-                    case orxCOMMAND_KC_BLOCK_MARKER:
-                    case orxCOMMAND_KC_VARIABLE_MARKER:
-                    case orxSTRING_KC_VECTOR_START:
-                    case orxSTRING_KC_VECTOR_START_ALT:
-                    case orxSTRING_KC_VECTOR_SEPARATOR:
-                    case orxSTRING_KC_VECTOR_END:
-                    case orxSTRING_KC_VECTOR_END_ALT:
-                    {
-                      /* Stops */
-                      bStop = orxTRUE;
-                      pcSrc--;
+            break;
+          }
 
-                      break;
-                    }
+          case orxSTRING_KC_VECTOR_START:
+          case orxSTRING_KC_VECTOR_START_ALT:
+          {
+            /* Increments vector depth */
+            s32VectorDepth++;
 
-                    case orxCOMMAND_KC_POP_MARKER:
-                    {
-                      orxU32 u32Size;
+            /* Copies it */
+            *pcDst++ = *pcSrc;
 
-                      /* Gets remaining size */
-                      u32Size = orxCOMMAND_KU32_NAME_BUFFER_SIZE - 1 - (orxU32)(pc - acNameBuffer);
+            break;
+          }
 
-                      /* Pops value */
-                      if(orxCommand_PopValue(&pc, u32Size, orxFALSE) == orxSTATUS_FAILURE)
-                      {
-                        orxU32 u32Length;
+          case orxSTRING_KC_VECTOR_END:
+          case orxSTRING_KC_VECTOR_END_ALT:
+          {
+            /* Decrements vector depth */
+            s32VectorDepth--;
 
-                        /* Logs message */
-                        orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
+            /* Copies it */
+            *pcDst++ = *pcSrc;
 
-                        /* Gets error length */
-                        u32Length = orxString_GetLength(orxCOMMAND_KZ_ERROR_VALUE);
+            break;
+          }
 
-                        /* Has room? */
-                        if(u32Length <= u32Size)
-                        {
-                          /* Replaces marker with stack error */
-                          orxString_NCopy(pc, orxCOMMAND_KZ_STACK_ERROR_VALUE, u32Size);
+          case orxCOMMAND_KC_BLOCK_MARKER:
+          {
+            /* Toggles block status */
+            bInBlock = !bInBlock;
 
-                          /* Updates pointers */
-                          pc += u32Length;
-                        }
-                      }
+            /* Falls through */
+          }
 
-                      break;
-                    }
+          default:
+          {
+            /* Copies it */
+            *pcDst++ = *pcSrc;
 
-                    default:
-                    {
-                      /* No section and is a separator? */
-                      if((pcSection == orxNULL) && (*pcSrc == orxCOMMAND_KC_CONFIG_SECTION_SEPARATOR))
-                      {
-                        /* Empty or inheritance? */
-                        if((pc == acNameBuffer)
-                        || ((pc == acNameBuffer + 1)
-                        && (*(pcSrc - 1) == orxCOMMAND_KC_CONFIG_INHERITANCE_MARKER)))
-                        {
-                          /* Updates section */
-                          pcSection = orxConfig_GetCurrentSection();
-                        }
-                        /* GUID? */
-                        else if((pc == acNameBuffer + 1) && (*(pcSrc - 1) == orxCOMMAND_KC_GUID_MARKER))
-                        {
-                          /* Updates section */
-                          pcSection = acGUID;
-                        }
-                        else
-                        {
-                          /* Updates section */
-                          pcSection = pcValue;
-                        }
+            break;
+          }
+        }
+      }
+    }
 
-                        /* Terminates section buffer */
-                        *pc++   = orxCHAR_NULL;
-                        pcValue = pc;
-                      }
-                      else
-                      {
-                        /* Copies character */
-                        *pc++ = *pcSrc;
-                      }
+    /* Invalid? */
+    if(bValid == orxFALSE)
+    {
+      break;
+    }
 
-                      break;
-                    }
-                  }
-                }
+    /* Terminates arguments */
+    *pcDst++ = orxCHAR_NULL;
 
-                /* Terminates buffer */
-                *pc = orxCHAR_NULL;
+    /* Updates next command expression */
+    zCommand = orxString_SkipWhiteSpaces(pcSrc);
 
-                /* Resets source */
-                pcSrc--;
+    /* Gets param number */
+    u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
 
-                /* Retrieves variable while protecting current processing buffer to support lazy commands */
-                s32Offset = (orxS32)(pcDst + 1 - sstCommand.acProcessBuffer - sstCommand.s32ProcessOffset);
-                sstCommand.s32ProcessOffset += s32Offset;
-                astNameArgList[0].eType   = astNameArgList[1].eType = orxCOMMAND_VAR_TYPE_STRING;
-                astNameArgList[0].zValue  = (pcSection != orxNULL) ? pcSection : orxCOMMAND_KZ_PUSH_SECTION;
-                astNameArgList[1].zValue  = pcValue;
-                zVariable = (orxCommand_Execute("Config.GetValue", 2, astNameArgList, &stNameResult) != orxNULL) ? stNameResult.zValue : orxSTRING_EMPTY;
-                sstCommand.s32ProcessOffset -= s32Offset;
+    /* Can't parse arguments? */
+    if((u32ArgCount + u32ParamNumber > orxCOMMAND_KU32_PROGRAM_ARG_NUMBER)
+    || (orxCommand_ParseArgList(pstCommand, pcArgs, astArgList + u32ArgCount, &u32ArgNumber, apcArgList) == orxSTATUS_FAILURE)
+    || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber))
+    {
+      /* Updates status */
+      bValid = orxFALSE;
+      break;
+    }
 
-                /* Not in block? */
-                if(bInBlock == orxFALSE)
-                {
-                  const orxCHAR *pc = zVariable;
+    /* Inits operands */
+    orxMemory_Set(au8OperandList + u32ArgCount, (orxU8)orxCOMMAND_OPERAND_LITERAL, u32ArgNumber);
 
-                  /* For all characters */
-                  do
-                  {
-                    /* Is a white space? */
-                    if((*pc == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*pc) != orxFALSE))
-                    {
-                      /* Has room? */
-                      if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
-                      {
-                        /* Adds block marker */
-                        *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
+    /* For all slots */
+    for(i = 0; i < u32SlotNumber; i++)
+    {
+      orxU32 k;
 
-                        /* Updates string marker status */
-                        bUseStringMarker = orxTRUE;
-                      }
+      /* Finds matching argument */
+      for(k = 0; (k < u32ArgNumber) && (apcArgList[k] != apcSlotList[i]); k++)
+        ;
 
-                      break;
-                    }
+      /* Found? */
+      if(k < u32ArgNumber)
+      {
+        /* Stores operand */
+        au8OperandList[u32ArgCount + k] = au8SlotList[i];
+        pstInstruction->u32Flags       |= orxCOMMAND_INSTRUCTION_KU32_FLAG_OPERANDS;
+      }
+      else
+      {
+        /* Can only be interpreted */
+        bValid = orxFALSE;
+        break;
+      }
+    }
 
-                    /* Gets next character */
-                    pc++;
+    /* Stores instruction */
+    pstInstruction->pstCommand      = pstCommand;
+    pstInstruction->stNameID        = pstCommand->stNameID;
+    pstInstruction->astArgList      = astArgList + u32ArgCount;
+    pstInstruction->au8OperandList  = au8OperandList + u32ArgCount;
+    pstInstruction->u32ArgNumber    = u32ArgNumber;
+    u32ArgCount                    += u32ArgNumber;
+    u32InstructionNumber++;
+  }
 
-                  } while(*pc != orxCHAR_NULL);
-                }
+  /* Gets source size */
+  u32SourceSize = orxString_GetLength(_zCommandLine) + 1;
 
-                /* Gets its length */
-                u32Length = orxString_GetLength(zVariable);
+  /* Valid? */
+  if((bValid != orxFALSE) && (u32InstructionNumber != 0))
+  {
+    orxU32 u32InstructionOffset, u32ArgOffset, u32OperandOffset, u32PoolOffset, u32PoolSize, u32SourceOffset;
 
-                /* Has room? */
-                if (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxS32)u32Length)
-                {
-                  /* Moves it (buffers can overlap if variable used a lazy command) */
-                  orxMemory_Move(pcDst, zVariable, u32Length);
+    /* Gets layout */
+    u32PoolSize           = (orxU32)(pcDst - pcPool);
+    u32InstructionOffset  = (orxU32)orxALIGN8(sizeof(orxCOMMAND_PROGRAM));
+    u32ArgOffset          = u32InstructionOffset + (orxU32)orxALIGN8(u32InstructionNumber * sizeof(orxCOMMAND_INSTRUCTION));
+    u32OperandOffset      = u32ArgOffset + u32ArgCount * sizeof(orxCOMMAND_VAR);
+    u32PoolOffset         = u32OperandOffset + u32ArgCount;
+    u32SourceOffset       = u32PoolOffset + u32PoolSize;
 
-                  /* Updates pointer */
-                  pcDst += u32Length;
-                }
+    /* Allocates program */
+    pstResult = (orxCOMMAND_PROGRAM *)orxMemory_Allocate(u32SourceOffset + u32SourceSize, orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(pstResult != orxNULL)
+    {
+      orxCOMMAND_INSTRUCTION *astInstructionCopy;
+      orxCOMMAND_VAR         *astArgCopy;
+      orxU8                  *au8OperandCopy;
+      orxCHAR                *pcPoolCopy, *pcSourceCopy;
+      orxU32                  i;
+
+      /* Gets sections */
+      astInstructionCopy  = (orxCOMMAND_INSTRUCTION *)((orxU8 *)pstResult + u32InstructionOffset);
+      astArgCopy          = (orxCOMMAND_VAR *)((orxU8 *)pstResult + u32ArgOffset);
+      au8OperandCopy      = (orxU8 *)pstResult + u32OperandOffset;
+      pcPoolCopy          = (orxCHAR *)pstResult + u32PoolOffset;
+      pcSourceCopy        = (orxCHAR *)pstResult + u32SourceOffset;
+
+      /* Copies everything */
+      orxMemory_Copy(astInstructionCopy, astInstructionList, u32InstructionNumber * sizeof(orxCOMMAND_INSTRUCTION));
+      orxMemory_Copy(astArgCopy, astArgList, u32ArgCount * sizeof(orxCOMMAND_VAR));
+      orxMemory_Copy(au8OperandCopy, au8OperandList, u32ArgCount);
+      orxMemory_Copy(pcPoolCopy, pcPool, u32PoolSize);
+      orxMemory_Copy(pcSourceCopy, _zCommandLine, u32SourceSize);
+
+      /* For all instructions */
+      for(i = 0; i < u32InstructionNumber; i++)
+      {
+        orxCOMMAND_INSTRUCTION *pstInstruction = &astInstructionCopy[i];
 
-                /* Should add string marker */
-                if(bUseStringMarker != orxFALSE)
-                {
-                  /* Has room? */
-                  if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
-                  {
-                    *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
-                  }
-                }
-              }
-              else
-              {
-                /* Copies it */
-                *pcDst++ = orxCOMMAND_KC_VARIABLE_MARKER;
-              }
+        /* Relocates it */
+        pstInstruction->astArgList      = astArgCopy + (pstInstruction->astArgList - astArgList);
+        pstInstruction->au8OperandList  = au8OperandCopy + (pstInstruction->au8OperandList - au8OperandList);
+        if(pstInstruction->zPushSection != orxNULL)
+        {
+          pstInstruction->zPushSection  = pcPoolCopy + (pstInstruction->zPushSection - pcPool);
+        }
+        if(pstInstruction->zPushKey != orxNULL)
+        {
+          pstInstruction->zPushKey      = pcPoolCopy + (pstInstruction->zPushKey - pcPool);
+        }
+      }
 
-              break;
-            }
+      /* For all arguments */
+      for(i = 0; i < u32ArgCount; i++)
+      {
+        /* Literal string stored in pool? */
+        if(((astArgCopy[i].eType == orxCOMMAND_VAR_TYPE_STRING) || (astArgCopy[i].eType == orxCOMMAND_VAR_TYPE_NUMERIC))
+        && (astArgCopy[i].zValue >= pcPool)
+        && (astArgCopy[i].zValue < pcDst))
+        {
+          /* Relocates it */
+          astArgCopy[i].zValue = pcPoolCopy + (astArgCopy[i].zValue - pcPool);
+        }
+      }
 
-            case orxCOMMAND_KC_POP_MARKER:
-            {
-              orxU32 u32Size;
+      /* Inits program */
+      pstResult->astInstructionList   = astInstructionCopy;
+      pstResult->u32InstructionNumber = u32InstructionNumber;
+      pstResult->u32Flags             = u32Flags | orxCOMMAND_PROGRAM_KU32_FLAG_VALID;
+      pstResult->zSource              = pcSourceCopy;
+    }
+  }
+  else
+  {
+    /* Allocates empty program, marking the command line as interpreted only */
+    pstResult = (orxCOMMAND_PROGRAM *)orxMemory_Allocate(sizeof(orxCOMMAND_PROGRAM) + u32SourceSize, orxMEMORY_TYPE_MAIN);
 
-              /* Gets remaining size */
-              u32Size = orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer);
+    /* Success? */
+    if(pstResult != orxNULL)
+    {
+      orxCHAR *pcSourceCopy;
 
-              /* Pops value */
-              if(orxCommand_PopValue(&pcDst, u32Size, bInBlock) == orxSTATUS_FAILURE)
-              {
-                orxU32 u32Length;
+      /* Inits it */
+      orxMemory_Zero(pstResult, sizeof(orxCOMMAND_PROGRAM));
 
-                /* Logs message */
-                orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
+      /* Stores its source */
+      pcSourceCopy = (orxCHAR *)(pstResult + 1);
+      orxMemory_Copy(pcSourceCopy, _zCommandLine, u32SourceSize);
+      pstResult->zSource = pcSourceCopy;
+    }
+  }
 
-                /* Gets error length */
-                u32Length = orxString_GetLength(orxCOMMAND_KZ_ERROR_VALUE);
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
 
-                /* Has room? */
-                if(u32Length <= u32Size)
-                {
-                  /* Replaces marker with stack error */
-                  orxString_NCopy(pcDst, orxCOMMAND_KZ_STACK_ERROR_VALUE, u32Size);
+  /* Done! */
+  return pstResult;
+}
 
-                  /* Updates pointers */
-                  pcDst += u32Length;
-                }
-              }
+/** Gets the compiled program of a command line, compiling it if needed
+ * @param[in]   _zCommandLine                 Command line
+ * @return      orxCOMMAND_PROGRAM / orxNULL
+ */
+static orxINLINE const orxCOMMAND_PROGRAM *orxCommand_GetProgram(const orxSTRING _zCommandLine)
+{
+  const orxCOMMAND_PROGRAM *pstResult = orxNULL;
 
-              break;
-            }
+  /* No pending flush? */
+  if(!orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_FLUSH))
+  {
+    /* No program table yet? */
+    if(sstCommand.pstProgramTable == orxNULL)
+    {
+      /* Creates it */
+      sstCommand.pstProgramTable = orxHashTable_Create(orxCOMMAND_KU32_PROGRAM_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    }
 
-            case orxCOMMAND_KC_SEPARATOR:
-            case orxCHAR_CR:
-            case orxCHAR_LF:
-            {
-              /* Not in block or in vector? */
-              if((bInBlock == orxFALSE)
-              && (s32VectorDepth == 0))
-              {
-                /* Stops */
-                bStop = orxTRUE;
-              }
-              else
-              {
-                /* Copies it */
-                *pcDst++ = *pcSrc;
-              }
+    /* Valid? */
+    if(sstCommand.pstProgramTable != orxNULL)
+    {
+      orxSTRINGID stID;
+      orxBOOL     bCompile = orxTRUE;
 
-              break;
-            }
+      /* Gets command line ID */
+      stID = orxString_Hash(_zCommandLine);
 
-            case orxSTRING_KC_VECTOR_START:
-            case orxSTRING_KC_VECTOR_START_ALT:
-            {
-              /* Increments vector depth */
-              s32VectorDepth++;
+      /* Gets program */
+      pstResult = (const orxCOMMAND_PROGRAM *)orxHashTable_Get(sstCommand.pstProgramTable, stID);
 
-              /* Copies it */
-              *pcDst++ = *pcSrc;
+      /* Found but compiled from another command line (hash collision)? */
+      if((pstResult != orxNULL) && (orxString_Compare(pstResult->zSource, _zCommandLine) != 0))
+      {
+        /* No running program? */
+        if(sstCommand.u32ProgramDepth == 0)
+        {
+          /* Removes it from the table */
+          orxHashTable_Remove(sstCommand.pstProgramTable, stID);
 
-              break;
-            }
+          /* Deletes it */
+          orxMemory_Free((void *)pstResult);
 
-            case orxSTRING_KC_VECTOR_END:
-            case orxSTRING_KC_VECTOR_END_ALT:
-            {
-              /* Decrements vector depth */
-              s32VectorDepth--;
+          /* Clears result, will get recompiled */
+          pstResult = orxNULL;
+        }
+        else
+        {
+          /* Clears result, command line will be interpreted as the colliding program might be running */
+          pstResult = orxNULL;
+          bCompile  = orxFALSE;
+        }
+      }
 
-              /* Copies it */
-              *pcDst++ = *pcSrc;
+      /* Not found? */
+      if((pstResult == orxNULL) && (bCompile != orxFALSE))
+      {
+        orxCOMMAND_PROGRAM *pstProgram;
 
-              break;
-            }
+        /* Full? */
+        if(orxHashTable_GetCount(sstCommand.pstProgramTable) >= orxCOMMAND_KU32_PROGRAM_MAX_NUMBER)
+        {
+          /* Flushes all programs */
+          orxCommand_FlushPrograms();
+        }
 
-            case orxCOMMAND_KC_BLOCK_MARKER:
-            {
-              /* Toggles block status */
-              bInBlock = !bInBlock;
+        /* Has room? */
+        if(orxHashTable_GetCount(sstCommand.pstProgramTable) < orxCOMMAND_KU32_PROGRAM_MAX_NUMBER)
+        {
+          /* Compiles it */
+          pstProgram = orxCommand_Compile(_zCommandLine);
 
-              /* Falls through */
+          /* Success? */
+          if(pstProgram != orxNULL)
+          {
+            /* Adds it to the table */
+            if(orxHashTable_Add(sstCommand.pstProgramTable, stID, pstProgram) != orxSTATUS_FAILURE)
+            {
+              /* Updates result */
+              pstResult = pstProgram;
             }
-
-            default:
+            else
             {
-              /* Copies it */
-              *pcDst++ = *pcSrc;
-
-              break;
+              /* Deletes it */
+              orxMemory_Free(pstProgram);
             }
           }
         }
       }
+    }
+  }
 
-      /* Copies end of string */
-      *pcDst = orxCHAR_NULL;
+  /* Done! */
+  return pstResult;
+}
 
-      /* Gets new additional offset */
-      s32Offset = (orxS32)(pcDst + 1 - sstCommand.acProcessBuffer - sstCommand.s32ProcessOffset);
+/** Converts a runtime value to the type of the argument it replaces, the same way it would have been parsed from a command line
+ * @param[in,out] _pstArg                     Argument, its type needs to be set
+ * @param[in]   _pstValue                     Runtime value
+ * @param[in,out] _ppcBuffer                  Buffer used to store string values
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxCommand_ConvertOperand(orxCOMMAND_VAR *_pstArg, const orxCOMMAND_VAR *_pstValue, orxCHAR **_ppcBuffer)
+{
+  orxCHAR         acValue[64];
+  const orxSTRING zValue;
+  orxSTATUS       eResult = orxSTATUS_SUCCESS;
 
-      /* Updates next command expression */
-      zCommand = orxString_SkipWhiteSpaces(pcSrc);
+  /* Gets literal value */
+  if((_pstValue->eType == orxCOMMAND_VAR_TYPE_STRING) || (_pstValue->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
+  {
+    zValue = _pstValue->zValue;
+  }
+  else
+  {
+    acValue[sizeof(acValue) - 1] = orxCHAR_NULL;
+    orxCommand_PrintVar(acValue, sizeof(acValue) - 1, _pstValue);
+    zValue = acValue;
+  }
+
+  /* Depending on argument type */
+  switch(_pstArg->eType)
+  {
+    default:
+    case orxCOMMAND_VAR_TYPE_STRING:
+    case orxCOMMAND_VAR_TYPE_NUMERIC:
+    {
+      orxU32 u32Length;
 
-      /* For all characters in the buffer */
-      for(pcSrc = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset, eStatus = orxSTATUS_SUCCESS, zArg = orxSTRING_EMPTY, u32ArgNumber = 0;
-          (u32ArgNumber < u32ParamNumber) && (pcSrc - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE) && (*pcSrc != orxCHAR_NULL);
-          pcSrc++, u32ArgNumber++)
+      /* Gets its length */
+      u32Length = orxString_GetLength(zValue);
+
+      /* Has room? */
+      if(*_ppcBuffer + u32Length < sstCommand.acProcessBuffer + orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
       {
-        /* Skips all whitespaces */
-        pcSrc = orxString_SkipWhiteSpaces(pcSrc);
+        /* Stores it */
+        orxMemory_Copy(*_ppcBuffer, zValue, u32Length + 1);
+        _pstArg->zValue = *_ppcBuffer;
+        *_ppcBuffer    += u32Length + 1;
+      }
+      else
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
 
-        /* Valid? */
-        if(*pcSrc != orxCHAR_NULL)
-        {
-          orxBOOL bInBlock = orxFALSE, bUseDefault = orxFALSE;
+      break;
+    }
+
+    case orxCOMMAND_VAR_TYPE_FLOAT:
+    {
+      /* Gets its value */
+      eResult = orxString_ToFloat(zValue, &(_pstArg->fValue), orxNULL);
 
-          /* Inits vector depth */
-          s32VectorDepth = ((*pcSrc == orxSTRING_KC_VECTOR_START) || (*pcSrc == orxSTRING_KC_VECTOR_START_ALT)) ? 0 : -1;
+      break;
+    }
 
-          /* Gets arg's beginning */
-          zArg = pcSrc;
+    case orxCOMMAND_VAR_TYPE_S32:
+    {
+      /* Gets its value */
+      eResult = orxString_ToS32(zValue, &(_pstArg->s32Value), orxNULL);
 
-          /* Is a block marker? */
-          if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
-          {
-            /* Updates arg pointer */
-            zArg++;
-            pcSrc++;
+      break;
+    }
 
-            /* Is an empty block? */
-            if((*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
-            && (*(pcSrc + 1) != orxCOMMAND_KC_BLOCK_MARKER))
-            {
-              /* Uses default */
-              bUseDefault = orxTRUE;
+    case orxCOMMAND_VAR_TYPE_U32:
+    {
+      /* Gets its value */
+      eResult = orxString_ToU32(zValue, &(_pstArg->u32Value), orxNULL);
 
-              /* Updates arg pointer */
-              zArg++;
-              pcSrc++;
-            }
-            else
-            {
-              /* Updates block status */
-              bInBlock = orxTRUE;
-            }
-          }
+      break;
+    }
 
-          /* Stores its type */
-          astArgList[u32ArgNumber].eType = pstCommand->astParamList[u32ArgNumber].eType;
+    case orxCOMMAND_VAR_TYPE_S64:
+    {
+      /* Gets its value */
+      eResult = orxString_ToS64(zValue, &(_pstArg->s64Value), orxNULL);
 
-          /* Depending on its type */
-          switch(pstCommand->astParamList[u32ArgNumber].eType)
-          {
-            case orxCOMMAND_VAR_TYPE_NUMERIC:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Replaces block end marker with 0 */
-                pcSrc--;
-                zArg--;
-                *((orxCHAR *)pcSrc) = '0';
+      break;
+    }
 
-                /* Falls through */
-              }
-              /* Not in block? */
-              else if(bInBlock == orxFALSE)
-              {
-                orxVECTOR vValue;
+    case orxCOMMAND_VAR_TYPE_U64:
+    {
+      /* Gets its value */
+      eResult = orxString_ToU64(zValue, &(_pstArg->u64Value), orxNULL);
 
-                /* Is a vector */
-                if(orxString_ToVector(zArg, &vValue, &pcSrc) != orxSTATUS_FAILURE)
-                {
-                  /* Stores its value */
-                  astArgList[u32ArgNumber].zValue = zArg;
+      break;
+    }
 
-                  /* Stops */
-                  break;
-                }
-                else
-                {
-                  /* Falls through */
-                }
-              }
-            }
+    case orxCOMMAND_VAR_TYPE_BOOL:
+    {
+      /* Gets its value */
+      eResult = orxString_ToBool(zValue, &(_pstArg->bValue), orxNULL);
 
-            default:
-            case orxCOMMAND_VAR_TYPE_STRING:
-            {
-              /* For all argument characters */
-              for(; *pcSrc != orxCHAR_NULL; pcSrc++)
-              {
-                orxCHAR *pcTemp;
+      break;
+    }
 
-                /* Depending on character */
-                switch(*pcSrc)
-                {
-                  case orxSTRING_KC_VECTOR_START:
-                  case orxSTRING_KC_VECTOR_START_ALT:
-                  {
-                    /* Should update? */
-                    if(s32VectorDepth >= 0)
-                    {
-                      /* Increments vector depth */
-                      s32VectorDepth++;
-                    }
-                    break;
-                  }
+    case orxCOMMAND_VAR_TYPE_VECTOR:
+    {
+      /* Gets its value */
+      eResult = orxString_ToVector(zValue, &(_pstArg->vValue), orxNULL);
 
-                  case orxSTRING_KC_VECTOR_END:
-                  case orxSTRING_KC_VECTOR_END_ALT:
-                  {
-                    /* Should update? */
-                    if(s32VectorDepth >= 0)
-                    {
-                      /* Decrements vector depth */
-                      s32VectorDepth--;
-                    }
-                    break;
-                  }
+      break;
+    }
+  }
 
-                  case orxCOMMAND_KC_BLOCK_MARKER:
-                  {
-                    /* Erases it */
-                    for(pcTemp = (orxCHAR *)pcSrc; *pcTemp != orxCHAR_NULL; pcTemp++)
-                    {
-                      *pcTemp = *(pcTemp + 1);
-                    }
+  /* Done! */
+  return eResult;
+}
 
-                    /* Not double marker? */
-                    if(*pcSrc != orxCOMMAND_KC_BLOCK_MARKER)
-                    {
-                      /* Updates block status */
-                      bInBlock = !bInBlock;
+/** Runs a compiled program
+ * @param[in]   _pstProgram                   Program to run
+ * @param[in]   _u64GUID                      GUID to use for GUID operands
+ * @param[out]  _pstResult                    Variable that will contain the result
+ * @param[in]   _zCommandLine                 Original command line, for logs
+ * @return      Command result if successful, orxNULL otherwise
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_RunProgram(const orxCOMMAND_PROGRAM *_pstProgram, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, const orxSTRING _zCommandLine)
+{
+  orxCHAR         acGUID[20];
+  orxU32          i;
+  orxCOMMAND_VAR *pstResult = orxNULL;
 
-                      /* Handles current character in new mode */
-                      pcSrc--;
-                    }
-                    continue;
-                  }
-                  default:
-                  {
-                    break;
-                  }
-                }
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxCommand_RunProgram");
 
-                /* Not in block or in vector? */
-                if((bInBlock == orxFALSE) && (s32VectorDepth <= 0))
-                {
-                  /* End of string? */
-                  if(orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE)
-                  {
-                    /* Stops */
-                    break;
-                  }
-                }
-              }
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(_pstProgram->u32Flags, orxCOMMAND_PROGRAM_KU32_FLAG_VALID));
 
-              /* Stores its value */
-              astArgList[u32ArgNumber].zValue = zArg;
+  /* Uses GUID? */
+  if(orxFLAG_TEST(_pstProgram->u32Flags, orxCOMMAND_PROGRAM_KU32_FLAG_GUID))
+  {
+    /* Checks */
+    orxASSERT(_u64GUID != orxU64_UNDEFINED);
 
-              break;
-            }
+    /* Gets its literal version */
+    orxString_NPrint(acGUID, sizeof(acGUID), "0x%016llX", _u64GUID);
+  }
 
-            case orxCOMMAND_VAR_TYPE_FLOAT:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].fValue = orxFLOAT_0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToFloat(zArg, &(astArgList[u32ArgNumber].fValue), &pcSrc);
-              }
+  /* Updates running depth */
+  sstCommand.u32ProgramDepth++;
 
-              break;
-            }
+  /* For all instructions */
+  for(i = 0; i < _pstProgram->u32InstructionNumber; i++)
+  {
+    const orxCOMMAND_INSTRUCTION *pstInstruction;
+    const orxCOMMAND_VAR         *astArgList = orxNULL;
+    const orxSTRING               zSection;
+    orxS32                        s32Offset = 0;
+    orxSTATUS                     eStatus = orxSTATUS_SUCCESS;
+    orxU32                        u32ArgIndex = 0;
+
+    /* Gets instruction */
+    pstInstruction = &(_pstProgram->astInstructionList[i]);
+
+    /* Gets named push section */
+    zSection = orxFLAG_TEST(pstInstruction->u32Flags, orxCOMMAND_INSTRUCTION_KU32_FLAG_PUSH_CURRENT)
+               ? orxConfig_GetCurrentSection()
+               : orxFLAG_TEST(pstInstruction->u32Flags, orxCOMMAND_INSTRUCTION_KU32_FLAG_PUSH_GUID)
+                 ? acGUID
+                 : pstInstruction->zPushSection;
+
+    /* Pending flush and command got unregistered by a previous instruction? */
+    if((orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_FLUSH))
+    && (orxCommand_FindNoAlias(orxString_GetFromID(pstInstruction->stNameID)) != pstInstruction->pstCommand))
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, orxString_GetFromID(pstInstruction->stNameID));
 
-            case orxCOMMAND_VAR_TYPE_S32:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].s32Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToS32(zArg, &(astArgList[u32ArgNumber].s32Value), &pcSrc);
-              }
+      /* Updates status */
+      pstResult = orxNULL;
+      eStatus   = orxSTATUS_FAILURE;
+    }
+    /* Has runtime operands? */
+    else if(orxFLAG_TEST(pstInstruction->u32Flags, orxCOMMAND_INSTRUCTION_KU32_FLAG_OPERANDS))
+    {
+      orxCOMMAND_VAR *astOperandList;
+      orxCHAR        *pcBuffer;
 
-              break;
-            }
+      /* Allocates argument list */
+      astOperandList = (orxCOMMAND_VAR *)orxMemory_StackAllocate(pstInstruction->u32ArgNumber * sizeof(orxCOMMAND_VAR));
 
-            case orxCOMMAND_VAR_TYPE_U32:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].u32Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToU32(zArg, &(astArgList[u32ArgNumber].u32Value), &pcSrc);
-              }
+      /* Copies pre-parsed arguments */
+      orxMemory_Copy(astOperandList, pstInstruction->astArgList, pstInstruction->u32ArgNumber * sizeof(orxCOMMAND_VAR));
 
-              break;
-            }
+      /* For all arguments */
+      for(pcBuffer = sstCommand.acProcessBuffer + sstCommand.s32ProcessOffset; (eStatus != orxSTATUS_FAILURE) && (u32ArgIndex < pstInstruction->u32ArgNumber); u32ArgIndex++)
+      {
+        orxCOMMAND_VAR stValue;
 
-            case orxCOMMAND_VAR_TYPE_S64:
+        /* Depending on operand */
+        switch(pstInstruction->au8OperandList[u32ArgIndex])
+        {
+          case orxCOMMAND_OPERAND_GUID:
+          {
+            /* Is U64? */
+            if(astOperandList[u32ArgIndex].eType == orxCOMMAND_VAR_TYPE_U64)
             {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].s64Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToS64(zArg, &(astArgList[u32ArgNumber].s64Value), &pcSrc);
-              }
-
-              break;
+              /* Stores it */
+              astOperandList[u32ArgIndex].u64Value = _u64GUID;
             }
-
-            case orxCOMMAND_VAR_TYPE_U64:
+            else
             {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].u64Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToU64(zArg, &(astArgList[u32ArgNumber].u64Value), &pcSrc);
-              }
-
-              break;
+              /* Converts its literal version */
+              stValue.eType   = orxCOMMAND_VAR_TYPE_STRING;
+              stValue.zValue  = acGUID;
+              eStatus         = orxCommand_ConvertOperand(&astOperandList[u32ArgIndex], &stValue, &pcBuffer);
             }
 
-            case orxCOMMAND_VAR_TYPE_BOOL:
+            break;
+          }
+
+          case orxCOMMAND_OPERAND_POP:
+          {
+            /* Has stacked value? */
+            if(orxBank_GetCount(sstCommand.pstResultBank) > 0)
             {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].bValue = orxFALSE;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToBool(zArg, &(astArgList[u32ArgNumber].bValue), &pcSrc);
-              }
+              orxCOMMAND_STACK_ENTRY *pstEntry;
 
-              break;
-            }
+              /* Gets last stack entry */
+              pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_GetAtIndex(sstCommand.pstResultBank, orxBank_GetCount(sstCommand.pstResultBank) - 1);
 
-            case orxCOMMAND_VAR_TYPE_VECTOR:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                orxVector_Copy(&(astArgList[u32ArgNumber].vValue), &orxVECTOR_0);
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToVector(zArg, &(astArgList[u32ArgNumber].vValue), &pcSrc);
-              }
+              /* Converts it */
+              eStatus = orxCommand_ConvertOperand(&astOperandList[u32ArgIndex], &(pstEntry->stValue), &pcBuffer);
 
-              break;
+              /* Deletes stack entry */
+              orxBank_Free(sstCommand.pstResultBank, pstEntry);
             }
-          }
+            else
+            {
+              /* Logs message */
+              orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
 
-          /* Interrupted? */
-          if((eStatus == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
-          {
-            /* Updates argument count */
-            u32ArgNumber++;
+              /* Converts stack error */
+              stValue.eType   = orxCOMMAND_VAR_TYPE_STRING;
+              stValue.zValue  = orxCOMMAND_KZ_STACK_ERROR_VALUE;
+              eStatus         = orxCommand_ConvertOperand(&astOperandList[u32ArgIndex], &stValue, &pcBuffer);
+            }
 
-            /* Stops processing */
             break;
           }
-          else
+
+          default:
           {
-            /* Ends current argument */
-            *(orxCHAR *)pcSrc = orxCHAR_NULL;
+            break;
           }
         }
-        else
-        {
-          /* Stops */
-          break;
-        }
       }
 
-      /* Error? */
-      if((eStatus == orxSTATUS_FAILURE) || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber))
-      {
-        /* Incorrect parameter? */
-        if(eStatus == orxSTATUS_FAILURE)
-        {
-          /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], invalid argument #%d for command [%s].", _zCommandLine, u32ArgNumber, orxString_GetFromID(pstCommand->stNameID));
-        }
-        else
-        {
-          /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], expected %d[+%d] arguments for command [%s], found %d.", _zCommandLine, (orxU32)pstCommand->u16RequiredParamNumber, (orxU32)pstCommand->u16OptionalParamNumber, orxString_GetFromID(pstCommand->stNameID), u32ArgNumber);
-        }
-      }
-      else
-      {
-        /* Runs it */
-        sstCommand.s32ProcessOffset += s32Offset;
-        pstResult = orxCommand_Run(pstCommand, orxFALSE, u32ArgNumber, astArgList, _pstResult);
-        sstCommand.s32ProcessOffset -= s32Offset;
-      }
-#undef orxCOMMAND_KU32_ALIAS_MAX_DEPTH
+      /* Gets used buffer size */
+      s32Offset   = (orxS32)(pcBuffer - sstCommand.acProcessBuffer - sstCommand.s32ProcessOffset);
+
+      /* Uses runtime argument list */
+      astArgList  = astOperandList;
     }
     else
     {
-      /* Restores command end */
-      *(orxCHAR *)pcCommandEnd = cBackupChar;
+      /* Uses pre-parsed argument list */
+      astArgList  = pstInstruction->astArgList;
+    }
 
-      /* Not silent? */
-      if(_bSilent == orxFALSE)
-      {
-        /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
-      }
+    /* Valid? */
+    if(eStatus != orxSTATUS_FAILURE)
+    {
+      /* Runs it */
+      sstCommand.s32ProcessOffset += s32Offset;
+      pstResult = orxCommand_Run(pstInstruction->pstCommand, orxFALSE, pstInstruction->u32ArgNumber, astArgList, _pstResult);
+      sstCommand.s32ProcessOffset -= s32Offset;
+    }
+    else if(astArgList != orxNULL)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s], invalid argument #%d for command [%s].", _zCommandLine, u32ArgIndex, orxString_GetFromID(pstInstruction->stNameID));
 
-      /* Stops */
-      zCommand = orxSTRING_EMPTY;
+      /* Updates result */
+      pstResult = orxNULL;
     }
 
     /* Failure? */
@@ -1436,121 +2612,18 @@ static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandL
       _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
     }
 
-    /* Has named push? */
-    if(pcValue != orxNULL)
-    {
-      /* Pushes section */
-      orxConfig_PushSection((pcSection != orxNULL) ? pcSection : orxCOMMAND_KZ_PUSH_SECTION);
-
-      /* Depending on type */
-      switch(_pstResult->eType)
-      {
-        default:
-        case orxCOMMAND_VAR_TYPE_STRING:
-        case orxCOMMAND_VAR_TYPE_NUMERIC:
-        {
-          /* Stores it */
-          orxConfig_SetString(pcValue, _pstResult->zValue);
-
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_FLOAT:
-        {
-          /* Stores it */
-          orxConfig_SetFloat(pcValue, _pstResult->fValue);
-
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_S32:
-        {
-          /* Stores it */
-          orxConfig_SetS32(pcValue, _pstResult->s32Value);
-
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_U32:
-        {
-          /* Stores it */
-          orxConfig_SetU32(pcValue, _pstResult->u32Value);
-
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_S64:
-        {
-          /* Stores it */
-          orxConfig_SetS64(pcValue, _pstResult->s64Value);
-
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_U64:
-        {
-          /* Stores it */
-          orxConfig_SetU64(pcValue, _pstResult->u64Value);
-
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_BOOL:
-        {
-          /* Stores it */
-          orxConfig_SetBool(pcValue, _pstResult->bValue);
-
-          break;
-        }
-        case orxCOMMAND_VAR_TYPE_VECTOR:
-        {
-          /* Stores it */
-          orxConfig_SetVector(pcValue, &(_pstResult->vValue));
-
-          break;
-        }
-      }
-
-      /* Pops section */
-      orxConfig_PopSection();
-    }
-    else
-    {
-      /* For all requested pushes */
-      while(u32PushCount > 0)
-      {
-        orxCOMMAND_STACK_ENTRY *pstEntry;
-
-        /* Allocates stack entry */
-        pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_Allocate(sstCommand.pstResultBank);
-
-        /* Checks */
-        orxASSERT(pstEntry != orxNULL);
-
-        /* Is a string or numeric value? */
-        if((_pstResult->eType == orxCOMMAND_VAR_TYPE_STRING)
-        || (_pstResult->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
-        {
-          /* Checks */
-          orxASSERT(orxString_GetLength(_pstResult->zValue) < orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE);
-
-          /* Duplicates it */
-          pstEntry->stValue.eType   = _pstResult->eType;
-          pstEntry->stValue.zValue  = pstEntry->acBuffer;
-          orxString_NCopy(pstEntry->acBuffer, _pstResult->zValue, sizeof(pstEntry->acBuffer) - 1);
-          pstEntry->acBuffer[sizeof(pstEntry->acBuffer) - 1] = orxCHAR_NULL;
-        }
-        else
-        {
-          /* Stores value */
-          orxMemory_Copy(&(pstEntry->stValue), _pstResult, sizeof(orxCOMMAND_VAR));
-        }
-
-        /* Updates push count */
-        u32PushCount--;
-      }
-    }
+    /* Stores result */
+    orxCommand_StoreResult(zSection, pstInstruction->zPushKey, pstInstruction->u32PushCount, _pstResult);
   }
 
-  /* Unprocessed? */
-  if(bProcessed == orxFALSE)
+  /* Updates running depth */
+  sstCommand.u32ProgramDepth--;
+
+  /* Pending flush? */
+  if((sstCommand.u32ProgramDepth == 0) && (orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_FLUSH)))
   {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_COMMAND, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+    /* Flushes all programs */
+    orxCommand_FlushPrograms();
   }
 
   /* Profiles */
@@ -1622,10 +2695,29 @@ static orxSTATUS orxFASTCALL orxCommand_EventHandler(const orxEVENT *_pstEvent)
   /* Has command? */
   if(zCommand != orxNULL)
   {
-    orxCOMMAND_VAR stResult;
+    const orxCOMMAND_PROGRAM *pstProgram;
+    orxCOMMAND_VAR            stResult;
+    orxU64                    u64GUID;
+
+    /* Gets sender's GUID */
+    u64GUID = orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender));
 
-    /* Processes it */
-    orxCommand_Process(zCommand, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
+    /* Gets its program */
+    pstProgram = orxCommand_GetProgram(zCommand);
+
+    /* Can be run? */
+    if((pstProgram != orxNULL)
+    && (orxFLAG_TEST(pstProgram->u32Flags, orxCOMMAND_PROGRAM_KU32_FLAG_VALID))
+    && ((u64GUID != orxU64_UNDEFINED) || (!orxFLAG_TEST(pstProgram->u32Flags, orxCOMMAND_PROGRAM_KU32_FLAG_GUID))))
+    {
+      /* Runs it */
+      orxCommand_RunProgram(pstProgram, u64GUID, &stResult, zCommand);
+    }
+    else
+    {
+      /* Processes it */
+      orxCommand_Process(zCommand, u64GUID, &stResult, orxTRUE);
+    }
   }
 
   /* Done! */
@@ -3442,6 +4534,59 @@ void orxFASTCALL orxCommand_CommandLogAllStructures(orxU32 _u32ArgNumber, const
   return;
 }
 
+/** Command: LogAllBanks
+ */
+void orxFASTCALL orxCommand_CommandLogAllBanks(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  orxBANK  *pstBank;
+  orxU64    u64TotalSize = 0;
+  orxU32    u32Count = 0;
+
+  /* For all banks */
+  for(pstBank = orxBank_GetNextBank(orxNULL);
+      pstBank != orxNULL;
+      pstBank = orxBank_GetNextBank(pstBank))
+  {
+    orxBANK_STATS stStats;
+
+    /* Gets its stats */
+    if(orxBank_GetStats(pstBank, &stStats) != orxSTATUS_FAILURE)
+    {
+      /* Logs them */
+      orxLOG("Bank #%03u: %6u/%6u cells (peak %6u) of %5u bytes, %4u/%4u segments, %10llu bytes, fragmentation %5.1f%%", u32Count, stStats.u32CellCount, stStats.u32SegmentCount * stStats.u32SegmentSize, stStats.u32PeakCellCount, stStats.u32CellSize, stStats.u32UsedSegmentCount, stStats.u32SegmentCount, stStats.u64Size, orx2F(100.0f) * stStats.fFragmentation);
+
+      /* Updates total size */
+      u64TotalSize += stStats.u64Size;
+    }
+
+    /* Updates count */
+    u32Count++;
+  }
+
+  /* Logs total */
+  orxLOG("%u banks, %llu bytes", u32Count, u64TotalSize);
+
+  /* Updates result */
+  _pstResult->u32Value = u32Count;
+
+  /* Done! */
+  return;
+}
+
+/** Command: CompactAllBanks
+ */
+void orxFASTCALL orxCommand_CommandCompactAllBanks(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Compacts all banks */
+  orxBank_CompactAll();
+
+  /* Updates result */
+  _pstResult->bValue = orxTRUE;
+
+  /* Done! */
+  return;
+}
+
 /** Command: GetClipboard
  */
 void orxFASTCALL orxCommand_CommandGetClipboard(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
@@ -3659,6 +4804,11 @@ static orxINLINE void orxCommand_RegisterCommands()
   /* Command: LogAllStructures */
   orxCOMMAND_REGISTER_CORE_COMMAND(Command, LogAllStructures, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"Private = false", orxCOMMAND_VAR_TYPE_STRING});
 
+  /* Command: LogAllBanks */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, LogAllBanks, "Count", orxCOMMAND_VAR_TYPE_U32, 0, 0);
+  /* Command: CompactAllBanks */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Command, CompactAllBanks, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
+
   /* Command: GetClipboard */
   orxCOMMAND_REGISTER_CORE_COMMAND(Command, GetClipboard, "Content", orxCOMMAND_VAR_TYPE_STRING, 0, 0);
   /* Command: SetClipboard */
@@ -3884,6 +5034,11 @@ static orxINLINE void orxCommand_RegisterCommands()
   /* Alias: Structure.LogAll */
   orxCommand_AddAlias("Structure.LogAll", "Command.LogAllStructures", orxNULL);
 
+  /* Alias: Bank.LogAll */
+  orxCommand_AddAlias("Bank.LogAll", "Command.LogAllBanks", orxNULL);
+  /* Alias: Bank.CompactAll */
+  orxCommand_AddAlias("Bank.CompactAll", "Command.CompactAllBanks", orxNULL);
+
   /* Alias: Clipboard.Get */
   orxCommand_AddAlias("Clipboard.Get", "Command.GetClipboard", orxNULL);
   /* Alias: Clipboard.Set */
@@ -4117,6 +5272,11 @@ static orxINLINE void orxCommand_UnregisterCommands()
   /* Alias: Structure.LogAll */
   orxCommand_RemoveAlias("Structure.LogAll");
 
+  /* Alias: Bank.LogAll */
+  orxCommand_RemoveAlias("Bank.LogAll");
+  /* Alias: Bank.CompactAll */
+  orxCommand_RemoveAlias("Bank.CompactAll");
+
   /* Alias: Clipboard.Get */
   orxCommand_RemoveAlias("Clipboard.Get");
   /* Alias: Clipboard.Set */
@@ -4265,6 +5425,11 @@ static orxINLINE void orxCommand_UnregisterCommands()
   /* Command: LogAllStructures */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, LogAllStructures);
 
+  /* Command: LogAllBanks */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, LogAllBanks);
+  /* Command: CompactAllBanks */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, CompactAllBanks);
+
   /* Command: GetClipboard */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Command, GetClipboard);
   /* Command: SetClipboard */
@@ -4444,6 +5609,17 @@ void orxFASTCALL orxCommand_Exit()
     /* Unregisters commands */
     orxCommand_UnregisterCommands();
 
+    /* Has program table? */
+    if(sstCommand.pstProgramTable != orxNULL)
+    {
+      /* Flushes all programs */
+      orxCommand_FlushPrograms();
+
+      /* Deletes table */
+      orxHashTable_Delete(sstCommand.pstProgramTable);
+      sstCommand.pstProgramTable = orxNULL;
+    }
+
     /* Clears trie */
     orxTree_Clean(&(sstCommand.stCommandTrie));
 
@@ -4571,6 +5747,13 @@ orxSTATUS orxFASTCALL orxCommand_Register(const orxSTRING _zCommand, const orxCO
     }
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Flushes all programs */
+    orxCommand_FlushPrograms();
+  }
+
   /* Done! */
   return eResult;
 }
@@ -4616,6 +5799,13 @@ orxSTATUS orxFASTCALL orxCommand_Unregister(const orxSTRING _zCommand)
     }
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Flushes all programs */
+    orxCommand_FlushPrograms();
+  }
+
   /* Done! */
   return eResult;
 }
@@ -4772,6 +5962,13 @@ orxSTATUS orxFASTCALL orxCommand_AddAlias(const orxSTRING _zAlias, const orxSTRI
     }
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Flushes all programs */
+    orxCommand_FlushPrograms();
+  }
+
   /* Done! */
   return eResult;
 }
@@ -4832,6 +6029,13 @@ orxSTATUS orxFASTCALL orxCommand_RemoveAlias(const orxSTRING _zAlias)
     }
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Flushes all programs */
+    orxCommand_FlushPrograms();
+  }
+
   /* Done! */
   return eResult;
 }
@@ -5137,17 +6341,33 @@ orxCOMMAND_VAR *orxFASTCALL orxCommand_EvaluateWithGUID(const orxSTRING _zComman
   /* Valid? */
   if((_zCommandLine != orxNULL) && (*_zCommandLine != orxCHAR_NULL))
   {
-    orxS32 s32Offset;
+    const orxCOMMAND_PROGRAM *pstProgram;
+
+    /* Gets its program */
+    pstProgram = orxCommand_GetProgram(_zCommandLine);
+
+    /* Can be run? */
+    if((pstProgram != orxNULL)
+    && (orxFLAG_TEST(pstProgram->u32Flags, orxCOMMAND_PROGRAM_KU32_FLAG_VALID))
+    && ((_u64GUID != orxU64_UNDEFINED) || (!orxFLAG_TEST(pstProgram->u32Flags, orxCOMMAND_PROGRAM_KU32_FLAG_GUID))))
+    {
+      /* Runs it */
+      pstResult = orxCommand_RunProgram(pstProgram, _u64GUID, _pstResult, _zCommandLine);
+    }
+    else
+    {
+      orxS32 s32Offset;
 
-    /* Stores it in buffer */
-    s32Offset = orxString_NPrint(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset, sizeof(sstCommand.acEvaluateBuffer) - sstCommand.s32EvaluateOffset, "%s", _zCommandLine) + 1;
-    sstCommand.s32EvaluateOffset += s32Offset;
+      /* Stores it in buffer */
+      s32Offset = orxString_NPrint(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset, sizeof(sstCommand.acEvaluateBuffer) - sstCommand.s32EvaluateOffset, "%s", _zCommandLine) + 1;
+      sstCommand.s32EvaluateOffset += s32Offset;
 
-    /* Processes it */
-    pstResult = orxCommand_Process(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset - s32Offset, _u64GUID, _pstResult, orxFALSE);
+      /* Processes it */
+      pstResult = orxCommand_Process(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset - s32Offset, _u64GUID, _pstResult, orxFALSE);
 
-    /* Restores buffer offset */
-    sstCommand.s32EvaluateOffset -= s32Offset;
+      /* Restores buffer offset */
+      sstCommand.s32EvaluateOffset -= s32Offset;
+    }
   }
 
   /* Done! */
@@ -72,6 +72,7 @@
 #define orxCONFIG_KU32_STATIC_FLAG_HISTORY        0x00000002  /**< Keep history flag */
 #define orxCONFIG_KU32_STATIC_FLAG_TYPO_CHECK     0x00000004  /**< Typo check flag */
 #define orxCONFIG_KU32_STATIC_FLAG_FOR_ALL_KEYS   0x00000008  /**< For all keys flag */
+#define orxCONFIG_KU32_STATIC_FLAG_RESOLVE_CACHE  0x00000010  /**< Resolve cache flag */
 
 #define orxCONFIG_KU32_STATIC_MASK_ALL            0xFFFFFFFF  /**< All mask */
 
@@ -86,15 +87,25 @@
 #define orxCONFIG_VALUE_KU16_FLAG_SELF_VALUE      0x0010      /**< Self value flag */
 #define orxCONFIG_VALUE_KU16_FLAG_COMMAND         0x0020      /**< Command flag */
 #define orxCONFIG_VALUE_KU16_FLAG_ALLOCATION      0x0040      /**< Allocation flag */
+#define orxCONFIG_VALUE_KU16_FLAG_STALE           0x0080      /**< Stale flag (file reload) */
 
 #define orxCONFIG_VALUE_KU16_MASK_ALL             0xFFFF      /**< All mask */
 
+#define orxCONFIG_SECTION_KU32_FLAG_NONE          0x00000000  /**< No flags */
+
+#define orxCONFIG_SECTION_KU32_FLAG_REFERENCE     0x00000001  /**< Has values inherited from other sections flag */
+
+#define orxCONFIG_SECTION_KU32_MASK_ALL           0xFFFFFFFF  /**< All mask */
+
 /** Defines
  */
 #define orxCONFIG_KU32_SECTION_BANK_SIZE          2048        /**< Default section bank size */
 #define orxCONFIG_KU32_ENTRY_BANK_SIZE            16384       /**< Default entry bank size */
 #define orxCONFIG_KU32_HISTORY_BANK_SIZE          32          /**< Default history bank size */
+#define orxCONFIG_KU32_CHANGE_BANK_SIZE           128         /**< Default change bank size */
 #define orxCONFIG_KU32_KEY_TABLE_SIZE             128         /**< Default key table size */
+#define orxCONFIG_KU32_SECTION_INDEX_THRESHOLD    16          /**< Entry count above which a section gets indexed */
+#define orxCONFIG_KU32_RESOLVE_CACHE_SIZE         16          /**< Default resolve cache table size */
 #define orxCONFIG_KU32_BASE_FILENAME_LENGTH       256         /**< Base file name length */
 #define orxCONFIG_KU32_STACK_SIZE                 64          /**< Section stack size */
 
@@ -122,6 +133,7 @@
 
 #define orxCONFIG_KZ_CONFIG_SECTION               "Config"    /**< Config section name */
 #define orxCONFIG_KZ_CONFIG_DEFAULT_PARENT        "DefaultParent" /**< Default parent for sections */
+#define orxCONFIG_KZ_CONFIG_RESOLVE_CACHE         "ResolveCache" /**< Resolve cache property */
 
 #define orxCONFIG_KZ_CONFIG_SECTION_SYSTEM        "System"    /**< System section name */
 #define orxCONFIG_KZ_CONFIG_BITS                  "Bits"      /**< Bits property */
@@ -134,6 +146,10 @@
 #define orxCONFIG_KZ_DEFAULT_ENCRYPTION_KEY       "Orx Default Encryption Key =)" /**< Orx default encryption key */
 #define orxCONFIG_KZ_ENCRYPTION_TAG               "OECF"      /**< Encryption file tag */
 #define orxCONFIG_KU32_ENCRYPTION_TAG_LENGTH      4           /**< Encryption file tag length */
+#define orxCONFIG_KZ_BINARY_TAG                   "OBCF"      /**< Binary file tag */
+#define orxCONFIG_KU32_BINARY_TAG_LENGTH          4           /**< Binary file tag length */
+#define orxCONFIG_KU32_BINARY_VERSION             1           /**< Binary file version */
+#define orxCONFIG_KU32_BINARY_ENDIANNESS          0x01020304  /**< Binary file endianness marker */
 
 #define orxCONFIG_KZ_UTF8_BOM                     "\xEF\xBB\xBF" /**< UTF-8 BOM */
 #define orxCONFIG_KU32_UTF8_BOM_LENGTH            3           /**< UTF-8 BOM length */
@@ -357,9 +373,68 @@ typedef struct __orxCONFIG_SECTION_t
   orxLINKLIST       stEntryList;            /**< Entry list : 32 */
   orxS32            s32ProtectionCount;     /**< Protection count : 36 */
   orxSTRINGID       stOriginID;             /**< Origin : 40 */
+  orxHASHTABLE     *pstEntryTable;          /**< Entry table (lazily created) : 44 */
+  orxHASHTABLE     *pstCacheTable;          /**< Resolved value cache (lazily created) : 48 */
+  orxU32            u32CacheGeneration;     /**< Resolved value cache generation : 52 */
+  orxU32            u32Stamp;               /**< Generation of its last modification : 56 */
+  orxU32            u32Flags;               /**< Flags : 60 */
 
 } orxCONFIG_SECTION;
 
+/** Config change structure (file reload)
+ */
+typedef struct __orxCONFIG_CHANGE_t
+{
+  const orxSTRING   zSectionName;           /**< Section name : 4 */
+  orxSTRINGID       stKeyID;                /**< Key ID, orxSTRINGID_UNDEFINED for section changes : 12 */
+  orxCONFIG_EVENT   eEventID;               /**< Event ID : 16 */
+
+} orxCONFIG_CHANGE;
+
+/** Binary config header structure
+ */
+typedef struct __orxCONFIG_BINARY_HEADER_t
+{
+  orxCHAR           acTag[orxCONFIG_KU32_BINARY_TAG_LENGTH]; /**< Tag : 4 */
+  orxU32            u32Version;             /**< Version : 8 */
+  orxU32            u32Endianness;          /**< Endianness marker : 12 */
+  orxU32            u32EntrySize;           /**< Entry record size : 16 */
+  orxU32            u32SectionCount;        /**< Section count : 20 */
+  orxU32            u32EntryCount;          /**< Entry count : 24 */
+  orxU32            u32IndexCount;          /**< List index count : 28 */
+  orxU32            u32PoolSize;            /**< String pool size : 32 */
+
+} orxCONFIG_BINARY_HEADER;
+
+/** Binary config section record structure
+ */
+typedef struct __orxCONFIG_BINARY_SECTION_t
+{
+  orxU32            u32NameOffset;          /**< Name (with inheritance) offset in string pool : 4 */
+  orxU32            u32EntryCount;          /**< Entry count : 8 */
+
+} orxCONFIG_BINARY_SECTION;
+
+/** Binary config entry record structure
+ */
+typedef struct __orxCONFIG_BINARY_ENTRY_t
+{
+  orxSTRINGID       stID;                   /**< Key ID : 8 */
+  orxU32            u32KeyOffset;           /**< Key offset in string pool : 12 */
+  orxU32            u32ValueOffset;         /**< Value offset in string pool : 16 */
+  orxU32            u32ValueSize;           /**< Value size, including inner list separators : 20 */
+  orxU32            u32IndexOffset;         /**< List index offset : 24 */
+  orxU16            u16Type;                /**< Value type : 26 */
+  orxU16            u16Flags;               /**< Value flags : 28 */
+  orxU16            u16ListCount;           /**< List count : 30 */
+  orxU16            u16CacheIndex;          /**< Cache index : 32 */
+  orxVECTOR         vValue;                 /**< Cached value : 44 */
+  orxVECTOR         vAltValue;              /**< Cached alternate value : 56 */
+  orxVECTOR         vStepValue;             /**< Cached step value : 68 */
+  orxU32            u32Padding;             /**< Padding : 72 */
+
+} orxCONFIG_BINARY_ENTRY;
+
 /** Static structure
  */
 typedef struct __orxCONFIG_STATIC_t
@@ -381,6 +456,11 @@ typedef struct __orxCONFIG_STATIC_t
   orxHASHTABLE       *pstSectionTable;      /**< Section table */
   orxHASHTABLE       *pstKeyTable;          /**< Key table */
   orxCONFIG_SECTION  *pstDefaultParent;     /**< Default parent section */
+  orxBANK            *pstChangeBank;        /**< Change bank (file reload) */
+  orxU32              u32CacheGeneration;   /**< Resolved value cache generation */
+  orxU32              u32GlobalStamp;       /**< Generation of the last modification affecting all sections */
+  orxU32              u32CacheHitCount;     /**< Resolved value cache hit count */
+  orxU32              u32CacheMissCount;    /**< Resolved value cache miss count */
   orxU32              u32CurrentStackEntry; /**< Current stack entry */
   orxCONFIG_SECTION*  apstSectionStack[orxCONFIG_KU32_STACK_SIZE]; /**< Section stack */
   orxCHAR             acCommandBuffer[orxCONFIG_KU32_COMMAND_BUFFER_SIZE]; /**< Command buffer */
@@ -699,6 +779,177 @@ static orxINLINE void orxConfig_CleanValue(orxCONFIG_VALUE *_pstValue)
   return;
 }
 
+/** Invalidates all resolved value caches
+ * @param[in] _pstSection       Modified section, orxNULL if the modification affects all sections
+ */
+static orxINLINE void orxConfig_InvalidateCache(orxCONFIG_SECTION *_pstSection)
+{
+  /* Updates generation */
+  sstConfig.u32CacheGeneration++;
+
+  /* Single section? */
+  if(_pstSection != orxNULL)
+  {
+    /* Stamps it */
+    _pstSection->u32Stamp = sstConfig.u32CacheGeneration;
+  }
+  else
+  {
+    /* Stamps all sections */
+    sstConfig.u32GlobalStamp = sstConfig.u32CacheGeneration;
+  }
+
+  return;
+}
+
+/** Gets the next ancestor of a section, the default parent being only considered once
+ * @param[in] _pstSection       Concerned section
+ * @param[in,out] _pbUseDefault Can the default parent be used? Cleared once it has been
+ * @return Next ancestor / orxNULL
+ */
+static orxINLINE orxCONFIG_SECTION *orxConfig_GetNextAncestor(const orxCONFIG_SECTION *_pstSection, orxBOOL *_pbUseDefault)
+{
+  orxCONFIG_SECTION *pstResult;
+
+  /* Has parent? */
+  if(_pstSection->pstParent != orxNULL)
+  {
+    /* Updates result */
+    pstResult = (_pstSection->pstParent != orxHANDLE_UNDEFINED) ? _pstSection->pstParent : orxNULL;
+  }
+  /* Can use default parent? */
+  else if((*_pbUseDefault != orxFALSE) && (_pstSection != sstConfig.pstDefaultParent))
+  {
+    /* Updates result */
+    pstResult       = sstConfig.pstDefaultParent;
+    *_pbUseDefault  = orxFALSE;
+  }
+  else
+  {
+    /* Updates result */
+    pstResult = orxNULL;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes a section's resolved value cache
+ * @param[in] _pstSection       Concerned section
+ */
+static orxINLINE void orxConfig_DeleteCacheTable(orxCONFIG_SECTION *_pstSection)
+{
+  /* Checks */
+  orxASSERT(_pstSection != orxNULL);
+
+  /* Has cache table? */
+  if(_pstSection->pstCacheTable != orxNULL)
+  {
+    /* Deletes it */
+    orxHashTable_Delete(_pstSection->pstCacheTable);
+    _pstSection->pstCacheTable = orxNULL;
+  }
+
+  return;
+}
+
+/** Adds an entry to a section, indexing it if the section is large enough
+ * @param[in] _pstSection       Concerned section
+ * @param[in] _pstEntry         Entry to add
+ */
+static orxINLINE void orxConfig_AddEntry(orxCONFIG_SECTION *_pstSection, orxCONFIG_ENTRY *_pstEntry)
+{
+  /* Checks */
+  orxASSERT(_pstSection != orxNULL);
+  orxASSERT(_pstEntry != orxNULL);
+
+  /* Invalidates caches */
+  orxConfig_InvalidateCache(_pstSection);
+
+  /* Adds it to list */
+  orxMemory_Zero(&(_pstEntry->stNode), sizeof(orxLINKLIST_NODE));
+  orxLinkList_AddEnd(&(_pstSection->stEntryList), &(_pstEntry->stNode));
+
+  /* Already indexed? */
+  if(_pstSection->pstEntryTable != orxNULL)
+  {
+    /* Adds it to table */
+    orxHashTable_Add(_pstSection->pstEntryTable, (orxU64)_pstEntry->stID, _pstEntry);
+  }
+  /* Large enough? */
+  else if(orxLinkList_GetCount(&(_pstSection->stEntryList)) >= orxCONFIG_KU32_SECTION_INDEX_THRESHOLD)
+  {
+    /* Creates entry table */
+    _pstSection->pstEntryTable = orxHashTable_Create(orxCONFIG_KU32_SECTION_INDEX_THRESHOLD << 1, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_CONFIG);
+
+    /* Success? */
+    if(_pstSection->pstEntryTable != orxNULL)
+    {
+      orxCONFIG_ENTRY *pstEntry;
+
+      /* For all entries */
+      for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(_pstSection->stEntryList));
+          pstEntry != orxNULL;
+          pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+      {
+        /* Adds it to table */
+        orxHashTable_Add(_pstSection->pstEntryTable, (orxU64)pstEntry->stID, pstEntry);
+      }
+    }
+  }
+
+  return;
+}
+
+/** Removes an entry from its section
+ * @param[in] _pstEntry         Entry to remove
+ */
+static orxINLINE void orxConfig_RemoveEntry(orxCONFIG_ENTRY *_pstEntry)
+{
+  orxCONFIG_SECTION *pstSection;
+
+  /* Checks */
+  orxASSERT(_pstEntry != orxNULL);
+  orxASSERT(orxLinkList_GetList(&(_pstEntry->stNode)) != orxNULL);
+
+  /* Gets its section */
+  pstSection = orxSTRUCT_GET_FROM_FIELD(orxCONFIG_SECTION, stEntryList, orxLinkList_GetList(&(_pstEntry->stNode)));
+
+  /* Invalidates caches */
+  orxConfig_InvalidateCache(pstSection);
+
+  /* Indexed? */
+  if(pstSection->pstEntryTable != orxNULL)
+  {
+    /* Removes it from table */
+    orxHashTable_Remove(pstSection->pstEntryTable, (orxU64)_pstEntry->stID);
+  }
+
+  /* Removes it from list */
+  orxLinkList_Remove(&(_pstEntry->stNode));
+
+  return;
+}
+
+/** Deletes a section's entry table
+ * @param[in] _pstSection       Concerned section
+ */
+static orxINLINE void orxConfig_DeleteEntryTable(orxCONFIG_SECTION *_pstSection)
+{
+  /* Checks */
+  orxASSERT(_pstSection != orxNULL);
+
+  /* Has entry table? */
+  if(_pstSection->pstEntryTable != orxNULL)
+  {
+    /* Deletes it */
+    orxHashTable_Delete(_pstSection->pstEntryTable);
+    _pstSection->pstEntryTable = orxNULL;
+  }
+
+  return;
+}
+
 /** Deletes an entry
  * @param[in] _pstEntry         Entry to delete
  */
@@ -710,8 +961,8 @@ static orxINLINE void orxConfig_DeleteEntry(orxCONFIG_ENTRY *_pstEntry)
   /* Deletes value */
   orxConfig_CleanValue(&(_pstEntry->stValue));
 
-  /* Removes it from list */
-  orxLinkList_Remove(&(_pstEntry->stNode));
+  /* Removes it from its section */
+  orxConfig_RemoveEntry(_pstEntry);
 
   /* Deletes the entry */
   orxBank_Free(sstConfig.pstEntryBank, _pstEntry);
@@ -719,6 +970,127 @@ static orxINLINE void orxConfig_DeleteEntry(orxCONFIG_ENTRY *_pstEntry)
   return;
 }
 
+/** Gets a value hash, used to detect modifications when reloading a file
+ * @param[in] _pstValue         Concerned config value
+ * @return                      Value hash
+ */
+static orxSTRINGID orxFASTCALL orxConfig_GetValueHash(const orxCONFIG_VALUE *_pstValue)
+{
+  orxSTRINGID stResult;
+  orxU32      i;
+
+  /* For all items */
+  for(i = 0, stResult = (orxSTRINGID)(_pstValue->u16Flags & ~(orxCONFIG_VALUE_KU16_FLAG_ALLOCATION | orxCONFIG_VALUE_KU16_FLAG_STALE));
+      i < (orxU32)_pstValue->u16ListCount;
+      i++)
+  {
+    /* Combines its hash */
+    stResult = (stResult * 31) ^ orxString_Hash((i == 0) ? _pstValue->zValue : _pstValue->zValue + _pstValue->au32ListIndexTable[i - 1]);
+  }
+
+  /* Done! */
+  return stResult;
+}
+
+/** Records a change while reloading a file
+ * @param[in] _pstSection       Concerned section
+ * @param[in] _stKeyID          Concerned key ID, orxSTRINGID_UNDEFINED for a section change
+ * @param[in] _eEventID         Event to send once the reload is complete
+ */
+static orxINLINE void orxConfig_RecordChange(const orxCONFIG_SECTION *_pstSection, orxSTRINGID _stKeyID, orxCONFIG_EVENT _eEventID)
+{
+  /* Reloading? */
+  if(sstConfig.pstChangeBank != orxNULL)
+  {
+    orxCONFIG_CHANGE *pstChange;
+
+    /* Allocates change */
+    pstChange = (orxCONFIG_CHANGE *)orxBank_Allocate(sstConfig.pstChangeBank);
+
+    /* Success? */
+    if(pstChange != orxNULL)
+    {
+      /* Inits it */
+      pstChange->zSectionName = _pstSection->zName;
+      pstChange->stKeyID      = _stKeyID;
+      pstChange->eEventID     = _eEventID;
+    }
+  }
+
+  return;
+}
+
+/** Sends all the events recorded while reloading a file
+ * @param[in] _pstChangeBank    Bank containing all the recorded changes
+ * @param[in] _zFileName        Name of the reloaded file
+ */
+static void orxFASTCALL orxConfig_SendChangeEvents(orxBANK *_pstChangeBank, const orxSTRING _zFileName)
+{
+  orxCONFIG_EVENT_PAYLOAD stPayload;
+  orxHASHTABLE           *pstSectionTable;
+  orxCONFIG_CHANGE       *pstChange;
+
+  /* Inits payload */
+  orxMemory_Zero(&stPayload, sizeof(orxCONFIG_EVENT_PAYLOAD));
+  stPayload.zFileName = _zFileName;
+
+  /* For all changes */
+  for(pstChange = (orxCONFIG_CHANGE *)orxBank_GetNext(_pstChangeBank, orxNULL);
+      pstChange != orxNULL;
+      pstChange = (orxCONFIG_CHANGE *)orxBank_GetNext(_pstChangeBank, pstChange))
+  {
+    /* Key change? */
+    if(pstChange->stKeyID != orxSTRINGID_UNDEFINED)
+    {
+      /* Updates payload */
+      stPayload.zSectionName  = pstChange->zSectionName;
+      stPayload.zKey          = orxString_GetFromID(pstChange->stKeyID);
+
+      /* Sends event */
+      orxEVENT_SEND(orxEVENT_TYPE_CONFIG, pstChange->eEventID, orxNULL, orxNULL, &stPayload);
+    }
+  }
+
+  /* Creates section table */
+  pstSectionTable = orxHashTable_Create(orxBank_GetCount(_pstChangeBank) + 1, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if(pstSectionTable != orxNULL)
+  {
+    /* Clears key */
+    stPayload.zKey = orxNULL;
+
+    /* For all changes */
+    for(pstChange = (orxCONFIG_CHANGE *)orxBank_GetNext(_pstChangeBank, orxNULL);
+        pstChange != orxNULL;
+        pstChange = (orxCONFIG_CHANGE *)orxBank_GetNext(_pstChangeBank, pstChange))
+    {
+      orxSTRINGID stSectionID;
+
+      /* Gets section ID */
+      stSectionID = orxString_Hash(pstChange->zSectionName);
+
+      /* Not already notified? */
+      if(orxHashTable_Get(pstSectionTable, (orxU64)stSectionID) == orxNULL)
+      {
+        /* Marks it */
+        orxHashTable_Add(pstSectionTable, (orxU64)stSectionID, pstChange);
+
+        /* Updates payload */
+        stPayload.zSectionName = pstChange->zSectionName;
+
+        /* Sends event */
+        orxEVENT_SEND(orxEVENT_TYPE_CONFIG, orxCONFIG_EVENT_SECTION_UPDATE, orxNULL, orxNULL, &stPayload);
+      }
+    }
+
+    /* Deletes section table */
+    orxHashTable_Delete(pstSectionTable);
+  }
+
+  return;
+}
+
 /** Event handler
  */
 static orxSTATUS orxFASTCALL orxConfig_EventHandler(const orxEVENT *_pstEvent)
@@ -735,7 +1107,41 @@ static orxSTATUS orxFASTCALL orxConfig_EventHandler(const orxEVENT *_pstEvent)
   /* Is config group? */
   if(pstPayload->stGroupID == sstConfig.stResourceGroupID)
   {
-    orxCONFIG_SECTION *pstSection;
+    orxCONFIG_SECTION  *pstSection;
+    const orxSTRING     zFileName;
+
+    /* Checks */
+    orxASSERT(sstConfig.pstChangeBank == orxNULL);
+
+    /* Gets file name */
+    zFileName = orxString_GetFromID(pstPayload->stNameID);
+
+    /* Creates change bank */
+    sstConfig.pstChangeBank = orxBank_Create(orxCONFIG_KU32_CHANGE_BANK_SIZE, sizeof(orxCONFIG_CHANGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
+    /* For all sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstSection != orxNULL;
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      orxCONFIG_ENTRY *pstEntry;
+
+      /* For all entries */
+      for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+          pstEntry != orxNULL;
+          pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+      {
+        /* Comes from this file? */
+        if(pstEntry->stOriginID == pstPayload->stNameID)
+        {
+          /* Marks it as stale, it'll get refreshed when the file is reloaded */
+          orxFLAG_SET(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_STALE, orxCONFIG_VALUE_KU16_FLAG_NONE);
+        }
+      }
+    }
+
+    /* Reloads file */
+    orxConfig_Load(zFileName);
 
     /* For all sections */
     for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
@@ -752,17 +1158,35 @@ static orxSTATUS orxFASTCALL orxConfig_EventHandler(const orxEVENT *_pstEvent)
         /* Gets next entry */
         pstNextEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode));
 
-        /* Should get cleaned? */
-        if(pstEntry->stOriginID == pstPayload->stNameID)
+        /* Still stale (removed from file)? */
+        if(orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_STALE))
         {
+          /* Records change */
+          orxConfig_RecordChange(pstSection, pstEntry->stID, orxCONFIG_EVENT_KEY_REMOVE);
+
           /* Deletes it */
           orxConfig_DeleteEntry(pstEntry);
         }
       }
     }
 
-    /* Reloads file */
-    orxConfig_Load(orxString_GetFromID(pstPayload->stNameID));
+    /* Has change bank? */
+    if(sstConfig.pstChangeBank != orxNULL)
+    {
+      orxBANK *pstChangeBank;
+
+      /* Gets it */
+      pstChangeBank = sstConfig.pstChangeBank;
+
+      /* Ends reload, in case event handlers would modify config */
+      sstConfig.pstChangeBank = orxNULL;
+
+      /* Sends all events */
+      orxConfig_SendChangeEvents(pstChangeBank, zFileName);
+
+      /* Deletes change bank */
+      orxBank_Delete(pstChangeBank);
+    }
   }
 
   /* Done! */
@@ -1368,18 +1792,27 @@ static orxINLINE orxCONFIG_ENTRY *orxConfig_GetEntry(orxSTRINGID _stKeyID)
   /* Checks */
   orxASSERT(sstConfig.pstCurrentSection != orxNULL);
 
-  /* For all entries */
-  for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(sstConfig.pstCurrentSection->stEntryList));
-      pstEntry != orxNULL;
-      pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+  /* Indexed? */
+  if(sstConfig.pstCurrentSection->pstEntryTable != orxNULL)
   {
-    /* Found? */
-    if(_stKeyID == pstEntry->stID)
+    /* Gets entry from table */
+    pstResult = (orxCONFIG_ENTRY *)orxHashTable_Get(sstConfig.pstCurrentSection->pstEntryTable, (orxU64)_stKeyID);
+  }
+  else
+  {
+    /* For all entries */
+    for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(sstConfig.pstCurrentSection->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
     {
-      /* Updates result */
-      pstResult = pstEntry;
+      /* Found? */
+      if(_stKeyID == pstEntry->stID)
+      {
+        /* Updates result */
+        pstResult = pstEntry;
 
-      break;
+        break;
+      }
     }
   }
 
@@ -1651,52 +2084,164 @@ static orxBOOL orxFASTCALL orxConfig_CheckTypo(const orxSTRING _zKeyName, const
   return bResult;
 }
 
-/** Gets a value from the current section, using inheritance
- * @param[in] _zKeyID           Entry key
+/** Gets a value from the current section, using inheritance and its resolved value cache
+ * @param[in] _stKeyID          Entry key ID
  * @return                      orxCONFIG_VALUE / orxNULL
  */
-static orxINLINE orxCONFIG_VALUE *orxConfig_GetValue(const orxSTRING _zKey)
+static orxCONFIG_VALUE *orxFASTCALL orxConfig_GetCachedValue(orxSTRINGID _stKeyID)
 {
-  orxCONFIG_VALUE *pstResult = orxNULL;
-
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxConfig_GetValue");
+  orxCONFIG_SECTION  *pstSection;
+  void               *pCachedValue = orxNULL;
+  orxCONFIG_VALUE    *pstResult;
 
   /* Checks */
   orxASSERT(sstConfig.pstCurrentSection != orxNULL);
 
-  /* Valid? */
-  if((_zKey != orxNULL) && (*_zKey != orxCHAR_NULL))
+  /* Gets current section */
+  pstSection = sstConfig.pstCurrentSection;
+
+  /* Outdated cache? */
+  if(pstSection->u32CacheGeneration != sstConfig.u32CacheGeneration)
+  {
+    /* Has cache table? */
+    if(pstSection->pstCacheTable != orxNULL)
+    {
+      /* Clears it */
+      orxHashTable_Clear(pstSection->pstCacheTable);
+    }
+
+    /* Updates its generation */
+    pstSection->u32CacheGeneration = sstConfig.u32CacheGeneration;
+  }
+  else if(pstSection->pstCacheTable != orxNULL)
+  {
+    /* Gets cached value */
+    pCachedValue = orxHashTable_Get(pstSection->pstCacheTable, (orxU64)_stKeyID);
+  }
+
+  /* Hit? */
+  if(pCachedValue != orxNULL)
+  {
+    /* Updates result */
+    pstResult = (pCachedValue != orxHANDLE_UNDEFINED) ? (orxCONFIG_VALUE *)pCachedValue : orxNULL;
+
+    /* Updates hit count */
+    sstConfig.u32CacheHitCount++;
+  }
+  else
   {
     orxCONFIG_SECTION  *pstDummy = orxNULL;
-    orxSTRINGID         stID;
+    orxU32              u32Generation;
 
-    /* Gets its ID */
-    stID = orxString_Hash(_zKey);
+    /* Backups generation */
+    u32Generation = sstConfig.u32CacheGeneration;
 
     /* Gets value */
-    pstResult = orxConfig_GetValueFromKey(stID, sstConfig.pstCurrentSection, &pstDummy);
-
-#ifdef __orxDEBUG__
+    pstResult = orxConfig_GetValueFromKey(_stKeyID, pstSection, &pstDummy);
 
-    /* Should check? */
-    if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_TYPO_CHECK))
+    /* Wasn't config modified during resolution? */
+    if(u32Generation == sstConfig.u32CacheGeneration)
     {
-      /* Not found? */
-      if(pstResult == orxNULL)
+      /* No cache table yet? */
+      if(pstSection->pstCacheTable == orxNULL)
       {
-        /* For all entries */
-        orxConfig_ForAllKeys(orxConfig_CheckTypo, orxTRUE, (void *)_zKey);
+        /* Creates it */
+        pstSection->pstCacheTable = orxHashTable_Create(orxCONFIG_KU32_RESOLVE_CACHE_SIZE, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_CONFIG);
       }
-    }
 
-#endif /* __orxDEBUG__ */
+      /* Valid? */
+      if(pstSection->pstCacheTable != orxNULL)
+      {
+        /* Stores resolved value (orxHANDLE_UNDEFINED for missing ones) */
+        orxHashTable_Add(pstSection->pstCacheTable, (orxU64)_stKeyID, (pstResult != orxNULL) ? (void *)pstResult : orxHANDLE_UNDEFINED);
+      }
+    }
 
+    /* Updates miss count */
+    sstConfig.u32CacheMissCount++;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets a value from the current section, using inheritance
+ * @param[in] _stKeyID          Entry key ID
+ * @param[in] _zKey             Entry key, used for typo checks only (orxNULL: retrieved from ID)
+ * @return                      orxCONFIG_VALUE / orxNULL
+ */
+static orxINLINE orxCONFIG_VALUE *orxConfig_GetValueByID(orxSTRINGID _stKeyID, const orxSTRING _zKey)
+{
+  orxCONFIG_VALUE *pstResult;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_GetValue");
+
+  /* Checks */
+  orxASSERT(sstConfig.pstCurrentSection != orxNULL);
+
+  /* Uses resolve cache? */
+  if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_RESOLVE_CACHE))
+  {
+    /* Gets cached value */
+    pstResult = orxConfig_GetCachedValue(_stKeyID);
+  }
+  else
+  {
+    orxCONFIG_SECTION *pstDummy = orxNULL;
+
+    /* Gets value */
+    pstResult = orxConfig_GetValueFromKey(_stKeyID, sstConfig.pstCurrentSection, &pstDummy);
+  }
+
+#ifdef __orxDEBUG__
+
+  /* Should check? */
+  if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_TYPO_CHECK))
+  {
+    /* Not found? */
+    if(pstResult == orxNULL)
+    {
+      /* No key name? */
+      if(_zKey == orxNULL)
+      {
+        /* Retrieves it */
+        _zKey = orxString_GetFromID(_stKeyID);
+      }
+
+      /* Valid? */
+      if(*_zKey != orxCHAR_NULL)
+      {
+        /* For all entries */
+        orxConfig_ForAllKeys(orxConfig_CheckTypo, orxTRUE, (void *)_zKey);
+      }
+    }
+  }
+
+#endif /* __orxDEBUG__ */
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets a value from the current section, using inheritance
+ * @param[in] _zKey             Entry key
+ * @return                      orxCONFIG_VALUE / orxNULL
+ */
+static orxINLINE orxCONFIG_VALUE *orxConfig_GetValue(const orxSTRING _zKey)
+{
+  orxCONFIG_VALUE *pstResult = orxNULL;
+
+  /* Valid? */
+  if((_zKey != orxNULL) && (*_zKey != orxCHAR_NULL))
+  {
+    /* Gets value */
+    pstResult = orxConfig_GetValueByID(orxString_Hash(_zKey), _zKey);
   }
 
-  /* Profiles */
-  orxPROFILER_POP_MARKER();
-
   /* Done! */
   return pstResult;
 }
@@ -1724,15 +2269,41 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
   if(*_zKey != orxCHAR_NULL)
   {
     orxCONFIG_ENTRY  *pstEntry;
-    orxSTRINGID       stKeyID;
+    orxSTRINGID       stKeyID, stPreviousHash = orxSTRINGID_UNDEFINED;
+    orxCONFIG_EVENT   eChangeEvent = orxCONFIG_EVENT_KEY_ADD;
     orxBOOL           bReuse;
 
     /* Gets key ID */
     stKeyID = orxString_GetID(_zKey);
 
+    /* Invalidates caches */
+    orxConfig_InvalidateCache(sstConfig.pstCurrentSection);
+
     /* Gets existing entry */
     pstEntry = orxConfig_GetEntry(stKeyID);
 
+    /* Found? */
+    if(pstEntry != orxNULL)
+    {
+      /* Updates change event */
+      eChangeEvent = orxCONFIG_EVENT_KEY_UPDATE;
+
+      /* Stale and appending? */
+      if((orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_STALE))
+      && (_eSetMode == orxCONFIG_SET_MODE_APPEND))
+      {
+        /* Deletes it, its new value will be built from its parent, as with a full reload */
+        orxConfig_DeleteEntry(pstEntry);
+        pstEntry = orxNULL;
+      }
+      /* Reloading? */
+      else if(sstConfig.pstChangeBank != orxNULL)
+      {
+        /* Stores its current hash */
+        stPreviousHash = orxConfig_GetValueHash(&(pstEntry->stValue));
+      }
+    }
+
     /* Found? */
     if(pstEntry != orxNULL)
     {
@@ -1833,16 +2404,30 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
         /* Not reusing entry? */
         if(bReuse == orxFALSE)
         {
-          /* Adds it to list */
-          orxMemory_Zero(&(pstEntry->stNode), sizeof(orxLINKLIST_NODE));
-          orxLinkList_AddEnd(&(sstConfig.pstCurrentSection->stEntryList), &(pstEntry->stNode));
-
           /* Sets its ID */
           pstEntry->stID = stKeyID;
+
+          /* Adds it to current section */
+          orxConfig_AddEntry(sstConfig.pstCurrentSection, pstEntry);
         }
 
         /* Inits its type */
         pstEntry->stValue.u16Type = (orxU16)orxCONFIG_VALUE_TYPE_STRING;
+
+        /* Inherits from another section? */
+        if(orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_INHERITANCE))
+        {
+          /* Updates section status */
+          orxFLAG_SET(sstConfig.pstCurrentSection->u32Flags, orxCONFIG_SECTION_KU32_FLAG_REFERENCE, orxCONFIG_SECTION_KU32_FLAG_NONE);
+        }
+
+        /* Reloading and new or modified? */
+        if((sstConfig.pstChangeBank != orxNULL)
+        && ((stPreviousHash == orxSTRINGID_UNDEFINED) || (orxConfig_GetValueHash(&(pstEntry->stValue)) != stPreviousHash)))
+        {
+          /* Records change */
+          orxConfig_RecordChange(sstConfig.pstCurrentSection, stKeyID, eChangeEvent);
+        }
       }
       else
       {
@@ -1855,8 +2440,8 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
           /* Reusing entry? */
           if(bReuse != orxFALSE)
           {
-            /* Removes it from list */
-            orxLinkList_Remove(&(pstEntry->stNode));
+            /* Removes it from its section */
+            orxConfig_RemoveEntry(pstEntry);
           }
 
           /* Deletes entry */
@@ -1892,6 +2477,17 @@ static orxINLINE orxCONFIG_SECTION *orxConfig_CreateSection(const orxSTRING _zSe
 
     /* Clears its entry list */
     orxMemory_Zero(&(pstSection->stEntryList), sizeof(orxLINKLIST));
+    pstSection->pstEntryTable = orxNULL;
+
+    /* Clears its resolve cache */
+    pstSection->pstCacheTable       = orxNULL;
+    pstSection->u32CacheGeneration  = sstConfig.u32CacheGeneration;
+
+    /* Clears its flags */
+    pstSection->u32Flags            = orxCONFIG_SECTION_KU32_FLAG_NONE;
+
+    /* Invalidates caches */
+    orxConfig_InvalidateCache(pstSection);
 
     /* Adds it to list */
     orxMemory_Zero(&(pstSection->stNode), sizeof(orxLINKLIST_NODE));
@@ -1963,6 +2559,9 @@ static orxINLINE orxSTATUS orxConfig_DeleteSection(orxCONFIG_SECTION *_pstSectio
     /* Empty? */
     if(orxLinkList_GetCount(&(_pstSection->stEntryList)) == 0)
     {
+      /* Deletes its entry table */
+      orxConfig_DeleteEntryTable(_pstSection);
+
       /* Not protected? */
       if(_pstSection->s32ProtectionCount == 0)
       {
@@ -2017,6 +2616,12 @@ static orxINLINE orxSTATUS orxConfig_DeleteSection(orxCONFIG_SECTION *_pstSectio
         /* Removes it from table */
         orxHashTable_Remove(sstConfig.pstSectionTable, orxString_Hash(_pstSection->zName));
 
+        /* Deletes its resolve cache */
+        orxConfig_DeleteCacheTable(_pstSection);
+
+        /* Invalidates caches */
+        orxConfig_InvalidateCache(orxNULL);
+
         /* Removes section */
         orxBank_Free(sstConfig.pstSectionBank, _pstSection);
 
@@ -3723,6 +4328,9 @@ static orxSTATUS orxConfig_SelectSectionInternal(const orxSTRING _zSectionName)
       {
         /* Selects it */
         sstConfig.pstCurrentSection = pstSection;
+
+        /* Records change */
+        orxConfig_RecordChange(pstSection, orxSTRINGID_UNDEFINED, orxCONFIG_EVENT_SECTION_UPDATE);
       }
       else
       {
@@ -3763,6 +4371,12 @@ static orxSTATUS orxConfig_SelectSectionInternal(const orxSTRING _zSectionName)
 
           /* Updates parent ID */
           pstSection->pstParent = pstParent;
+
+          /* Invalidates caches */
+          orxConfig_InvalidateCache(pstSection);
+
+          /* Records change */
+          orxConfig_RecordChange(pstSection, orxSTRINGID_UNDEFINED, orxCONFIG_EVENT_SECTION_UPDATE);
         }
       }
     }
@@ -3794,462 +4408,909 @@ static orxSTATUS orxConfig_SelectSectionInternal(const orxSTRING _zSectionName)
   return eResult;
 }
 
-/** Origin save callback
+/** Gets the size of a value's working string, including its inner list separators
+ * @param[in] _pstValue         Concerned config value
+ * @return                      Size of the working string, including its terminating null character
  */
-static orxBOOL orxFASTCALL orxConfig_OriginSaveCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+static orxINLINE orxU32 orxConfig_GetWorkingValueSize(const orxCONFIG_VALUE *_pstValue)
 {
-  orxBOOL bResult;
-
-#ifdef __orxWINDOWS__
-
-  /* Updates result */
-  bResult = ((_zKeyName != orxNULL) || (orxString_ICompare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
-
-#else /* __orxWINDOWS__ */
-
-  /* Updates result */
-  bResult = ((_zKeyName != orxNULL) || (orxString_Compare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+  orxU32 u32Result;
 
-#endif /* __orxWINDOWS__ */
+  /* Is a list? */
+  if(orxFLAG_TEST(_pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+  {
+    /* Updates result */
+    u32Result = _pstValue->au32ListIndexTable[_pstValue->u16ListCount - 2] + orxString_GetLength(_pstValue->zValue + _pstValue->au32ListIndexTable[_pstValue->u16ListCount - 2]) + 1;
+  }
+  else
+  {
+    /* Updates result */
+    u32Result = orxString_GetLength(_pstValue->zValue) + 1;
+  }
 
   /* Done! */
-  return bResult;
+  return u32Result;
 }
 
-/** Origin clear callback
+/** Loads an entry from a binary record in the current section
+ * @param[in] _pstRecord        Entry record
+ * @param[in] _acPool           String pool
+ * @param[in] _au32IndexList    List index array
+ * @return                      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-static orxBOOL orxFASTCALL orxConfig_OriginClearCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName)
+static orxSTATUS orxFASTCALL orxConfig_LoadBinaryEntry(const orxCONFIG_BINARY_ENTRY *_pstRecord, const orxCHAR *_acPool, const orxU32 *_au32IndexList)
 {
-  orxBOOL bResult;
+  orxCONFIG_ENTRY  *pstEntry;
+  orxSTRINGID       stKeyID, stPreviousHash = orxSTRINGID_UNDEFINED;
+  orxBOOL           bReuse;
+  orxSTATUS         eResult = orxSTATUS_FAILURE;
 
-  /* Updates result */
-  bResult = (orxConfig_GetOriginID(_zSectionName) != orxSTRINGID_UNDEFINED) ? orxTRUE : orxFALSE;
+  /* Checks */
+  orxASSERT(sstConfig.pstCurrentSection != orxNULL);
 
-  /* Done! */
-  return bResult;
-}
+  /* Gets key ID */
+  stKeyID = orxString_GetID(_acPool + _pstRecord->u32KeyOffset);
 
-/** Transforms a string to Pascal case
- */
-static void orxFASTCALL orxConfig_ToPascalCase(orxSTRING _zDst, const orxSTRING _zSrc)
-{
-  const orxCHAR  *pcSrc;
-  orxCHAR        *pcDst;
-  orxBOOL         bUpper;
+  /* Checks */
+  orxASSERT(stKeyID == _pstRecord->stID);
 
-  /* For all characters */
-  for(pcSrc = _zSrc, pcDst = _zDst, bUpper = orxTRUE; *pcSrc != orxCHAR_NULL; pcSrc++, pcDst++)
+  /* Gets existing entry */
+  pstEntry = orxConfig_GetEntry(stKeyID);
+
+  /* Found? */
+  if(pstEntry != orxNULL)
   {
-    /* Is an underscore? */
-    if(*pcSrc == '_')
+    /* Reloading? */
+    if(sstConfig.pstChangeBank != orxNULL)
     {
-      /* Replaces it with a space */
-      *pcDst = ' ';
-
-      /* Updates status */
-      bUpper = orxTRUE;
+      /* Stores its current hash */
+      stPreviousHash = orxConfig_GetValueHash(&(pstEntry->stValue));
     }
-    /* Is a space? */
-    else if(*pcSrc == ' ')
-    {
-      /* Skips it */
-      pcDst--;
 
-      /* Updates status */
-      bUpper = orxTRUE;
-    }
-    else
-    {
-      /* Updates character */
-      *pcDst = ((bUpper != orxFALSE) && (*pcSrc >= 'a') && (*pcSrc <= 'z'))
-               ? *pcSrc & ~0x20
-               : ((bUpper == orxFALSE) && (*pcSrc >= 'A') && (*pcSrc <= 'Z'))
-                 ? *pcSrc | 0x20
-                 : *pcSrc;
+    /* Deletes value */
+    orxConfig_CleanValue(&(pstEntry->stValue));
 
-      /* Updates status */
-      bUpper = orxFALSE;
-    }
+    /* Invalidates caches */
+    orxConfig_InvalidateCache(sstConfig.pstCurrentSection);
+
+    /* Updates status */
+    bReuse = orxTRUE;
   }
+  else
+  {
+    /* Creates entry */
+    pstEntry = (orxCONFIG_ENTRY *)orxBank_Allocate(sstConfig.pstEntryBank);
 
-  /* Ends string */
-  *pcDst = orxCHAR_NULL;
+    /* Updates status */
+    bReuse = orxFALSE;
+  }
 
-  /* Done! */
-  return;
-}
+  /* Valid? */
+  if(pstEntry != orxNULL)
+  {
+    orxCONFIG_VALUE *pstValue;
 
-/** Set default color list
- */
-static void orxFASTCALL orxConfig_SetDefaultColorList()
-{
-  orxCHAR acParentBuffer[128];
-  orxS32  s32Offset;
-  orxU32  i, iCount;
+    /* Gets its value */
+    pstValue = &(pstEntry->stValue);
 
-#define orxCOLOR_DECLARE(NAME, R, G, B) {#NAME, &orxVECTOR_##NAME},
+    /* Is a list? */
+    if(orxFLAG_TEST(_pstRecord->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+    {
+      /* Allocates working string and index table */
+      pstValue->zValue              = (orxSTRING)orxMemory_Allocate(_pstRecord->u32ValueSize, orxMEMORY_TYPE_TEXT);
+      pstValue->au32ListIndexTable  = (orxU32 *)orxMemory_Allocate((orxU32)(_pstRecord->u16ListCount - 1) * sizeof(orxU32), orxMEMORY_TYPE_CONFIG);
 
-  struct
-  {
-    const orxSTRING   zName;
-    const orxVECTOR  *pvColor;
-  } astColorList[] =
-  {
-    #include "display/orxColorList.inc"
-  };
+      /* Success? */
+      if((pstValue->zValue != orxNULL) && (pstValue->au32ListIndexTable != orxNULL))
+      {
+        orxU32 i;
 
-#undef orxCOLOR_DECLARE
+        /* Copies them */
+        orxMemory_Copy(pstValue->zValue, _acPool + _pstRecord->u32ValueOffset, _pstRecord->u32ValueSize);
+        orxMemory_Copy(pstValue->au32ListIndexTable, _au32IndexList + _pstRecord->u32IndexOffset, (orxU32)(_pstRecord->u16ListCount - 1) * sizeof(orxU32));
 
-  /* Pushes color config section */
-  orxConfig_PushSection(orxCOLOR_KZ_CONFIG_SECTION);
+        /* Updates result */
+        eResult = (pstValue->zValue[_pstRecord->u32ValueSize - 1] == orxCHAR_NULL) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
 
-  /* For all colors */
-  for(i = 0, iCount = orxARRAY_GET_ITEM_COUNT(astColorList); i < iCount; i++)
-  {
-    orxVECTOR vColor;
+        /* For all indices */
+        for(i = 0; i < (orxU32)(_pstRecord->u16ListCount - 1); i++)
+        {
+          /* Out of bounds? */
+          if(pstValue->au32ListIndexTable[i] >= _pstRecord->u32ValueSize)
+          {
+            /* Updates result */
+            eResult = orxSTATUS_FAILURE;
 
-    /* Checks */
-    orxASSERT(orxString_GetLength(astColorList[i].zName) < sizeof(acParentBuffer));
+            break;
+          }
+        }
+      }
 
-    /* Gets PascalCase name with spaces */
-    orxConfig_ToPascalCase(acParentBuffer, astColorList[i].zName);
+      /* Success? */
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        /* Updates flags */
+        pstValue->u16Flags = (_pstRecord->u16Flags & ~orxCONFIG_VALUE_KU16_FLAG_ALLOCATION) | orxCONFIG_VALUE_KU16_FLAG_ALLOCATION;
+      }
+      else
+      {
+        /* Had working string? */
+        if(pstValue->zValue != orxNULL)
+        {
+          /* Deletes it */
+          orxMemory_Free(pstValue->zValue);
+        }
 
-    /* Stores color values under PascalCase name with spaces */
-    if(orxConfig_GetEntry(orxString_Hash(acParentBuffer)) == orxNULL)
-    {
-      orxConfig_SetVector(acParentBuffer, orxVector_Mulf(&vColor, astColorList[i].pvColor, orxCOLOR_DENORMALIZER));
+        /* Had index table? */
+        if(pstValue->au32ListIndexTable != orxNULL)
+        {
+          /* Deletes it */
+          orxMemory_Free(pstValue->au32ListIndexTable);
+        }
+      }
     }
-  }
+    else
+    {
+      /* Stores value */
+      pstValue->zValue              = (_acPool[_pstRecord->u32ValueOffset] != orxCHAR_NULL) ? (orxSTRING)orxString_Store(_acPool + _pstRecord->u32ValueOffset) : (orxSTRING)orxSTRING_EMPTY;
+      pstValue->au32ListIndexTable  = orxNULL;
 
-  /* Inits parent buffer */
-  s32Offset = orxString_NPrint(acParentBuffer, sizeof(acParentBuffer), "@.");
+      /* Updates flags */
+      pstValue->u16Flags            = _pstRecord->u16Flags & ~orxCONFIG_VALUE_KU16_FLAG_ALLOCATION;
 
-  /* For all keys */
-  for(i = 0, iCount = orxConfig_GetKeyCount(); i < iCount; i++)
-  {
-    orxCHAR         acBuffer[sizeof(acParentBuffer)];
-    const orxSTRING zKey;
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
 
-    /* Gets it */
-    zKey = orxConfig_GetKey(i);
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Restores list & cache status */
+      pstValue->u16ListCount  = _pstRecord->u16ListCount;
+      pstValue->u16CacheIndex = _pstRecord->u16CacheIndex;
+      pstValue->u16Type       = _pstRecord->u16Type;
+      orxVector_Copy(&(pstValue->vValue), &(_pstRecord->vValue));
+      orxVector_Copy(&(pstValue->vAltValue), &(_pstRecord->vAltValue));
+      orxVector_Copy(&(pstValue->vStepValue), &(_pstRecord->vStepValue));
 
-    /* Checks */
-    orxASSERT(orxString_GetLength(zKey) < sizeof(acParentBuffer) - s32Offset);
+      /* Stores origin */
+      pstEntry->stOriginID = sstConfig.stLoadFileID;
 
-    /* Sets PascalCase name with spaces as parent */
-    orxString_NPrint(acParentBuffer + s32Offset, sizeof(acParentBuffer) - s32Offset, "%s", zKey);
+      /* Not reusing entry? */
+      if(bReuse == orxFALSE)
+      {
+        /* Sets its ID */
+        pstEntry->stID = stKeyID;
 
-    /* Inherits from the PascalCase for all the variations (PascalCase without spaces, lower case with and without spaces) */
-    orxString_NPrint(acBuffer, sizeof(acBuffer), "%s", acParentBuffer + s32Offset);
-    orxString_LowerCase(acBuffer);
-    if(orxConfig_GetEntry(orxString_Hash(acBuffer)) == orxNULL)
-    {
-      orxConfig_SetString(acBuffer, acParentBuffer);
-    }
-    orxConfig_ToPascalCase(acBuffer, acParentBuffer + s32Offset);
-    if(orxConfig_GetEntry(orxString_Hash(acBuffer)) == orxNULL)
-    {
-      orxConfig_SetString(acBuffer, acParentBuffer);
+        /* Adds it to current section */
+        orxConfig_AddEntry(sstConfig.pstCurrentSection, pstEntry);
+      }
+
+      /* Inherits from another section? */
+      if(orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_INHERITANCE))
+      {
+        /* Updates section status */
+        orxFLAG_SET(sstConfig.pstCurrentSection->u32Flags, orxCONFIG_SECTION_KU32_FLAG_REFERENCE, orxCONFIG_SECTION_KU32_FLAG_NONE);
+      }
+
+      /* Reloading and new or modified? */
+      if((sstConfig.pstChangeBank != orxNULL)
+      && ((bReuse == orxFALSE) || (orxConfig_GetValueHash(pstValue) != stPreviousHash)))
+      {
+        /* Records change */
+        orxConfig_RecordChange(sstConfig.pstCurrentSection, stKeyID, (bReuse != orxFALSE) ? orxCONFIG_EVENT_KEY_UPDATE : orxCONFIG_EVENT_KEY_ADD);
+      }
     }
-    orxString_LowerCase(acBuffer);
-    if(orxConfig_GetEntry(orxString_Hash(acBuffer)) == orxNULL)
+    else
     {
-      orxConfig_SetString(acBuffer, acParentBuffer);
-    }
-  }
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Failed to load binary config entry <%s.%s>: invalid list record.", sstConfig.pstCurrentSection->zName, _acPool + _pstRecord->u32KeyOffset);
 
-  /* Pops config section */
-  orxConfig_PopSection();
+      /* Reusing entry? */
+      if(bReuse != orxFALSE)
+      {
+        /* Removes it from its section */
+        orxConfig_RemoveEntry(pstEntry);
+      }
 
-  /* Protects it */
-  orxConfig_ProtectSection(orxCOLOR_KZ_CONFIG_SECTION, orxTRUE);
+      /* Deletes entry */
+      orxBank_Free(sstConfig.pstEntryBank, pstEntry);
+    }
+  }
 
   /* Done! */
-  return;
+  return eResult;
 }
 
-/** Command: Load
+/** Processes a binary config image
+ * @param[in] _zName            Name of the image origin
+ * @param[in] _acBuffer         Image, starting with its header
+ * @param[in] _u32Size          Size of the image
+ * @return                      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-void orxFASTCALL orxConfig_CommandLoad(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+static orxSTATUS orxFASTCALL orxConfig_ProcessBinary(const orxSTRING _zName, const orxCHAR *_acBuffer, orxU32 _u32Size)
 {
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_Load(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+  const orxCONFIG_BINARY_HEADER  *pstHeader;
+  orxSTATUS                       eResult = orxSTATUS_FAILURE;
 
-  /* Done! */
-  return;
-}
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_ProcessBinary");
+
+  /* Gets header */
+  pstHeader = (const orxCONFIG_BINARY_HEADER *)_acBuffer;
+
+  /* Valid and compatible image? */
+  if((_u32Size >= sizeof(orxCONFIG_BINARY_HEADER))
+  && (orxString_NCompare(pstHeader->acTag, orxCONFIG_KZ_BINARY_TAG, orxCONFIG_KU32_BINARY_TAG_LENGTH) == 0)
+  && (pstHeader->u32Version == orxCONFIG_KU32_BINARY_VERSION)
+  && (pstHeader->u32Endianness == orxCONFIG_KU32_BINARY_ENDIANNESS)
+  && (pstHeader->u32EntrySize == (orxU32)sizeof(orxCONFIG_BINARY_ENTRY))
+  && ((orxU64)sizeof(orxCONFIG_BINARY_HEADER) + (orxU64)pstHeader->u32SectionCount * sizeof(orxCONFIG_BINARY_SECTION) + (orxU64)pstHeader->u32EntryCount * sizeof(orxCONFIG_BINARY_ENTRY) + (orxU64)pstHeader->u32IndexCount * sizeof(orxU32) + (orxU64)pstHeader->u32PoolSize == (orxU64)_u32Size)
+  && ((pstHeader->u32PoolSize == 0) || (_acBuffer[_u32Size - 1] == orxCHAR_NULL)))
+  {
+    const orxCONFIG_BINARY_SECTION *pstSectionRecord;
+    const orxCONFIG_BINARY_ENTRY   *pstEntryRecord;
+    const orxU32                   *au32IndexList;
+    const orxCHAR                  *acPool;
+    orxU32                          u32SectionIndex, u32EntryIndex;
+
+    /* Gets all tables */
+    pstSectionRecord  = (const orxCONFIG_BINARY_SECTION *)(pstHeader + 1);
+    pstEntryRecord    = (const orxCONFIG_BINARY_ENTRY *)(pstSectionRecord + pstHeader->u32SectionCount);
+    au32IndexList     = (const orxU32 *)(pstEntryRecord + pstHeader->u32EntryCount);
+    acPool            = (const orxCHAR *)(au32IndexList + pstHeader->u32IndexCount);
 
-/** Command: Save
- */
-void orxFASTCALL orxConfig_CommandSave(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_Save(_astArgList[0].zValue, (_u32ArgNumber > 2) ? _astArgList[2].bValue : orxFALSE, ((_u32ArgNumber > 1) && (_astArgList[1].bValue != orxFALSE)) ? orxConfig_OriginSaveCallback : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
 
-  /* Done! */
-  return;
-}
+    /* For all sections */
+    for(u32SectionIndex = 0, u32EntryIndex = 0; u32SectionIndex < pstHeader->u32SectionCount; u32SectionIndex++, pstSectionRecord++)
+    {
+      /* Valid record and could select section? */
+      if((pstSectionRecord->u32NameOffset < pstHeader->u32PoolSize)
+      && (pstSectionRecord->u32EntryCount <= pstHeader->u32EntryCount - u32EntryIndex)
+      && (orxConfig_SelectSectionInternal(acPool + pstSectionRecord->u32NameOffset) != orxSTATUS_FAILURE))
+      {
+        orxU32 i;
 
-/** Command: Reload
- */
-void orxFASTCALL orxConfig_CommandReload(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_ReloadHistory() != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+        /* For all its entries */
+        for(i = 0; i < pstSectionRecord->u32EntryCount; i++, pstEntryRecord++)
+        {
+          /* Valid record? */
+          if((pstEntryRecord->u32KeyOffset < pstHeader->u32PoolSize)
+          && (pstEntryRecord->u32ValueOffset < pstHeader->u32PoolSize)
+          && (pstEntryRecord->u32ValueSize > 0)
+          && (pstEntryRecord->u32ValueSize <= pstHeader->u32PoolSize - pstEntryRecord->u32ValueOffset)
+          && ((!orxFLAG_TEST(pstEntryRecord->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+           || ((pstEntryRecord->u16ListCount > 1)
+            && (pstEntryRecord->u32IndexOffset <= pstHeader->u32IndexCount)
+            && ((orxU32)(pstEntryRecord->u16ListCount - 1) <= pstHeader->u32IndexCount - pstEntryRecord->u32IndexOffset))))
+          {
+            /* Loads it */
+            if(orxConfig_LoadBinaryEntry(pstEntryRecord, acPool, au32IndexList) == orxSTATUS_FAILURE)
+            {
+              /* Updates result */
+              eResult = orxSTATUS_FAILURE;
+            }
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Invalid binary config entry record #%u in section [%s], skipping.", _zName, i, sstConfig.pstCurrentSection->zName);
 
-  /* Done! */
-  return;
-}
+            /* Updates result */
+            eResult = orxSTATUS_FAILURE;
+          }
+        }
 
-/** Command: Clear
- */
-void orxFASTCALL orxConfig_CommandClear(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->bValue = (orxConfig_Clear(((_u32ArgNumber > 0) && (_astArgList[0].bValue != orxFALSE)) ? orxConfig_OriginClearCallback : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+        /* Updates entry index */
+        u32EntryIndex += pstSectionRecord->u32EntryCount;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Invalid binary config section record #%u, aborting.", _zName, u32SectionIndex);
 
-  /* Done! */
-  return;
-}
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
 
-/** Command: GetOrigin
- */
-void orxFASTCALL orxConfig_CommandGetOrigin(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->zValue = orxConfig_GetOrigin(_astArgList[0].zValue);
+        break;
+      }
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load binary config file, invalid or incompatible image.", _zName);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
 
   /* Done! */
-  return;
+  return eResult;
 }
 
-/** Command: SetOrigin
+/** Loads a binary config image from an opened resource
+ * @param[in] _zName            Name of the file
+ * @param[in] _hResource        Resource, positioned after the already read data
+ * @param[in] _acData           Already read (and decrypted) data, starting with the binary tag
+ * @param[in] _u32DataSize      Size of the already read data
+ * @param[in] _u32Offset        Offset of the binary tag in the resource
+ * @param[in] _bUseEncryption   Is the resource encrypted?
+ * @return                      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-void orxFASTCALL orxConfig_CommandSetOrigin(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+static orxSTATUS orxFASTCALL orxConfig_LoadBinary(const orxSTRING _zName, orxHANDLE _hResource, const orxCHAR *_acData, orxU32 _u32DataSize, orxU32 _u32Offset, orxBOOL _bUseEncryption)
 {
-  /* Updates result */
-  _pstResult->zValue = (orxConfig_SetOrigin(_astArgList[0].zValue, (_u32ArgNumber > 1) ? _astArgList[1].zValue : orxNULL) != orxSTATUS_FAILURE) ? _astArgList[0].zValue : orxSTRING_EMPTY;
+  orxS64    s64Size;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
 
-  /* Done! */
-  return;
-}
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_LoadBinary");
 
-/** Command: GetParent
- */
-void orxFASTCALL orxConfig_CommandGetParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->zValue = ((*_astArgList[0].zValue != orxCHAR_NULL) && (*_astArgList[0].zValue != orxCONFIG_KC_INHERITANCE_MARKER)) ? orxConfig_GetParent(_astArgList[0].zValue) : orxConfig_GetParent(orxConfig_GetCurrentSection());
-  if(_pstResult->zValue == orxNULL)
+  /* Gets image size */
+  s64Size = orxResource_GetSize(_hResource) - (orxS64)_u32Offset;
+
+  /* Valid? */
+  if((s64Size >= (orxS64)_u32DataSize) && (s64Size < (orxS64)orxU32_UNDEFINED))
   {
-    _pstResult->zValue = orxSTRING_EMPTY;
-  }
+    const orxCHAR  *acMap = orxNULL;
+    orxCHAR        *acImage;
 
-  /* Done! */
-  return;
-}
+    /* Not encrypted? */
+    if(_bUseEncryption == orxFALSE)
+    {
+      orxS64 s64MapSize;
 
-/** Command: SetParent
- */
-void orxFASTCALL orxConfig_CommandSetParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->zValue = (orxConfig_SetParent(_astArgList[0].zValue, (_u32ArgNumber > 1) ? ((_astArgList[1].zValue[0] != orxCONFIG_KC_INHERITANCE_MARKER) ? _astArgList[1].zValue : orxSTRING_EMPTY) : orxNULL) != orxSTATUS_FAILURE) ? _astArgList[0].zValue : orxSTRING_EMPTY;
+      /* Maps resource */
+      acMap = (const orxCHAR *)orxResource_Map(_hResource, &s64MapSize);
 
-  /* Done! */
-  return;
-}
+      /* Success? */
+      if(acMap != orxNULL)
+      {
+        /* Gets image start */
+        acMap += _u32Offset;
 
-/** Command: SetDefaultParent
- */
-void orxFASTCALL orxConfig_CommandSetDefaultParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->zValue = (orxConfig_SetDefaultParent((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL) != orxSTATUS_FAILURE) ? ((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxSTRING_EMPTY) : orxSTRING_EMPTY;
+        /* Incomplete or misaligned image? */
+        if((s64MapSize != s64Size + (orxS64)_u32Offset)
+        || (((orxUPTR)acMap & (sizeof(orxU32) - 1)) != 0))
+        {
+          /* Unmaps resource */
+          orxResource_Unmap(_hResource);
+          acMap = orxNULL;
+        }
+      }
+    }
 
-  /* Done! */
-  return;
-}
+    /* Mapped? */
+    if(acMap != orxNULL)
+    {
+      /* Processes it in place */
+      eResult = orxConfig_ProcessBinary(_zName, acMap, (orxU32)s64Size);
 
-/** Command: GetDefaultParent
- */
-void orxFASTCALL orxConfig_CommandGetDefaultParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->zValue = orxConfig_GetDefaultParent();
-  if(_pstResult->zValue == orxNULL)
+      /* Unmaps resource */
+      orxResource_Unmap(_hResource);
+    }
+    /* Allocates image */
+    else if((acImage = (orxCHAR *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_TEMP)) != orxNULL)
+    {
+      orxU32 u32RemainingSize;
+
+      /* Copies already read data */
+      orxMemory_Copy(acImage, _acData, _u32DataSize);
+
+      /* Gets remaining size */
+      u32RemainingSize = (orxU32)s64Size - _u32DataSize;
+
+      /* Reads the rest of the image */
+      if((u32RemainingSize == 0)
+      || ((orxU32)orxResource_Read(_hResource, (orxS64)u32RemainingSize, acImage + _u32DataSize, orxNULL, orxNULL) == u32RemainingSize))
+      {
+        /* Uses encryption? */
+        if(_bUseEncryption != orxFALSE)
+        {
+          /* Decrypts all new characters */
+          orxConfig_CryptBuffer(acImage + _u32DataSize, u32RemainingSize);
+        }
+
+        /* Processes it */
+        eResult = orxConfig_ProcessBinary(_zName, acImage, (orxU32)s64Size);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load binary config file, couldn't read its content.", _zName);
+      }
+
+      /* Deletes image */
+      orxMemory_Free(acImage);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load binary config file, couldn't allocate memory.", _zName);
+    }
+  }
+  else
   {
-    _pstResult->zValue = orxSTRING_EMPTY;
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load binary config file, invalid size.", _zName);
   }
 
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
   /* Done! */
-  return;
+  return eResult;
 }
 
-/** Command: CreateSection
+/** Origin save callback
  */
-void orxFASTCALL orxConfig_CommandCreateSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+static orxBOOL orxFASTCALL orxConfig_OriginSaveCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
 {
+  orxBOOL bResult;
+
+#ifdef __orxWINDOWS__
+
   /* Updates result */
-  _pstResult->zValue = (orxConfig_SelectSection(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? _astArgList[0].zValue : orxSTRING_EMPTY;
+  bResult = ((_zKeyName != orxNULL) || (orxString_ICompare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
 
-  /* Done! */
-  return;
-}
+#else /* __orxWINDOWS__ */
 
-/** Command: HasSection
- */
-void orxFASTCALL orxConfig_CommandHasSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
   /* Updates result */
-  _pstResult->bValue = (orxConfig_HasSection(_astArgList[0].zValue));
+  bResult = ((_zKeyName != orxNULL) || (orxString_Compare(_zFileName, orxConfig_GetOrigin(_zSectionName)) == 0)) ? orxTRUE : orxFALSE;
+
+#endif /* __orxWINDOWS__ */
 
   /* Done! */
-  return;
+  return bResult;
 }
 
-/** Command: RenameSection
+/** Origin clear callback
  */
-void orxFASTCALL orxConfig_CommandRenameSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+static orxBOOL orxFASTCALL orxConfig_OriginClearCallback(const orxSTRING _zSectionName, const orxSTRING _zKeyName)
 {
-  /* Renames section */
-   orxConfig_RenameSection(_astArgList[0].zValue, _astArgList[1].zValue);
+  orxBOOL bResult;
 
   /* Updates result */
-  _pstResult->zValue = _astArgList[1].zValue;
+  bResult = (orxConfig_GetOriginID(_zSectionName) != orxSTRINGID_UNDEFINED) ? orxTRUE : orxFALSE;
 
   /* Done! */
-  return;
+  return bResult;
 }
 
-/** Command: ClearSection
+/** Transforms a string to Pascal case
  */
-void orxFASTCALL orxConfig_CommandClearSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+static void orxFASTCALL orxConfig_ToPascalCase(orxSTRING _zDst, const orxSTRING _zSrc)
 {
-  /* Clears section */
-   orxConfig_ClearSection(_astArgList[0].zValue);
+  const orxCHAR  *pcSrc;
+  orxCHAR        *pcDst;
+  orxBOOL         bUpper;
 
-  /* Updates result */
-  _pstResult->zValue = _astArgList[0].zValue;
+  /* For all characters */
+  for(pcSrc = _zSrc, pcDst = _zDst, bUpper = orxTRUE; *pcSrc != orxCHAR_NULL; pcSrc++, pcDst++)
+  {
+    /* Is an underscore? */
+    if(*pcSrc == '_')
+    {
+      /* Replaces it with a space */
+      *pcDst = ' ';
 
-  /* Done! */
-  return;
-}
+      /* Updates status */
+      bUpper = orxTRUE;
+    }
+    /* Is a space? */
+    else if(*pcSrc == ' ')
+    {
+      /* Skips it */
+      pcDst--;
 
-/** Command: GetCurrentSection
- */
-void orxFASTCALL orxConfig_CommandGetCurrentSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  /* Updates result */
-  _pstResult->zValue = orxConfig_GetCurrentSection();
+      /* Updates status */
+      bUpper = orxTRUE;
+    }
+    else
+    {
+      /* Updates character */
+      *pcDst = ((bUpper != orxFALSE) && (*pcSrc >= 'a') && (*pcSrc <= 'z'))
+               ? *pcSrc & ~0x20
+               : ((bUpper == orxFALSE) && (*pcSrc >= 'A') && (*pcSrc <= 'Z'))
+                 ? *pcSrc | 0x20
+                 : *pcSrc;
+
+      /* Updates status */
+      bUpper = orxFALSE;
+    }
+  }
+
+  /* Ends string */
+  *pcDst = orxCHAR_NULL;
 
   /* Done! */
   return;
 }
 
-/** Command: ClearValue
+/** Set default color list
  */
-void orxFASTCALL orxConfig_CommandClearValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+static void orxFASTCALL orxConfig_SetDefaultColorList()
 {
-  orxBOOL bPush;
+  orxCHAR acParentBuffer[128];
+  orxS32  s32Offset;
+  orxU32  i, iCount;
 
-  /* Pushes section */
-  bPush = ((*_astArgList[0].zValue != orxCHAR_NULL) && (*_astArgList[0].zValue != orxCONFIG_KC_INHERITANCE_MARKER)) ? orxTRUE : orxFALSE;
-  if(bPush != orxFALSE)
+#define orxCOLOR_DECLARE(NAME, R, G, B) {#NAME, &orxVECTOR_##NAME},
+
+  struct
   {
-    orxConfig_PushSection(_astArgList[0].zValue);
+    const orxSTRING   zName;
+    const orxVECTOR  *pvColor;
+  } astColorList[] =
+  {
+    #include "display/orxColorList.inc"
+  };
+
+#undef orxCOLOR_DECLARE
+
+  /* Pushes color config section */
+  orxConfig_PushSection(orxCOLOR_KZ_CONFIG_SECTION);
+
+  /* For all colors */
+  for(i = 0, iCount = orxARRAY_GET_ITEM_COUNT(astColorList); i < iCount; i++)
+  {
+    orxVECTOR vColor;
+
+    /* Checks */
+    orxASSERT(orxString_GetLength(astColorList[i].zName) < sizeof(acParentBuffer));
+
+    /* Gets PascalCase name with spaces */
+    orxConfig_ToPascalCase(acParentBuffer, astColorList[i].zName);
+
+    /* Stores color values under PascalCase name with spaces */
+    if(orxConfig_GetEntry(orxString_Hash(acParentBuffer)) == orxNULL)
+    {
+      orxConfig_SetVector(acParentBuffer, orxVector_Mulf(&vColor, astColorList[i].pvColor, orxCOLOR_DENORMALIZER));
+    }
   }
 
-  /* Clears value */
-  orxConfig_ClearValue(_astArgList[1].zValue);
+  /* Inits parent buffer */
+  s32Offset = orxString_NPrint(acParentBuffer, sizeof(acParentBuffer), "@.");
 
-  /* Pops section */
-  if(bPush != orxFALSE)
+  /* For all keys */
+  for(i = 0, iCount = orxConfig_GetKeyCount(); i < iCount; i++)
   {
-    orxConfig_PopSection();
+    orxCHAR         acBuffer[sizeof(acParentBuffer)];
+    const orxSTRING zKey;
+
+    /* Gets it */
+    zKey = orxConfig_GetKey(i);
+
+    /* Checks */
+    orxASSERT(orxString_GetLength(zKey) < sizeof(acParentBuffer) - s32Offset);
+
+    /* Sets PascalCase name with spaces as parent */
+    orxString_NPrint(acParentBuffer + s32Offset, sizeof(acParentBuffer) - s32Offset, "%s", zKey);
+
+    /* Inherits from the PascalCase for all the variations (PascalCase without spaces, lower case with and without spaces) */
+    orxString_NPrint(acBuffer, sizeof(acBuffer), "%s", acParentBuffer + s32Offset);
+    orxString_LowerCase(acBuffer);
+    if(orxConfig_GetEntry(orxString_Hash(acBuffer)) == orxNULL)
+    {
+      orxConfig_SetString(acBuffer, acParentBuffer);
+    }
+    orxConfig_ToPascalCase(acBuffer, acParentBuffer + s32Offset);
+    if(orxConfig_GetEntry(orxString_Hash(acBuffer)) == orxNULL)
+    {
+      orxConfig_SetString(acBuffer, acParentBuffer);
+    }
+    orxString_LowerCase(acBuffer);
+    if(orxConfig_GetEntry(orxString_Hash(acBuffer)) == orxNULL)
+    {
+      orxConfig_SetString(acBuffer, acParentBuffer);
+    }
   }
 
+  /* Pops config section */
+  orxConfig_PopSection();
+
+  /* Protects it */
+  orxConfig_ProtectSection(orxCOLOR_KZ_CONFIG_SECTION, orxTRUE);
+
+  /* Done! */
+  return;
+}
+
+/** Command: Load
+ */
+void orxFASTCALL orxConfig_CommandLoad(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
   /* Updates result */
-  _pstResult->zValue = _astArgList[1].zValue;
+  _pstResult->bValue = (orxConfig_Load(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
 
   /* Done! */
   return;
 }
 
-/** Command: HasValue
+/** Command: Save
  */
-void orxFASTCALL orxConfig_CommandHasValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+void orxFASTCALL orxConfig_CommandSave(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
 {
-  orxBOOL bPush;
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_Save(_astArgList[0].zValue, (_u32ArgNumber > 2) ? _astArgList[2].bValue : orxFALSE, ((_u32ArgNumber > 1) && (_astArgList[1].bValue != orxFALSE)) ? orxConfig_OriginSaveCallback : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
 
-  /* Pushes section */
-  bPush = ((*_astArgList[0].zValue != orxCHAR_NULL) && (*_astArgList[0].zValue != orxCONFIG_KC_INHERITANCE_MARKER)) ? orxTRUE : orxFALSE;
-  if(bPush != orxFALSE)
-  {
-    orxConfig_PushSection(_astArgList[0].zValue);
-  }
+  /* Done! */
+  return;
+}
 
+/** Command: SaveBinary
+ */
+void orxFASTCALL orxConfig_CommandSaveBinary(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
   /* Updates result */
-  _pstResult->bValue = ((_u32ArgNumber > 2) && (_astArgList[2].bValue == orxFALSE)) ? orxConfig_HasValueNoCheck(_astArgList[1].zValue) : orxConfig_HasValue(_astArgList[1].zValue);
+  _pstResult->bValue = (orxConfig_SaveBinary(_astArgList[0].zValue, (_u32ArgNumber > 2) ? _astArgList[2].bValue : orxFALSE, ((_u32ArgNumber > 1) && (_astArgList[1].bValue != orxFALSE)) ? orxConfig_OriginSaveCallback : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
 
-  /* Pops section */
-  if(bPush != orxFALSE)
-  {
-    orxConfig_PopSection();
-  }
+  /* Done! */
+  return;
+}
+
+/** Command: Reload
+ */
+void orxFASTCALL orxConfig_CommandReload(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_ReloadHistory() != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
 
   /* Done! */
   return;
 }
 
-/** Command: GetValue
+/** Command: Clear
  */
-void orxFASTCALL orxConfig_CommandGetValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+void orxFASTCALL orxConfig_CommandClear(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
 {
-  const orxSTRING zSection  = _astArgList[0].zValue;
-  const orxSTRING zKey      = _astArgList[1].zValue;
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_Clear(((_u32ArgNumber > 0) && (_astArgList[0].bValue != orxFALSE)) ? orxConfig_OriginClearCallback : orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
 
-  /* Using shorthand? */
-  if(_u32ArgNumber == 1)
-  {
-    orxS32 s32SeparatorIndex;
+  /* Done! */
+  return;
+}
 
-    /* Looks for separator index */
-    s32SeparatorIndex = orxString_SearchCharIndex(zSection, orxCONFIG_KC_SECTION_SEPARATOR, 0);
+/** Command: GetOrigin
+ */
+void orxFASTCALL orxConfig_CommandGetOrigin(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = orxConfig_GetOrigin(_astArgList[0].zValue);
 
-    /* Found and no empty part? */
-    if((s32SeparatorIndex > 0) && (*(zSection + s32SeparatorIndex +1) != orxCHAR_NULL))
-    {
-      /* Updates key */
-      zKey = zSection + s32SeparatorIndex + 1;
+  /* Done! */
+  return;
+}
 
-      /* Allocates section buffer */
-      zSection = (const orxSTRING)orxMemory_StackAllocate(s32SeparatorIndex + 1);
+/** Command: SetOrigin
+ */
+void orxFASTCALL orxConfig_CommandSetOrigin(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = (orxConfig_SetOrigin(_astArgList[0].zValue, (_u32ArgNumber > 1) ? _astArgList[1].zValue : orxNULL) != orxSTATUS_FAILURE) ? _astArgList[0].zValue : orxSTRING_EMPTY;
 
-      /* Copies its name */
-      orxMemory_Copy((orxSTRING)zSection, _astArgList[0].zValue, s32SeparatorIndex);
-      *(orxSTRING)(zSection + s32SeparatorIndex) = orxCHAR_NULL;
-    }
-    else
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[Config.GetValue] Can't retrieve value from section <%s>: missing key!", zSection);
+  /* Done! */
+  return;
+}
 
-      /* Clears section */
-      zSection = orxNULL;
-    }
+/** Command: GetParent
+ */
+void orxFASTCALL orxConfig_CommandGetParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = ((*_astArgList[0].zValue != orxCHAR_NULL) && (*_astArgList[0].zValue != orxCONFIG_KC_INHERITANCE_MARKER)) ? orxConfig_GetParent(_astArgList[0].zValue) : orxConfig_GetParent(orxConfig_GetCurrentSection());
+  if(_pstResult->zValue == orxNULL)
+  {
+    _pstResult->zValue = orxSTRING_EMPTY;
   }
 
-  /* Valid? */
-  if(zSection != orxNULL)
-  {
-    orxS32  s32Index;
-    orxBOOL bPush = orxFALSE;
+  /* Done! */
+  return;
+}
 
-    /* Gets index */
-    s32Index = (_u32ArgNumber > 2) ? _astArgList[2].s32Value : -1;
+/** Command: SetParent
+ */
+void orxFASTCALL orxConfig_CommandSetParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = (orxConfig_SetParent(_astArgList[0].zValue, (_u32ArgNumber > 1) ? ((_astArgList[1].zValue[0] != orxCONFIG_KC_INHERITANCE_MARKER) ? _astArgList[1].zValue : orxSTRING_EMPTY) : orxNULL) != orxSTATUS_FAILURE) ? _astArgList[0].zValue : orxSTRING_EMPTY;
 
-    /* Not current? */
+  /* Done! */
+  return;
+}
+
+/** Command: SetDefaultParent
+ */
+void orxFASTCALL orxConfig_CommandSetDefaultParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = (orxConfig_SetDefaultParent((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxNULL) != orxSTATUS_FAILURE) ? ((_u32ArgNumber > 0) ? _astArgList[0].zValue : orxSTRING_EMPTY) : orxSTRING_EMPTY;
+
+  /* Done! */
+  return;
+}
+
+/** Command: GetDefaultParent
+ */
+void orxFASTCALL orxConfig_CommandGetDefaultParent(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = orxConfig_GetDefaultParent();
+  if(_pstResult->zValue == orxNULL)
+  {
+    _pstResult->zValue = orxSTRING_EMPTY;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Command: CreateSection
+ */
+void orxFASTCALL orxConfig_CommandCreateSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = (orxConfig_SelectSection(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? _astArgList[0].zValue : orxSTRING_EMPTY;
+
+  /* Done! */
+  return;
+}
+
+/** Command: HasSection
+ */
+void orxFASTCALL orxConfig_CommandHasSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_HasSection(_astArgList[0].zValue));
+
+  /* Done! */
+  return;
+}
+
+/** Command: RenameSection
+ */
+void orxFASTCALL orxConfig_CommandRenameSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Renames section */
+   orxConfig_RenameSection(_astArgList[0].zValue, _astArgList[1].zValue);
+
+  /* Updates result */
+  _pstResult->zValue = _astArgList[1].zValue;
+
+  /* Done! */
+  return;
+}
+
+/** Command: ClearSection
+ */
+void orxFASTCALL orxConfig_CommandClearSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Clears section */
+   orxConfig_ClearSection(_astArgList[0].zValue);
+
+  /* Updates result */
+  _pstResult->zValue = _astArgList[0].zValue;
+
+  /* Done! */
+  return;
+}
+
+/** Command: GetCurrentSection
+ */
+void orxFASTCALL orxConfig_CommandGetCurrentSection(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->zValue = orxConfig_GetCurrentSection();
+
+  /* Done! */
+  return;
+}
+
+/** Command: ClearValue
+ */
+void orxFASTCALL orxConfig_CommandClearValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  orxBOOL bPush;
+
+  /* Pushes section */
+  bPush = ((*_astArgList[0].zValue != orxCHAR_NULL) && (*_astArgList[0].zValue != orxCONFIG_KC_INHERITANCE_MARKER)) ? orxTRUE : orxFALSE;
+  if(bPush != orxFALSE)
+  {
+    orxConfig_PushSection(_astArgList[0].zValue);
+  }
+
+  /* Clears value */
+  orxConfig_ClearValue(_astArgList[1].zValue);
+
+  /* Pops section */
+  if(bPush != orxFALSE)
+  {
+    orxConfig_PopSection();
+  }
+
+  /* Updates result */
+  _pstResult->zValue = _astArgList[1].zValue;
+
+  /* Done! */
+  return;
+}
+
+/** Command: HasValue
+ */
+void orxFASTCALL orxConfig_CommandHasValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  orxBOOL bPush;
+
+  /* Pushes section */
+  bPush = ((*_astArgList[0].zValue != orxCHAR_NULL) && (*_astArgList[0].zValue != orxCONFIG_KC_INHERITANCE_MARKER)) ? orxTRUE : orxFALSE;
+  if(bPush != orxFALSE)
+  {
+    orxConfig_PushSection(_astArgList[0].zValue);
+  }
+
+  /* Updates result */
+  _pstResult->bValue = ((_u32ArgNumber > 2) && (_astArgList[2].bValue == orxFALSE)) ? orxConfig_HasValueNoCheck(_astArgList[1].zValue) : orxConfig_HasValue(_astArgList[1].zValue);
+
+  /* Pops section */
+  if(bPush != orxFALSE)
+  {
+    orxConfig_PopSection();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Command: GetValue
+ */
+void orxFASTCALL orxConfig_CommandGetValue(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  const orxSTRING zSection  = _astArgList[0].zValue;
+  const orxSTRING zKey      = _astArgList[1].zValue;
+
+  /* Using shorthand? */
+  if(_u32ArgNumber == 1)
+  {
+    orxS32 s32SeparatorIndex;
+
+    /* Looks for separator index */
+    s32SeparatorIndex = orxString_SearchCharIndex(zSection, orxCONFIG_KC_SECTION_SEPARATOR, 0);
+
+    /* Found and no empty part? */
+    if((s32SeparatorIndex > 0) && (*(zSection + s32SeparatorIndex +1) != orxCHAR_NULL))
+    {
+      /* Updates key */
+      zKey = zSection + s32SeparatorIndex + 1;
+
+      /* Allocates section buffer */
+      zSection = (const orxSTRING)orxMemory_StackAllocate(s32SeparatorIndex + 1);
+
+      /* Copies its name */
+      orxMemory_Copy((orxSTRING)zSection, _astArgList[0].zValue, s32SeparatorIndex);
+      *(orxSTRING)(zSection + s32SeparatorIndex) = orxCHAR_NULL;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[Config.GetValue] Can't retrieve value from section <%s>: missing key!", zSection);
+
+      /* Clears section */
+      zSection = orxNULL;
+    }
+  }
+
+  /* Valid? */
+  if(zSection != orxNULL)
+  {
+    orxS32  s32Index;
+    orxBOOL bPush = orxFALSE;
+
+    /* Gets index */
+    s32Index = (_u32ArgNumber > 2) ? _astArgList[2].s32Value : -1;
+
+    /* Not current? */
     if((*zSection != orxCHAR_NULL) && (*zSection != orxCONFIG_KC_INHERITANCE_MARKER))
     {
       /* Has section? */
@@ -4643,6 +5704,8 @@ static orxINLINE void orxConfig_RegisterCommands()
   orxCOMMAND_REGISTER_CORE_COMMAND(Config, Load, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"FileName", orxCOMMAND_VAR_TYPE_STRING});
   /* Command: Save */
   orxCOMMAND_REGISTER_CORE_COMMAND(Config, Save, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 2, {"FileName", orxCOMMAND_VAR_TYPE_STRING}, {"OnlyOrigin = false", orxCOMMAND_VAR_TYPE_BOOL}, {"Encrypt = false", orxCOMMAND_VAR_TYPE_BOOL});
+  /* Command: SaveBinary */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Config, SaveBinary, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 2, {"FileName", orxCOMMAND_VAR_TYPE_STRING}, {"OnlyOrigin = false", orxCOMMAND_VAR_TYPE_BOOL}, {"Encrypt = false", orxCOMMAND_VAR_TYPE_BOOL});
   /* Command: Reload */
   orxCOMMAND_REGISTER_CORE_COMMAND(Config, Reload, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
   /* Command: Clear */
@@ -4749,6 +5812,8 @@ static orxINLINE void orxConfig_UnregisterCommands()
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, Load);
   /* Command: Save */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, Save);
+  /* Command: SaveBinary */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, SaveBinary);
   /* Command: Reload */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, Reload);
   /* Command: Clear */
@@ -4950,6 +6015,13 @@ orxSTATUS orxFASTCALL orxConfig_Init()
       /* Sets default parent */
       orxConfig_SetDefaultParent(orxConfig_GetString(orxCONFIG_KZ_CONFIG_DEFAULT_PARENT));
 
+      /* Should use resolve cache? */
+      if(orxConfig_GetBool(orxCONFIG_KZ_CONFIG_RESOLVE_CACHE) != orxFALSE)
+      {
+        /* Updates flags */
+        orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_RESOLVE_CACHE, orxCONFIG_KU32_STATIC_FLAG_NONE);
+      }
+
       /* Sets default color list */
       orxConfig_SetDefaultColorList();
 
@@ -5021,6 +6093,8 @@ orxSTATUS orxFASTCALL orxConfig_Init()
  */
 void orxFASTCALL orxConfig_Exit()
 {
+  orxCONFIG_SECTION *pstSection;
+
   /* Initialized? */
   if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY))
   {
@@ -5036,6 +6110,16 @@ void orxFASTCALL orxConfig_Exit()
     /* Clears all data */
     orxConfig_Clear(orxNULL);
 
+    /* For all remaining sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstSection != orxNULL;
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      /* Deletes its entry & cache tables */
+      orxConfig_DeleteEntryTable(pstSection);
+      orxConfig_DeleteCacheTable(pstSection);
+    }
+
     /* Clears section list */
     orxLinkList_Clean(&(sstConfig.stSectionList));
 
@@ -5105,68 +6189,159 @@ orxBOOL orxFASTCALL orxConfig_IsTypoCheckEnabled()
   return bResult;
 }
 
-/** Sets encryption key
- * @param[in] _zEncryption key  Encryption key to use, orxNULL to clear
- * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+/** Enables/disables resolved value cache, which stores the result of inherited lookups per section until any section gets modified
+ * @param[in] _bEnable          Enable / disable
  */
-orxSTATUS orxFASTCALL orxConfig_SetEncryptionKey(const orxSTRING _zEncryptionKey)
+void orxFASTCALL orxConfig_EnableResolveCache(orxBOOL _bEnable)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
 
-  /* Had encryption key? */
-  if(sstConfig.zEncryptionKey != orxNULL)
+  /* Enable? */
+  if(_bEnable != orxFALSE)
   {
-    /* Deletes it */
-    free(sstConfig.zEncryptionKey);
-  }
+    /* Invalidates caches */
+    orxConfig_InvalidateCache(orxNULL);
 
-  /* Has new key? */
-  if((_zEncryptionKey != orxNULL) && (*_zEncryptionKey != orxCHAR_NULL))
-  {
-    /* Updates values */
-    sstConfig.u32EncryptionKeySize  = (orxU32)strlen(_zEncryptionKey);
-    sstConfig.zEncryptionKey        = (orxSTRING)malloc((size_t)(sstConfig.u32EncryptionKeySize + 1));
-    memcpy(sstConfig.zEncryptionKey, _zEncryptionKey, (size_t)(sstConfig.u32EncryptionKeySize + 1));
-    sstConfig.pcEncryptionChar      = sstConfig.zEncryptionKey;
+    /* Updates flags */
+    orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_RESOLVE_CACHE, orxCONFIG_KU32_STATIC_FLAG_NONE);
   }
   else
   {
-    /* Updates values */
-    sstConfig.zEncryptionKey        = orxNULL;
-    sstConfig.u32EncryptionKeySize  = 0;
-    sstConfig.pcEncryptionChar      = orxNULL;
+    /* Updates flags */
+    orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_NONE, orxCONFIG_KU32_STATIC_FLAG_RESOLVE_CACHE);
   }
 
   /* Done! */
-  return eResult;
+  return;
 }
 
-/** Gets encryption key
- * @return Current encryption key / orxSTRING_EMPTY
+/** Is resolved value cache enabled?
+ * @return orxTRUE / orxFALSE
  */
-const orxSTRING orxFASTCALL orxConfig_GetEncryptionKey()
+orxBOOL orxFASTCALL orxConfig_IsResolveCacheEnabled()
 {
-  const orxSTRING zResult;
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
 
   /* Updates result */
-  zResult = (sstConfig.zEncryptionKey != orxNULL) ? sstConfig.zEncryptionKey : orxSTRING_EMPTY;
+  bResult = orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_RESOLVE_CACHE) ? orxTRUE : orxFALSE;
 
   /* Done! */
-  return zResult;
+  return bResult;
 }
 
-/** Sets config bootstrap function: this function will get called when the config module is initialized, before any config file is loaded.
- * The only available APIs from within the bootstrap function are those of orxConfig and its dependencies (orxMemory, orxString, orxFile, orxEvent, orxResource, ...)
- * @param[in] _pfnBootstrap     Bootstrap function that will get called at module init, before loading any config file.
-                                If this function returns orxSTATUS_FAILURE, the default config file will be skipped, otherwise the regular load sequence will take place
+/** Gets resolved value cache usage
+ * @param[out] _pu32HitCount    Number of lookups served by the cache, orxNULL to ignore
+ * @param[out] _pu32MissCount   Number of lookups that had to walk the inheritance chain, orxNULL to ignore
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-orxSTATUS orxFASTCALL orxConfig_SetBootstrap(const orxCONFIG_BOOTSTRAP_FUNCTION _pfnBootstrap)
+orxSTATUS orxFASTCALL orxConfig_GetResolveCacheUsage(orxU32 *_pu32HitCount, orxU32 *_pu32MissCount)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
 
-  /* Stores it */
-  sstConfig.pfnBootstrap = _pfnBootstrap;
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Hit count? */
+  if(_pu32HitCount != orxNULL)
+  {
+    /* Updates it */
+    *_pu32HitCount = sstConfig.u32CacheHitCount;
+  }
+
+  /* Miss count? */
+  if(_pu32MissCount != orxNULL)
+  {
+    /* Updates it */
+    *_pu32MissCount = sstConfig.u32CacheMissCount;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets config generation, which changes every time any section or value gets modified, can be used to validate data derived from config
+ * @return Current config generation
+ */
+orxU32 orxFASTCALL orxConfig_GetGeneration()
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Updates result */
+  u32Result = sstConfig.u32CacheGeneration;
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Sets encryption key
+ * @param[in] _zEncryption key  Encryption key to use, orxNULL to clear
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_SetEncryptionKey(const orxSTRING _zEncryptionKey)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Had encryption key? */
+  if(sstConfig.zEncryptionKey != orxNULL)
+  {
+    /* Deletes it */
+    free(sstConfig.zEncryptionKey);
+  }
+
+  /* Has new key? */
+  if((_zEncryptionKey != orxNULL) && (*_zEncryptionKey != orxCHAR_NULL))
+  {
+    /* Updates values */
+    sstConfig.u32EncryptionKeySize  = (orxU32)strlen(_zEncryptionKey);
+    sstConfig.zEncryptionKey        = (orxSTRING)malloc((size_t)(sstConfig.u32EncryptionKeySize + 1));
+    memcpy(sstConfig.zEncryptionKey, _zEncryptionKey, (size_t)(sstConfig.u32EncryptionKeySize + 1));
+    sstConfig.pcEncryptionChar      = sstConfig.zEncryptionKey;
+  }
+  else
+  {
+    /* Updates values */
+    sstConfig.zEncryptionKey        = orxNULL;
+    sstConfig.u32EncryptionKeySize  = 0;
+    sstConfig.pcEncryptionChar      = orxNULL;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets encryption key
+ * @return Current encryption key / orxSTRING_EMPTY
+ */
+const orxSTRING orxFASTCALL orxConfig_GetEncryptionKey()
+{
+  const orxSTRING zResult;
+
+  /* Updates result */
+  zResult = (sstConfig.zEncryptionKey != orxNULL) ? sstConfig.zEncryptionKey : orxSTRING_EMPTY;
+
+  /* Done! */
+  return zResult;
+}
+
+/** Sets config bootstrap function: this function will get called when the config module is initialized, before any config file is loaded.
+ * The only available APIs from within the bootstrap function are those of orxConfig and its dependencies (orxMemory, orxString, orxFile, orxEvent, orxResource, ...)
+ * @param[in] _pfnBootstrap     Bootstrap function that will get called at module init, before loading any config file.
+                                If this function returns orxSTATUS_FAILURE, the default config file will be skipped, otherwise the regular load sequence will take place
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_SetBootstrap(const orxCONFIG_BOOTSTRAP_FUNCTION _pfnBootstrap)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Stores it */
+  sstConfig.pfnBootstrap = _pfnBootstrap;
 
   /* Done! */
   return eResult;
@@ -5342,6 +6517,16 @@ orxSTATUS orxFASTCALL orxConfig_Load(const orxSTRING _zFileName)
           bUseEncryption = orxFALSE;
         }
 
+        /* Is a binary image? */
+        if((u32Size - u32Offset >= orxCONFIG_KU32_BINARY_TAG_LENGTH)
+        && (orxMemory_Compare(acBuffer + u32Offset, orxCONFIG_KZ_BINARY_TAG, orxCONFIG_KU32_BINARY_TAG_LENGTH) == 0))
+        {
+          /* Loads it */
+          eResult = orxConfig_LoadBinary(_zFileName, hResource, acBuffer + u32Offset, u32Size - u32Offset, u32Offset, bUseEncryption);
+
+          break;
+        }
+
         /* Has UTF-8 BOM? */
         if(orxString_NCompare(acBuffer + u32Offset, orxCONFIG_KZ_UTF8_BOM, orxCONFIG_KU32_UTF8_BOM_LENGTH) == 0)
         {
@@ -5836,6 +7021,288 @@ orxSTATUS orxFASTCALL orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEn
   return eResult;
 }
 
+/** Writes config to given file as a binary image, which will be loaded without any parsing by orxConfig_Load. Will overwrite any existing file.
+ * @param[in] _zFileName        File name, if null or empty the default file name will be used
+ * @param[in] _bUseEncryption   Use file encryption to make it human non-readable?
+ * @param[in] _pfnSaveCallback  Callback used to filter sections/keys to save. If null, all sections/keys will be saved
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_SaveBinary(const orxSTRING _zFileName, orxBOOL _bUseEncryption, const orxCONFIG_SAVE_FUNCTION _pfnSaveCallback)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_SaveBinary");
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* No encryption requested or has a valid key? */
+  if((_bUseEncryption == orxFALSE) || (sstConfig.zEncryptionKey != orxNULL))
+  {
+    orxCONFIG_BINARY_HEADER stHeader;
+    orxCONFIG_SECTION      *pstSection;
+    const orxSTRING         zFileName;
+    orxCHAR                *acImage;
+    orxU32                  u32ImageSize;
+
+    /* Is given an invalid file name? */
+    if((_zFileName == orxNULL) || (*_zFileName == orxCHAR_NULL))
+    {
+      /* Uses default file */
+      zFileName = sstConfig.zBaseFile;
+    }
+    else
+    {
+      /* Uses given one */
+      zFileName = _zFileName;
+    }
+
+    /* Inits header */
+    orxMemory_Zero(&stHeader, sizeof(orxCONFIG_BINARY_HEADER));
+    orxMemory_Copy(stHeader.acTag, orxCONFIG_KZ_BINARY_TAG, orxCONFIG_KU32_BINARY_TAG_LENGTH);
+    stHeader.u32Version     = orxCONFIG_KU32_BINARY_VERSION;
+    stHeader.u32Endianness  = orxCONFIG_KU32_BINARY_ENDIANNESS;
+    stHeader.u32EntrySize   = (orxU32)sizeof(orxCONFIG_BINARY_ENTRY);
+
+    /* For all sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstSection != orxNULL;
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      /* No callback or should save it? */
+      if((_pfnSaveCallback == orxNULL) || (_pfnSaveCallback(pstSection->zName, orxNULL, zFileName, _bUseEncryption) != orxFALSE))
+      {
+        orxCONFIG_ENTRY *pstEntry;
+
+        /* Updates section count */
+        stHeader.u32SectionCount++;
+
+        /* Updates pool size with name and inheritance */
+        stHeader.u32PoolSize += orxString_GetLength(pstSection->zName) + 1;
+        stHeader.u32PoolSize += (pstSection->pstParent == orxHANDLE_UNDEFINED) ? 2 : (pstSection->pstParent != orxNULL) ? orxString_GetLength(pstSection->pstParent->zName) + 1 : 0;
+
+        /* For all entries */
+        for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+            pstEntry != orxNULL;
+            pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+        {
+          const orxSTRING zKey;
+
+          /* Gets key */
+          zKey = orxString_GetFromID(pstEntry->stID);
+
+          /* No callback or should save it? */
+          if((_pfnSaveCallback == orxNULL) || (_pfnSaveCallback(pstSection->zName, zKey, zFileName, _bUseEncryption) != orxFALSE))
+          {
+            /* Updates counts */
+            stHeader.u32EntryCount++;
+            stHeader.u32PoolSize += orxString_GetLength(zKey) + 1 + orxConfig_GetWorkingValueSize(&(pstEntry->stValue));
+            stHeader.u32IndexCount += orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST) ? (orxU32)(pstEntry->stValue.u16ListCount - 1) : 0;
+          }
+        }
+      }
+    }
+
+    /* Gets image size */
+    u32ImageSize = (orxU32)(sizeof(orxCONFIG_BINARY_HEADER) + stHeader.u32SectionCount * sizeof(orxCONFIG_BINARY_SECTION) + stHeader.u32EntryCount * sizeof(orxCONFIG_BINARY_ENTRY) + stHeader.u32IndexCount * sizeof(orxU32) + stHeader.u32PoolSize);
+
+    /* Allocates it */
+    acImage = (orxCHAR *)orxMemory_Allocate(u32ImageSize, orxMEMORY_TYPE_TEMP);
+
+    /* Success? */
+    if(acImage != orxNULL)
+    {
+      orxCONFIG_BINARY_SECTION *pstSectionRecord;
+      orxCONFIG_BINARY_ENTRY   *pstEntryRecord;
+      orxU32                   *au32IndexList;
+      orxCHAR                  *acPool;
+      const orxSTRING           zResourceLocation;
+      orxHANDLE                 hResource;
+      orxU32                    u32PoolOffset, u32IndexOffset;
+
+      /* Clears it */
+      orxMemory_Zero(acImage, u32ImageSize);
+
+      /* Stores header */
+      orxMemory_Copy(acImage, &stHeader, sizeof(orxCONFIG_BINARY_HEADER));
+
+      /* Gets all tables */
+      pstSectionRecord  = (orxCONFIG_BINARY_SECTION *)(acImage + sizeof(orxCONFIG_BINARY_HEADER));
+      pstEntryRecord    = (orxCONFIG_BINARY_ENTRY *)(pstSectionRecord + stHeader.u32SectionCount);
+      au32IndexList     = (orxU32 *)(pstEntryRecord + stHeader.u32EntryCount);
+      acPool            = (orxCHAR *)(au32IndexList + stHeader.u32IndexCount);
+
+      /* For all sections */
+      for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList)), u32PoolOffset = 0, u32IndexOffset = 0;
+          pstSection != orxNULL;
+          pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+      {
+        /* No callback or should save it? */
+        if((_pfnSaveCallback == orxNULL) || (_pfnSaveCallback(pstSection->zName, orxNULL, zFileName, _bUseEncryption) != orxFALSE))
+        {
+          orxCONFIG_ENTRY *pstEntry;
+
+          /* Stores name offset */
+          pstSectionRecord->u32NameOffset = u32PoolOffset;
+
+          /* Forces default section? */
+          if(pstSection->pstParent == orxHANDLE_UNDEFINED)
+          {
+            /* Writes name */
+            u32PoolOffset += (orxU32)orxString_NPrint(acPool + u32PoolOffset, stHeader.u32PoolSize - u32PoolOffset, "%s%c%c", pstSection->zName, orxCONFIG_KC_INHERITANCE_MARKER, orxCONFIG_KC_INHERITANCE_MARKER) + 1;
+          }
+          /* Has a valid parent section */
+          else if(pstSection->pstParent != orxNULL)
+          {
+            /* Writes name with inheritance */
+            u32PoolOffset += (orxU32)orxString_NPrint(acPool + u32PoolOffset, stHeader.u32PoolSize - u32PoolOffset, "%s%c%s", pstSection->zName, orxCONFIG_KC_INHERITANCE_MARKER, pstSection->pstParent->zName) + 1;
+          }
+          else
+          {
+            /* Writes name */
+            u32PoolOffset += (orxU32)orxString_NPrint(acPool + u32PoolOffset, stHeader.u32PoolSize - u32PoolOffset, "%s", pstSection->zName) + 1;
+          }
+
+          /* For all entries */
+          for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+              pstEntry != orxNULL;
+              pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+          {
+            const orxSTRING zKey;
+
+            /* Gets key */
+            zKey = orxString_GetFromID(pstEntry->stID);
+
+            /* No callback or should save it? */
+            if((_pfnSaveCallback == orxNULL) || (_pfnSaveCallback(pstSection->zName, zKey, zFileName, _bUseEncryption) != orxFALSE))
+            {
+              const orxCONFIG_VALUE  *pstValue;
+              orxU32                  u32Length;
+
+              /* Gets value */
+              pstValue = &(pstEntry->stValue);
+
+              /* Stores key */
+              u32Length = orxString_GetLength(zKey) + 1;
+              orxMemory_Copy(acPool + u32PoolOffset, zKey, u32Length);
+              pstEntryRecord->stID          = pstEntry->stID;
+              pstEntryRecord->u32KeyOffset  = u32PoolOffset;
+              u32PoolOffset                += u32Length;
+
+              /* Stores working value, including its inner list separators */
+              u32Length = orxConfig_GetWorkingValueSize(pstValue);
+              orxMemory_Copy(acPool + u32PoolOffset, pstValue->zValue, u32Length);
+              pstEntryRecord->u32ValueOffset  = u32PoolOffset;
+              pstEntryRecord->u32ValueSize    = u32Length;
+              u32PoolOffset                  += u32Length;
+
+              /* Is a list? */
+              if(orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+              {
+                /* Stores its index table */
+                orxMemory_Copy(au32IndexList + u32IndexOffset, pstValue->au32ListIndexTable, (orxU32)(pstValue->u16ListCount - 1) * sizeof(orxU32));
+                pstEntryRecord->u32IndexOffset  = u32IndexOffset;
+                u32IndexOffset                 += (orxU32)(pstValue->u16ListCount - 1);
+              }
+
+              /* Stores status */
+              pstEntryRecord->u16Flags      = pstValue->u16Flags & ~orxCONFIG_VALUE_KU16_FLAG_ALLOCATION;
+              pstEntryRecord->u16ListCount  = pstValue->u16ListCount;
+              pstEntryRecord->u16CacheIndex = pstValue->u16CacheIndex;
+
+              /* Has a cached typed value that doesn't depend on a command? */
+              if((pstValue->u16Type != (orxU16)orxCONFIG_VALUE_TYPE_STRING)
+              && (!orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_COMMAND)))
+              {
+                /* Stores it */
+                pstEntryRecord->u16Type = pstValue->u16Type;
+                orxVector_Copy(&(pstEntryRecord->vValue), &(pstValue->vValue));
+                orxVector_Copy(&(pstEntryRecord->vAltValue), &(pstValue->vAltValue));
+                orxVector_Copy(&(pstEntryRecord->vStepValue), &(pstValue->vStepValue));
+              }
+              else
+              {
+                /* Stores string type */
+                pstEntryRecord->u16Type = (orxU16)orxCONFIG_VALUE_TYPE_STRING;
+              }
+
+              /* Updates section record */
+              pstSectionRecord->u32EntryCount++;
+
+              /* Next record */
+              pstEntryRecord++;
+            }
+          }
+
+          /* Next record */
+          pstSectionRecord++;
+        }
+      }
+
+      /* Checks */
+      orxASSERT(u32PoolOffset == stHeader.u32PoolSize);
+      orxASSERT(u32IndexOffset == stHeader.u32IndexCount);
+
+      /* Valid file to open? */
+      if(((zResourceLocation = orxResource_LocateInStorage(orxCONFIG_KZ_RESOURCE_GROUP, orxRESOURCE_KZ_DEFAULT_STORAGE, zFileName)) != orxNULL)
+      && ((hResource = orxResource_Open(zResourceLocation, orxTRUE)) != orxHANDLE_UNDEFINED))
+      {
+        /* Use encryption? */
+        if(_bUseEncryption != orxFALSE)
+        {
+          orxCHAR *pcPreviousEncryptionChar;
+
+          /* Gets previous encryption character */
+          pcPreviousEncryptionChar = sstConfig.pcEncryptionChar;
+
+          /* Resets current encryption character */
+          sstConfig.pcEncryptionChar = sstConfig.zEncryptionKey;
+
+          /* Adds encryption tag */
+          orxResource_Write(hResource, orxCONFIG_KU32_ENCRYPTION_TAG_LENGTH, orxCONFIG_KZ_ENCRYPTION_TAG, orxNULL, orxNULL);
+
+          /* Encrypts image */
+          orxConfig_CryptBuffer(acImage, u32ImageSize);
+
+          /* Restores previous encryption character */
+          sstConfig.pcEncryptionChar = pcPreviousEncryptionChar;
+        }
+
+        /* Saves image */
+        eResult = (orxResource_Write(hResource, (orxS64)u32ImageSize, acImage, orxNULL, orxNULL) == (orxS64)u32ImageSize) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+        /* Flushes & closes the resource */
+        orxResource_Close(hResource);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save file, can't open file on disk!", zFileName);
+      }
+
+      /* Deletes image */
+      orxMemory_Free(acImage);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save binary file, couldn't allocate memory.", zFileName);
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save file with encryption, no valid encryption key provided!", _zFileName);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
 /** Copies a file with optional encryption
  * @param[in] _zDstFileName     Name of the destination file
  * @param[in] _zSrcFileName     Name of the source file
@@ -6068,102 +7535,542 @@ orxSTATUS orxFASTCALL orxConfig_MergeFiles(const orxSTRING _zDstFileName, const
   return eResult;
 }
 
-/** Selects current working section
- * @param[in] _zSectionName     Section name to select
- * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+/** Selects current working section
+ * @param[in] _zSectionName     Section name to select
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_SelectSection(const orxSTRING _zSectionName)
+{
+  orxSTATUS eResult;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_SelectSection");
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSectionName != orxNULL);
+
+  /* Selects section */
+  eResult = orxConfig_SelectSectionInternal(_zSectionName);
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Renames a section
+ * @param[in] _zSectionName     Section to rename
+ * @param[in] _zNewSectionName  New name for the section
+ */
+orxSTATUS orxFASTCALL orxConfig_RenameSection(const orxSTRING _zSectionName, const orxSTRING _zNewSectionName)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSectionName != orxNULL);
+  orxASSERT(_zNewSectionName != orxNULL);
+
+  /* Valid? */
+  if((*_zSectionName != orxCHAR_NULL) && (*_zNewSectionName != orxCHAR_NULL))
+  {
+    /* No inheritance markers? */
+    if((orxString_SearchCharIndex(_zSectionName, orxCONFIG_KC_INHERITANCE_MARKER, 0) < 0)
+    && (orxString_SearchCharIndex(_zNewSectionName, orxCONFIG_KC_INHERITANCE_MARKER, 0) < 0))
+    {
+      orxCONFIG_SECTION  *pstSection;
+      orxSTRINGID         stID;
+
+      /* Gets section name ID */
+      stID = orxString_Hash(_zSectionName);
+
+      /* Gets it from table */
+      pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, stID);
+
+      /* Valid? */
+      if(pstSection != orxNULL)
+      {
+        const orxSTRING zNewName;
+
+        /* Get new name */
+        zNewName = orxString_Store(_zNewSectionName);
+
+        /* Stores it */
+        pstSection->zName = zNewName;
+
+        /* Removes it from table */
+        orxHashTable_Remove(sstConfig.pstSectionTable, stID);
+
+        /* Adds it again with the new ID */
+        orxHashTable_Add(sstConfig.pstSectionTable, orxString_Hash(_zNewSectionName), pstSection);
+
+        /* Invalidates caches */
+        orxConfig_InvalidateCache(orxNULL);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Can't rename section [%s] -> <%s>: section not found.", _zSectionName, _zNewSectionName);
+
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Can't rename section [%s] -> <%s>: inheritance marker detected.", _zSectionName, _zNewSectionName);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Can't rename section [%s] -> <%s>: empty name.", _zSectionName, _zNewSectionName);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Sets a section's parent
+ * @param[in] _zSectionName     Concerned section, if the section doesn't exist, it will be created
+ * @param[in] _zParentName      Parent section's name, if the section doesn't exist, it will be created, if orxNULL is provided, the former parent will be erased, if orxSTRING_EMPTY is provided, "no default parent" will be enforced
+ */
+orxSTATUS orxFASTCALL orxConfig_SetParent(const orxSTRING _zSectionName, const orxSTRING _zParentName)
+{
+  orxCONFIG_SECTION  *pstPreviousSection;
+  orxSTATUS           eResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSectionName != orxNULL);
+
+  /* Backups current section */
+  pstPreviousSection = sstConfig.pstCurrentSection;
+
+  /* Selects concerned section */
+  eResult = orxConfig_SelectSection(_zSectionName);
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Invalidates caches */
+    orxConfig_InvalidateCache(sstConfig.pstCurrentSection);
+
+    /* Already has a parent? */
+    if((sstConfig.pstCurrentSection->pstParent != orxNULL) && (sstConfig.pstCurrentSection->pstParent != orxHANDLE_UNDEFINED))
+    {
+      /* Unprotects it */
+      sstConfig.pstCurrentSection->pstParent->s32ProtectionCount--;
+
+      /* Checks */
+      orxASSERT(sstConfig.pstCurrentSection->pstParent->s32ProtectionCount >= 0);
+
+      /* Removes its reference */
+      sstConfig.pstCurrentSection->pstParent = orxNULL;
+    }
+
+    /* No new parent? */
+    if(_zParentName == orxNULL)
+    {
+      /* Clears its parent */
+      sstConfig.pstCurrentSection->pstParent = orxNULL;
+    }
+    /* Force no parent? */
+    else if(*_zParentName == orxCHAR_NULL)
+    {
+      /* Updates section */
+      sstConfig.pstCurrentSection->pstParent = (orxCONFIG_SECTION *)orxHANDLE_UNDEFINED;
+    }
+    /* New parent */
+    else
+    {
+      orxCONFIG_SECTION *pstSection;
+
+      /* Stores it */
+      pstSection = sstConfig.pstCurrentSection;
+
+      /* Selects parent section */
+      eResult = orxConfig_SelectSection(_zParentName);
+
+      /* Success? */
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        /* Updates concerned section's parent */
+        pstSection->pstParent = sstConfig.pstCurrentSection;
+
+        /* Protects it */
+        sstConfig.pstCurrentSection->s32ProtectionCount++;
+      }
+    }
+  }
+
+  /* Restores previous section */
+  sstConfig.pstCurrentSection = pstPreviousSection;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets a section's parent
+ * @param[in] _zSectionName     Concerned section
+ * @return Section's parent name if set, orxSTRING_EMPTY if no parent has been forced or orxNULL otherwise
+ */
+const orxSTRING orxFASTCALL orxConfig_GetParent(const orxSTRING _zSectionName)
+{
+  const orxSTRING zResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSectionName != orxNULL);
+
+  /* Has section? */
+  if(orxConfig_HasSection(_zSectionName) != orxFALSE)
+  {
+    orxCONFIG_SECTION *pstPreviousSection;
+
+    /* Backups current section */
+    pstPreviousSection = sstConfig.pstCurrentSection;
+
+    /* Selects concerned section */
+    if(orxConfig_SelectSection(_zSectionName) != orxSTATUS_FAILURE)
+    {
+      /* Has parent? */
+      if(sstConfig.pstCurrentSection->pstParent != orxNULL)
+      {
+        /* Updates result */
+        zResult = (sstConfig.pstCurrentSection->pstParent != orxHANDLE_UNDEFINED) ? sstConfig.pstCurrentSection->pstParent->zName : orxSTRING_EMPTY;
+      }
+    }
+
+    /* Restores previous section */
+    sstConfig.pstCurrentSection = pstPreviousSection;
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+/** Gets parent distance, ie. how far up the ancestry of a given section is a parent (does not consider the default parent)
+ * @param[in] _zSectionName     Concerned section
+ * @param[in] _zParentName      Parent section name to check
+ * @return 1 for a direct parent, 2 for a grandparent, etc., and 0 if not found in the ancestry
+ */
+orxU32 orxFASTCALL orxConfig_GetParentDistance(const orxSTRING _zSectionName, const orxSTRING _zParentName)
+{
+  orxCONFIG_SECTION  *pstSection;
+  orxU32              u32Result = 0, i;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSectionName != orxNULL);
+  orxASSERT(_zParentName != orxNULL);
+
+  /* Gets section */
+  pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_Hash(_zSectionName));
+
+  /* Valid? */
+  if(pstSection != orxNULL)
+  {
+    /* For all parents */
+    for(i = 1, pstSection = pstSection->pstParent;
+        (pstSection != orxNULL) && (pstSection != orxHANDLE_UNDEFINED);
+        i++, pstSection = pstSection->pstParent)
+    {
+      /* Found? */
+      if(orxString_Compare(pstSection->zName, _zParentName) == 0)
+      {
+        /* Updates result */
+        u32Result = i;
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Is section affected by an update of another section, ie. is the updated section the section itself or one of its ancestors (default parent included)?
+ * @param[in] _zSectionName     Concerned section
+ * @param[in] _zUpdatedSectionName Updated section name, as sent with orxCONFIG_EVENT_SECTION_UPDATE
+ * @return orxTRUE if affected, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxConfig_IsSectionAffected(const orxSTRING _zSectionName, const orxSTRING _zUpdatedSectionName)
+{
+  orxBOOL bResult = orxFALSE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSectionName != orxNULL);
+  orxASSERT(_zUpdatedSectionName != orxNULL);
+
+  /* Same section? */
+  if(orxString_Compare(_zSectionName, _zUpdatedSectionName) == 0)
+  {
+    /* Updates result */
+    bResult = orxTRUE;
+  }
+  else
+  {
+    orxCONFIG_SECTION  *pstSection;
+    orxBOOL             bUseDefault = orxTRUE;
+
+    /* Gets section */
+    pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_Hash(_zSectionName));
+
+    /* For all its ancestors */
+    for(pstSection = (pstSection != orxNULL) ? orxConfig_GetNextAncestor(pstSection, &bUseDefault) : orxNULL;
+        pstSection != orxNULL;
+        pstSection = orxConfig_GetNextAncestor(pstSection, &bUseDefault))
+    {
+      /* Found? */
+      if(orxString_Compare(pstSection->zName, _zUpdatedSectionName) == 0)
+      {
+        /* Updates result */
+        bResult = orxTRUE;
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Gets section generation, which changes every time the section or one of its ancestors (default parent included) gets modified, can be used to validate data derived from a section
+ * @param[in] _zSectionName     Concerned section
+ * @return Section generation
+ */
+orxU32 orxFASTCALL orxConfig_GetSectionGeneration(const orxSTRING _zSectionName)
+{
+  orxCONFIG_SECTION  *pstSection;
+  orxBOOL             bUseDefault = orxTRUE;
+  orxU32              u32Result;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSectionName != orxNULL);
+
+  /* Inits result */
+  u32Result = sstConfig.u32GlobalStamp;
+
+  /* For the section and all its ancestors */
+  for(pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_Hash(_zSectionName));
+      pstSection != orxNULL;
+      pstSection = orxConfig_GetNextAncestor(pstSection, &bUseDefault))
+  {
+    /* Contains values inherited from other sections? */
+    if(orxFLAG_TEST(pstSection->u32Flags, orxCONFIG_SECTION_KU32_FLAG_REFERENCE))
+    {
+      /* Depends on any modification */
+      u32Result = sstConfig.u32CacheGeneration;
+      break;
+    }
+
+    /* Updates result */
+    u32Result = orxMAX(u32Result, pstSection->u32Stamp);
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Sets default parent for all sections
+* @param[in] _zSectionName     Section name that will be used as an implicit default parent section for all config sections, if orxNULL is provided, default parent will be removed
+* @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+*/
+orxSTATUS orxFASTCALL orxConfig_SetDefaultParent(const orxSTRING _zSectionName)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Invalidates caches */
+  orxConfig_InvalidateCache(orxNULL);
+
+  /* Has current default parent? */
+  if(sstConfig.pstDefaultParent != orxNULL)
+  {
+    /* Unprotects it */
+    sstConfig.pstDefaultParent->s32ProtectionCount--;
+
+    /* Checks */
+    orxASSERT(sstConfig.pstDefaultParent->s32ProtectionCount >= 0);
+
+    /* Clears it */
+    sstConfig.pstDefaultParent = orxNULL;
+  }
+
+  /* Valid? */
+  if((_zSectionName != orxNULL) && (*_zSectionName != orxCHAR_NULL))
+  {
+    orxCONFIG_SECTION *pstPreviousSection;
+
+    /* Backups current section */
+    pstPreviousSection = sstConfig.pstCurrentSection;
+
+    /* Selects default parent section */
+    eResult = orxConfig_SelectSection(_zSectionName);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Checks */
+      orxASSERT(sstConfig.pstCurrentSection != orxNULL);
+
+      /* Protects it */
+      sstConfig.pstCurrentSection->s32ProtectionCount++;
+
+      /* Stores it */
+      sstConfig.pstDefaultParent = sstConfig.pstCurrentSection;
+    }
+
+    /* Restores current section */
+    sstConfig.pstCurrentSection = pstPreviousSection;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets default parent for all sections
+ * @return Default parent name if set, orxNULL otherwise
+ */
+const orxSTRING orxFASTCALL orxConfig_GetDefaultParent()
+{
+  const orxSTRING zResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Has default parent? */
+  if(sstConfig.pstDefaultParent != orxNULL)
+  {
+    /* Updates result */
+    zResult = sstConfig.pstDefaultParent->zName;
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+/** Gets current working section
+ * @return Current selected section
  */
-orxSTATUS orxFASTCALL orxConfig_SelectSection(const orxSTRING _zSectionName)
+const orxSTRING orxFASTCALL orxConfig_GetCurrentSection()
 {
-  orxSTATUS eResult;
-
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxConfig_SelectSection");
+  const orxSTRING zResult;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zSectionName != orxNULL);
-
-  /* Selects section */
-  eResult = orxConfig_SelectSectionInternal(_zSectionName);
 
-  /* Profiles */
-  orxPROFILER_POP_MARKER();
+  /* Has selected section? */
+  if(sstConfig.pstCurrentSection != orxNULL)
+  {
+    /* Updates result */
+    zResult = sstConfig.pstCurrentSection->zName;
+  }
+  else
+  {
+    /* Updates result */
+    zResult = orxSTRING_EMPTY;
+  }
 
   /* Done! */
-  return eResult;
+  return zResult;
 }
 
-/** Renames a section
- * @param[in] _zSectionName     Section to rename
- * @param[in] _zNewSectionName  New name for the section
+/** Pushes a section (storing the current one on section stack)
+ * @param[in] _zSectionName     Section name to push
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-orxSTATUS orxFASTCALL orxConfig_RenameSection(const orxSTRING _zSectionName, const orxSTRING _zNewSectionName)
+orxSTATUS orxFASTCALL orxConfig_PushSection(const orxSTRING _zSectionName)
 {
   orxSTATUS eResult;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zSectionName != orxNULL);
-  orxASSERT(_zNewSectionName != orxNULL);
 
   /* Valid? */
-  if((*_zSectionName != orxCHAR_NULL) && (*_zNewSectionName != orxCHAR_NULL))
+  if(*_zSectionName != orxCHAR_NULL)
   {
-    /* No inheritance markers? */
-    if((orxString_SearchCharIndex(_zSectionName, orxCONFIG_KC_INHERITANCE_MARKER, 0) < 0)
-    && (orxString_SearchCharIndex(_zNewSectionName, orxCONFIG_KC_INHERITANCE_MARKER, 0) < 0))
-    {
-      orxCONFIG_SECTION  *pstSection;
-      orxSTRINGID         stID;
+    orxCONFIG_SECTION *pstCurrentSection;
 
-      /* Gets section name ID */
-      stID = orxString_Hash(_zSectionName);
+    /* Stores current section */
+    pstCurrentSection = sstConfig.pstCurrentSection;
 
-      /* Gets it from table */
-      pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, stID);
+    /* Selects requested section */
+    eResult = orxConfig_SelectSection(_zSectionName);
 
-      /* Valid? */
-      if(pstSection != orxNULL)
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Isn't stack full? */
+      if(sstConfig.u32CurrentStackEntry < orxCONFIG_KU32_STACK_SIZE)
       {
-        const orxSTRING zNewName;
-
-        /* Get new name */
-        zNewName = orxString_Store(_zNewSectionName);
-
-        /* Stores it */
-        pstSection->zName = zNewName;
-
-        /* Removes it from table */
-        orxHashTable_Remove(sstConfig.pstSectionTable, stID);
-
-        /* Adds it again with the new ID */
-        orxHashTable_Add(sstConfig.pstSectionTable, orxString_Hash(_zNewSectionName), pstSection);
-
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
+        /* Updates stack */
+        sstConfig.apstSectionStack[sstConfig.u32CurrentStackEntry++] = pstCurrentSection;
       }
       else
       {
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Can't rename section [%s] -> <%s>: section not found.", _zSectionName, _zNewSectionName);
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Failed to push section: section stack is full.", _zSectionName);
+
+        /* Restores current section */
+        sstConfig.pstCurrentSection = pstCurrentSection;
 
         /* Updates result */
         eResult = orxSTATUS_FAILURE;
       }
     }
-    else
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Can't rename section [%s] -> <%s>: inheritance marker detected.", _zSectionName, _zNewSectionName);
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
 
-      /* Updates result */
-      eResult = orxSTATUS_FAILURE;
-    }
+  /* Done! */
+  return eResult;
+}
+
+/** Pops last section from section stack
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_PopSection()
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Has stacked entry? */
+  if(sstConfig.u32CurrentStackEntry != 0)
+  {
+    /* Updates current section */
+    sstConfig.pstCurrentSection = sstConfig.apstSectionStack[--sstConfig.u32CurrentStackEntry];
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
   }
   else
   {
     /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Can't rename section [%s] -> <%s>: empty name.", _zSectionName, _zNewSectionName);
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Failed to pop section: section stack is empty.");
 
     /* Updates result */
     eResult = orxSTATUS_FAILURE;
@@ -6173,254 +8080,200 @@ orxSTATUS orxFASTCALL orxConfig_RenameSection(const orxSTRING _zSectionName, con
   return eResult;
 }
 
-/** Sets a section's parent
- * @param[in] _zSectionName     Concerned section, if the section doesn't exist, it will be created
- * @param[in] _zParentName      Parent section's name, if the section doesn't exist, it will be created, if orxNULL is provided, the former parent will be erased, if orxSTRING_EMPTY is provided, "no default parent" will be enforced
+/** Has section for the given section name?
+ * @param[in] _zSectionName     Section name
+ * @return orxTRUE / orxFALSE
  */
-orxSTATUS orxFASTCALL orxConfig_SetParent(const orxSTRING _zSectionName, const orxSTRING _zParentName)
+orxBOOL orxFASTCALL orxConfig_HasSection(const orxSTRING _zSectionName)
 {
-  orxCONFIG_SECTION  *pstPreviousSection;
-  orxSTATUS           eResult;
+  orxBOOL bResult = orxFALSE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zSectionName != orxNULL);
 
-  /* Backups current section */
-  pstPreviousSection = sstConfig.pstCurrentSection;
-
-  /* Selects concerned section */
-  eResult = orxConfig_SelectSection(_zSectionName);
-
-  /* Success? */
-  if(eResult != orxSTATUS_FAILURE)
+  /* Valid? */
+  if(*_zSectionName != orxCHAR_NULL)
   {
-    /* Already has a parent? */
-    if((sstConfig.pstCurrentSection->pstParent != orxNULL) && (sstConfig.pstCurrentSection->pstParent != orxHANDLE_UNDEFINED))
-    {
-      /* Unprotects it */
-      sstConfig.pstCurrentSection->pstParent->s32ProtectionCount--;
+    /* Updates result */
+    bResult = (orxHashTable_Get(sstConfig.pstSectionTable, orxString_Hash(_zSectionName)) != orxNULL) ? orxTRUE : orxFALSE;
+  }
 
-      /* Checks */
-      orxASSERT(sstConfig.pstCurrentSection->pstParent->s32ProtectionCount >= 0);
+  /* Done! */
+  return bResult;
+}
 
-      /* Removes its reference */
-      sstConfig.pstCurrentSection->pstParent = orxNULL;
-    }
+/** Protects/unprotects a section from deletion (content might still be changed or deleted, but the section itself will resist delete/clear calls)
+ * @param[in] _zSectionName     Section name to protect
+ * @param[in] _bProtect         orxTRUE for protecting the section, orxFALSE to remove the protection
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_ProtectSection(const orxSTRING _zSectionName, orxBOOL _bProtect)
+{
+  orxCONFIG_SECTION  *pstSection;
+  orxSTRINGID         stID;
+  orxSTATUS           eResult = orxSTATUS_FAILURE;
 
-    /* No new parent? */
-    if(_zParentName == orxNULL)
-    {
-      /* Clears its parent */
-      sstConfig.pstCurrentSection->pstParent = orxNULL;
-    }
-    /* Force no parent? */
-    else if(*_zParentName == orxCHAR_NULL)
-    {
-      /* Updates section */
-      sstConfig.pstCurrentSection->pstParent = (orxCONFIG_SECTION *)orxHANDLE_UNDEFINED;
-    }
-    /* New parent */
-    else
-    {
-      orxCONFIG_SECTION *pstSection;
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSectionName != orxNULL);
 
-      /* Stores it */
-      pstSection = sstConfig.pstCurrentSection;
+  /* Gets section name ID */
+  stID = orxString_Hash(_zSectionName);
 
-      /* Selects parent section */
-      eResult = orxConfig_SelectSection(_zParentName);
+  /* Gets it from table */
+  pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, stID);
 
-      /* Success? */
-      if(eResult != orxSTATUS_FAILURE)
-      {
-        /* Updates concerned section's parent */
-        pstSection->pstParent = sstConfig.pstCurrentSection;
+  /* Valid? */
+  if(pstSection != orxNULL)
+  {
+    /* Updates protection count */
+    pstSection->s32ProtectionCount += (_bProtect != orxFALSE) ? 1 : -1;
 
-        /* Protects it */
-        sstConfig.pstCurrentSection->s32ProtectionCount++;
-      }
-    }
-  }
+    /* Checks */
+    orxASSERT(pstSection->s32ProtectionCount >= 0);
 
-  /* Restores previous section */
-  sstConfig.pstCurrentSection = pstPreviousSection;
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
 
   /* Done! */
   return eResult;
 }
 
-/** Gets a section's parent
- * @param[in] _zSectionName     Concerned section
- * @return Section's parent name if set, orxSTRING_EMPTY if no parent has been forced or orxNULL otherwise
+/** Gets section origin (ie. the file where it was defined for the first time or orxSTRING_EMPTY if not defined via a file)
+ * @param[in] _zSectionName     Concerned section name
+ * @return orxSTRING if found, orxSTRING_EMPTY otherwise
  */
-const orxSTRING orxFASTCALL orxConfig_GetParent(const orxSTRING _zSectionName)
+const orxSTRING orxFASTCALL orxConfig_GetOrigin(const orxSTRING _zSectionName)
 {
-  const orxSTRING zResult = orxNULL;
+  orxSTRINGID     stID;
+  const orxSTRING zResult = orxSTRING_EMPTY;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zSectionName != orxNULL);
 
-  /* Has section? */
-  if(orxConfig_HasSection(_zSectionName) != orxFALSE)
-  {
-    orxCONFIG_SECTION *pstPreviousSection;
-
-    /* Backups current section */
-    pstPreviousSection = sstConfig.pstCurrentSection;
-
-    /* Selects concerned section */
-    if(orxConfig_SelectSection(_zSectionName) != orxSTATUS_FAILURE)
-    {
-      /* Has parent? */
-      if(sstConfig.pstCurrentSection->pstParent != orxNULL)
-      {
-        /* Updates result */
-        zResult = (sstConfig.pstCurrentSection->pstParent != orxHANDLE_UNDEFINED) ? sstConfig.pstCurrentSection->pstParent->zName : orxSTRING_EMPTY;
-      }
-    }
+  /* Gets origin ID */
+  stID = orxConfig_GetOriginID(_zSectionName);
 
-    /* Restores previous section */
-    sstConfig.pstCurrentSection = pstPreviousSection;
+  /* Valid? */
+  if(stID != orxSTRINGID_UNDEFINED)
+  {
+    /* Updates result */
+    zResult = orxString_GetFromID(stID);
   }
 
   /* Done! */
   return zResult;
 }
 
-/** Gets parent distance, ie. how far up the ancestry of a given section is a parent (does not consider the default parent)
- * @param[in] _zSectionName     Concerned section
- * @param[in] _zParentName      Parent section name to check
- * @return 1 for a direct parent, 2 for a grandparent, etc., and 0 if not found in the ancestry
+/** Gets section origin ID (ie. the file where it was defined for the first time or orxSTRING_EMPTY if not defined via a file)
+ * @param[in] _zSectionName     Concerned section name
+ * @return String ID if found, orxSTRINGID_UNDEFINED otherwise
  */
-orxU32 orxFASTCALL orxConfig_GetParentDistance(const orxSTRING _zSectionName, const orxSTRING _zParentName)
+orxSTRINGID orxFASTCALL orxConfig_GetOriginID(const orxSTRING _zSectionName)
 {
   orxCONFIG_SECTION  *pstSection;
-  orxU32              u32Result = 0, i;
+  orxSTRINGID         stID, stResult = orxSTRINGID_UNDEFINED;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zSectionName != orxNULL);
-  orxASSERT(_zParentName != orxNULL);
 
-  /* Gets section */
-  pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_Hash(_zSectionName));
+  /* Gets section name ID */
+  stID = orxString_Hash(_zSectionName);
+
+  /* Gets it from table */
+  pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, stID);
 
   /* Valid? */
   if(pstSection != orxNULL)
   {
-    /* For all parents */
-    for(i = 1, pstSection = pstSection->pstParent;
-        (pstSection != orxNULL) && (pstSection != orxHANDLE_UNDEFINED);
-        i++, pstSection = pstSection->pstParent)
-    {
-      /* Found? */
-      if(orxString_Compare(pstSection->zName, _zParentName) == 0)
-      {
-        /* Updates result */
-        u32Result = i;
-        break;
-      }
-    }
+    /* Updates result */
+    stResult = pstSection->stOriginID;
   }
 
   /* Done! */
-  return u32Result;
+  return stResult;
 }
 
-/** Sets default parent for all sections
-* @param[in] _zSectionName     Section name that will be used as an implicit default parent section for all config sections, if orxNULL is provided, default parent will be removed
-* @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
-*/
-orxSTATUS orxFASTCALL orxConfig_SetDefaultParent(const orxSTRING _zSectionName)
+/** Sets (overrides) section origin
+ * @param[in] _zSectionName     Concerned section name
+ * @param[in] _zOrigin          Origin name to set, orxNULL for none
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_SetOrigin(const orxSTRING _zSectionName, const orxSTRING _zOrigin)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxCONFIG_SECTION  *pstSection;
+  orxSTRINGID         stID;
+  orxSTATUS           eResult = orxSTATUS_FAILURE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSectionName != orxNULL);
 
-  /* Has current default parent? */
-  if(sstConfig.pstDefaultParent != orxNULL)
-  {
-    /* Unprotects it */
-    sstConfig.pstDefaultParent->s32ProtectionCount--;
-
-    /* Checks */
-    orxASSERT(sstConfig.pstDefaultParent->s32ProtectionCount >= 0);
+  /* Gets section name ID */
+  stID = orxString_Hash(_zSectionName);
 
-    /* Clears it */
-    sstConfig.pstDefaultParent = orxNULL;
-  }
+  /* Gets it from table */
+  pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, stID);
 
   /* Valid? */
-  if((_zSectionName != orxNULL) && (*_zSectionName != orxCHAR_NULL))
+  if(pstSection != orxNULL)
   {
-    orxCONFIG_SECTION *pstPreviousSection;
-
-    /* Backups current section */
-    pstPreviousSection = sstConfig.pstCurrentSection;
-
-    /* Selects default parent section */
-    eResult = orxConfig_SelectSection(_zSectionName);
-
-    /* Success? */
-    if(eResult != orxSTATUS_FAILURE)
-    {
-      /* Checks */
-      orxASSERT(sstConfig.pstCurrentSection != orxNULL);
-
-      /* Protects it */
-      sstConfig.pstCurrentSection->s32ProtectionCount++;
-
-      /* Stores it */
-      sstConfig.pstDefaultParent = sstConfig.pstCurrentSection;
-    }
+    /* Updates its origin */
+    pstSection->stOriginID = (_zOrigin != orxNULL) ? orxString_GetID(_zOrigin) : orxSTRINGID_UNDEFINED;
 
-    /* Restores current section */
-    sstConfig.pstCurrentSection = pstPreviousSection;
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
   }
 
   /* Done! */
   return eResult;
 }
 
-/** Gets default parent for all sections
- * @return Default parent name if set, orxNULL otherwise
+/** Gets section count
+ * @return Section count
  */
-const orxSTRING orxFASTCALL orxConfig_GetDefaultParent()
+orxU32 orxFASTCALL orxConfig_GetSectionCount()
 {
-  const orxSTRING zResult = orxNULL;
+  orxU32 u32Result;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
 
-  /* Has default parent? */
-  if(sstConfig.pstDefaultParent != orxNULL)
-  {
-    /* Updates result */
-    zResult = sstConfig.pstDefaultParent->zName;
-  }
+  /* Updates result */
+  u32Result = orxLinkList_GetCount(&(sstConfig.stSectionList));
 
   /* Done! */
-  return zResult;
+  return u32Result;
 }
 
-/** Gets current working section
- * @return Current selected section
+/** Gets section at the given index
+ * @param[in] _u32SectionIndex  Index of the desired section
+ * @return orxSTRING if exist, orxSTRING_EMPTY otherwise
  */
-const orxSTRING orxFASTCALL orxConfig_GetCurrentSection()
+const orxSTRING orxFASTCALL orxConfig_GetSection(orxU32 _u32SectionIndex)
 {
   const orxSTRING zResult;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
 
-  /* Has selected section? */
-  if(sstConfig.pstCurrentSection != orxNULL)
+  /* Valid? */
+  if(_u32SectionIndex < orxConfig_GetSectionCount())
   {
+    orxCONFIG_SECTION  *pstSection;
+    orxU32              i;
+
+    /* Finds correct entry */
+    for(i = _u32SectionIndex, pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        i > 0;
+        i--, pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)));
+
     /* Updates result */
-    zResult = sstConfig.pstCurrentSection->zName;
+    zResult = pstSection->zName;
   }
   else
   {
@@ -6432,85 +8285,128 @@ const orxSTRING orxFASTCALL orxConfig_GetCurrentSection()
   return zResult;
 }
 
-/** Pushes a section (storing the current one on section stack)
- * @param[in] _zSectionName     Section name to push
+/** Clears all config info
+ * @param[in] _pfnClearCallback Callback used to filter sections/keys to clear. If null, all sections/keys will be cleared
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-orxSTATUS orxFASTCALL orxConfig_PushSection(const orxSTRING _zSectionName)
+orxSTATUS orxFASTCALL orxConfig_Clear(const orxCONFIG_CLEAR_FUNCTION _pfnClearCallback)
 {
-  orxSTATUS eResult;
+  orxCONFIG_SECTION  *pstLastSection, *pstNewSection;
+  orxBOOL             bPending;
+  orxU32              u32ClearCount;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zSectionName != orxNULL);
 
-  /* Valid? */
-  if(*_zSectionName != orxCHAR_NULL)
+  /* Until there's no more pending deletions */
+  do
   {
-    orxCONFIG_SECTION *pstCurrentSection;
-
-    /* Stores current section */
-    pstCurrentSection = sstConfig.pstCurrentSection;
-
-    /* Selects requested section */
-    eResult = orxConfig_SelectSection(_zSectionName);
+    /* Inits status */
+    bPending      = orxFALSE;
+    u32ClearCount = 0;
 
-    /* Success? */
-    if(eResult != orxSTATUS_FAILURE)
+    /* For all sections */
+    for(pstLastSection = orxNULL, pstNewSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstNewSection != orxNULL;
+        pstNewSection = (pstLastSection != orxNULL) ? (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstLastSection->stNode)) : (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList)))
     {
-      /* Isn't stack full? */
-      if(sstConfig.u32CurrentStackEntry < orxCONFIG_KU32_STACK_SIZE)
+      /* Checks */
+      orxASSERT(pstNewSection->s32ProtectionCount >= 0);
+
+      /* Protected or can't delete section? */
+      if((pstNewSection->s32ProtectionCount > 0)
+      || (orxConfig_DeleteSection(pstNewSection, _pfnClearCallback) == orxSTATUS_FAILURE))
       {
-        /* Updates stack */
-        sstConfig.apstSectionStack[sstConfig.u32CurrentStackEntry++] = pstCurrentSection;
+        /* Updates last section */
+        pstLastSection = pstNewSection;
+
+        /* Updates status */
+        bPending = orxTRUE;
       }
       else
       {
-        /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Failed to push section: section stack is full.", _zSectionName);
-
-        /* Restores current section */
-        sstConfig.pstCurrentSection = pstCurrentSection;
-
-        /* Updates result */
-        eResult = orxSTATUS_FAILURE;
+        /* Updates clear count */
+        u32ClearCount++;
       }
     }
+  } while((bPending != orxFALSE) && (u32ClearCount != 0));
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Clears section
+ * @param[in] _zSectionName     Section name to clear
+ */
+orxSTATUS orxFASTCALL orxConfig_ClearSection(const orxSTRING _zSectionName)
+{
+  orxCONFIG_SECTION  *pstSection;
+  orxSTRINGID         stID;
+  orxS32              s32MarkerIndex;
+  orxSTATUS           eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSectionName != orxNULL);
+  orxASSERT(*_zSectionName != orxCHAR_NULL);
+
+  /* Looks for inheritance index */
+  s32MarkerIndex = orxString_SearchCharIndex(_zSectionName, orxCONFIG_KC_INHERITANCE_MARKER, 0);
+
+  /* Found? */
+  if(s32MarkerIndex >= 0)
+  {
+    /* Gets section name ID */
+    stID = orxString_NHash(_zSectionName, (orxU32)s32MarkerIndex);
   }
   else
   {
-    /* Updates result */
-    eResult = orxSTATUS_FAILURE;
+    /* Gets section name ID */
+    stID = orxString_Hash(_zSectionName);
+  }
+
+  /* Gets it from table */
+  pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, stID);
+
+  /* Valid? */
+  if(pstSection != orxNULL)
+  {
+    /* Deletes it */
+    eResult = orxConfig_DeleteSection(pstSection, orxNULL);
   }
 
   /* Done! */
   return eResult;
 }
 
-/** Pops last section from section stack
+/** Clears a value from current selected section
+ * @param[in] _zKey             Key name
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-orxSTATUS orxFASTCALL orxConfig_PopSection()
+orxSTATUS orxFASTCALL orxConfig_ClearValue(const orxSTRING _zKey)
 {
-  orxSTATUS eResult;
+  orxCONFIG_ENTRY  *pstEntry;
+  orxSTATUS         eResult;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zKey != orxNULL);
+  orxASSERT(*_zKey != orxCHAR_NULL);
 
-  /* Has stacked entry? */
-  if(sstConfig.u32CurrentStackEntry != 0)
-  {
-    /* Updates current section */
-    sstConfig.pstCurrentSection = sstConfig.apstSectionStack[--sstConfig.u32CurrentStackEntry];
+  /* Gets entry */
+  pstEntry = orxConfig_GetEntry(orxString_Hash(_zKey));
+
+  /* Found? */
+  if(pstEntry != orxNULL)
+  {
+    /* Deletes it */
+    orxConfig_DeleteEntry(pstEntry);
 
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
   else
   {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Failed to pop section: section stack is empty.");
-
     /* Updates result */
     eResult = orxSTATUS_FAILURE;
   }
@@ -6519,620 +8415,601 @@ orxSTATUS orxFASTCALL orxConfig_PopSection()
   return eResult;
 }
 
-/** Has section for the given section name?
- * @param[in] _zSectionName     Section name
+/** Is this value locally inherited from another one (ie. with a Value = @... syntax)?
+ * @param[in] _zKey             Key name
  * @return orxTRUE / orxFALSE
  */
-orxBOOL orxFASTCALL orxConfig_HasSection(const orxSTRING _zSectionName)
+orxBOOL orxFASTCALL orxConfig_IsLocallyInheritedValue(const orxSTRING _zKey)
 {
-  orxBOOL bResult = orxFALSE;
+  orxCONFIG_ENTRY  *pstEntry;
+  orxSTRINGID       stKeyID;
+  orxBOOL           bResult = orxFALSE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zSectionName != orxNULL);
+  orxASSERT(_zKey != orxNULL);
+  orxASSERT(*_zKey != orxCHAR_NULL);
+
+  /* Gets ID */
+  stKeyID = orxString_Hash(_zKey);
+
+  /* Gets corresponding entry */
+  pstEntry = orxConfig_GetEntryFromKey(stKeyID);
 
   /* Valid? */
-  if(*_zSectionName != orxCHAR_NULL)
+  if(pstEntry != orxNULL)
   {
-    /* Updates result */
-    bResult = (orxHashTable_Get(sstConfig.pstSectionTable, orxString_Hash(_zSectionName)) != orxNULL) ? orxTRUE : orxFALSE;
+    /* Has local inheritance? */
+    if(orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_INHERITANCE))
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+    }
   }
 
   /* Done! */
   return bResult;
 }
 
-/** Protects/unprotects a section from deletion (content might still be changed or deleted, but the section itself will resist delete/clear calls)
- * @param[in] _zSectionName     Section name to protect
- * @param[in] _bProtect         orxTRUE for protecting the section, orxFALSE to remove the protection
- * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+/** Is this value inherited from another one?
+ * @param[in] _zKey             Key name
+ * @return orxTRUE / orxFALSE
  */
-orxSTATUS orxFASTCALL orxConfig_ProtectSection(const orxSTRING _zSectionName, orxBOOL _bProtect)
+orxBOOL orxFASTCALL orxConfig_IsInheritedValue(const orxSTRING _zKey)
 {
-  orxCONFIG_SECTION  *pstSection;
-  orxSTRINGID         stID;
-  orxSTATUS           eResult = orxSTATUS_FAILURE;
+  orxCONFIG_ENTRY  *pstEntry;
+  orxSTRINGID       stKeyID;
+  orxBOOL           bResult = orxFALSE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zSectionName != orxNULL);
+  orxASSERT(_zKey != orxNULL);
+  orxASSERT(*_zKey != orxCHAR_NULL);
 
-  /* Gets section name ID */
-  stID = orxString_Hash(_zSectionName);
+  /* Gets ID */
+  stKeyID = orxString_Hash(_zKey);
 
-  /* Gets it from table */
-  pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, stID);
+  /* Gets corresponding entry */
+  pstEntry = orxConfig_GetEntry(stKeyID);
 
   /* Valid? */
-  if(pstSection != orxNULL)
+  if(pstEntry != orxNULL)
+  {
+    /* Has local inheritance? */
+    if(orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_INHERITANCE))
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+    }
+  }
+  else
   {
-    /* Updates protection count */
-    pstSection->s32ProtectionCount += (_bProtect != orxFALSE) ? 1 : -1;
-
-    /* Checks */
-    orxASSERT(pstSection->s32ProtectionCount >= 0);
-
     /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
+    bResult = (orxConfig_GetEntryFromKey(stKeyID) != orxNULL) ? orxTRUE : orxFALSE;
   }
 
   /* Done! */
-  return eResult;
+  return bResult;
 }
 
-/** Gets section origin (ie. the file where it was defined for the first time or orxSTRING_EMPTY if not defined via a file)
- * @param[in] _zSectionName     Concerned section name
- * @return orxSTRING if found, orxSTRING_EMPTY otherwise
+/** Is this value random? (ie. using '~' character, within or without a list)
+ * @param[in] _zKey             Key name
+ * @return orxTRUE / orxFALSE
  */
-const orxSTRING orxFASTCALL orxConfig_GetOrigin(const orxSTRING _zSectionName)
+orxBOOL orxFASTCALL orxConfig_IsRandomValue(const orxSTRING _zKey)
 {
-  orxSTRINGID     stID;
-  const orxSTRING zResult = orxSTRING_EMPTY;
+  orxCONFIG_VALUE  *pstValue;
+  orxBOOL           bResult = orxFALSE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zSectionName != orxNULL);
+  orxASSERT(_zKey != orxNULL);
 
-  /* Gets origin ID */
-  stID = orxConfig_GetOriginID(_zSectionName);
+  /* Gets corresponding value */
+  pstValue = orxConfig_GetValue(_zKey);
 
   /* Valid? */
-  if(stID != orxSTRINGID_UNDEFINED)
+  if(pstValue != orxNULL)
   {
-    /* Updates result */
-    zResult = orxString_GetFromID(stID);
+    /* Has random flag? */
+    if(orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_RANDOM))
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+    }
   }
 
   /* Done! */
-  return zResult;
+  return bResult;
 }
 
-/** Gets section origin ID (ie. the file where it was defined for the first time or orxSTRING_EMPTY if not defined via a file)
- * @param[in] _zSectionName     Concerned section name
- * @return String ID if found, orxSTRINGID_UNDEFINED otherwise
+/** Is this value dynamic? (ie. random and/or a list or command)
+ * @param[in] _zKey             Key name
+ * @return orxTRUE / orxFALSE
  */
-orxSTRINGID orxFASTCALL orxConfig_GetOriginID(const orxSTRING _zSectionName)
+orxBOOL orxFASTCALL orxConfig_IsDynamicValue(const orxSTRING _zKey)
 {
-  orxCONFIG_SECTION  *pstSection;
-  orxSTRINGID         stID, stResult = orxSTRINGID_UNDEFINED;
+  orxCONFIG_VALUE  *pstValue;
+  orxBOOL           bResult = orxFALSE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zSectionName != orxNULL);
-
-  /* Gets section name ID */
-  stID = orxString_Hash(_zSectionName);
+  orxASSERT(_zKey != orxNULL);
 
-  /* Gets it from table */
-  pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, stID);
+  /* Gets corresponding value */
+  pstValue = orxConfig_GetValue(_zKey);
 
   /* Valid? */
-  if(pstSection != orxNULL)
+  if(pstValue != orxNULL)
   {
-    /* Updates result */
-    stResult = pstSection->stOriginID;
+    /* Has random, list or command flag? */
+    if(orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_RANDOM | orxCONFIG_VALUE_KU16_FLAG_LIST | orxCONFIG_VALUE_KU16_FLAG_COMMAND))
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+    }
   }
 
   /* Done! */
-  return stResult;
+  return bResult;
 }
 
-/** Sets (overrides) section origin
- * @param[in] _zSectionName     Concerned section name
- * @param[in] _zOrigin          Origin name to set, orxNULL for none
- * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
- */
-orxSTATUS orxFASTCALL orxConfig_SetOrigin(const orxSTRING _zSectionName, const orxSTRING _zOrigin)
+/** Is this a command value? (ie. lazily evaluated command: %...)
+* @param[in] _zKey             Key name
+* @return orxTRUE / orxFALSE
+*/
+orxBOOL orxFASTCALL orxConfig_IsCommandValue(const orxSTRING _zKey)
 {
-  orxCONFIG_SECTION  *pstSection;
-  orxSTRINGID         stID;
-  orxSTATUS           eResult = orxSTATUS_FAILURE;
+  orxCONFIG_VALUE  *pstValue;
+  orxBOOL           bResult = orxFALSE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zSectionName != orxNULL);
-
-  /* Gets section name ID */
-  stID = orxString_Hash(_zSectionName);
+  orxASSERT(_zKey != orxNULL);
 
-  /* Gets it from table */
-  pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, stID);
+  /* Gets corresponding value */
+  pstValue = orxConfig_GetValue(_zKey);
 
   /* Valid? */
-  if(pstSection != orxNULL)
+  if(pstValue != orxNULL)
   {
-    /* Updates its origin */
-    pstSection->stOriginID = (_zOrigin != orxNULL) ? orxString_GetID(_zOrigin) : orxSTRINGID_UNDEFINED;
-
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
+    /* Is a command? */
+    if(orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_COMMAND))
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+    }
   }
 
   /* Done! */
-  return eResult;
+  return bResult;
 }
 
-/** Gets section count
- * @return Section count
+/** Has specified value for the given key?
+ * @param[in] _zKey             Key name
+ * @return orxTRUE / orxFALSE
  */
-orxU32 orxFASTCALL orxConfig_GetSectionCount()
+orxBOOL orxFASTCALL orxConfig_HasValue(const orxSTRING _zKey)
 {
-  orxU32 u32Result;
+  orxBOOL bResult = orxFALSE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zKey != orxNULL);
 
-  /* Updates result */
-  u32Result = orxLinkList_GetCount(&(sstConfig.stSectionList));
+  /* Valid? */
+  if(*_zKey != orxCHAR_NULL)
+  {
+    /* Updates result */
+    bResult = (orxConfig_GetValue(_zKey) != orxNULL) ? orxTRUE : orxFALSE;
+  }
 
   /* Done! */
-  return u32Result;
+  return bResult;
 }
 
-/** Gets section at the given index
- * @param[in] _u32SectionIndex  Index of the desired section
- * @return orxSTRING if exist, orxSTRING_EMPTY otherwise
+/** Gets a key ID that can be used with all the orxConfig_*ByID functions, best retrieved once and kept for repeated queries
+ * @param[in] _zKey             Key name
+ * @return Key ID
  */
-const orxSTRING orxFASTCALL orxConfig_GetSection(orxU32 _u32SectionIndex)
+orxSTRINGID orxFASTCALL orxConfig_GetKeyID(const orxSTRING _zKey)
 {
-  const orxSTRING zResult;
+  orxSTRINGID stResult;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zKey != orxNULL);
+  orxASSERT(*_zKey != orxCHAR_NULL);
 
-  /* Valid? */
-  if(_u32SectionIndex < orxConfig_GetSectionCount())
-  {
-    orxCONFIG_SECTION  *pstSection;
-    orxU32              i;
+  /* Updates result (stores the key name for typo checks & logs) */
+  stResult = orxString_GetID(_zKey);
 
-    /* Finds correct entry */
-    for(i = _u32SectionIndex, pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
-        i > 0;
-        i--, pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)));
+  /* Done! */
+  return stResult;
+}
 
-    /* Updates result */
-    zResult = pstSection->zName;
-  }
-  else
-  {
-    /* Updates result */
-    zResult = orxSTRING_EMPTY;
-  }
+/** Has specified value for the given key ID?
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxConfig_HasValueByID(orxSTRINGID _stKeyID)
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Updates result */
+  bResult = (orxConfig_GetValueByID(_stKeyID, orxNULL) != orxNULL) ? orxTRUE : orxFALSE;
 
   /* Done! */
-  return zResult;
+  return bResult;
 }
 
-/** Clears all config info
- * @param[in] _pfnClearCallback Callback used to filter sections/keys to clear. If null, all sections/keys will be cleared
- * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+/** Has specified value for the given key (no check for typos)?
+ * @param[in] _zKey             Key name
+ * @return orxTRUE / orxFALSE
  */
-orxSTATUS orxFASTCALL orxConfig_Clear(const orxCONFIG_CLEAR_FUNCTION _pfnClearCallback)
-{
-  orxCONFIG_SECTION  *pstLastSection, *pstNewSection;
-  orxBOOL             bPending;
-  orxU32              u32ClearCount;
+orxBOOL orxFASTCALL orxConfig_HasValueNoCheck(const orxSTRING _zKey)
+{
+  orxU32  u32TypoCheckFlag;
+  orxBOOL bResult;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zKey != orxNULL);
 
-  /* Until there's no more pending deletions */
-  do
-  {
-    /* Inits status */
-    bPending      = orxFALSE;
-    u32ClearCount = 0;
-
-    /* For all sections */
-    for(pstLastSection = orxNULL, pstNewSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
-        pstNewSection != orxNULL;
-        pstNewSection = (pstLastSection != orxNULL) ? (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstLastSection->stNode)) : (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList)))
-    {
-      /* Checks */
-      orxASSERT(pstNewSection->s32ProtectionCount >= 0);
+  /* Updates flags */
+  u32TypoCheckFlag = orxFLAG_GET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_TYPO_CHECK);
+  orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_NONE, orxCONFIG_KU32_STATIC_FLAG_TYPO_CHECK);
 
-      /* Protected or can't delete section? */
-      if((pstNewSection->s32ProtectionCount > 0)
-      || (orxConfig_DeleteSection(pstNewSection, _pfnClearCallback) == orxSTATUS_FAILURE))
-      {
-        /* Updates last section */
-        pstLastSection = pstNewSection;
+  /* Updates result */
+  bResult = orxConfig_HasValue(_zKey);
 
-        /* Updates status */
-        bPending = orxTRUE;
-      }
-      else
-      {
-        /* Updates clear count */
-        u32ClearCount++;
-      }
-    }
-  } while((bPending != orxFALSE) && (u32ClearCount != 0));
+  /* Updates flags */
+  orxFLAG_SET(sstConfig.u32Flags, u32TypoCheckFlag, orxCONFIG_KU32_STATIC_FLAG_NONE);
 
   /* Done! */
-  return orxSTATUS_SUCCESS;
+  return bResult;
 }
 
-/** Clears section
- * @param[in] _zSectionName     Section name to clear
+/** Gets a value's source section (ie. the section where the value is explicitly defined), only considering section inheritance, not local one
+ * @param[in] _zKey             Key name
+ * @return Name of the section that explicitly contains the value, orxSTRING_EMPTY if not found
  */
-orxSTATUS orxFASTCALL orxConfig_ClearSection(const orxSTRING _zSectionName)
+const orxSTRING orxFASTCALL orxConfig_GetValueSource(const orxSTRING _zKey)
 {
-  orxCONFIG_SECTION  *pstSection;
-  orxSTRINGID         stID;
-  orxS32              s32MarkerIndex;
-  orxSTATUS           eResult = orxSTATUS_FAILURE;
+  orxCONFIG_ENTRY  *pstEntry;
+  orxSTRINGID       stKeyID;
+  const orxSTRING   zResult = orxSTRING_EMPTY;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zSectionName != orxNULL);
-  orxASSERT(*_zSectionName != orxCHAR_NULL);
+  orxASSERT(_zKey != orxNULL);
+  orxASSERT(*_zKey != orxCHAR_NULL);
 
-  /* Looks for inheritance index */
-  s32MarkerIndex = orxString_SearchCharIndex(_zSectionName, orxCONFIG_KC_INHERITANCE_MARKER, 0);
+  /* Gets ID */
+  stKeyID = orxString_Hash(_zKey);
 
-  /* Found? */
-  if(s32MarkerIndex >= 0)
+  /* Gets corresponding entry */
+  pstEntry = orxConfig_GetEntry(stKeyID);
+
+  /* Valid? */
+  if(pstEntry != orxNULL)
   {
-    /* Gets section name ID */
-    stID = orxString_NHash(_zSectionName, (orxU32)s32MarkerIndex);
+    /* Updates result */
+    zResult = sstConfig.pstCurrentSection->zName;
   }
   else
   {
-    /* Gets section name ID */
-    stID = orxString_Hash(_zSectionName);
-  }
-
-  /* Gets it from table */
-  pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, stID);
+    orxCONFIG_SECTION *pstSource = orxNULL;
 
-  /* Valid? */
-  if(pstSection != orxNULL)
-  {
-    /* Deletes it */
-    eResult = orxConfig_DeleteSection(pstSection, orxNULL);
+    /* Gets value from key */
+    if(orxConfig_GetValueFromKey(stKeyID, sstConfig.pstCurrentSection, &pstSource) != orxNULL)
+    {
+      /* Updates result */
+      zResult = pstSource->zName;
+    }
   }
 
   /* Done! */
-  return eResult;
+  return zResult;
 }
 
-/** Clears a value from current selected section
+/** Reads a signed integer value from config (will take a random value if a list is provided for this key)
  * @param[in] _zKey             Key name
- * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ * @return The value
  */
-orxSTATUS orxFASTCALL orxConfig_ClearValue(const orxSTRING _zKey)
+orxS32 orxFASTCALL orxConfig_GetS32(const orxSTRING _zKey)
 {
-  orxCONFIG_ENTRY  *pstEntry;
-  orxSTATUS         eResult;
+  orxCONFIG_VALUE  *pstValue;
+  orxS32            s32Result = 0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
   orxASSERT(*_zKey != orxCHAR_NULL);
 
-  /* Gets entry */
-  pstEntry = orxConfig_GetEntry(orxString_Hash(_zKey));
+  /* Gets corresponding value */
+  pstValue = orxConfig_GetValue(_zKey);
 
   /* Found? */
-  if(pstEntry != orxNULL)
-  {
-    /* Deletes it */
-    orxConfig_DeleteEntry(pstEntry);
-
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
-  }
-  else
+  if(pstValue != orxNULL)
   {
     /* Updates result */
-    eResult = orxSTATUS_FAILURE;
+    orxConfig_GetS32FromValue(pstValue, -1, &s32Result);
   }
 
   /* Done! */
-  return eResult;
+  return s32Result;
 }
 
-/** Is this value locally inherited from another one (ie. with a Value = @... syntax)?
+/** Reads an unsigned integer value from config (will take a random value if a list is provided for this key)
  * @param[in] _zKey             Key name
- * @return orxTRUE / orxFALSE
+ * @return The value
  */
-orxBOOL orxFASTCALL orxConfig_IsLocallyInheritedValue(const orxSTRING _zKey)
+orxU32 orxFASTCALL orxConfig_GetU32(const orxSTRING _zKey)
 {
-  orxCONFIG_ENTRY  *pstEntry;
-  orxSTRINGID       stKeyID;
-  orxBOOL           bResult = orxFALSE;
+  orxCONFIG_VALUE  *pstValue;
+  orxU32            u32Result = 0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
   orxASSERT(*_zKey != orxCHAR_NULL);
 
-  /* Gets ID */
-  stKeyID = orxString_Hash(_zKey);
-
-  /* Gets corresponding entry */
-  pstEntry = orxConfig_GetEntryFromKey(stKeyID);
+  /* Gets corresponding value */
+  pstValue = orxConfig_GetValue(_zKey);
 
-  /* Valid? */
-  if(pstEntry != orxNULL)
+  /* Found? */
+  if(pstValue != orxNULL)
   {
-    /* Has local inheritance? */
-    if(orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_INHERITANCE))
-    {
-      /* Updates result */
-      bResult = orxTRUE;
-    }
+    /* Updates result */
+    orxConfig_GetU32FromValue(pstValue, -1, &u32Result);
   }
 
   /* Done! */
-  return bResult;
+  return u32Result;
 }
 
-/** Is this value inherited from another one?
+/** Reads a signed integer value from config (will take a random value if a list is provided for this key)
  * @param[in] _zKey             Key name
- * @return orxTRUE / orxFALSE
+ * @return The value
  */
-orxBOOL orxFASTCALL orxConfig_IsInheritedValue(const orxSTRING _zKey)
+orxS64 orxFASTCALL orxConfig_GetS64(const orxSTRING _zKey)
 {
-  orxCONFIG_ENTRY  *pstEntry;
-  orxSTRINGID       stKeyID;
-  orxBOOL           bResult = orxFALSE;
+  orxCONFIG_VALUE  *pstValue;
+  orxS64            s64Result = 0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
   orxASSERT(*_zKey != orxCHAR_NULL);
 
-  /* Gets ID */
-  stKeyID = orxString_Hash(_zKey);
-
-  /* Gets corresponding entry */
-  pstEntry = orxConfig_GetEntry(stKeyID);
+  /* Gets corresponding value */
+  pstValue = orxConfig_GetValue(_zKey);
 
-  /* Valid? */
-  if(pstEntry != orxNULL)
-  {
-    /* Has local inheritance? */
-    if(orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_INHERITANCE))
-    {
-      /* Updates result */
-      bResult = orxTRUE;
-    }
-  }
-  else
+  /* Found? */
+  if(pstValue != orxNULL)
   {
     /* Updates result */
-    bResult = (orxConfig_GetEntryFromKey(stKeyID) != orxNULL) ? orxTRUE : orxFALSE;
+    orxConfig_GetS64FromValue(pstValue, -1, &s64Result);
   }
 
   /* Done! */
-  return bResult;
+  return s64Result;
 }
 
-/** Is this value random? (ie. using '~' character, within or without a list)
+/** Reads an unsigned integer value from config (will take a random value if a list is provided for this key)
  * @param[in] _zKey             Key name
- * @return orxTRUE / orxFALSE
+ * @return The value
  */
-orxBOOL orxFASTCALL orxConfig_IsRandomValue(const orxSTRING _zKey)
+orxU64 orxFASTCALL orxConfig_GetU64(const orxSTRING _zKey)
 {
   orxCONFIG_VALUE  *pstValue;
-  orxBOOL           bResult = orxFALSE;
+  orxU64            u64Result = 0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
+  orxASSERT(*_zKey != orxCHAR_NULL);
 
   /* Gets corresponding value */
   pstValue = orxConfig_GetValue(_zKey);
 
-  /* Valid? */
+  /* Found? */
   if(pstValue != orxNULL)
   {
-    /* Has random flag? */
-    if(orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_RANDOM))
-    {
-      /* Updates result */
-      bResult = orxTRUE;
-    }
+    /* Updates result */
+    orxConfig_GetU64FromValue(pstValue, -1, &u64Result);
   }
 
   /* Done! */
-  return bResult;
+  return u64Result;
 }
 
-/** Is this value dynamic? (ie. random and/or a list or command)
+/** Reads a float value from config (will take a random value if a list is provided for this key)
  * @param[in] _zKey             Key name
- * @return orxTRUE / orxFALSE
+ * @return The value
  */
-orxBOOL orxFASTCALL orxConfig_IsDynamicValue(const orxSTRING _zKey)
+orxFLOAT orxFASTCALL orxConfig_GetFloat(const orxSTRING _zKey)
 {
   orxCONFIG_VALUE  *pstValue;
-  orxBOOL           bResult = orxFALSE;
+  orxFLOAT          fResult = orxFLOAT_0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
+  orxASSERT(*_zKey != orxCHAR_NULL);
 
   /* Gets corresponding value */
   pstValue = orxConfig_GetValue(_zKey);
 
-  /* Valid? */
+  /* Found? */
   if(pstValue != orxNULL)
   {
-    /* Has random, list or command flag? */
-    if(orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_RANDOM | orxCONFIG_VALUE_KU16_FLAG_LIST | orxCONFIG_VALUE_KU16_FLAG_COMMAND))
-    {
-      /* Updates result */
-      bResult = orxTRUE;
-    }
+    /* Updates result */
+    orxConfig_GetFloatFromValue(pstValue, -1, &fResult);
   }
 
   /* Done! */
-  return bResult;
+  return fResult;
 }
 
-/** Is this a command value? (ie. lazily evaluated command: %...)
-* @param[in] _zKey             Key name
-* @return orxTRUE / orxFALSE
-*/
-orxBOOL orxFASTCALL orxConfig_IsCommandValue(const orxSTRING _zKey)
+/** Reads a string value from config (will take a random value if a list is provided for this key)
+ * Beware: result might not persist through any subsequent orxConfig_Get* calls
+ * @param[in] _zKey             Key name
+ * @return The value
+ */
+const orxSTRING orxFASTCALL orxConfig_GetString(const orxSTRING _zKey)
 {
   orxCONFIG_VALUE  *pstValue;
-  orxBOOL           bResult = orxFALSE;
+  const orxSTRING   zResult = orxSTRING_EMPTY;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
+  orxASSERT(*_zKey != orxCHAR_NULL);
 
   /* Gets corresponding value */
   pstValue = orxConfig_GetValue(_zKey);
 
-  /* Valid? */
+  /* Found? */
   if(pstValue != orxNULL)
   {
-    /* Is a command? */
-    if(orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_COMMAND))
-    {
-      /* Updates result */
-      bResult = orxTRUE;
-    }
+    /* Updates result */
+    orxConfig_GetStringFromValue(pstValue, -1, &zResult);
   }
 
   /* Done! */
-  return bResult;
+  return zResult;
 }
 
-/** Has specified value for the given key?
+/** Reads a boolean value from config (will take a random value if a list is provided for this key)
  * @param[in] _zKey             Key name
- * @return orxTRUE / orxFALSE
+ * @return The value
  */
-orxBOOL orxFASTCALL orxConfig_HasValue(const orxSTRING _zKey)
+orxBOOL orxFASTCALL orxConfig_GetBool(const orxSTRING _zKey)
 {
-  orxBOOL bResult = orxFALSE;
+  orxCONFIG_VALUE  *pstValue;
+  orxBOOL           bResult = orxFALSE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
+  orxASSERT(*_zKey != orxCHAR_NULL);
 
-  /* Valid? */
-  if(*_zKey != orxCHAR_NULL)
+  /* Gets corresponding value */
+  pstValue = orxConfig_GetValue(_zKey);
+
+  /* Found? */
+  if(pstValue != orxNULL)
   {
     /* Updates result */
-    bResult = (orxConfig_GetValue(_zKey) != orxNULL) ? orxTRUE : orxFALSE;
+    orxConfig_GetBoolFromValue(pstValue, -1, &bResult);
   }
 
   /* Done! */
   return bResult;
 }
 
-/** Has specified value for the given key (no check for typos)?
- * @param[in] _zKey             Key name
- * @return orxTRUE / orxFALSE
+/** Reads a vector value from config (will take a random value if a list is provided for this key)
+ * @param[in]   _zKey             Key name
+ * @param[out]  _pvVector         Storage for vector value
+ * @return The value if valid, orxNULL otherwise
  */
-orxBOOL orxFASTCALL orxConfig_HasValueNoCheck(const orxSTRING _zKey)
+orxVECTOR *orxFASTCALL orxConfig_GetVector(const orxSTRING _zKey, orxVECTOR *_pvVector)
 {
-  orxU32  u32TypoCheckFlag;
-  orxBOOL bResult;
+  orxCONFIG_VALUE  *pstValue;
+  orxVECTOR        *pvResult = orxNULL;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
+  orxASSERT(*_zKey != orxCHAR_NULL);
+  orxASSERT(_pvVector != orxNULL);
 
-  /* Updates flags */
-  u32TypoCheckFlag = orxFLAG_GET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_TYPO_CHECK);
-  orxFLAG_SET(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_NONE, orxCONFIG_KU32_STATIC_FLAG_TYPO_CHECK);
-
-  /* Updates result */
-  bResult = orxConfig_HasValue(_zKey);
+  /* Gets corresponding value */
+  pstValue = orxConfig_GetValue(_zKey);
 
-  /* Updates flags */
-  orxFLAG_SET(sstConfig.u32Flags, u32TypoCheckFlag, orxCONFIG_KU32_STATIC_FLAG_NONE);
+  /* Found? */
+  if(pstValue != orxNULL)
+  {
+    /* Updates result */
+    if(orxConfig_GetVectorFromValue(pstValue, -1, _pvVector) != orxSTATUS_FAILURE)
+    {
+      pvResult = _pvVector;
+    }
+  }
 
   /* Done! */
-  return bResult;
+  return pvResult;
 }
 
-/** Gets a value's source section (ie. the section where the value is explicitly defined), only considering section inheritance, not local one
- * @param[in] _zKey             Key name
- * @return Name of the section that explicitly contains the value, orxSTRING_EMPTY if not found
+/** Reads a vector value from config and interpret any color literals in the given color space (will take a random value if a list is provided for this key)
+ * @param[in]   _zKey             Key name
+ * @param[in]   _eColorSpace      Color space to use when translating color literals (NONE: no literal, COMPONENT: 0-255 RGB values, all others: normalized spaces)
+ * @param[out]  _pvVector         Storage for vector value
+ * @return The value if valid, orxNULL otherwise
  */
-const orxSTRING orxFASTCALL orxConfig_GetValueSource(const orxSTRING _zKey)
+orxVECTOR *orxFASTCALL orxConfig_GetColorVector(const orxSTRING _zKey, orxCOLORSPACE _eColorSpace, orxVECTOR *_pvVector)
 {
-  orxCONFIG_ENTRY  *pstEntry;
-  orxSTRINGID       stKeyID;
-  const orxSTRING   zResult = orxSTRING_EMPTY;
+  orxCONFIG_VALUE  *pstValue;
+  orxVECTOR        *pvResult = orxNULL;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
   orxASSERT(_zKey != orxNULL);
   orxASSERT(*_zKey != orxCHAR_NULL);
+  orxASSERT((_eColorSpace < orxCOLORSPACE_NUMBER) || (_eColorSpace == orxCOLORSPACE_NONE));
+  orxASSERT(_pvVector != orxNULL);
 
-  /* Gets ID */
-  stKeyID = orxString_Hash(_zKey);
-
-  /* Gets corresponding entry */
-  pstEntry = orxConfig_GetEntry(stKeyID);
+  /* Gets corresponding value */
+  pstValue = orxConfig_GetValue(_zKey);
 
-  /* Valid? */
-  if(pstEntry != orxNULL)
-  {
-    /* Updates result */
-    zResult = sstConfig.pstCurrentSection->zName;
-  }
-  else
+  /* Found? */
+  if(pstValue != orxNULL)
   {
-    orxCONFIG_SECTION *pstSource = orxNULL;
+    const orxSTRING zValue;
+    orxS32          s32ListIndex;
 
-    /* Gets value from key */
-    if(orxConfig_GetValueFromKey(stKeyID, sstConfig.pstCurrentSection, &pstSource) != orxNULL)
+    /* Not a list? */
+    if(!orxFLAG_TEST(pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
     {
-      /* Updates result */
-      zResult = pstSource->zName;
+      /* Updates real index */
+      s32ListIndex = 0;
+    }
+    else
+    {
+      /* Updates real index */
+      s32ListIndex = orxMath_GetRandomS32(0, (orxU32)pstValue->u16ListCount - 1);
     }
+
+    /* Gets its value */
+    zValue = orxConfig_GetListValue(pstValue, s32ListIndex, orxFALSE);
+
+    /* Converts it */
+    pvResult = orxConfig_ToVector(zValue, _eColorSpace, _pvVector);
   }
 
   /* Done! */
-  return zResult;
+  return pvResult;
 }
 
-/** Reads a signed integer value from config (will take a random value if a list is provided for this key)
- * @param[in] _zKey             Key name
+/** Reads a signed integer value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
  * @return The value
  */
-orxS32 orxFASTCALL orxConfig_GetS32(const orxSTRING _zKey)
+orxS32 orxFASTCALL orxConfig_GetS32ByID(orxSTRINGID _stKeyID)
 {
   orxCONFIG_VALUE  *pstValue;
   orxS32            s32Result = 0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zKey != orxNULL);
-  orxASSERT(*_zKey != orxCHAR_NULL);
 
   /* Gets corresponding value */
-  pstValue = orxConfig_GetValue(_zKey);
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
 
   /* Found? */
   if(pstValue != orxNULL)
@@ -7145,22 +9022,20 @@ orxS32 orxFASTCALL orxConfig_GetS32(const orxSTRING _zKey)
   return s32Result;
 }
 
-/** Reads an unsigned integer value from config (will take a random value if a list is provided for this key)
- * @param[in] _zKey             Key name
+/** Reads an unsigned integer value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
  * @return The value
  */
-orxU32 orxFASTCALL orxConfig_GetU32(const orxSTRING _zKey)
+orxU32 orxFASTCALL orxConfig_GetU32ByID(orxSTRINGID _stKeyID)
 {
   orxCONFIG_VALUE  *pstValue;
   orxU32            u32Result = 0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zKey != orxNULL);
-  orxASSERT(*_zKey != orxCHAR_NULL);
 
   /* Gets corresponding value */
-  pstValue = orxConfig_GetValue(_zKey);
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
 
   /* Found? */
   if(pstValue != orxNULL)
@@ -7173,22 +9048,20 @@ orxU32 orxFASTCALL orxConfig_GetU32(const orxSTRING _zKey)
   return u32Result;
 }
 
-/** Reads a signed integer value from config (will take a random value if a list is provided for this key)
- * @param[in] _zKey             Key name
+/** Reads a signed integer value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
  * @return The value
  */
-orxS64 orxFASTCALL orxConfig_GetS64(const orxSTRING _zKey)
+orxS64 orxFASTCALL orxConfig_GetS64ByID(orxSTRINGID _stKeyID)
 {
   orxCONFIG_VALUE  *pstValue;
   orxS64            s64Result = 0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zKey != orxNULL);
-  orxASSERT(*_zKey != orxCHAR_NULL);
 
   /* Gets corresponding value */
-  pstValue = orxConfig_GetValue(_zKey);
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
 
   /* Found? */
   if(pstValue != orxNULL)
@@ -7201,22 +9074,20 @@ orxS64 orxFASTCALL orxConfig_GetS64(const orxSTRING _zKey)
   return s64Result;
 }
 
-/** Reads an unsigned integer value from config (will take a random value if a list is provided for this key)
- * @param[in] _zKey             Key name
+/** Reads an unsigned integer value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
  * @return The value
  */
-orxU64 orxFASTCALL orxConfig_GetU64(const orxSTRING _zKey)
+orxU64 orxFASTCALL orxConfig_GetU64ByID(orxSTRINGID _stKeyID)
 {
   orxCONFIG_VALUE  *pstValue;
   orxU64            u64Result = 0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zKey != orxNULL);
-  orxASSERT(*_zKey != orxCHAR_NULL);
 
   /* Gets corresponding value */
-  pstValue = orxConfig_GetValue(_zKey);
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
 
   /* Found? */
   if(pstValue != orxNULL)
@@ -7229,22 +9100,20 @@ orxU64 orxFASTCALL orxConfig_GetU64(const orxSTRING _zKey)
   return u64Result;
 }
 
-/** Reads a float value from config (will take a random value if a list is provided for this key)
- * @param[in] _zKey             Key name
+/** Reads a float value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
  * @return The value
  */
-orxFLOAT orxFASTCALL orxConfig_GetFloat(const orxSTRING _zKey)
+orxFLOAT orxFASTCALL orxConfig_GetFloatByID(orxSTRINGID _stKeyID)
 {
   orxCONFIG_VALUE  *pstValue;
   orxFLOAT          fResult = orxFLOAT_0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zKey != orxNULL);
-  orxASSERT(*_zKey != orxCHAR_NULL);
 
   /* Gets corresponding value */
-  pstValue = orxConfig_GetValue(_zKey);
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
 
   /* Found? */
   if(pstValue != orxNULL)
@@ -7257,23 +9126,21 @@ orxFLOAT orxFASTCALL orxConfig_GetFloat(const orxSTRING _zKey)
   return fResult;
 }
 
-/** Reads a string value from config (will take a random value if a list is provided for this key)
+/** Reads a string value from config, using a key ID (will take a random value if a list is provided for this key)
  * Beware: result might not persist through any subsequent orxConfig_Get* calls
- * @param[in] _zKey             Key name
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
  * @return The value
  */
-const orxSTRING orxFASTCALL orxConfig_GetString(const orxSTRING _zKey)
+const orxSTRING orxFASTCALL orxConfig_GetStringByID(orxSTRINGID _stKeyID)
 {
   orxCONFIG_VALUE  *pstValue;
   const orxSTRING   zResult = orxSTRING_EMPTY;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zKey != orxNULL);
-  orxASSERT(*_zKey != orxCHAR_NULL);
 
   /* Gets corresponding value */
-  pstValue = orxConfig_GetValue(_zKey);
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
 
   /* Found? */
   if(pstValue != orxNULL)
@@ -7286,22 +9153,20 @@ const orxSTRING orxFASTCALL orxConfig_GetString(const orxSTRING _zKey)
   return zResult;
 }
 
-/** Reads a boolean value from config (will take a random value if a list is provided for this key)
- * @param[in] _zKey             Key name
+/** Reads a boolean value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
  * @return The value
  */
-orxBOOL orxFASTCALL orxConfig_GetBool(const orxSTRING _zKey)
+orxBOOL orxFASTCALL orxConfig_GetBoolByID(orxSTRINGID _stKeyID)
 {
   orxCONFIG_VALUE  *pstValue;
   orxBOOL           bResult = orxFALSE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zKey != orxNULL);
-  orxASSERT(*_zKey != orxCHAR_NULL);
 
   /* Gets corresponding value */
-  pstValue = orxConfig_GetValue(_zKey);
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
 
   /* Found? */
   if(pstValue != orxNULL)
@@ -7314,24 +9179,22 @@ orxBOOL orxFASTCALL orxConfig_GetBool(const orxSTRING _zKey)
   return bResult;
 }
 
-/** Reads a vector value from config (will take a random value if a list is provided for this key)
- * @param[in]   _zKey             Key name
+/** Reads a vector value from config, using a key ID (will take a random value if a list is provided for this key)
+ * @param[in]   _stKeyID          Key ID, as returned by orxConfig_GetKeyID
  * @param[out]  _pvVector         Storage for vector value
  * @return The value if valid, orxNULL otherwise
  */
-orxVECTOR *orxFASTCALL orxConfig_GetVector(const orxSTRING _zKey, orxVECTOR *_pvVector)
+orxVECTOR *orxFASTCALL orxConfig_GetVectorByID(orxSTRINGID _stKeyID, orxVECTOR *_pvVector)
 {
   orxCONFIG_VALUE  *pstValue;
   orxVECTOR        *pvResult = orxNULL;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zKey != orxNULL);
-  orxASSERT(*_zKey != orxCHAR_NULL);
   orxASSERT(_pvVector != orxNULL);
 
   /* Gets corresponding value */
-  pstValue = orxConfig_GetValue(_zKey);
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
 
   /* Found? */
   if(pstValue != orxNULL)
@@ -7347,26 +9210,24 @@ orxVECTOR *orxFASTCALL orxConfig_GetVector(const orxSTRING _zKey, orxVECTOR *_pv
   return pvResult;
 }
 
-/** Reads a vector value from config and interpret any color literals in the given color space (will take a random value if a list is provided for this key)
- * @param[in]   _zKey             Key name
+/** Reads a vector value from config, using a key ID, and interpret any color literals in the given color space (will take a random value if a list is provided for this key)
+ * @param[in]   _stKeyID          Key ID, as returned by orxConfig_GetKeyID
  * @param[in]   _eColorSpace      Color space to use when translating color literals (NONE: no literal, COMPONENT: 0-255 RGB values, all others: normalized spaces)
  * @param[out]  _pvVector         Storage for vector value
  * @return The value if valid, orxNULL otherwise
  */
-orxVECTOR *orxFASTCALL orxConfig_GetColorVector(const orxSTRING _zKey, orxCOLORSPACE _eColorSpace, orxVECTOR *_pvVector)
+orxVECTOR *orxFASTCALL orxConfig_GetColorVectorByID(orxSTRINGID _stKeyID, orxCOLORSPACE _eColorSpace, orxVECTOR *_pvVector)
 {
   orxCONFIG_VALUE  *pstValue;
   orxVECTOR        *pvResult = orxNULL;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
-  orxASSERT(_zKey != orxNULL);
-  orxASSERT(*_zKey != orxCHAR_NULL);
   orxASSERT((_eColorSpace < orxCOLORSPACE_NUMBER) || (_eColorSpace == orxCOLORSPACE_NONE));
   orxASSERT(_pvVector != orxNULL);
 
   /* Gets corresponding value */
-  pstValue = orxConfig_GetValue(_zKey);
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
 
   /* Found? */
   if(pstValue != orxNULL)
@@ -8081,6 +9942,107 @@ orxVECTOR *orxFASTCALL orxConfig_GetListColorVector(const orxSTRING _zKey, orxS3
   return pvResult;
 }
 
+/** Gets list count for a given key ID
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @return List count if it's a valid list, 0 otherwise
+ */
+orxS32 orxFASTCALL orxConfig_GetListCountByID(orxSTRINGID _stKeyID)
+{
+  orxCONFIG_VALUE  *pstValue;
+  orxS32            s32Result = 0;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+
+  /* Gets associated value */
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
+
+  /* Valid? */
+  if(pstValue != orxNULL)
+  {
+    /* Updates result */
+    s32Result = (orxS32)pstValue->u16ListCount;
+  }
+
+  /* Done! */
+  return s32Result;
+}
+
+/** Reads a string value from config list, using a key ID
+ * Beware: result might not persist through any subsequent orxConfig_Get* calls
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @param[in] _s32ListIndex     Index of desired item in list / -1 for random
+ * @return The value
+ */
+const orxSTRING orxFASTCALL orxConfig_GetListStringByID(orxSTRINGID _stKeyID, orxS32 _s32ListIndex)
+{
+  orxCONFIG_VALUE  *pstValue;
+  const orxSTRING   zResult = orxSTRING_EMPTY;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_s32ListIndex < 0xFFFF);
+
+  /* Gets value */
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
+
+  /* Valid? */
+  if(pstValue != orxNULL)
+  {
+    /* Is index valid? */
+    if(_s32ListIndex < (orxS32)pstValue->u16ListCount)
+    {
+      /* Updates result */
+      orxConfig_GetStringFromValue(pstValue, _s32ListIndex, &zResult);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Failed to get STRING list item config value <%s.%s>, invalid index: %d out of %d item(s).", orxString_GetFromID(_stKeyID), pstValue->zValue, _s32ListIndex, (orxS32)pstValue->u16ListCount);
+    }
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+/** Reads a boolean value from config list, using a key ID
+ * @param[in] _stKeyID          Key ID, as returned by orxConfig_GetKeyID
+ * @param[in] _s32ListIndex     Index of desired item in list / -1 for random
+ * @return The value
+ */
+orxBOOL orxFASTCALL orxConfig_GetListBoolByID(orxSTRINGID _stKeyID, orxS32 _s32ListIndex)
+{
+  orxCONFIG_VALUE  *pstValue;
+  orxBOOL           bResult = orxFALSE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_s32ListIndex < 0xFFFF);
+
+  /* Gets value */
+  pstValue = orxConfig_GetValueByID(_stKeyID, orxNULL);
+
+  /* Valid? */
+  if(pstValue != orxNULL)
+  {
+    /* Is index valid? */
+    if(_s32ListIndex < (orxS32)pstValue->u16ListCount)
+    {
+      /* Updates result */
+      orxConfig_GetBoolFromValue(pstValue, _s32ListIndex, &bResult);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "Failed to get BOOL list item config value <%s.%s>, invalid index: %d out of %d item(s).", orxString_GetFromID(_stKeyID), pstValue->zValue, _s32ListIndex, (orxS32)pstValue->u16ListCount);
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
 /** Writes a list of string values to config
  * @param[in] _zKey             Key name
  * @param[in] _azValue          Values
@@ -38,6 +38,7 @@
 #include "memory/orxBank.h"
 #include "utils/orxHashTable.h"
 #include "utils/orxLinkList.h"
+#include "utils/orxString.h"
 
 
 /** Module flags
@@ -49,6 +50,13 @@
 #define orxEVENT_KU32_STATIC_MASK_ALL     0xFFFFFFFF  /**< All mask */
 
 
+/** Storage flags
+ */
+#define orxEVENT_KU32_STORAGE_FLAG_NONE   0x00000000  /**< No flags */
+
+#define orxEVENT_KU32_STORAGE_FLAG_DIRTY  0x00000001  /**< Dirty flag: dispatch list needs to be rebuilt */
+
+
 /** Misc defines
  */
 #define orxEVENT_KU32_HANDLER_TABLE_SIZE  64
@@ -75,9 +83,15 @@ typedef struct __orxEVENT_HANDLER_INFO_t
  */
 typedef struct __orxEVENT_HANDLER_STORAGE_t
 {
-  orxU8       au8HandledIDList[32];
-  orxLINKLIST stList;
-  orxBANK    *pstBank;
+  orxU8                   au8HandledIDList[32];
+  orxU16                  au16DispatchIndexList[32 + 1];  /**< Start of each ID bucket in the dispatch list */
+  orxEVENT_HANDLER_INFO **apstDispatchList;               /**< Handlers bucketed per ID, in registration order */
+  orxLINKLIST             stList;
+  orxBANK                *pstBank;
+  orxU32                  u32DispatchSize;                /**< Dispatch list size */
+  orxU32                  u32SendCount;                   /**< Number of sends currently dispatching from this storage */
+  orxU32                  u32Flags;                       /**< Storage flags */
+  orxS32                  s32MarkerID;                    /**< Profiler marker ID */
 
 } orxEVENT_HANDLER_STORAGE;
 
@@ -100,11 +114,176 @@ typedef struct __orxEVENT_STATIC_t
 
 static orxEVENT_STATIC sstEvent;
 
+#ifdef __orxPROFILER__
+
+/** Core event type names, used for profiler markers
+ */
+static const orxSTRING sazEventTypeNameList[orxEVENT_TYPE_CORE_NUMBER] =
+{
+  "Anim",
+  "Clock",
+  "Config",
+  "Display",
+  "FX",
+  "Input",
+  "Locale",
+  "Object",
+  "Render",
+  "Physics",
+  "Resource",
+  "Shader",
+  "Sound",
+  "Spawner",
+  "System",
+  "Texture",
+  "Timeline",
+  "Trigger",
+  "Viewport"
+};
+
+#endif /* __orxPROFILER__ */
+
 
 /***************************************************************************
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Gets the handler storage of an event type
+ * @param[in] _eEventType           Concerned type of event
+ * @return orxEVENT_HANDLER_STORAGE / orxNULL
+ */
+static orxINLINE orxEVENT_HANDLER_STORAGE *orxEvent_GetStorage(orxEVENT_TYPE _eEventType)
+{
+  orxEVENT_HANDLER_STORAGE *pstResult;
+
+  /* Updates result */
+  pstResult = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes all the handlers marked for deletion from a storage
+ * @param[in] _pstStorage           Concerned storage, mustn't be dispatching, main thread only
+ */
+static void orxFASTCALL orxEvent_CleanStorage(orxEVENT_HANDLER_STORAGE *_pstStorage)
+{
+  orxEVENT_HANDLER_STORAGE *pstStorage = _pstStorage;
+  orxEVENT_HANDLER_INFO    *pstInfo, *pstNextInfo;
+
+  /* Checks */
+  orxASSERT(_pstStorage->u32SendCount == 0);
+
+  /* For all handlers */
+  for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
+      pstInfo != orxNULL;
+      pstInfo = pstNextInfo)
+  {
+    /* Gets next info */
+    pstNextInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode));
+
+    /* Marked for deletion? */
+    if(pstInfo->pfnHandler == orxNULL)
+    {
+      /* Removes it from list */
+      orxLinkList_Remove(&(pstInfo->stNode));
+
+      /* For all IDs */
+      for(orxU32 i = 0; i < 32; i++)
+      {
+        orxU32 u32ID;
+
+        /* Gets it */
+        u32ID = (orxU32)(1 << i);
+
+        /* Should be removed? */
+        if(orxFLAG_TEST(pstInfo->u32IDFlags, u32ID))
+        {
+          /* Checks */
+          orxASSERT(pstStorage->au8HandledIDList[i] > 0);
+
+          /* Updates ID tracking */
+          pstStorage->au8HandledIDList[i]--;
+        }
+      }
+
+      /* Frees it */
+      orxBank_Free(pstStorage->pstBank, pstInfo);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Rebuilds the per-ID dispatch list of a storage
+ * @param[in] _pstStorage           Concerned storage, mustn't be dispatching, main thread only
+ */
+static void orxFASTCALL orxEvent_UpdateStorage(orxEVENT_HANDLER_STORAGE *_pstStorage)
+{
+  orxEVENT_HANDLER_INFO  *pstInfo;
+  orxU16                  au16CursorList[32];
+  orxU32                  i, u32Count;
+
+  /* Checks */
+  orxASSERT(_pstStorage->u32SendCount == 0);
+
+  /* Deletes handlers marked for deletion */
+  orxEvent_CleanStorage(_pstStorage);
+
+  /* For all IDs */
+  for(i = 0, u32Count = 0; i < 32; i++)
+  {
+    /* Stores its bucket start */
+    _pstStorage->au16DispatchIndexList[i] = au16CursorList[i] = (orxU16)u32Count;
+
+    /* Updates count */
+    u32Count += (orxU32)_pstStorage->au8HandledIDList[i];
+  }
+
+  /* Stores end */
+  _pstStorage->au16DispatchIndexList[32] = (orxU16)u32Count;
+
+  /* Needs to grow? */
+  if(u32Count > _pstStorage->u32DispatchSize)
+  {
+    orxEVENT_HANDLER_INFO **apstDispatchList;
+
+    /* Grows list */
+    apstDispatchList = (orxEVENT_HANDLER_INFO **)orxMemory_Reallocate(_pstStorage->apstDispatchList, u32Count * sizeof(orxEVENT_HANDLER_INFO *), orxMEMORY_TYPE_MAIN);
+
+    /* Checks */
+    orxASSERT(apstDispatchList != orxNULL);
+
+    /* Stores it */
+    _pstStorage->apstDispatchList = apstDispatchList;
+    _pstStorage->u32DispatchSize  = u32Count;
+  }
+
+  /* For all handlers */
+  for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(_pstStorage->stList));
+      pstInfo != orxNULL;
+      pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
+  {
+    /* For all its IDs */
+    for(i = 0; i < 32; i++)
+    {
+      /* Handles it? */
+      if(orxFLAG_TEST(pstInfo->u32IDFlags, orxEVENT_GET_FLAG(i)))
+      {
+        /* Adds it to the ID bucket */
+        _pstStorage->apstDispatchList[au16CursorList[i]++] = pstInfo;
+      }
+    }
+  }
+
+  /* Updates status */
+  orxFLAG_SET(_pstStorage->u32Flags, orxEVENT_KU32_STORAGE_FLAG_NONE, orxEVENT_KU32_STORAGE_FLAG_DIRTY);
+
+  /* Done! */
+  return;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -208,6 +387,13 @@ void orxFASTCALL orxEvent_Exit()
     {
       /* Deletes its bank */
       orxBank_Delete(pstStorage->pstBank);
+
+      /* Has dispatch list? */
+      if(pstStorage->apstDispatchList != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(pstStorage->apstDispatchList);
+      }
     }
 
     /* Deletes bank */
@@ -252,7 +438,7 @@ orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType,
   orxASSERT(_pfnEventHandler != orxNULL);
 
   /* Gets corresponding storage */
-  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+  pstStorage = orxEvent_GetStorage(_eEventType);
 
   /* No storage yet? */
   if(pstStorage == orxNULL)
@@ -275,6 +461,9 @@ orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType,
         /* Clears its list */
         orxMemory_Zero(&(pstStorage->stList), sizeof(orxLINKLIST));
 
+        /* Inits its profiler marker */
+        pstStorage->s32MarkerID = orxPROFILER_KS32_MARKER_ID_NONE;
+
         /* Is a core event handler? */
         if(_eEventType < orxEVENT_TYPE_CORE_NUMBER)
         {
@@ -307,44 +496,14 @@ orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType,
   /* Valid? */
   if(pstStorage != orxNULL)
   {
-    orxEVENT_HANDLER_INFO *pstInfo, *pstNextInfo;
+    orxEVENT_HANDLER_INFO *pstInfo;
 
-    /* For all handlers */
-    for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
-        pstInfo != orxNULL;
-        pstInfo = pstNextInfo)
+    /* Not dispatching and on main thread? */
+    if((pstStorage->u32SendCount == 0)
+    && (orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID))
     {
-      /* Gets next info */
-      pstNextInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode));
-
-      /* Marked for deletion? */
-      if(pstInfo->pfnHandler == orxNULL)
-      {
-        /* Removes it from list */
-        orxLinkList_Remove(&(pstInfo->stNode));
-
-        /* For all IDs */
-        for(orxU32 i = 0; i < 32; i++)
-        {
-          orxU32 u32ID;
-
-          /* Gets it */
-          u32ID = (orxU32)(1 << i);
-
-          /* Should be removed? */
-          if(orxFLAG_TEST(pstInfo->u32IDFlags, u32ID))
-          {
-            /* Checks */
-            orxASSERT(pstStorage->au8HandledIDList[i] > 0);
-
-            /* Updates ID tracking */
-            pstStorage->au8HandledIDList[i]--;
-          }
-        }
-
-        /* Frees it */
-        orxBank_Free(pstStorage->pstBank, pstInfo);
-      }
+      /* Deletes handlers marked for deletion */
+      orxEvent_CleanStorage(pstStorage);
     }
 
     /* Allocates a new handler info */
@@ -378,6 +537,9 @@ orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType,
           pstStorage->au8HandledIDList[i]++;
         }
 
+        /* Updates status */
+        orxFLAG_SET(pstStorage->u32Flags, orxEVENT_KU32_STORAGE_FLAG_DIRTY, orxEVENT_KU32_STORAGE_FLAG_NONE);
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
       }
@@ -425,7 +587,7 @@ orxSTATUS orxFASTCALL orxEvent_RemoveHandlerWithContext(orxEVENT_TYPE _eEventTyp
   orxASSERT(_pfnEventHandler != orxNULL);
 
   /* Gets corresponding storage */
-  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+  pstStorage = orxEvent_GetStorage(_eEventType);
 
   /* Valid? */
   if(pstStorage != orxNULL)
@@ -446,6 +608,9 @@ orxSTATUS orxFASTCALL orxEvent_RemoveHandlerWithContext(orxEVENT_TYPE _eEventTyp
         /* Marks it for deletion */
         pstInfo->pfnHandler = orxNULL;
 
+        /* Updates status */
+        orxFLAG_SET(pstStorage->u32Flags, orxEVENT_KU32_STORAGE_FLAG_DIRTY, orxEVENT_KU32_STORAGE_FLAG_NONE);
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
 
@@ -486,7 +651,7 @@ orxSTATUS orxFASTCALL orxEvent_SetHandlerIDFlags(orxEVENT_HANDLER _pfnEventHandl
   orxASSERT(_pfnEventHandler != orxNULL);
 
   /* Gets corresponding storage */
-  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+  pstStorage = orxEvent_GetStorage(_eEventType);
 
   /* Valid? */
   if(pstStorage != orxNULL)
@@ -503,6 +668,9 @@ orxSTATUS orxFASTCALL orxEvent_SetHandlerIDFlags(orxEVENT_HANDLER _pfnEventHandl
       && ((_pContext == orxNULL)
        || (_pContext == pstInfo->pContext)))
       {
+        /* Updates status */
+        orxFLAG_SET(pstStorage->u32Flags, orxEVENT_KU32_STORAGE_FLAG_DIRTY, orxEVENT_KU32_STORAGE_FLAG_NONE);
+
         /* For all IDs */
         for(orxU32 i = 0; i < 32; i++)
         {
@@ -565,7 +733,7 @@ orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
   orxASSERT((_pstEvent->eID >= 0) && (_pstEvent->eID < 32));
 
   /* Gets corresponding storage */
-  pstStorage = (_pstEvent->eType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_pstEvent->eType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _pstEvent->eType);
+  pstStorage = orxEvent_GetStorage(_pstEvent->eType);
 
   /* Valid? */
   if(pstStorage != orxNULL)
@@ -573,8 +741,8 @@ orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
     /* Should handle this ID? */
     if(pstStorage->au8HandledIDList[_pstEvent->eID] != 0)
     {
-      orxEVENT_HANDLER_INFO  *pstInfo, *pstNextInfo;
-      orxU32                  u32IDFlag, u32CurrentThread;
+      orxU32  u32IDFlag, u32CurrentThread;
+      orxBOOL bUseDispatchList = orxFALSE;
 
       /* Get its ID flag */
       u32IDFlag = orxEVENT_GET_FLAG(_pstEvent->eID);
@@ -587,62 +755,105 @@ orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
       {
         /* Updates event send count */
         sstEvent.s32EventSendCount++;
+
+#ifdef __orxPROFILER__
+
+        /* No marker yet? */
+        if(orxProfiler_IsMarkerIDValid(pstStorage->s32MarkerID) == orxFALSE)
+        {
+          orxCHAR acBuffer[64];
+
+          /* Gets its name */
+          if(_pstEvent->eType < orxEVENT_TYPE_CORE_NUMBER)
+          {
+            orxString_NPrint(acBuffer, sizeof(acBuffer), "orxEvent_Send <%s>", sazEventTypeNameList[_pstEvent->eType]);
+          }
+          else
+          {
+            orxString_NPrint(acBuffer, sizeof(acBuffer), "orxEvent_Send <%u>", (orxU32)_pstEvent->eType);
+          }
+
+          /* Gets its ID */
+          pstStorage->s32MarkerID = orxProfiler_GetIDFromName(acBuffer);
+        }
+
+        /* Profiles */
+        orxProfiler_PushMarker(pstStorage->s32MarkerID);
+
+#endif /* __orxPROFILER__ */
+
+        /* Needs to rebuild dispatch list and not already dispatching? */
+        if((orxFLAG_TEST(pstStorage->u32Flags, orxEVENT_KU32_STORAGE_FLAG_DIRTY))
+        && (pstStorage->u32SendCount == 0))
+        {
+          /* Rebuilds it */
+          orxEvent_UpdateStorage(pstStorage);
+        }
+
+        /* Updates storage send count */
+        pstStorage->u32SendCount++;
+
+        /* Uses dispatch list if up-to-date */
+        bUseDispatchList = (orxFLAG_TEST(pstStorage->u32Flags, orxEVENT_KU32_STORAGE_FLAG_DIRTY)) ? orxFALSE : orxTRUE;
       }
 
-      /* For all handlers */
-      for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
-          pstInfo != orxNULL;
-          pstInfo = pstNextInfo)
+      /* Should use dispatch list? */
+      if(bUseDispatchList != orxFALSE)
       {
-        /* Gets next info */
-        pstNextInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode));
+        orxU32 i, u32End;
 
-        /* Should process? */
-        if(orxFLAG_TEST(pstInfo->u32IDFlags, u32IDFlag))
+        /* For all handlers of this ID */
+        for(i = (orxU32)pstStorage->au16DispatchIndexList[_pstEvent->eID], u32End = (orxU32)pstStorage->au16DispatchIndexList[_pstEvent->eID + 1];
+            i < u32End;
+            i++)
         {
-          /* Not marked for deletion? */
-          if(pstInfo->pfnHandler != orxNULL)
+          orxEVENT_HANDLER_INFO *pstInfo;
+
+          /* Gets it */
+          pstInfo = pstStorage->apstDispatchList[i];
+
+          /* Should process and not marked for deletion? */
+          if((orxFLAG_TEST(pstInfo->u32IDFlags, u32IDFlag))
+          && (pstInfo->pfnHandler != orxNULL))
           {
             /* Stores context */
             _pstEvent->pContext = pstInfo->pContext;
 
             /* Calls it */
             eResult = (pstInfo->pfnHandler)(_pstEvent);
-          }
-
-          /* Marked for deletion? */
-          if(pstInfo->pfnHandler == orxNULL)
-          {
-            /* Removes it from list */
-            orxLinkList_Remove(&(pstInfo->stNode));
 
-            /* For all IDs */
-            for(orxU32 i = 0; i < 32; i++)
+            /* Should stop? */
+            if(eResult == orxSTATUS_FAILURE)
             {
-              orxU32 u32ID;
-
-              /* Gets it */
-              u32ID = (orxU32)(1 << i);
-
-              /* Should be removed? */
-              if(orxFLAG_TEST(pstInfo->u32IDFlags, u32ID))
-              {
-                /* Checks */
-                orxASSERT(pstStorage->au8HandledIDList[i] > 0);
-
-                /* Updates ID tracking */
-                pstStorage->au8HandledIDList[i]--;
-              }
+              break;
             }
-
-            /* Frees it */
-            orxBank_Free(pstStorage->pstBank, pstInfo);
           }
+        }
+      }
+      else
+      {
+        orxEVENT_HANDLER_INFO *pstInfo;
 
-          /* Should stop? */
-          if(eResult == orxSTATUS_FAILURE)
+        /* For all handlers (other threads only read the list, storage gets only updated/cleaned on the main thread) */
+        for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
+            pstInfo != orxNULL;
+            pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
+        {
+          /* Should process and not marked for deletion? */
+          if((orxFLAG_TEST(pstInfo->u32IDFlags, u32IDFlag))
+          && (pstInfo->pfnHandler != orxNULL))
           {
-            break;
+            /* Stores context */
+            _pstEvent->pContext = pstInfo->pContext;
+
+            /* Calls it */
+            eResult = (pstInfo->pfnHandler)(_pstEvent);
+
+            /* Should stop? */
+            if(eResult == orxSTATUS_FAILURE)
+            {
+              break;
+            }
           }
         }
       }
@@ -653,6 +864,24 @@ orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
       /* Main thread? */
       if(u32CurrentThread == orxTHREAD_KU32_MAIN_THREAD_ID)
       {
+        /* Updates storage send count */
+        pstStorage->u32SendCount--;
+
+        /* Handlers got modified while dispatching? */
+        if((orxFLAG_TEST(pstStorage->u32Flags, orxEVENT_KU32_STORAGE_FLAG_DIRTY))
+        && (pstStorage->u32SendCount == 0))
+        {
+          /* Rebuilds dispatch list */
+          orxEvent_UpdateStorage(pstStorage);
+        }
+
+#ifdef __orxPROFILER__
+
+        /* Profiles */
+        orxProfiler_PopMarker();
+
+#endif /* __orxPROFILER__ */
+
         /* Updates event send count */
         sstEvent.s32EventSendCount--;
       }
@@ -707,3 +936,40 @@ orxBOOL orxFASTCALL orxEvent_IsSending()
   /* Done! */
   return bResult;
 }
+
+/** Has an event type/ID any handler? Can be used to skip building an event payload that no-one would receive
+ * @param[in] _eEventType           Event type
+ * @param[in] _eEventID             Event ID
+ * @return orxTRUE / orxFALSE
+ */
+orxBOOL orxFASTCALL orxEvent_HasHandler(orxEVENT_TYPE _eEventType, orxENUM _eEventID)
+{
+  orxEVENT_HANDLER_STORAGE *pstStorage;
+  orxBOOL                   bResult = orxFALSE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT((_eEventID >= 0) && (_eEventID < 32));
+
+  /* Gets corresponding storage */
+  pstStorage = orxEvent_GetStorage(_eEventType);
+
+  /* Valid? */
+  if(pstStorage != orxNULL)
+  {
+    /* Needs to rebuild dispatch list, not dispatching and on main thread? */
+    if((orxFLAG_TEST(pstStorage->u32Flags, orxEVENT_KU32_STORAGE_FLAG_DIRTY))
+    && (pstStorage->u32SendCount == 0)
+    && (orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID))
+    {
+      /* Rebuilds it */
+      orxEvent_UpdateStorage(pstStorage);
+    }
+
+    /* Updates result */
+    bResult = (pstStorage->au8HandledIDList[_eEventID] != 0) ? orxTRUE : orxFALSE;
+  }
+
+  /* Done! */
+  return bResult;
+}
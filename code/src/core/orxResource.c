@@ -53,6 +53,22 @@
 
 #endif /* __orxANDROID__ */
 
+#if defined(__orxLINUX__)
+
+  #include <sys/inotify.h>
+  #include <unistd.h>
+  #include <errno.h>
+
+  #define orxRESOURCE_KB_NOTIFY_SUPPORT
+
+#endif /* __orxLINUX__ */
+
+#if defined(__orxWINDOWS__) || defined(__orxMAC__) || defined(__orxIOS__)
+
+  #define orxRESOURCE_KB_INDEX_CASE_INSENSITIVE
+
+#endif /* __orxWINDOWS__ || __orxMAC__ || __orxIOS__ */
+
 /** Module flags
  */
 #define orxRESOURCE_KU32_STATIC_FLAG_NONE             0x00000000                      /**< No flags */
@@ -63,6 +79,8 @@
 #define orxRESOURCE_KU32_STATIC_FLAG_NOTIFY_SET       0x00000008                      /**< Notify set flag */
 #define orxRESOURCE_KU32_STATIC_FLAG_WATCH_REGISTERED 0x00000010                      /**< Watch registered flag */
 #define orxRESOURCE_KU32_STATIC_FLAG_EXIT             0x00000020                      /**< Exit flag */
+#define orxRESOURCE_KU32_STATIC_FLAG_WORKER_SET       0x00000040                      /**< Worker set flag */
+#define orxRESOURCE_KU32_STATIC_FLAG_LOOKUP_CACHE     0x00000080                      /**< Lookup cache flag */
 
 #define orxRESOURCE_KU32_STATIC_MASK_ALL              0xFFFFFFFF                      /**< All mask */
 
@@ -81,13 +99,30 @@
 
 #define orxRESOURCE_KU32_OPEN_INFO_BANK_SIZE          64                              /**< Open resource info bank size */
 
+#define orxRESOURCE_KU32_PREFETCH_SET_BANK_SIZE       8                               /**< Prefetch set bank size */
+#define orxRESOURCE_KU32_PREFETCH_DATA_BANK_SIZE      64                              /**< Prefetch data bank size */
+
+#define orxRESOURCE_KU32_MISS_TABLE_SIZE              64                              /**< Missed lookup table size */
+#define orxRESOURCE_KU32_INDEX_BANK_SIZE              16                              /**< Storage index bank size */
+#define orxRESOURCE_KU32_INDEX_LIST_SIZE              1024                            /**< Storage index path list initial size */
+#define orxRESOURCE_KU32_INDEX_MAX_ENTRY_NUMBER       65536                           /**< Storage index max entry number, beyond which the storage won't be indexed */
+#define orxRESOURCE_KU32_INDEX_MAX_DEPTH              16                              /**< Storage index max directory depth */
+#define orxRESOURCE_KU32_INDEX_BUFFER_SIZE            1024                            /**< Storage index path buffer size */
+
 #define orxRESOURCE_KU32_WATCH_ITERATION_LIMIT        2                               /**< Watch iteration limit */
 #define orxRESOURCE_KU32_WATCH_TIME_UNINITIALIZED     -1                              /**< Watch time uninitialized */
 #define orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY       0.2                             /**< Watch notification delay */
 
+#define orxRESOURCE_KU32_NOTIFY_BUFFER_SIZE           4096                            /**< Change notification buffer size */
+#define orxRESOURCE_KU32_NOTIFY_CHANGE_NUMBER         64                              /**< Change notification number per update, beyond which all watched resources get checked */
+#define orxRESOURCE_KU32_NOTIFY_TABLE_SIZE            64                              /**< Watched directory table size */
+
 #define orxRESOURCE_KU32_BUFFER_SIZE                  256                             /**< Buffer size */
 #define orxRESOURCE_KU32_REQUEST_LIST_SIZE            8192                            /**< Request list size */
 
+#define orxRESOURCE_KU32_DEFAULT_WORKER_NUMBER        2                               /**< Default worker number */
+#define orxRESOURCE_KU32_MAX_WORKER_NUMBER            8                               /**< Max worker number */
+
 #define orxRESOURCE_KZ_THREAD_NAME                    "Resource"
 
 
@@ -112,6 +147,8 @@ typedef struct __orxRESOURCE_GROUP_t
   orxLINKLIST               stStorageList;                                            /**< Group storage list */
   orxBANK                  *pstStorageBank;                                           /**< Group storage bank */
   orxHASHTABLE             *pstCacheTable;                                            /**< Group cache table */
+  orxHASHTABLE             *pstMissTable;                                             /**< Group missed lookup table */
+  orxRESOURCE_STATS         stStats;                                                  /**< Group request stats */
 
 } orxRESOURCE_GROUP;
 
@@ -135,6 +172,7 @@ typedef struct __orxRESOURCE_INFO_t
   orxSTRINGID               stStorageID;                                              /**< Storage ID */
   orxSTRINGID               stNameID;                                                 /**< Name ID */
   orxBOOL                   bPendingWatch;                                            /**< Pending watch */
+  orxBOOL                   bNotified;                                                /**< Its directory is watched for changes */
 
 } orxRESOURCE_INFO;
 
@@ -145,6 +183,12 @@ typedef struct __orxRESOURCE_OPEN_INFO_t
   orxRESOURCE_TYPE_INFO    *pstTypeInfo;                                              /**< Resource type info */
   orxHANDLE                 hResource;                                                /**< Resource handle */
   orxSTRING                 zLocation;                                                /**< Resource location */
+  const void               *pMap;                                                     /**< Mapped content */
+  orxS64                    s64MapSize;                                               /**< Mapped content size */
+  orxRESOURCE_GROUP        *pstGroup;                                                 /**< Resource group, if known */
+  orxRESOURCE_PRIORITY      ePriority;                                                /**< Request priority */
+  orxU32                    u32NextSequence;                                          /**< Next request sequence */
+  volatile orxU32           u32ServeSequence;                                         /**< Serviceable request sequence */
   volatile orxU32           u32OpCount;                                               /**< Operation count */
 
 } orxRESOURCE_OPEN_INFO;
@@ -173,7 +217,14 @@ typedef struct __orxRESOURCE_REQUEST_t
   orxRESOURCE_OP_FUNCTION   pfnCallback;                                              /**< Request completion callback */
   void                     *pContext;                                                 /**< Request context */
   orxRESOURCE_OPEN_INFO    *pstResourceInfo;                                          /**< Request open resource info */
+  orxRESOURCE_GROUP        *pstGroup;                                                 /**< Request group, if known */
+  orxDOUBLE                 dQueueTime;                                               /**< Request queue time */
+  orxDOUBLE                 dStartTime;                                               /**< Request start time */
+  orxDOUBLE                 dEndTime;                                                 /**< Request end time */
   orxRESOURCE_REQUEST_TYPE  eType;                                                    /**< Request type */
+  orxU32                    u32Sequence;                                              /**< Request sequence in its resource */
+  orxU32                    u32NextIndex;                                             /**< Next request index in its list */
+  orxBOOL                   bCancelled;                                               /**< Request has been cancelled */
 
 } orxRESOURCE_REQUEST;
 
@@ -198,6 +249,60 @@ typedef struct __orxRESOURCE_MEMORY_RESOURCE_t
 
 } orxRESOURCE_MEMORY_RESOURCE;
 
+/** Prefetch set
+ */
+typedef struct __orxRESOURCE_PREFETCH_SET_t
+{
+  const orxSTRING                 zSet;                                               /**< Set name */
+  orxRESOURCE_PREFETCH_FUNCTION   pfnCallback;                                        /**< Completion callback */
+  void                           *pContext;                                           /**< Completion callback context */
+  orxU32                          u32Count;                                           /**< Processed resource count */
+  orxU32                          u32LoadCount;                                       /**< Loaded resource count */
+  orxU32                          u32TotalCount;                                      /**< Total resource count */
+  orxBOOL                         bIssuing;                                           /**< Requests are still being issued */
+
+} orxRESOURCE_PREFETCH_SET;
+
+/** Prefetch data
+ */
+typedef struct __orxRESOURCE_PREFETCH_DATA_t
+{
+  orxRESOURCE_PREFETCH_SET *pstSet;                                                   /**< Prefetch set, orxNULL once loaded */
+  void                     *pBuffer;                                                  /**< Prefetched content */
+  orxS64                    s64Size;                                                  /**< Prefetched content size */
+  orxSTRINGID               stGroupID;                                                /**< Group ID */
+  orxSTRINGID               stStorageID;                                              /**< Storage ID */
+  orxSTRINGID               stNameID;                                                 /**< Name ID */
+
+} orxRESOURCE_PREFETCH_DATA;
+
+/** Storage index status enum
+ */
+typedef enum __orxRESOURCE_INDEX_STATUS_t
+{
+  orxRESOURCE_INDEX_STATUS_EMPTY = 0,
+  orxRESOURCE_INDEX_STATUS_BUILDING,
+  orxRESOURCE_INDEX_STATUS_READY,
+  orxRESOURCE_INDEX_STATUS_FAILED,
+
+  orxRESOURCE_INDEX_STATUS_NUMBER,
+
+  orxRESOURCE_INDEX_STATUS_NONE = orxENUM_NONE
+
+} orxRESOURCE_INDEX_STATUS;
+
+/** Storage index, lists all the files of a storage directory
+ */
+typedef struct __orxRESOURCE_INDEX_t
+{
+  orxSTRINGID                        *astPathList;                                    /**< Sorted path ID list, owned by the building worker until ready */
+  orxU32                              u32PathCount;                                   /**< Path count */
+  const orxSTRING                     zStorage;                                       /**< Storage */
+  volatile orxRESOURCE_INDEX_STATUS   eStatus;                                        /**< Status */
+  orxBOOL                             bDirty;                                         /**< Needs to be rebuilt */
+
+} orxRESOURCE_INDEX;
+
 /** Static structure
  */
 typedef struct __orxRESOURCE_STATIC_t
@@ -207,18 +312,40 @@ typedef struct __orxRESOURCE_STATIC_t
   orxBANK                  *pstResourceInfoBank;                                      /**< Resource info bank */
   orxBANK                  *pstOpenInfoBank;                                          /**< Open resource table size */
   orxTHREAD_SEMAPHORE*      pstWorkerSemaphore;                                       /**< Worker semaphore */
+  orxHASHTABLE             *pstLocationTable;                                         /**< Location to group table */
   orxLINKLIST               stTypeList;                                               /**< Type list */
   orxSTRING                 zLastUncachedLocation;                                    /**< Last uncached location */
   orxSTRINGID               stLastWatchedGroupID;                                     /**< Last watched group ID */
   orxHASHTABLE             *pstMemoryDataTable;                                       /**< Memory data table */
   orxBANK                  *pstMemoryDataBank;                                        /**< Memory data bank */
   orxBANK                  *pstMemoryResourceBank;                                    /**< Memory resource bank */
+  orxBANK                  *pstPrefetchSetBank;                                       /**< Prefetch set bank */
+  orxBANK                  *pstPrefetchDataBank;                                      /**< Prefetch data bank */
+  orxHASHTABLE             *pstPrefetchTable;                                         /**< Prefetched memory resource table */
+  orxBANK                  *pstIndexBank;                                             /**< Storage index bank */
+  orxHASHTABLE             *pstIndexTable;                                            /**< Storage index table */
+
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+  orxHASHTABLE             *pstNotifyTable;                                           /**< Watched directory table */
+  orxHASHTABLE             *pstWatchTable;                                            /**< Watch descriptor to directory table */
+  int                       iNotifyFD;                                                /**< Change notification descriptor */
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
   volatile orxSTATUS        eThreadResult;                                            /**< Thread result */
   volatile orxRESOURCE_REQUEST astRequestList[orxRESOURCE_KU32_REQUEST_LIST_SIZE];    /**< Request list */
-  volatile orxU32           u32RequestInIndex;                                        /**< Request in index */
-  volatile orxU32           u32RequestProcessIndex;                                   /**< Request process index */
-  volatile orxU32           u32RequestOutIndex;                                       /**< Request out index */
-  orxU32                    u32RequestThreadID;                                       /**< Request thread ID */
+  volatile orxU32           au32QueueHeadList[orxRESOURCE_PRIORITY_NUMBER];           /**< Request queue head index list, per priority */
+  volatile orxU32           au32QueueTailList[orxRESOURCE_PRIORITY_NUMBER];           /**< Request queue tail index list, per priority */
+  volatile orxU32           u32DoneHeadIndex;                                         /**< Processed request list head index */
+  volatile orxU32           u32DoneTailIndex;                                         /**< Processed request list tail index */
+  volatile orxU32           u32QueueLock;                                             /**< Request queue lock */
+  volatile orxU32           u32UnprocessedCount;                                      /**< Unprocessed request count */
+  orxU32                    u32FreeIndex;                                             /**< Free request list head index */
+  orxU32                    u32RequestCount;                                          /**< Request count (added & not yet notified) */
+  orxU32                    au32WorkerIDList[orxRESOURCE_KU32_MAX_WORKER_NUMBER];     /**< Worker thread ID list */
+  orxU32                    u32WorkerCount;                                           /**< Worker count */
+  orxRESOURCE_STATS         stStats;                                                  /**< Global request stats */
   orxU32                    u32Flags;                                                 /**< Control flags */
 
 } orxRESOURCE_STATIC;
@@ -237,12 +364,394 @@ static orxRESOURCE_STATIC sstResource;
  * Private functions                                                       *
  ***************************************************************************/
 
+static orxINLINE orxBOOL orxResource_IsLookupCacheEnabled()
+{
+  orxBOOL bResult;
+
+  /* Updates result: new resources can't be detected when watching by polling */
+  bResult = (!orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_REGISTERED)) ? orxTRUE : orxFALSE;
+
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+  /* Uses change notifications? */
+  if(sstResource.iNotifyFD >= 0)
+  {
+    /* Updates result */
+    bResult = orxTRUE;
+  }
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
+  /* Not enabled in config? */
+  if(!orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_LOOKUP_CACHE))
+  {
+    /* Updates result */
+    bResult = orxFALSE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static orxINLINE orxBOOL orxResource_IsIndexable(const orxSTRING _zName)
+{
+  const orxCHAR  *pc;
+  orxBOOL         bResult = orxTRUE;
+
+  /* Absolute path? */
+  if((*_zName == orxCHAR_NULL) || (*_zName == orxCHAR_DIRECTORY_SEPARATOR_LINUX))
+  {
+    /* Updates result */
+    bResult = orxFALSE;
+  }
+  else
+  {
+    /* For all segments */
+    for(pc = _zName; (bResult != orxFALSE) && (*pc != orxCHAR_NULL); pc++)
+    {
+      /* Non-canonical character? */
+      if((*pc == orxCHAR_DIRECTORY_SEPARATOR_WINDOWS) || (*pc == ':'))
+      {
+        /* Updates result */
+        bResult = orxFALSE;
+      }
+      /* Relative segment? */
+      else if((*pc == '.')
+           && ((pc == _zName) || (*(pc - 1) == orxCHAR_DIRECTORY_SEPARATOR_LINUX))
+           && ((*(pc + 1) == orxCHAR_DIRECTORY_SEPARATOR_LINUX) || (*(pc + 1) == orxCHAR_NULL) || ((*(pc + 1) == '.') && ((*(pc + 2) == orxCHAR_DIRECTORY_SEPARATOR_LINUX) || (*(pc + 2) == orxCHAR_NULL)))))
+      {
+        /* Updates result */
+        bResult = orxFALSE;
+      }
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static orxINLINE orxSTRINGID orxResource_GetIndexID(const orxSTRING _zPath)
+{
+  orxSTRINGID stResult;
+
+#ifdef orxRESOURCE_KB_INDEX_CASE_INSENSITIVE
+
+  orxCHAR acBuffer[orxRESOURCE_KU32_INDEX_BUFFER_SIZE];
+
+  /* Gets lower case path */
+  orxString_NPrint(acBuffer, sizeof(acBuffer), "%s", _zPath);
+  orxString_LowerCase(acBuffer);
+
+  /* Updates result */
+  stResult = orxString_Hash(acBuffer);
+
+#else /* orxRESOURCE_KB_INDEX_CASE_INSENSITIVE */
+
+  /* Updates result */
+  stResult = orxString_Hash(_zPath);
+
+#endif /* orxRESOURCE_KB_INDEX_CASE_INSENSITIVE */
+
+  /* Done! */
+  return stResult;
+}
+
+static int orxResource_ComparePathIDs(const void *_pA, const void *_pB)
+{
+  orxSTRINGID stA, stB;
+
+  /* Gets both IDs */
+  stA = *(const orxSTRINGID *)_pA;
+  stB = *(const orxSTRINGID *)_pB;
+
+  /* Done! */
+  return (stA < stB) ? -1 : (stA > stB) ? 1 : 0;
+}
+
+static orxSTATUS orxResource_IndexDirectory(orxRESOURCE_INDEX *_pstIndex, orxCHAR *_acPath, orxS32 _s32Length, orxS32 _s32RootLength, orxU32 _u32Depth, orxU32 *_pu32Size)
+{
+  orxFILE_INFO  stInfo;
+  orxSTATUS     eResult = orxSTATUS_SUCCESS;
+
+  /* Too deep? */
+  if(_u32Depth > orxRESOURCE_KU32_INDEX_MAX_DEPTH)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+  /* Can't add search pattern? */
+  else if(_s32Length + 3 >= orxRESOURCE_KU32_INDEX_BUFFER_SIZE)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+  else
+  {
+    /* Adds search pattern */
+    _acPath[_s32Length]     = orxCHAR_DIRECTORY_SEPARATOR_LINUX;
+    _acPath[_s32Length + 1] = '*';
+    _acPath[_s32Length + 2] = orxCHAR_NULL;
+
+    /* For all entries */
+    if(orxFile_FindFirst(_acPath, &stInfo) != orxSTATUS_FAILURE)
+    {
+      do
+      {
+        /* Not current or parent directory? */
+        if((orxString_Compare(stInfo.zName, ".") != 0) && (orxString_Compare(stInfo.zName, "..") != 0))
+        {
+          orxS32 s32Length;
+
+          /* Appends its name */
+          s32Length = _s32Length + 1 + orxString_GetLength(stInfo.zName);
+          if(s32Length < orxRESOURCE_KU32_INDEX_BUFFER_SIZE)
+          {
+            orxString_NPrint(_acPath + _s32Length + 1, orxRESOURCE_KU32_INDEX_BUFFER_SIZE - _s32Length - 1, "%s", stInfo.zName);
+
+            /* Directory? */
+            if(orxFLAG_TEST(stInfo.u32Flags, orxFILE_KU32_FLAG_INFO_DIRECTORY))
+            {
+              /* Indexes it */
+              eResult = orxResource_IndexDirectory(_pstIndex, _acPath, s32Length, _s32RootLength, _u32Depth + 1, _pu32Size);
+            }
+            /* Too many files? */
+            else if(_pstIndex->u32PathCount >= orxRESOURCE_KU32_INDEX_MAX_ENTRY_NUMBER)
+            {
+              /* Updates result */
+              eResult = orxSTATUS_FAILURE;
+            }
+            else
+            {
+              /* List full? */
+              if(_pstIndex->u32PathCount == *_pu32Size)
+              {
+                orxSTRINGID  *astPathList;
+                orxU32        u32NewSize;
+
+                /* Gets new size */
+                u32NewSize = (*_pu32Size != 0) ? *_pu32Size << 1 : orxRESOURCE_KU32_INDEX_LIST_SIZE;
+
+                /* Grows list */
+                astPathList = (orxSTRINGID *)orxMemory_Reallocate(_pstIndex->astPathList, u32NewSize * sizeof(orxSTRINGID), orxMEMORY_TYPE_MAIN);
+
+                /* Success? */
+                if(astPathList != orxNULL)
+                {
+                  /* Stores it */
+                  _pstIndex->astPathList  = astPathList;
+                  *_pu32Size              = u32NewSize;
+                }
+                else
+                {
+                  /* Updates result */
+                  eResult = orxSTATUS_FAILURE;
+                }
+              }
+
+              /* Valid? */
+              if(eResult != orxSTATUS_FAILURE)
+              {
+                /* Adds its path, relative to the storage */
+                _pstIndex->astPathList[_pstIndex->u32PathCount++] = orxResource_GetIndexID(_acPath + _s32RootLength + 1);
+              }
+            }
+          }
+          else
+          {
+            /* Updates result */
+            eResult = orxSTATUS_FAILURE;
+          }
+        }
+      } while((eResult != orxSTATUS_FAILURE) && (orxFile_FindNext(&stInfo) != orxSTATUS_FAILURE));
+
+      /* Ends search */
+      orxFile_FindClose(&stInfo);
+    }
+
+    /* Restores path */
+    _acPath[_s32Length] = orxCHAR_NULL;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxResource_BuildIndex(void *_pContext)
+{
+  orxRESOURCE_INDEX  *pstIndex;
+  orxCHAR             acPath[orxRESOURCE_KU32_INDEX_BUFFER_SIZE];
+  orxS32              s32Length;
+  orxU32              u32Size = 0;
+  orxSTATUS           eResult;
+
+  /* Gets index */
+  pstIndex = (orxRESOURCE_INDEX *)_pContext;
+
+  /* Inits path with storage */
+  s32Length = orxString_NPrint(acPath, sizeof(acPath), "%s", pstIndex->zStorage);
+
+  /* Indexes storage, only using plain memory allocations as banks & tables can't be created from a worker */
+  eResult = orxResource_IndexDirectory(pstIndex, acPath, s32Length, s32Length, 0, &u32Size);
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Has paths? */
+    if(pstIndex->u32PathCount != 0)
+    {
+      /* Sorts them for lookups */
+      qsort(pstIndex->astPathList, (size_t)pstIndex->u32PathCount, sizeof(orxSTRINGID), &orxResource_ComparePathIDs);
+    }
+  }
+  else
+  {
+    /* Has list? */
+    if(pstIndex->astPathList != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(pstIndex->astPathList);
+      pstIndex->astPathList = orxNULL;
+    }
+    pstIndex->u32PathCount = 0;
+  }
+
+  /* Updates status */
+  orxMEMORY_BARRIER();
+  pstIndex->eStatus = (eResult != orxSTATUS_FAILURE) ? orxRESOURCE_INDEX_STATUS_READY : orxRESOURCE_INDEX_STATUS_FAILED;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+static orxINLINE orxBOOL orxResource_IsIndexed(const orxRESOURCE_INDEX *_pstIndex, orxSTRINGID _stPathID)
+{
+  orxU32  u32Min, u32Max;
+  orxBOOL bResult = orxFALSE;
+
+  /* Binary searches its sorted path list */
+  for(u32Min = 0, u32Max = _pstIndex->u32PathCount; u32Min < u32Max;)
+  {
+    orxU32 u32Middle;
+
+    /* Gets middle */
+    u32Middle = (u32Min + u32Max) >> 1;
+
+    /* Found? */
+    if(_pstIndex->astPathList[u32Middle] == _stPathID)
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+
+      break;
+    }
+    /* Before? */
+    else if(_pstIndex->astPathList[u32Middle] < _stPathID)
+    {
+      /* Searches upper half */
+      u32Min = u32Middle + 1;
+    }
+    else
+    {
+      /* Searches lower half */
+      u32Max = u32Middle;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static orxRESOURCE_INDEX *orxResource_GetIndex(const orxSTRING _zStorage)
+{
+  orxRESOURCE_INDEX *pstResult = orxNULL;
+
+  /* On main thread and is lookup cache enabled? */
+  if((orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+  && (orxResource_IsLookupCacheEnabled() != orxFALSE))
+  {
+    orxRESOURCE_INDEX  *pstIndex;
+    orxSTRINGID         stStorageID;
+
+    /* Gets storage ID */
+    stStorageID = orxString_Hash(_zStorage);
+
+    /* Gets its index */
+    pstIndex = (orxRESOURCE_INDEX *)orxHashTable_Get(sstResource.pstIndexTable, stStorageID);
+
+    /* Not found? */
+    if(pstIndex == orxNULL)
+    {
+      /* Allocates it */
+      pstIndex = (orxRESOURCE_INDEX *)orxBank_Allocate(sstResource.pstIndexBank);
+
+      /* Success? */
+      if(pstIndex != orxNULL)
+      {
+        /* Inits it */
+        orxMemory_Zero(pstIndex, sizeof(orxRESOURCE_INDEX));
+        pstIndex->zStorage  = orxString_Store(_zStorage);
+        pstIndex->eStatus   = orxRESOURCE_INDEX_STATUS_EMPTY;
+
+        /* Stores it */
+        orxHashTable_Add(sstResource.pstIndexTable, stStorageID, pstIndex);
+      }
+    }
+
+    /* Valid? */
+    if(pstIndex != orxNULL)
+    {
+      /* Needs to be rebuilt and not currently building? */
+      if((pstIndex->bDirty != orxFALSE) && (pstIndex->eStatus != orxRESOURCE_INDEX_STATUS_BUILDING))
+      {
+        /* Has list? */
+        if(pstIndex->astPathList != orxNULL)
+        {
+          /* Deletes it */
+          orxMemory_Free(pstIndex->astPathList);
+          pstIndex->astPathList = orxNULL;
+        }
+        pstIndex->u32PathCount = 0;
+
+        /* Updates status */
+        pstIndex->eStatus = orxRESOURCE_INDEX_STATUS_EMPTY;
+        pstIndex->bDirty  = orxFALSE;
+      }
+
+      /* Empty? */
+      if(pstIndex->eStatus == orxRESOURCE_INDEX_STATUS_EMPTY)
+      {
+        /* Updates status */
+        pstIndex->eStatus = orxRESOURCE_INDEX_STATUS_BUILDING;
+        orxMEMORY_BARRIER();
+
+        /* Builds it on a worker */
+        if(orxThread_RunTask(&orxResource_BuildIndex, orxNULL, orxNULL, pstIndex) == orxSTATUS_FAILURE)
+        {
+          /* Updates status */
+          pstIndex->eStatus = orxRESOURCE_INDEX_STATUS_FAILED;
+        }
+      }
+      /* Ready? */
+      else if((pstIndex->eStatus == orxRESOURCE_INDEX_STATUS_READY) && (pstIndex->bDirty == orxFALSE))
+      {
+        /* Updates result */
+        orxMEMORY_BARRIER();
+        pstResult = pstIndex;
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 static const orxSTRING orxFASTCALL orxResource_File_Locate(const orxSTRING _zGroup, const orxSTRING _zStorage, const orxSTRING _zName, orxBOOL _bRequireExistence)
 {
-  static orxCHAR  sacFileLocationBuffer[orxRESOURCE_KU32_BUFFER_SIZE];
-  orxFILE_INFO    stInfo;
-  orxFILE        *pstFile = orxNULL;
-  const orxSTRING zResult = orxNULL;
+  static orxCHAR      sacFileLocationBuffer[orxRESOURCE_KU32_BUFFER_SIZE];
+  orxFILE_INFO        stInfo;
+  orxFILE            *pstFile = orxNULL;
+  orxRESOURCE_INDEX  *pstIndex = orxNULL;
+  const orxSTRING     zResult = orxNULL;
 
   /* Default storage? */
   if(orxString_Compare(_zStorage, orxRESOURCE_KZ_DEFAULT_STORAGE) == 0)
@@ -256,8 +765,25 @@ static const orxSTRING orxFASTCALL orxResource_File_Locate(const orxSTRING _zGro
     orxString_NPrint(sacFileLocationBuffer, sizeof(sacFileLocationBuffer), "%s%c%s", _zStorage, orxCHAR_DIRECTORY_SEPARATOR_LINUX, _zName);
   }
 
+  /* Requires existence and can be looked up in storage index? */
+  if((_bRequireExistence != orxFALSE) && (orxResource_IsIndexable(_zName) != orxFALSE))
+  {
+    /* Gets storage index */
+    pstIndex = orxResource_GetIndex(_zStorage);
+  }
+
+  /* Has index? */
+  if(pstIndex != orxNULL)
+  {
+    /* Indexed? */
+    if(orxResource_IsIndexed(pstIndex, orxResource_GetIndexID(_zName)) != orxFALSE)
+    {
+      /* Updates result */
+      zResult = sacFileLocationBuffer;
+    }
+  }
   /* Exists or doesn't require existence and can be created? */
-  if(((orxFile_GetInfo(sacFileLocationBuffer, &stInfo) != orxSTATUS_FAILURE)
+  else if(((orxFile_GetInfo(sacFileLocationBuffer, &stInfo) != orxSTATUS_FAILURE)
    && !orxFLAG_TEST(stInfo.u32Flags, orxFILE_KU32_FLAG_INFO_DIRECTORY))
   || ((_bRequireExistence == orxFALSE)
    && ((pstFile = orxFile_Open(sacFileLocationBuffer, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY)) != orxNULL)))
@@ -410,6 +936,33 @@ static orxS64 orxFASTCALL orxResource_File_Write(orxHANDLE _hResource, orxS64 _s
   return s64Result;
 }
 
+static const void *orxFASTCALL orxResource_File_Map(orxHANDLE _hResource, orxS64 *_ps64Size)
+{
+  orxFILE    *pstFile;
+  const void *pResult;
+
+  /* Gets file */
+  pstFile = (orxFILE *)_hResource;
+
+  /* Gets its size */
+  *_ps64Size = orxFile_GetSize(pstFile);
+
+  /* Updates result */
+  pResult = orxFile_Map(pstFile, *_ps64Size);
+
+  /* Done! */
+  return pResult;
+}
+
+static void orxFASTCALL orxResource_File_Unmap(orxHANDLE _hResource, const void *_pMap, orxS64 _s64Size)
+{
+  /* Unmaps it */
+  orxFile_Unmap(_pMap, _s64Size);
+
+  /* Done! */
+  return;
+}
+
 static orxSTATUS orxFASTCALL orxResource_File_Delete(const orxSTRING _zLocation)
 {
   orxSTATUS eResult;
@@ -640,14 +1193,30 @@ static orxS64 orxFASTCALL orxResource_Memory_Read(orxHANDLE _hResource, orxS64 _
   return s64CopySize;
 }
 
-static orxINLINE void orxResource_DeleteGroup(orxRESOURCE_GROUP *_pstGroup)
+static const void *orxFASTCALL orxResource_Memory_Map(orxHANDLE _hResource, orxS64 *_ps64Size)
 {
-  orxRESOURCE_INFO *pstResourceInfo;
-  orxHANDLE         hIterator;
+  orxRESOURCE_MEMORY_RESOURCE  *pstResource;
+  const void                   *pResult;
 
-  /* For all cached resources */
-  for(hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
-      hIterator != orxHANDLE_UNDEFINED;
+  /* Gets internal resource */
+  pstResource = (orxRESOURCE_MEMORY_RESOURCE *)_hResource;
+
+  /* Updates result */
+  *_ps64Size  = pstResource->pstData->s64Size;
+  pResult     = pstResource->pstData->pu8Buffer;
+
+  /* Done! */
+  return pResult;
+}
+
+static orxINLINE void orxResource_DeleteGroup(orxRESOURCE_GROUP *_pstGroup)
+{
+  orxRESOURCE_INFO *pstResourceInfo;
+  orxHANDLE         hIterator;
+
+  /* For all cached resources */
+  for(hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
+      hIterator != orxHANDLE_UNDEFINED;
       hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, hIterator, orxNULL, (void **)&pstResourceInfo))
   {
     /* Deletes its location */
@@ -657,8 +1226,9 @@ static orxINLINE void orxResource_DeleteGroup(orxRESOURCE_GROUP *_pstGroup)
     orxBank_Free(sstResource.pstResourceInfoBank, pstResourceInfo);
   }
 
-  /* Deletes cache table */
+  /* Deletes cache & missed lookup tables */
   orxHashTable_Delete(_pstGroup->pstCacheTable);
+  orxHashTable_Delete(_pstGroup->pstMissTable);
 
   /* Deletes storage bank */
   orxBank_Delete(_pstGroup->pstStorageBank);
@@ -686,7 +1256,9 @@ static orxINLINE orxRESOURCE_GROUP *orxResource_CreateGroup(orxSTRINGID _stGroup
     pstResult->stID           = _stGroupID;
     pstResult->pstStorageBank = orxBank_Create(orxRESOURCE_KU32_STORAGE_BANK_SIZE, sizeof(orxRESOURCE_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
     pstResult->pstCacheTable  = orxHashTable_Create(orxRESOURCE_KU32_CACHE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    pstResult->pstMissTable   = orxHashTable_Create(orxRESOURCE_KU32_MISS_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
     orxMemory_Zero(&(pstResult->stStorageList), sizeof(orxLINKLIST));
+    orxMemory_Zero(&(pstResult->stStats), sizeof(orxRESOURCE_STATS));
 
     /* Creates storage */
     pstStorage = (orxRESOURCE_STORAGE *)orxBank_Allocate(pstResult->pstStorageBank);
@@ -731,39 +1303,754 @@ static orxINLINE orxRESOURCE_GROUP *orxResource_FindGroup(orxSTRINGID _stGroupID
   return pstResult;
 }
 
+static orxINLINE orxBOOL orxResource_IsInStorage(const orxSTRING _zStorage, const orxSTRING _zPath)
+{
+  orxBOOL bResult;
+
+  /* Default storage? */
+  if(orxString_Compare(_zStorage, orxRESOURCE_KZ_DEFAULT_STORAGE) == 0)
+  {
+    /* Updates result */
+    bResult = orxTRUE;
+  }
+  else
+  {
+    orxU32 u32Length;
+
+    /* Gets storage length */
+    u32Length = orxString_GetLength(_zStorage);
+
+#ifdef orxRESOURCE_KB_INDEX_CASE_INSENSITIVE
+
+    /* Updates result */
+    bResult = (orxString_NICompare(_zStorage, _zPath, u32Length) == 0) ? orxTRUE : orxFALSE;
+
+#else /* orxRESOURCE_KB_INDEX_CASE_INSENSITIVE */
+
+    /* Updates result */
+    bResult = (orxString_NCompare(_zStorage, _zPath, u32Length) == 0) ? orxTRUE : orxFALSE;
+
+#endif /* orxRESOURCE_KB_INDEX_CASE_INSENSITIVE */
+
+    /* Not ending on a directory boundary? */
+    if((bResult != orxFALSE)
+    && (u32Length != 0)
+    && (_zStorage[u32Length - 1] != orxCHAR_DIRECTORY_SEPARATOR_LINUX)
+    && (_zStorage[u32Length - 1] != orxCHAR_DIRECTORY_SEPARATOR_WINDOWS)
+    && (_zPath[u32Length] != orxCHAR_NULL)
+    && (_zPath[u32Length] != orxCHAR_DIRECTORY_SEPARATOR_LINUX)
+    && (_zPath[u32Length] != orxCHAR_DIRECTORY_SEPARATOR_WINDOWS))
+    {
+      /* Updates result */
+      bResult = orxFALSE;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static void orxResource_InvalidateMisses(orxRESOURCE_GROUP *_pstGroup)
+{
+  /* Has group? */
+  if(_pstGroup != orxNULL)
+  {
+    /* Clears its missed lookups */
+    orxHashTable_Clear(_pstGroup->pstMissTable);
+  }
+  else
+  {
+    orxRESOURCE_GROUP *pstGroup;
+
+    /* For all groups */
+    for(pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+        pstGroup != orxNULL;
+        pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstGroup))
+    {
+      /* Clears its missed lookups */
+      orxHashTable_Clear(pstGroup->pstMissTable);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxResource_InvalidateLookups()
+{
+  orxRESOURCE_INDEX *pstIndex;
+
+  /* Clears all missed lookups */
+  orxResource_InvalidateMisses(orxNULL);
+
+  /* For all storage indices */
+  for(pstIndex = (orxRESOURCE_INDEX *)orxBank_GetNext(sstResource.pstIndexBank, orxNULL);
+      pstIndex != orxNULL;
+      pstIndex = (orxRESOURCE_INDEX *)orxBank_GetNext(sstResource.pstIndexBank, pstIndex))
+  {
+    /* Marks it for rebuild */
+    pstIndex->bDirty = orxTRUE;
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxResource_InvalidatePath(const orxSTRING _zPath)
+{
+  orxRESOURCE_GROUP *pstGroup;
+  orxRESOURCE_INDEX *pstIndex;
+
+  /* For all groups */
+  for(pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+      pstGroup != orxNULL;
+      pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstGroup))
+  {
+    orxRESOURCE_STORAGE *pstStorage;
+
+    /* For all its storages */
+    for(pstStorage = (orxRESOURCE_STORAGE *)orxLinkList_GetFirst(&(pstGroup->stStorageList));
+        pstStorage != orxNULL;
+        pstStorage = (orxRESOURCE_STORAGE *)orxLinkList_GetNext(&(pstStorage->stNode)))
+    {
+      /* Contains path? */
+      if(orxResource_IsInStorage(orxString_GetFromID(pstStorage->stID), _zPath) != orxFALSE)
+      {
+        /* Clears group's missed lookups */
+        orxHashTable_Clear(pstGroup->pstMissTable);
+
+        break;
+      }
+    }
+  }
+
+  /* For all storage indices */
+  for(pstIndex = (orxRESOURCE_INDEX *)orxBank_GetNext(sstResource.pstIndexBank, orxNULL);
+      pstIndex != orxNULL;
+      pstIndex = (orxRESOURCE_INDEX *)orxBank_GetNext(sstResource.pstIndexBank, pstIndex))
+  {
+    /* Contains path? */
+    if(orxResource_IsInStorage(pstIndex->zStorage, _zPath) != orxFALSE)
+    {
+      /* Marks it for rebuild */
+      pstIndex->bDirty = orxTRUE;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxResource_InvalidateLocation(const orxRESOURCE_TYPE_INFO *_pstTypeInfo, const orxSTRING _zLocation)
+{
+  /* File? */
+  if(orxString_Compare(_pstTypeInfo->zTag, orxRESOURCE_KZ_TYPE_TAG_FILE) == 0)
+  {
+    /* Invalidates its path */
+    orxResource_InvalidatePath(_zLocation + orxString_GetLength(_pstTypeInfo->zTag) + 1);
+  }
+  else
+  {
+    /* Clears all missed lookups, other types aren't indexed */
+    orxResource_InvalidateMisses(orxNULL);
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxBOOL orxResource_IsNotified(const orxRESOURCE_INFO *_pstResourceInfo)
+{
+  orxBOOL bResult = orxFALSE;
+
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+  /* Updates result */
+  bResult = ((sstResource.iNotifyFD >= 0) && (_pstResourceInfo->bNotified != orxFALSE)) ? orxTRUE : orxFALSE;
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
+  /* Done! */
+  return bResult;
+}
+
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+static orxINLINE const orxSTRING orxResource_GetNotifyName(const orxRESOURCE_INFO *_pstResourceInfo, orxS32 *_ps32DirectoryLength)
+{
+  const orxSTRING zPath;
+  orxS32          i, s32Index;
+
+  /* Gets its path */
+  zPath = _pstResourceInfo->zLocation + orxString_GetLength(orxRESOURCE_KZ_TYPE_TAG_FILE) + 1;
+
+  /* Finds its last separator */
+  for(i = 0, s32Index = -1; zPath[i] != orxCHAR_NULL; i++)
+  {
+    /* Separator? */
+    if((zPath[i] == orxCHAR_DIRECTORY_SEPARATOR_LINUX) || (zPath[i] == orxCHAR_DIRECTORY_SEPARATOR_WINDOWS))
+    {
+      /* Stores it */
+      s32Index = i;
+    }
+  }
+
+  /* Updates directory length */
+  *_ps32DirectoryLength = s32Index;
+
+  /* Done! */
+  return zPath + s32Index + 1;
+}
+
+static void orxResource_StopNotify()
+{
+  /* Closes descriptor, watches are released along with it */
+  close(sstResource.iNotifyFD);
+  sstResource.iNotifyFD = -1;
+
+  /* Deletes directory & watch tables */
+  orxHashTable_Delete(sstResource.pstNotifyTable);
+  sstResource.pstNotifyTable = orxNULL;
+  orxHashTable_Delete(sstResource.pstWatchTable);
+  sstResource.pstWatchTable = orxNULL;
+
+  /* Done! */
+  return;
+}
+
+static void orxResource_AddNotifyWatch(orxRESOURCE_INFO *_pstResourceInfo)
+{
+  /* Clears its status */
+  _pstResourceInfo->bNotified = orxFALSE;
+
+  /* Uses change notifications and is a file? */
+  if((sstResource.iNotifyFD >= 0) && (orxString_Compare(_pstResourceInfo->pstTypeInfo->zTag, orxRESOURCE_KZ_TYPE_TAG_FILE) == 0))
+  {
+    orxCHAR     acBuffer[orxRESOURCE_KU32_BUFFER_SIZE];
+    orxS32      s32Length;
+    orxSTRINGID stDirectoryID;
+
+    /* Gets its directory */
+    orxResource_GetNotifyName(_pstResourceInfo, &s32Length);
+    if(s32Length > 0)
+    {
+      s32Length = orxMIN(s32Length, (orxS32)sizeof(acBuffer) - 1);
+      orxString_NCopy(acBuffer, _pstResourceInfo->zLocation + orxString_GetLength(orxRESOURCE_KZ_TYPE_TAG_FILE) + 1, (orxU32)s32Length);
+      acBuffer[s32Length] = orxCHAR_NULL;
+    }
+    else
+    {
+      orxString_NPrint(acBuffer, sizeof(acBuffer), "%s", (s32Length == 0) ? "/" : ".");
+    }
+    stDirectoryID = orxString_Hash(acBuffer);
+
+    /* Already watched? */
+    if(orxHashTable_Get(sstResource.pstNotifyTable, stDirectoryID) != orxNULL)
+    {
+      /* Updates its status */
+      _pstResourceInfo->bNotified = orxTRUE;
+    }
+    else
+    {
+      int iWatch;
+
+      /* Watches it */
+      iWatch = inotify_add_watch(sstResource.iNotifyFD, acBuffer, IN_CLOSE_WRITE | IN_ATTRIB | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO);
+
+      /* Success? */
+      if(iWatch >= 0)
+      {
+        /* Stores it */
+        orxHashTable_Add(sstResource.pstNotifyTable, stDirectoryID, (void *)(orxUPTR)(iWatch + 1));
+        orxHashTable_Set(sstResource.pstWatchTable, (orxU64)iWatch, (void *)orxString_Store(acBuffer));
+
+        /* Updates its status */
+        _pstResourceInfo->bNotified = orxTRUE;
+      }
+      /* Missing directory? */
+      else if((errno == ENOENT) || (errno == ENOTDIR))
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't watch missing directory <%s> for changes, polling its resources until it gets recreated.", acBuffer);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't watch directory <%s> for changes, falling back to polling.", acBuffer);
+
+        /* Stops notifications */
+        orxResource_StopNotify();
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxResource_RemoveNotifyWatch(int _iWatch)
+{
+  const orxSTRING zDirectory;
+
+  /* Gets its directory */
+  zDirectory = (const orxSTRING)orxHashTable_Get(sstResource.pstWatchTable, (orxU64)_iWatch);
+
+  /* Found? */
+  if(zDirectory != orxNULL)
+  {
+    /* Removes it */
+    orxHashTable_Remove(sstResource.pstNotifyTable, orxString_Hash(zDirectory));
+    orxHashTable_Remove(sstResource.pstWatchTable, (orxU64)_iWatch);
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxResource_WatchAll()
+{
+  orxRESOURCE_GROUP *pstGroup;
+
+  /* For all groups */
+  for(pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+      (pstGroup != orxNULL) && (sstResource.iNotifyFD >= 0);
+      pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstGroup))
+  {
+    orxHANDLE         hIterator;
+    orxRESOURCE_INFO *pstResourceInfo;
+
+    /* For all its cached resources */
+    for(hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
+        (hIterator != orxHANDLE_UNDEFINED) && (sstResource.iNotifyFD >= 0);
+        hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, hIterator, orxNULL, (void **)&pstResourceInfo))
+    {
+      /* Watches it */
+      orxResource_AddNotifyWatch(pstResourceInfo);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxResource_StartNotify()
+{
+  /* Creates descriptor */
+  sstResource.iNotifyFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+  /* Success? */
+  if(sstResource.iNotifyFD >= 0)
+  {
+    /* Creates directory & watch tables */
+    sstResource.pstNotifyTable  = orxHashTable_Create(orxRESOURCE_KU32_NOTIFY_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstResource.pstWatchTable   = orxHashTable_Create(orxRESOURCE_KU32_NOTIFY_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if((sstResource.pstNotifyTable != orxNULL) && (sstResource.pstWatchTable != orxNULL))
+    {
+      /* Watches all cached resources */
+      orxResource_WatchAll();
+    }
+    else
+    {
+      /* Deletes tables */
+      if(sstResource.pstNotifyTable != orxNULL)
+      {
+        orxHashTable_Delete(sstResource.pstNotifyTable);
+        sstResource.pstNotifyTable = orxNULL;
+      }
+      if(sstResource.pstWatchTable != orxNULL)
+      {
+        orxHashTable_Delete(sstResource.pstWatchTable);
+        sstResource.pstWatchTable = orxNULL;
+      }
+
+      /* Closes descriptor */
+      close(sstResource.iNotifyFD);
+      sstResource.iNotifyFD = -1;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
+/** Relocates a cached resource to the first storage of its group that contains it
+ * @param[in]   _pstGroup             Concerned group
+ * @param[in]   _pstResourceInfo      Concerned resource info
+ * @param[out]  _pbMoved              Whether its location has changed (or it has been found again after being removed), can be orxNULL
+ * @return      orxSTATUS_SUCCESS if found in any storage, orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxResource_Relocate(orxRESOURCE_GROUP *_pstGroup, orxRESOURCE_INFO *_pstResourceInfo, orxBOOL *_pbMoved)
+{
+  orxRESOURCE_STORAGE  *pstStorage;
+  const orxSTRING       zGroup;
+  const orxSTRING       zName;
+  orxBOOL               bMoved = orxFALSE;
+  orxSTATUS             eResult = orxSTATUS_FAILURE;
+
+  /* Gets group & name */
+  zGroup  = orxString_GetFromID(_pstGroup->stID);
+  zName   = orxString_GetFromID(_pstResourceInfo->stNameID);
+
+  /* For all storages in group */
+  for(pstStorage = (orxRESOURCE_STORAGE *)orxLinkList_GetFirst(&(_pstGroup->stStorageList));
+      (eResult == orxSTATUS_FAILURE) && (pstStorage != orxNULL);
+      pstStorage = (orxRESOURCE_STORAGE *)orxLinkList_GetNext(&(pstStorage->stNode)))
+  {
+    orxRESOURCE_TYPE *pstType;
+
+    /* For all registered types */
+    for(pstType = (orxRESOURCE_TYPE *)orxLinkList_GetFirst(&(sstResource.stTypeList));
+        pstType != orxNULL;
+        pstType = (orxRESOURCE_TYPE *)orxLinkList_GetNext(&(pstType->stNode)))
+    {
+      const orxSTRING zNewLocation;
+
+      /* Locates resource */
+      zNewLocation = pstType->stInfo.pfnLocate(zGroup, orxString_GetFromID(pstStorage->stID), zName, orxTRUE);
+
+      /* Success? */
+      if(zNewLocation != orxNULL)
+      {
+        /* New location? */
+        if((&(pstType->stInfo) != _pstResourceInfo->pstTypeInfo)
+        || (_pstResourceInfo->s64Time == 0)
+        || (orxString_ICompare(_pstResourceInfo->zLocation + orxString_GetLength(pstType->stInfo.zTag) + 1, zNewLocation) != 0))
+        {
+          orxRESOURCE_GROUP **ppstGroup;
+          orxS32              s32Size;
+
+          /* Deletes its previous location */
+          orxMemory_Free(_pstResourceInfo->zLocation);
+
+          /* Updates its resource info */
+          _pstResourceInfo->pstTypeInfo = &(pstType->stInfo);
+          _pstResourceInfo->s64Time     = orxRESOURCE_KU32_WATCH_TIME_UNINITIALIZED;
+          s32Size                       = orxString_GetLength(pstType->stInfo.zTag) + orxString_GetLength(zNewLocation) + 2;
+          _pstResourceInfo->zLocation   = (orxSTRING)orxMemory_Allocate(s32Size, orxMEMORY_TYPE_TEXT);
+          orxASSERT(_pstResourceInfo->zLocation != orxNULL);
+          orxString_NPrint(_pstResourceInfo->zLocation, s32Size, "%s%c%s", pstType->stInfo.zTag, orxRESOURCE_KC_LOCATION_SEPARATOR, zNewLocation);
+          _pstResourceInfo->stStorageID = pstStorage->stID;
+          orxMEMORY_BARRIER();
+
+          /* Stores its group for request stats, if not already known */
+          ppstGroup = (orxRESOURCE_GROUP **)orxHashTable_Retrieve(sstResource.pstLocationTable, orxString_Hash(_pstResourceInfo->zLocation));
+          if((ppstGroup != orxNULL) && (*ppstGroup == orxNULL))
+          {
+            *ppstGroup = _pstGroup;
+          }
+
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+          /* Watches it */
+          orxResource_AddNotifyWatch(_pstResourceInfo);
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
+          /* Updates status */
+          bMoved = orxTRUE;
+        }
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+
+        break;
+      }
+    }
+  }
+
+  /* Asked for status? */
+  if(_pbMoved != orxNULL)
+  {
+    /* Stores it */
+    *_pbMoved = bMoved;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static orxINLINE orxSTRINGID orxResource_GetMemoryID(const orxSTRING _zGroup, const orxSTRING _zStorage, const orxSTRING _zName)
+{
+  orxCHAR acBuffer[orxRESOURCE_KU32_BUFFER_SIZE];
+
+  /* Composes full name */
+  orxString_NPrint(acBuffer, sizeof(acBuffer), "%s%c%s%c%s", (_zGroup != orxNULL) ? _zGroup : orxSTRING_EMPTY, orxRESOURCE_KC_LOCATION_SEPARATOR, ((_zStorage != orxNULL) && (orxString_Compare(_zStorage, orxRESOURCE_KZ_DEFAULT_STORAGE) != 0)) ? _zStorage : orxSTRING_EMPTY, orxCHAR_DIRECTORY_SEPARATOR_LINUX, _zName);
+
+  /* Done! */
+  return orxString_Hash(acBuffer);
+}
+
+static orxINLINE void orxResource_DeletePrefetchData(orxRESOURCE_PREFETCH_DATA *_pstData)
+{
+  /* Frees its content */
+  orxMemory_Free(_pstData->pBuffer);
+
+  /* Frees it */
+  orxBank_Free(sstResource.pstPrefetchDataBank, _pstData);
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxResource_LockQueue()
+{
+  /* Waits for lock */
+  while(orxMEMORY_ATOMIC_CAS32(&(sstResource.u32QueueLock), 0, 1) == orxFALSE)
+  {
+    /* Yields */
+    orxThread_Yield();
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxResource_UnlockQueue()
+{
+  /* Releases lock */
+  orxMEMORY_BARRIER();
+  sstResource.u32QueueLock = 0;
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxResource_UpdateStats(orxRESOURCE_STATS *_pstStats, volatile const orxRESOURCE_REQUEST *_pstRequest)
+{
+  /* Cancelled? */
+  if(_pstRequest->bCancelled != orxFALSE)
+  {
+    /* Updates cancel count */
+    _pstStats->u32CancelCount++;
+  }
+  else
+  {
+    orxDOUBLE dLatency;
+
+    /* Gets latency */
+    dLatency = _pstRequest->dEndTime - _pstRequest->dQueueTime;
+
+    /* Valid size? */
+    if(_pstRequest->s64Size > 0)
+    {
+      /* Updates it */
+      if(_pstRequest->eType == orxRESOURCE_REQUEST_TYPE_READ)
+      {
+        _pstStats->u64ReadSize   += (orxU64)_pstRequest->s64Size;
+      }
+      else
+      {
+        _pstStats->u64WriteSize  += (orxU64)_pstRequest->s64Size;
+      }
+    }
+
+    /* Updates timings */
+    _pstStats->dServiceTime += _pstRequest->dEndTime - _pstRequest->dStartTime;
+    _pstStats->dLatency     += dLatency;
+    _pstStats->dMaxLatency   = orxMAX(_pstStats->dMaxLatency, dLatency);
+
+    /* Updates request count */
+    _pstStats->u32RequestCount++;
+  }
+
+  /* Done! */
+  return;
+}
+
 static void orxFASTCALL orxResource_NotifyRequest(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxResource_NotifyRequest");
 
-  /* While there are processed requests */
-  while(sstResource.u32RequestOutIndex != sstResource.u32RequestProcessIndex)
+  /* Has processed requests? */
+  if(sstResource.u32DoneHeadIndex != orxU32_UNDEFINED)
   {
-    volatile orxRESOURCE_REQUEST *pstRequest;
+    orxU32 u32Index;
 
-    /* Gets request */
-    pstRequest = &(sstResource.astRequestList[sstResource.u32RequestOutIndex]);
+    /* Grabs all processed requests */
+    orxResource_LockQueue();
+    u32Index                      = sstResource.u32DoneHeadIndex;
+    sstResource.u32DoneHeadIndex  =
+    sstResource.u32DoneTailIndex  = orxU32_UNDEFINED;
+    orxResource_UnlockQueue();
 
-    /* Decrements operation count */
-    if(pstRequest->pstResourceInfo != orxNULL)
+    /* For all of them, in completion order */
+    while(u32Index != orxU32_UNDEFINED)
     {
-      pstRequest->pstResourceInfo->u32OpCount--;
+      volatile orxRESOURCE_REQUEST *pstRequest;
+      orxU32                        u32NextIndex;
+
+      /* Gets request */
+      pstRequest    = &(sstResource.astRequestList[u32Index]);
+      u32NextIndex  = pstRequest->u32NextIndex;
+
+      /* Read or write? */
+      if((pstRequest->eType == orxRESOURCE_REQUEST_TYPE_READ)
+      || (pstRequest->eType == orxRESOURCE_REQUEST_TYPE_WRITE))
+      {
+        /* Updates stats */
+        orxResource_UpdateStats(&(sstResource.stStats), pstRequest);
+        if(pstRequest->pstGroup != orxNULL)
+        {
+          orxResource_UpdateStats(&(pstRequest->pstGroup->stStats), pstRequest);
+        }
+      }
+
+      /* Has resource? */
+      if(pstRequest->pstResourceInfo != orxNULL)
+      {
+        /* Closed? */
+        if(pstRequest->eType == orxRESOURCE_REQUEST_TYPE_CLOSE)
+        {
+          /* Frees open info */
+          orxBank_Free(sstResource.pstOpenInfoBank, pstRequest->pstResourceInfo);
+          pstRequest->pstResourceInfo = orxNULL;
+        }
+        else
+        {
+          /* Decrements operation count */
+          pstRequest->pstResourceInfo->u32OpCount--;
+        }
+      }
+
+      /* Has callback? */
+      if(pstRequest->pfnCallback != orxNULL)
+      {
+        /* Notifies it */
+        pstRequest->pfnCallback((orxHANDLE)pstRequest->pstResourceInfo, pstRequest->s64Size, pstRequest->pBuffer, pstRequest->pContext);
+      }
+
+      /* Frees request */
+      pstRequest->u32NextIndex  = sstResource.u32FreeIndex;
+      sstResource.u32FreeIndex  = u32Index;
+      sstResource.u32RequestCount--;
+
+      /* Goes to next request */
+      u32Index = u32NextIndex;
     }
+  }
 
-    /* Has callback? */
-    if(pstRequest->pfnCallback != orxNULL)
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxResource_ReleaseMap(orxRESOURCE_OPEN_INFO *_pstOpenInfo)
+{
+  /* Is mapped? */
+  if(_pstOpenInfo->pMap != orxNULL)
+  {
+    /* Has unmap function? */
+    if(_pstOpenInfo->pstTypeInfo->pfnUnmap != orxNULL)
     {
-      /* Notifies it */
-      pstRequest->pfnCallback((orxHANDLE)pstRequest->pstResourceInfo, pstRequest->s64Size, pstRequest->pBuffer, pstRequest->pContext);
+      /* Unmaps it */
+      _pstOpenInfo->pstTypeInfo->pfnUnmap(_pstOpenInfo->hResource, _pstOpenInfo->pMap, _pstOpenInfo->s64MapSize);
     }
 
-    /* Updates request out index */
-    orxMEMORY_BARRIER();
-    sstResource.u32RequestOutIndex = (sstResource.u32RequestOutIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
+    /* Clears mapping */
+    _pstOpenInfo->pMap        = orxNULL;
+    _pstOpenInfo->s64MapSize  = 0;
   }
 
-  /* Profiles */
-  orxPROFILER_POP_MARKER();
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxU32 orxResource_TakeRequest()
+{
+  orxU32 i, u32Result = orxU32_UNDEFINED;
+
+  /* Locks queue */
+  orxResource_LockQueue();
+
+  /* For all priorities, highest first */
+  for(i = 0; (u32Result == orxU32_UNDEFINED) && (i < orxRESOURCE_PRIORITY_NUMBER); i++)
+  {
+    orxU32 u32Index, u32PreviousIndex;
+
+    /* For all queued requests */
+    for(u32Index = sstResource.au32QueueHeadList[i], u32PreviousIndex = orxU32_UNDEFINED;
+        u32Index != orxU32_UNDEFINED;
+        u32PreviousIndex = u32Index, u32Index = sstResource.astRequestList[u32Index].u32NextIndex)
+    {
+      volatile orxRESOURCE_REQUEST *pstRequest;
+
+      /* Gets request */
+      pstRequest = &(sstResource.astRequestList[u32Index]);
+
+      /* Serviceable (all previous requests on the same resource are done)? */
+      if((pstRequest->pstResourceInfo == orxNULL)
+      || (pstRequest->u32Sequence == pstRequest->pstResourceInfo->u32ServeSequence))
+      {
+        /* Removes it from queue */
+        if(u32PreviousIndex != orxU32_UNDEFINED)
+        {
+          sstResource.astRequestList[u32PreviousIndex].u32NextIndex = pstRequest->u32NextIndex;
+        }
+        else
+        {
+          sstResource.au32QueueHeadList[i] = pstRequest->u32NextIndex;
+        }
+        if(sstResource.au32QueueTailList[i] == u32Index)
+        {
+          sstResource.au32QueueTailList[i] = u32PreviousIndex;
+        }
+
+        /* Updates result */
+        u32Result = u32Index;
+
+        break;
+      }
+    }
+  }
+
+  /* Unlocks queue */
+  orxResource_UnlockQueue();
+
+  /* Done! */
+  return u32Result;
+}
+
+static orxINLINE void orxResource_CompleteRequest(orxU32 _u32Index)
+{
+  volatile orxRESOURCE_REQUEST *pstRequest;
+
+  /* Gets request */
+  pstRequest = &(sstResource.astRequestList[_u32Index]);
+
+  /* Locks queue */
+  orxResource_LockQueue();
+
+  /* Has resource? */
+  if(pstRequest->pstResourceInfo != orxNULL)
+  {
+    /* Allows its next request to be serviced */
+    pstRequest->pstResourceInfo->u32ServeSequence++;
+  }
+
+  /* Adds request to processed list */
+  pstRequest->u32NextIndex = orxU32_UNDEFINED;
+  if(sstResource.u32DoneTailIndex != orxU32_UNDEFINED)
+  {
+    sstResource.astRequestList[sstResource.u32DoneTailIndex].u32NextIndex = _u32Index;
+  }
+  else
+  {
+    sstResource.u32DoneHeadIndex = _u32Index;
+  }
+  sstResource.u32DoneTailIndex = _u32Index;
+
+  /* Unlocks queue */
+  orxResource_UnlockQueue();
+
+  /* Updates unprocessed count */
+  orxMEMORY_ATOMIC_DEC32(&(sstResource.u32UnprocessedCount));
 
   /* Done! */
   return;
@@ -771,6 +2058,7 @@ static void orxFASTCALL orxResource_NotifyRequest(const orxCLOCK_INFO *_pstClock
 
 static orxSTATUS orxFASTCALL orxResource_ProcessRequests(void *_pContext)
 {
+  orxU32    u32Index;
   orxSTATUS eResult;
 
   /* Waits for worker semaphore */
@@ -779,73 +2067,90 @@ static orxSTATUS orxFASTCALL orxResource_ProcessRequests(void *_pContext)
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxResource_ProcessRequests");
 
-  /* While there are pending requests */
-  while(sstResource.u32RequestProcessIndex != sstResource.u32RequestInIndex)
+  /* While there are serviceable requests */
+  while((u32Index = orxResource_TakeRequest()) != orxU32_UNDEFINED)
   {
     volatile orxRESOURCE_REQUEST *pstRequest;
 
     /* Gets request */
-    pstRequest = &(sstResource.astRequestList[sstResource.u32RequestProcessIndex]);
+    pstRequest = &(sstResource.astRequestList[u32Index]);
+
+    /* Stores start time */
+    pstRequest->dStartTime = orxSystem_GetTime();
 
-    /* Depending on request type */
-    switch(pstRequest->eType)
+    /* Cancelled? */
+    if(pstRequest->bCancelled != orxFALSE)
     {
-      case orxRESOURCE_REQUEST_TYPE_READ:
+      /* Clears size */
+      pstRequest->s64Size = 0;
+    }
+    else
+    {
+      /* Depending on request type */
+      switch(pstRequest->eType)
       {
-        /* Services it */
-        pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnRead(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+        case orxRESOURCE_REQUEST_TYPE_READ:
+        {
+          /* Services it */
+          pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnRead(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
 
-        break;
-      }
+          break;
+        }
 
-      case orxRESOURCE_REQUEST_TYPE_WRITE:
-      {
-        /* Services it */
-        pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnWrite(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+        case orxRESOURCE_REQUEST_TYPE_WRITE:
+        {
+          /* Services it */
+          pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnWrite(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+
+          break;
+        }
 
-        break;
-      }
+        case orxRESOURCE_REQUEST_TYPE_CLOSE:
+        {
+          /* Releases its mapping */
+          orxResource_ReleaseMap(pstRequest->pstResourceInfo);
 
-      case orxRESOURCE_REQUEST_TYPE_CLOSE:
-      {
-        /* Services it */
-        pstRequest->pstResourceInfo->pstTypeInfo->pfnClose(pstRequest->pstResourceInfo->hResource);
+          /* Services it */
+          pstRequest->pstResourceInfo->pstTypeInfo->pfnClose(pstRequest->pstResourceInfo->hResource);
+          pstRequest->pstResourceInfo->hResource = orxHANDLE_UNDEFINED;
 
-        /* Deletes location */
-        orxString_Delete(pstRequest->pstResourceInfo->zLocation);
+          /* Deletes location */
+          orxString_Delete(pstRequest->pstResourceInfo->zLocation);
+          pstRequest->pstResourceInfo->zLocation = orxNULL;
 
-        /* Frees open info */
-        orxBank_Free(sstResource.pstOpenInfoBank, pstRequest->pstResourceInfo);
-        pstRequest->pstResourceInfo = orxNULL;
+          /* Note: open info will get freed from main thread, upon notification */
 
-        break;
-      }
+          break;
+        }
 
-      case orxRESOURCE_REQUEST_TYPE_GET_TIME:
-      {
-        orxRESOURCE_INFO *pstResourceInfo;
+        case orxRESOURCE_REQUEST_TYPE_GET_TIME:
+        {
+          orxRESOURCE_INFO *pstResourceInfo;
 
-        /* Gets resource info */
-        pstResourceInfo = (orxRESOURCE_INFO *)pstRequest->pContext;
+          /* Gets resource info */
+          pstResourceInfo = (orxRESOURCE_INFO *)pstRequest->pContext;
 
-        /* Gets its modification time (cheating for the storage) */
-        pstRequest->s64Size = pstResourceInfo->pstTypeInfo->pfnGetTime(pstResourceInfo->zLocation + orxString_GetLength(pstResourceInfo->pstTypeInfo->zTag) + 1);
+          /* Gets its modification time (cheating for the storage) */
+          pstRequest->s64Size = pstResourceInfo->pstTypeInfo->pfnGetTime(pstResourceInfo->zLocation + orxString_GetLength(pstResourceInfo->pstTypeInfo->zTag) + 1);
 
-        /* Updates its status */
-        pstResourceInfo->bPendingWatch = orxFALSE;
+          /* Updates its status */
+          pstResourceInfo->bPendingWatch = orxFALSE;
 
-        break;
-      }
+          break;
+        }
 
-      default:
-      {
-        break;
+        default:
+        {
+          break;
+        }
       }
     }
 
-    /* Updates request process index */
-    orxMEMORY_BARRIER();
-    sstResource.u32RequestProcessIndex = (sstResource.u32RequestProcessIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
+    /* Stores end time */
+    pstRequest->dEndTime = orxSystem_GetTime();
+
+    /* Completes it */
+    orxResource_CompleteRequest(u32Index);
   }
 
   /* Profiles */
@@ -866,31 +2171,18 @@ static void orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE _eType, orxS64 _s64S
   /* Not shutting down */
   if(!orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_EXIT))
   {
-    orxU32  u32NextRequestIndex;
     orxBOOL bAdd;
 
-    /* Gets next request index */
-    u32NextRequestIndex = (sstResource.u32RequestInIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
-
     /* Time request? */
     if(_eType == orxRESOURCE_REQUEST_TYPE_GET_TIME)
     {
-      orxU32 u32InIndex, u32ProcessIndex, u32FreeSlots;
-
-      /* Gets indices */
-      u32InIndex      = sstResource.u32RequestInIndex;
-      u32ProcessIndex = sstResource.u32RequestProcessIndex;
-
-      /* Gets number of free slots */
-      u32FreeSlots = (u32InIndex >= u32ProcessIndex) ? orxRESOURCE_KU32_REQUEST_LIST_SIZE - u32InIndex + u32ProcessIndex : u32ProcessIndex - u32InIndex;
-
       /* Requests processing if more than a quarter of the slots are free */
-      bAdd = (u32FreeSlots >= orxRESOURCE_KU32_REQUEST_LIST_SIZE / 4) ? orxTRUE : orxFALSE;
+      bAdd = (orxRESOURCE_KU32_REQUEST_LIST_SIZE - sstResource.u32RequestCount >= orxRESOURCE_KU32_REQUEST_LIST_SIZE / 4) ? orxTRUE : orxFALSE;
     }
     else
     {
       /* Waits for a free slot */
-      while(u32NextRequestIndex == sstResource.u32RequestOutIndex)
+      while(sstResource.u32FreeIndex == orxU32_UNDEFINED)
       {
         /* Manually pumps some request notifications */
         orxResource_NotifyRequest(orxNULL, orxNULL);
@@ -904,25 +2196,58 @@ static void orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE _eType, orxS64 _s64S
     if(bAdd != orxFALSE)
     {
       volatile orxRESOURCE_REQUEST *pstRequest;
+      orxRESOURCE_PRIORITY          ePriority;
+      orxU32                        u32Index;
 
-      /* Gets current request */
-      pstRequest = &(sstResource.astRequestList[sstResource.u32RequestInIndex]);
+      /* Gets free request */
+      u32Index                  = sstResource.u32FreeIndex;
+      pstRequest                = &(sstResource.astRequestList[u32Index]);
+      sstResource.u32FreeIndex  = pstRequest->u32NextIndex;
+      sstResource.u32RequestCount++;
 
-      /* Inits it */
+      /* Has resource? */
       if(_pstResourceInfo != orxNULL)
       {
+        /* Updates it */
         _pstResourceInfo->u32OpCount++;
+        pstRequest->u32Sequence = _pstResourceInfo->u32NextSequence++;
+        pstRequest->pstGroup    = _pstResourceInfo->pstGroup;
+        ePriority               = _pstResourceInfo->ePriority;
+      }
+      else
+      {
+        /* Runs in background */
+        pstRequest->u32Sequence = 0;
+        pstRequest->pstGroup    = orxNULL;
+        ePriority               = orxRESOURCE_PRIORITY_BACKGROUND;
       }
+
+      /* Inits it */
       pstRequest->s64Size         = _s64Size;
       pstRequest->pBuffer         = _pBuffer;
       pstRequest->pfnCallback     = _pfnCallback;
       pstRequest->pContext        = _pContext;
       pstRequest->pstResourceInfo = _pstResourceInfo;
+      pstRequest->dQueueTime      = orxSystem_GetTime();
       pstRequest->eType           = _eType;
+      pstRequest->u32NextIndex    = orxU32_UNDEFINED;
+      pstRequest->bCancelled      = orxFALSE;
 
-      /* Commits request */
-      orxMEMORY_BARRIER();
-      sstResource.u32RequestInIndex = u32NextRequestIndex;
+      /* Updates unprocessed count */
+      orxMEMORY_ATOMIC_INC32(&(sstResource.u32UnprocessedCount));
+
+      /* Commits request to its priority queue */
+      orxResource_LockQueue();
+      if(sstResource.au32QueueTailList[ePriority] != orxU32_UNDEFINED)
+      {
+        sstResource.astRequestList[sstResource.au32QueueTailList[ePriority]].u32NextIndex = u32Index;
+      }
+      else
+      {
+        sstResource.au32QueueHeadList[ePriority] = u32Index;
+      }
+      sstResource.au32QueueTailList[ePriority] = u32Index;
+      orxResource_UnlockQueue();
 
       /* Signals worker semaphore */
       orxThread_SignalSemaphore(sstResource.pstWorkerSemaphore);
@@ -994,6 +2319,17 @@ static void orxFASTCALL orxResource_NotifyChange(orxHANDLE _hResource, orxS64 _s
         /* Added */
         else
         {
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+          /* Was polled? */
+          if(orxResource_IsNotified(pstResourceInfo) == orxFALSE)
+          {
+            /* Tries to watch it again, in case its directory has been recreated */
+            orxResource_AddNotifyWatch(pstResourceInfo);
+          }
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
           /* Sends event */
           orxEVENT_SEND(orxEVENT_TYPE_RESOURCE, orxRESOURCE_EVENT_ADD, orxNULL, orxNULL, &stPayload);
         }
@@ -1021,6 +2357,338 @@ static void orxFASTCALL orxResource_NotifyChange(orxHANDLE _hResource, orxS64 _s
   return;
 }
 
+static void orxFASTCALL orxResource_NotifyPrefetch(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer, void *_pContext)
+{
+  orxRESOURCE_PREFETCH_DATA  *pstData;
+  orxRESOURCE_PREFETCH_SET   *pstSet;
+  orxRESOURCE_EVENT_PAYLOAD   stPayload;
+  const orxSTRING             zGroup;
+  const orxSTRING             zStorage;
+  const orxSTRING             zName;
+  orxBOOL                     bLoaded = orxFALSE;
+
+  /* Gets prefetch data & set */
+  pstData = (orxRESOURCE_PREFETCH_DATA *)_pContext;
+  pstSet  = pstData->pstSet;
+
+  /* Checks */
+  orxASSERT(pstSet != orxNULL);
+
+  /* Closes resource */
+  orxResource_Close(_hResource);
+
+  /* Gets group, storage & name */
+  zGroup    = orxString_GetFromID(pstData->stGroupID);
+  zStorage  = orxString_GetFromID(pstData->stStorageID);
+  zName     = orxString_GetFromID(pstData->stNameID);
+
+  /* Clears payload */
+  orxMemory_Zero(&stPayload, sizeof(orxRESOURCE_EVENT_PAYLOAD));
+
+  /* Fully read? */
+  if(_s64Size == pstData->s64Size)
+  {
+    orxRESOURCE_PREFETCH_DATA  *pstPreviousData;
+    orxSTRINGID                 stMemoryID;
+
+    /* Gets memory ID */
+    stMemoryID = orxResource_GetMemoryID(zGroup, zStorage, zName);
+
+    /* Gets previously prefetched data */
+    pstPreviousData = (orxRESOURCE_PREFETCH_DATA *)orxHashTable_Get(sstResource.pstPrefetchTable, stMemoryID);
+
+    /* Sets it as memory resource, in its original storage */
+    if(orxResource_SetMemoryResource(zGroup, zStorage, zName, pstData->s64Size, pstData->pBuffer) != orxSTATUS_FAILURE)
+    {
+      orxRESOURCE_GROUP *pstGroup;
+
+      /* Had previous data? */
+      if(pstPreviousData != orxNULL)
+      {
+        /* Deletes it */
+        orxResource_DeletePrefetchData(pstPreviousData);
+      }
+
+      /* Stores data */
+      pstData->pstSet = orxNULL;
+      orxHashTable_Set(sstResource.pstPrefetchTable, stMemoryID, pstData);
+
+      /* Gets group */
+      pstGroup = orxResource_FindGroup(pstData->stGroupID);
+
+      /* Found? */
+      if(pstGroup != orxNULL)
+      {
+        orxRESOURCE_INFO *pstResourceInfo;
+
+        /* Gets cached resource info */
+        pstResourceInfo = (orxRESOURCE_INFO *)orxHashTable_Get(pstGroup->pstCacheTable, pstData->stNameID);
+
+        /* Found? */
+        if(pstResourceInfo != orxNULL)
+        {
+          /* Points it to memory */
+          orxResource_Relocate(pstGroup, pstResourceInfo, orxNULL);
+        }
+      }
+
+      /* Inits payload */
+      stPayload.zLocation   = orxResource_Locate(zGroup, zName);
+      stPayload.pstTypeInfo = orxResource_GetType(stPayload.zLocation);
+
+      /* Updates status */
+      bLoaded = orxTRUE;
+      pstSet->u32LoadCount++;
+    }
+  }
+
+  /* Not loaded? */
+  if(bLoaded == orxFALSE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "[%s]: Couldn't prefetch resource <%s> from group <%s>.", pstSet->zSet, zName, zGroup);
+
+    /* Deletes data */
+    orxResource_DeletePrefetchData(pstData);
+  }
+
+  /* Updates count */
+  pstSet->u32Count++;
+
+  /* Inits payload */
+  stPayload.stGroupID         = pstData->stGroupID;
+  stPayload.stStorageID       = pstData->stStorageID;
+  stPayload.stNameID          = pstData->stNameID;
+  stPayload.zPrefetchSet      = pstSet->zSet;
+  stPayload.u32PrefetchCount  = pstSet->u32Count;
+  stPayload.u32PrefetchTotal  = pstSet->u32TotalCount;
+
+  /* Sends event */
+  orxEVENT_SEND(orxEVENT_TYPE_RESOURCE, orxRESOURCE_EVENT_PREFETCH, orxNULL, orxNULL, &stPayload);
+
+  /* Set complete? */
+  if((pstSet->bIssuing == orxFALSE) && (pstSet->u32Count == pstSet->u32TotalCount))
+  {
+    /* Has callback? */
+    if(pstSet->pfnCallback != orxNULL)
+    {
+      /* Calls it */
+      pstSet->pfnCallback(pstSet->zSet, pstSet->u32LoadCount, pstSet->u32TotalCount, pstSet->pContext);
+    }
+
+    /* Frees set */
+    orxBank_Free(sstResource.pstPrefetchSetBank, pstSet);
+  }
+
+  /* Done! */
+  return;
+}
+
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+static void orxResource_ProcessNotifications()
+{
+  orxSTRINGID astChangeList[orxRESOURCE_KU32_NOTIFY_CHANGE_NUMBER];
+  orxU32      u32ChangeCount = 0;
+  orxBOOL     bCheckAll = orxFALSE, bInvalidate = orxFALSE, bRewatch = orxFALSE;
+  orxU64      au64Buffer[orxRESOURCE_KU32_NOTIFY_BUFFER_SIZE / sizeof(orxU64)];
+  ssize_t     sSize;
+  int         iLastWatch = -1;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_ProcessNotifications");
+
+  /* For all pending notifications */
+  while((sSize = read(sstResource.iNotifyFD, au64Buffer, sizeof(au64Buffer))) > 0)
+  {
+    const orxU8 *pu8Event;
+
+    /* For all events */
+    for(pu8Event = (const orxU8 *)au64Buffer;
+        pu8Event < (const orxU8 *)au64Buffer + sSize;
+        pu8Event += sizeof(struct inotify_event) + ((const struct inotify_event *)pu8Event)->len)
+    {
+      const struct inotify_event *pstEvent;
+
+      /* Gets it */
+      pstEvent = (const struct inotify_event *)pu8Event;
+
+      /* Lost events? */
+      if(pstEvent->mask & IN_Q_OVERFLOW)
+      {
+        /* Updates status */
+        bInvalidate = orxTRUE;
+      }
+      /* Might have added or removed resources in a directory not yet invalidated? */
+      else if((pstEvent->mask & (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_IGNORED))
+           && (pstEvent->wd != iLastWatch)
+           && (bInvalidate == orxFALSE))
+      {
+        const orxSTRING zDirectory;
+
+        /* Gets its directory */
+        zDirectory = (const orxSTRING)orxHashTable_Get(sstResource.pstWatchTable, (orxU64)pstEvent->wd);
+
+        /* Found? */
+        if(zDirectory != orxNULL)
+        {
+          /* Only invalidates lookups that might include it */
+          orxResource_InvalidatePath(zDirectory);
+        }
+        else
+        {
+          /* Updates status */
+          bInvalidate = orxTRUE;
+        }
+
+        /* Stores it */
+        iLastWatch = pstEvent->wd;
+      }
+
+      /* Directory not watched anymore (removed, moved or unmounted)? */
+      if(pstEvent->mask & IN_IGNORED)
+      {
+        /* Forgets its watch */
+        orxResource_RemoveNotifyWatch(pstEvent->wd);
+
+        /* Updates status */
+        bRewatch = orxTRUE;
+      }
+
+      /* Lost events or directory not watched anymore? */
+      if(pstEvent->mask & (IN_Q_OVERFLOW | IN_IGNORED))
+      {
+        /* Checks all resources */
+        bCheckAll = orxTRUE;
+      }
+      /* File event */
+      else if((pstEvent->len > 0) && (bCheckAll == orxFALSE))
+      {
+        orxSTRINGID stNameID;
+        orxU32      i;
+
+        /* Gets its name ID */
+        stNameID = orxString_Hash(pstEvent->name);
+
+        /* Finds it in changes */
+        for(i = 0; (i < u32ChangeCount) && (astChangeList[i] != stNameID); i++)
+          ;
+
+        /* New change? */
+        if(i == u32ChangeCount)
+        {
+          /* Too many changes? */
+          if(u32ChangeCount == orxRESOURCE_KU32_NOTIFY_CHANGE_NUMBER)
+          {
+            /* Checks all resources */
+            bCheckAll = orxTRUE;
+          }
+          else
+          {
+            /* Stores it */
+            astChangeList[u32ChangeCount++] = stNameID;
+          }
+        }
+      }
+    }
+  }
+
+  /* Should invalidate all lookups? */
+  if(bInvalidate != orxFALSE)
+  {
+    /* Invalidates them */
+    orxResource_InvalidateLookups();
+  }
+
+  /* Lost any directory watch? */
+  if((bRewatch != orxFALSE) && (sstResource.iNotifyFD >= 0))
+  {
+    /* Re-watches all cached resources, the ones in missing directories will get polled instead */
+    orxResource_WatchAll();
+  }
+
+  /* Any change? */
+  if((u32ChangeCount != 0) || (bCheckAll != orxFALSE))
+  {
+    orxS32 i, s32ListCount;
+
+    /* Pushes config section */
+    orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
+
+    /* For all watched groups */
+    for(i = 0, s32ListCount = orxConfig_GetListCount(orxRESOURCE_KZ_CONFIG_WATCH_LIST); i < s32ListCount; i++)
+    {
+      orxRESOURCE_GROUP *pstGroup;
+
+      /* Gets group */
+      pstGroup = orxResource_FindGroup(orxString_Hash(orxConfig_GetListString(orxRESOURCE_KZ_CONFIG_WATCH_LIST, i)));
+
+      /* Found? */
+      if(pstGroup != orxNULL)
+      {
+        orxHANDLE         hIterator;
+        orxRESOURCE_INFO *pstResourceInfo;
+
+        /* For all its cached resources */
+        for(hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
+            hIterator != orxHANDLE_UNDEFINED;
+            hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, hIterator, orxNULL, (void **)&pstResourceInfo))
+        {
+          /* Is notified of its changes and not already queued? */
+          if((orxResource_IsNotified(pstResourceInfo) != orxFALSE) && (pstResourceInfo->bPendingWatch == orxFALSE))
+          {
+            orxBOOL bChanged;
+
+            /* Should check all? */
+            if(bCheckAll != orxFALSE)
+            {
+              /* Updates status */
+              bChanged = orxTRUE;
+            }
+            else
+            {
+              orxSTRINGID stNameID;
+              orxS32      s32Length;
+              orxU32      j;
+
+              /* Gets its name ID */
+              stNameID = orxString_Hash(orxResource_GetNotifyName(pstResourceInfo, &s32Length));
+
+              /* Finds it in changes */
+              for(j = 0; (j < u32ChangeCount) && (astChangeList[j] != stNameID); j++)
+                ;
+
+              /* Updates status */
+              bChanged = (j < u32ChangeCount) ? orxTRUE : orxFALSE;
+            }
+
+            /* Changed? */
+            if(bChanged != orxFALSE)
+            {
+              /* Updates its status */
+              pstResourceInfo->bPendingWatch = orxTRUE;
+
+              /* Adds request */
+              orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL);
+            }
+          }
+        }
+      }
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
 static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
   static orxS32 ss32GroupIndex = 0;
@@ -1031,6 +2699,17 @@ static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, vo
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxResource_Watch");
 
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+  /* Uses change notifications? */
+  if(sstResource.iNotifyFD >= 0)
+  {
+    /* Processes them */
+    orxResource_ProcessNotifications();
+  }
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
   /* Pushes config section */
   orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
 
@@ -1070,8 +2749,8 @@ static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, vo
         /* Does its type support time? */
         if(pstResourceInfo->pstTypeInfo->pfnGetTime != orxNULL)
         {
-          /* Not already queued? */
-          if(pstResourceInfo->bPendingWatch == orxFALSE)
+          /* Not notified of its changes and not already queued? */
+          if((orxResource_IsNotified(pstResourceInfo) == orxFALSE) && (pstResourceInfo->bPendingWatch == orxFALSE))
           {
             /* Updates its status */
             pstResourceInfo->bPendingWatch = orxTRUE;
@@ -1174,6 +2853,13 @@ static void orxResource_UpdatePostInit()
 
           /* Updates flags */
           orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_REGISTERED, orxRESOURCE_KU32_STATIC_FLAG_NONE);
+
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+          /* Starts change notifications, polling will be used as fallback */
+          orxResource_StartNotify();
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
         }
 
         /* Pops config section */
@@ -1186,6 +2872,52 @@ static void orxResource_UpdatePostInit()
         orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_SET, orxRESOURCE_KU32_STATIC_FLAG_NONE);
       }
     }
+
+    /* Workers not set yet? */
+    if(!orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WORKER_SET))
+    {
+      orxU32 u32WorkerCount;
+
+      /* Pushes resource config section */
+      orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
+
+      /* Gets worker count */
+      u32WorkerCount = (orxConfig_HasValue(orxRESOURCE_KZ_CONFIG_WORKER_COUNT) != orxFALSE) ? orxConfig_GetU32(orxRESOURCE_KZ_CONFIG_WORKER_COUNT) : orxRESOURCE_KU32_DEFAULT_WORKER_NUMBER;
+      u32WorkerCount = orxCLAMP(u32WorkerCount, 1, orxRESOURCE_KU32_MAX_WORKER_NUMBER);
+
+      /* Pops config section */
+      orxConfig_PopSection();
+
+      /* Starts missing workers */
+      while(sstResource.u32WorkerCount < u32WorkerCount)
+      {
+        orxCHAR acName[32];
+        orxU32  u32ThreadID;
+
+        /* Gets its name */
+        orxString_NPrint(acName, sizeof(acName), "%s #%u", orxRESOURCE_KZ_THREAD_NAME, sstResource.u32WorkerCount + 1);
+
+        /* Starts it */
+        u32ThreadID = orxThread_Start(&orxResource_ProcessRequests, acName, orxNULL);
+
+        /* Success? */
+        if(u32ThreadID != orxU32_UNDEFINED)
+        {
+          /* Stores it */
+          sstResource.au32WorkerIDList[sstResource.u32WorkerCount++] = u32ThreadID;
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't start resource worker #%u, using %u worker(s).", sstResource.u32WorkerCount + 1, sstResource.u32WorkerCount);
+
+          break;
+        }
+      }
+
+      /* Updates flags */
+      orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WORKER_SET, orxRESOURCE_KU32_STATIC_FLAG_NONE);
+    }
   }
 }
 
@@ -1207,8 +2939,10 @@ static orxBOOL orxFASTCALL orxResource_LoadStorage(const orxSTRING _zKeyName, co
   /* Gets group ID */
   stGroupID = orxString_Hash(zGroup);
 
-  /* Is not watch list? */
-  if(stGroupID != orxString_Hash(orxRESOURCE_KZ_CONFIG_WATCH_LIST))
+  /* Is not watch list, worker count nor lookup cache? */
+  if((stGroupID != orxString_Hash(orxRESOURCE_KZ_CONFIG_WATCH_LIST))
+  && (stGroupID != orxString_Hash(orxRESOURCE_KZ_CONFIG_WORKER_COUNT))
+  && (stGroupID != orxString_Hash(orxRESOURCE_KZ_CONFIG_LOOKUP_CACHE)))
   {
     orxRESOURCE_GROUP  *pstGroup;
     orxS32              i, iCount;
@@ -1375,6 +3109,28 @@ void orxFASTCALL orxResource_CommandClearCache(orxU32 _u32ArgNumber, const orxCO
   return;
 }
 
+/** Command: Prefetch
+ */
+void orxFASTCALL orxResource_CommandPrefetch(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxResource_Prefetch(_astArgList[0].zValue, orxNULL, orxNULL) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: ReleasePrefetch
+ */
+void orxFASTCALL orxResource_CommandReleasePrefetch(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxResource_ReleasePrefetch(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
 /** Registers all the resource commands
  */
 static orxINLINE void orxResource_RegisterCommands()
@@ -1399,6 +3155,11 @@ static orxINLINE void orxResource_RegisterCommands()
   orxCOMMAND_REGISTER_CORE_COMMAND(Resource, Sync, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"Group = <void>", orxCOMMAND_VAR_TYPE_STRING});
   /* Command: ClearCache */
   orxCOMMAND_REGISTER_CORE_COMMAND(Resource, ClearCache, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 1, {"Group = <void>", orxCOMMAND_VAR_TYPE_STRING});
+
+  /* Command: Prefetch */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Resource, Prefetch, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"Set", orxCOMMAND_VAR_TYPE_STRING});
+  /* Command: ReleasePrefetch */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Resource, ReleasePrefetch, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"Set", orxCOMMAND_VAR_TYPE_STRING});
 }
 
 /** Unregisters all the resource commands
@@ -1425,6 +3186,11 @@ static orxINLINE void orxResource_UnregisterCommands()
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Resource, Sync);
   /* Command: ClearCache */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Resource, ClearCache);
+
+  /* Command: Prefetch */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Resource, Prefetch);
+  /* Command: ReleasePrefetch */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Resource, ReleasePrefetch);
 }
 
 
@@ -1458,23 +3224,44 @@ orxSTATUS orxFASTCALL orxResource_Init()
 {
   orxSTATUS eResult = orxSTATUS_FAILURE;
 
-  /* Checks */
-  orxASSERT(orxMath_IsPowerOfTwo(orxRESOURCE_KU32_REQUEST_LIST_SIZE) != orxFALSE);
-
   /* Not already Initialized? */
   if(!(sstResource.u32Flags & orxRESOURCE_KU32_STATIC_FLAG_READY))
   {
     /* Cleans control structure */
     orxMemory_Zero(&sstResource, sizeof(orxRESOURCE_STATIC));
 
-    /* Creates worker semaphore */
-    sstResource.pstWorkerSemaphore = orxThread_CreateSemaphore(1);
+    /* Creates worker semaphore */
+    sstResource.pstWorkerSemaphore = orxThread_CreateSemaphore(1);
+
+    /* Valid? */
+    if(sstResource.pstWorkerSemaphore != orxNULL)
+    {
+      orxU32 i;
+
+      /* Inits request lists */
+      for(i = 0; i < orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1; i++)
+      {
+        sstResource.astRequestList[i].u32NextIndex = i + 1;
+      }
+      sstResource.astRequestList[orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1].u32NextIndex = orxU32_UNDEFINED;
+      for(i = 0; i < orxRESOURCE_PRIORITY_NUMBER; i++)
+      {
+        sstResource.au32QueueHeadList[i]  =
+        sstResource.au32QueueTailList[i]  = orxU32_UNDEFINED;
+      }
+      sstResource.u32DoneHeadIndex        =
+      sstResource.u32DoneTailIndex        = orxU32_UNDEFINED;
+      sstResource.u32FreeIndex            = 0;
+
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
 
-    /* Valid? */
-    if(sstResource.pstWorkerSemaphore != orxNULL)
-    {
-      /* Inits request thread ID */
-      sstResource.u32RequestThreadID = orxU32_UNDEFINED;
+      /* Inits change notification descriptor */
+      sstResource.iNotifyFD               = -1;
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
+      /* Creates location table */
+      sstResource.pstLocationTable    = orxHashTable_Create(orxRESOURCE_KU32_CACHE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
       /* Creates resource info bank */
       sstResource.pstResourceInfoBank = orxBank_Create(orxRESOURCE_KU32_RESOURCE_INFO_BANK_SIZE, sizeof(orxRESOURCE_INFO), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
@@ -1493,9 +3280,21 @@ orxSTATUS orxFASTCALL orxResource_Init()
       sstResource.pstMemoryDataBank     = orxBank_Create(orxRESOURCE_KU32_MEMORY_BANK_SIZE, sizeof(orxRESOURCE_MEMORY_DATA), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
       sstResource.pstMemoryResourceBank = orxBank_Create(orxRESOURCE_KU32_MEMORY_BANK_SIZE, sizeof(orxRESOURCE_MEMORY_RESOURCE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates prefetch banks & table */
+      sstResource.pstPrefetchSetBank    = orxBank_Create(orxRESOURCE_KU32_PREFETCH_SET_BANK_SIZE, sizeof(orxRESOURCE_PREFETCH_SET), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      sstResource.pstPrefetchDataBank   = orxBank_Create(orxRESOURCE_KU32_PREFETCH_DATA_BANK_SIZE, sizeof(orxRESOURCE_PREFETCH_DATA), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      sstResource.pstPrefetchTable      = orxHashTable_Create(orxRESOURCE_KU32_PREFETCH_DATA_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+      /* Creates storage index bank & table */
+      sstResource.pstIndexBank          = orxBank_Create(orxRESOURCE_KU32_INDEX_BANK_SIZE, sizeof(orxRESOURCE_INDEX), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      sstResource.pstIndexTable         = orxHashTable_Create(orxRESOURCE_KU32_INDEX_BANK_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
       /* Success? */
       if((sstResource.pstResourceInfoBank != orxNULL) && (sstResource.pstOpenInfoBank != orxNULL) && (sstResource.pstGroupBank != orxNULL) && (sstResource.pstTypeBank != orxNULL)
-      && (sstResource.pstMemoryDataTable != orxNULL) && (sstResource.pstMemoryDataBank != orxNULL) && (sstResource.pstMemoryResourceBank != orxNULL))
+      && (sstResource.pstMemoryDataTable != orxNULL) && (sstResource.pstMemoryDataBank != orxNULL) && (sstResource.pstMemoryResourceBank != orxNULL)
+      && (sstResource.pstLocationTable != orxNULL)
+      && (sstResource.pstPrefetchSetBank != orxNULL) && (sstResource.pstPrefetchDataBank != orxNULL) && (sstResource.pstPrefetchTable != orxNULL)
+      && (sstResource.pstIndexBank != orxNULL) && (sstResource.pstIndexTable != orxNULL))
       {
         orxRESOURCE_TYPE_INFO stTypeInfo;
 
@@ -1515,6 +3314,8 @@ orxSTATUS orxFASTCALL orxResource_Init()
         stTypeInfo.pfnRead    = orxResource_File_Read;
         stTypeInfo.pfnWrite   = orxResource_File_Write;
         stTypeInfo.pfnDelete  = orxResource_File_Delete;
+        stTypeInfo.pfnMap     = orxResource_File_Map;
+        stTypeInfo.pfnUnmap   = orxResource_File_Unmap;
 
         /* Registers it */
         eResult = orxResource_RegisterType(&stTypeInfo);
@@ -1535,6 +3336,8 @@ orxSTATUS orxFASTCALL orxResource_Init()
           stTypeInfo.pfnRead    = orxResource_Memory_Read;
           stTypeInfo.pfnWrite   = orxNULL;
           stTypeInfo.pfnDelete  = orxNULL;
+          stTypeInfo.pfnMap     = orxResource_Memory_Map;
+          stTypeInfo.pfnUnmap   = orxNULL;
 
           /* Registers it */
           eResult = orxResource_RegisterType(&stTypeInfo);
@@ -1548,12 +3351,15 @@ orxSTATUS orxFASTCALL orxResource_Init()
             /* Waits for worker semaphore */
             orxThread_WaitSemaphore(sstResource.pstWorkerSemaphore);
 
-            /* Starts request processing thread */
-            sstResource.u32RequestThreadID = orxThread_Start(&orxResource_ProcessRequests, orxRESOURCE_KZ_THREAD_NAME, orxNULL);
+            /* Starts first request processing thread, others will be started once config is loaded */
+            sstResource.au32WorkerIDList[0] = orxThread_Start(&orxResource_ProcessRequests, orxRESOURCE_KZ_THREAD_NAME, orxNULL);
 
             /* Success? */
-            if(sstResource.u32RequestThreadID != orxU32_UNDEFINED)
+            if(sstResource.au32WorkerIDList[0] != orxU32_UNDEFINED)
             {
+              /* Updates worker count */
+              sstResource.u32WorkerCount = 1;
+
               /* Registers commands */
               orxResource_RegisterCommands();
 
@@ -1626,12 +3432,42 @@ orxSTATUS orxFASTCALL orxResource_Init()
         orxBank_Delete(sstResource.pstMemoryResourceBank);
       }
 
+      /* Deletes prefetch banks & table */
+      if(sstResource.pstPrefetchSetBank != orxNULL)
+      {
+        orxBank_Delete(sstResource.pstPrefetchSetBank);
+      }
+      if(sstResource.pstPrefetchDataBank != orxNULL)
+      {
+        orxBank_Delete(sstResource.pstPrefetchDataBank);
+      }
+      if(sstResource.pstPrefetchTable != orxNULL)
+      {
+        orxHashTable_Delete(sstResource.pstPrefetchTable);
+      }
+
+      /* Deletes storage index bank & table */
+      if(sstResource.pstIndexBank != orxNULL)
+      {
+        orxBank_Delete(sstResource.pstIndexBank);
+      }
+      if(sstResource.pstIndexTable != orxNULL)
+      {
+        orxHashTable_Delete(sstResource.pstIndexTable);
+      }
+
+      /* Deletes location table */
+      if(sstResource.pstLocationTable != orxNULL)
+      {
+        orxHashTable_Delete(sstResource.pstLocationTable);
+      }
+
       /* Has request thread? */
-      if(sstResource.u32RequestThreadID != orxU32_UNDEFINED)
+      if(sstResource.u32WorkerCount != 0)
       {
         /* Joins it */
-        orxThread_Join(sstResource.u32RequestThreadID);
-        sstResource.u32RequestThreadID = orxU32_UNDEFINED;
+        orxThread_Join(sstResource.au32WorkerIDList[0]);
+        sstResource.u32WorkerCount = 0;
       }
 
       /* Logs message */
@@ -1658,8 +3494,12 @@ void orxFASTCALL orxResource_Exit()
   /* Initialized? */
   if(sstResource.u32Flags & orxRESOURCE_KU32_STATIC_FLAG_READY)
   {
-    orxRESOURCE_GROUP      *pstGroup;
-    orxRESOURCE_OPEN_INFO  *pstOpenInfo;
+    orxRESOURCE_GROUP          *pstGroup;
+    orxRESOURCE_OPEN_INFO      *pstOpenInfo;
+    orxRESOURCE_PREFETCH_DATA  *pstPrefetchData;
+    orxRESOURCE_INDEX          *pstIndex;
+    orxU64                      u64WorkerFlags;
+    orxU32                      i;
 
     /* Unregisters commands */
     orxResource_UnregisterCommands();
@@ -1667,22 +3507,34 @@ void orxFASTCALL orxResource_Exit()
     /* Updates status */
     orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_EXIT, orxRESOURCE_KU32_STATIC_FLAG_NONE);
 
-    /* Makes sure resource thread is enabled */
-    orxThread_Enable(orxTHREAD_GET_FLAG_FROM_ID(sstResource.u32RequestThreadID), orxTHREAD_KU32_FLAG_NONE);
+    /* Makes sure resource threads are enabled */
+    for(i = 0, u64WorkerFlags = 0; i < sstResource.u32WorkerCount; i++)
+    {
+      u64WorkerFlags |= orxTHREAD_GET_FLAG_FROM_ID(sstResource.au32WorkerIDList[i]);
+    }
+    orxThread_Enable(u64WorkerFlags, orxTHREAD_KU32_FLAG_NONE);
 
     /* Waits for all pending operations to complete */
-    while(sstResource.u32RequestProcessIndex != sstResource.u32RequestInIndex);
+    while(sstResource.u32UnprocessedCount != 0);
 
     /* Updates worker result */
     sstResource.eThreadResult = orxSTATUS_FAILURE;
     orxMEMORY_BARRIER();
 
-    /* Signals worker semaphore */
-    orxThread_SignalSemaphore(sstResource.pstWorkerSemaphore);
+    /* For all workers */
+    for(i = 0; i < sstResource.u32WorkerCount; i++)
+    {
+      /* Signals worker semaphore */
+      orxThread_SignalSemaphore(sstResource.pstWorkerSemaphore);
+    }
 
-    /* Joins request thread */
-    orxThread_Join(sstResource.u32RequestThreadID);
-    sstResource.u32RequestThreadID = orxU32_UNDEFINED;
+    /* For all workers */
+    for(i = 0; i < sstResource.u32WorkerCount; i++)
+    {
+      /* Joins it */
+      orxThread_Join(sstResource.au32WorkerIDList[i]);
+    }
+    sstResource.u32WorkerCount = 0;
 
     /* Delete worker semaphore */
     orxThread_DeleteSemaphore(sstResource.pstWorkerSemaphore);
@@ -1701,6 +3553,17 @@ void orxFASTCALL orxResource_Exit()
       }
     }
 
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+    /* Uses change notifications? */
+    if(sstResource.iNotifyFD >= 0)
+    {
+      /* Stops them */
+      orxResource_StopNotify();
+    }
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
     /* Has uncached location? */
     if(sstResource.zLastUncachedLocation != orxNULL)
     {
@@ -1726,8 +3589,17 @@ void orxFASTCALL orxResource_Exit()
     /* For all open resources */
     while((pstOpenInfo = (orxRESOURCE_OPEN_INFO *)orxBank_GetNext(sstResource.pstOpenInfoBank, orxNULL)) != orxNULL)
     {
-      /* Closes it */
-      orxResource_Close((orxHANDLE)pstOpenInfo);
+      /* Already closed by a worker? */
+      if(pstOpenInfo->hResource == orxHANDLE_UNDEFINED)
+      {
+        /* Frees open info */
+        orxBank_Free(sstResource.pstOpenInfoBank, pstOpenInfo);
+      }
+      else
+      {
+        /* Closes it */
+        orxResource_Close((orxHANDLE)pstOpenInfo);
+      }
     }
 
     /* Deletes open info bank */
@@ -1739,11 +3611,46 @@ void orxFASTCALL orxResource_Exit()
     /* Deletes info bank */
     orxBank_Delete(sstResource.pstResourceInfoBank);
 
+    /* For all prefetch data */
+    while((pstPrefetchData = (orxRESOURCE_PREFETCH_DATA *)orxBank_GetNext(sstResource.pstPrefetchDataBank, orxNULL)) != orxNULL)
+    {
+      /* Deletes it */
+      orxResource_DeletePrefetchData(pstPrefetchData);
+    }
+
+    /* Deletes prefetch banks & table */
+    orxBank_Delete(sstResource.pstPrefetchSetBank);
+    orxBank_Delete(sstResource.pstPrefetchDataBank);
+    orxHashTable_Delete(sstResource.pstPrefetchTable);
+
+    /* For all storage indices */
+    for(pstIndex = (orxRESOURCE_INDEX *)orxBank_GetNext(sstResource.pstIndexBank, orxNULL);
+        pstIndex != orxNULL;
+        pstIndex = (orxRESOURCE_INDEX *)orxBank_GetNext(sstResource.pstIndexBank, pstIndex))
+    {
+      /* Waits for it to be built */
+      while(pstIndex->eStatus == orxRESOURCE_INDEX_STATUS_BUILDING);
+
+      /* Has list? */
+      if(pstIndex->astPathList != orxNULL)
+      {
+        /* Deletes it */
+        orxMemory_Free(pstIndex->astPathList);
+      }
+    }
+
+    /* Deletes storage index bank & table */
+    orxBank_Delete(sstResource.pstIndexBank);
+    orxHashTable_Delete(sstResource.pstIndexTable);
+
     /* Deletes memory table & banks */
     orxHashTable_Delete(sstResource.pstMemoryDataTable);
     orxBank_Delete(sstResource.pstMemoryDataBank);
     orxBank_Delete(sstResource.pstMemoryResourceBank);
 
+    /* Deletes location table */
+    orxHashTable_Delete(sstResource.pstLocationTable);
+
     /* Updates flags */
     sstResource.u32Flags &= ~orxRESOURCE_KU32_STATIC_FLAG_READY;
   }
@@ -1879,6 +3786,9 @@ orxSTATUS orxFASTCALL orxResource_AddStorage(const orxSTRING _zGroup, const orxS
         }
         }
 
+        /* Clears its missed lookups */
+        orxHashTable_Clear(pstGroup->pstMissTable);
+
         /* Updates result */
         eResult = orxSTATUS_SUCCESS;
       }
@@ -2058,12 +3968,18 @@ orxSTATUS orxFASTCALL orxResource_ReloadStorage()
   /* Pushes resource config section */
   orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
 
+  /* Updates lookup cache status */
+  orxFLAG_SET(sstResource.u32Flags, (orxConfig_GetBool(orxRESOURCE_KZ_CONFIG_LOOKUP_CACHE) != orxFALSE) ? orxRESOURCE_KU32_STATIC_FLAG_LOOKUP_CACHE : orxRESOURCE_KU32_STATIC_FLAG_NONE, orxRESOURCE_KU32_STATIC_FLAG_LOOKUP_CACHE);
+
   /* Loads all storages */
   orxConfig_ForAllKeys(orxResource_LoadStorage, orxTRUE, &eResult);
 
   /* Pops config section */
   orxConfig_PopSection();
 
+  /* Invalidates lookups */
+  orxResource_InvalidateLookups();
+
   /* Done! */
   return eResult;
 }
@@ -2125,7 +4041,8 @@ const orxSTRING orxFASTCALL orxResource_Locate(const orxSTRING _zGroup, const or
         /* Updates result */
         zResult = pstResourceInfo->zLocation;
       }
-      else
+      /* Not already missed? */
+      else if(orxHashTable_Get(pstGroup->pstMissTable, stKey) == orxNULL)
       {
         orxRESOURCE_STORAGE *pstStorage;
 
@@ -2149,8 +4066,9 @@ const orxSTRING orxFASTCALL orxResource_Locate(const orxSTRING _zGroup, const or
             /* Success? */
             if(zLocation != orxNULL)
             {
-              orxRESOURCE_INFO *pstResourceInfo;
-              orxS32            s32Size;
+              orxRESOURCE_INFO   *pstResourceInfo;
+              orxRESOURCE_GROUP **ppstGroup;
+              orxS32              s32Size;
 
               /* Allocates resource info */
               pstResourceInfo = (orxRESOURCE_INFO *)orxBank_Allocate(sstResource.pstResourceInfoBank);
@@ -2168,11 +4086,26 @@ const orxSTRING orxFASTCALL orxResource_Locate(const orxSTRING _zGroup, const or
               pstResourceInfo->stGroupID    = stGroupID;
               pstResourceInfo->stStorageID  = pstStorage->stID;
               pstResourceInfo->stNameID     = stKey;
+              pstResourceInfo->bNotified    = orxFALSE;
               orxMEMORY_BARRIER();
 
               /* Adds it to cache */
               orxHashTable_Add(pstGroup->pstCacheTable, stKey, pstResourceInfo);
 
+#ifdef orxRESOURCE_KB_NOTIFY_SUPPORT
+
+              /* Watches it */
+              orxResource_AddNotifyWatch(pstResourceInfo);
+
+#endif /* orxRESOURCE_KB_NOTIFY_SUPPORT */
+
+              /* Stores its group for request stats, if not already known */
+              ppstGroup = (orxRESOURCE_GROUP **)orxHashTable_Retrieve(sstResource.pstLocationTable, orxString_Hash(pstResourceInfo->zLocation));
+              if((ppstGroup != orxNULL) && (*ppstGroup == orxNULL))
+              {
+                *ppstGroup = pstGroup;
+              }
+
               /* Updates result */
               zResult = pstResourceInfo->zLocation;
 
@@ -2180,6 +4113,13 @@ const orxSTRING orxFASTCALL orxResource_Locate(const orxSTRING _zGroup, const or
             }
           }
         }
+
+        /* Not found and can cache missed lookups? */
+        if((zResult == orxNULL) && (orxResource_IsLookupCacheEnabled() != orxFALSE))
+        {
+          /* Stores it */
+          orxHashTable_Add(pstGroup->pstMissTable, stKey, pstGroup);
+        }
       }
     }
   }
@@ -2499,8 +4439,14 @@ orxHANDLE orxFASTCALL orxResource_Open(const orxSTRING _zLocation, orxBOOL _bEra
       orxASSERT(pstOpenInfo != orxNULL);
 
       /* Inits it */
-      pstOpenInfo->pstTypeInfo  = &(pstType->stInfo);
-      pstOpenInfo->u32OpCount   = 0;
+      pstOpenInfo->pstTypeInfo      = &(pstType->stInfo);
+      pstOpenInfo->pMap             = orxNULL;
+      pstOpenInfo->s64MapSize       = 0;
+      pstOpenInfo->pstGroup         = (orxRESOURCE_GROUP *)orxHashTable_Get(sstResource.pstLocationTable, orxString_Hash(_zLocation));
+      pstOpenInfo->ePriority        = orxRESOURCE_PRIORITY_NORMAL;
+      pstOpenInfo->u32NextSequence  = 0;
+      pstOpenInfo->u32ServeSequence = 0;
+      pstOpenInfo->u32OpCount       = 0;
 
       /* Opens it */
       pstOpenInfo->hResource = pstType->stInfo.pfnOpen(_zLocation + u32TagLength + 1, _bEraseMode);
@@ -2513,6 +4459,13 @@ orxHANDLE orxFASTCALL orxResource_Open(const orxSTRING _zLocation, orxBOOL _bEra
 
         /* Stores location */
         pstOpenInfo->zLocation = orxString_Duplicate(_zLocation);
+
+        /* Erase mode? */
+        if(_bEraseMode != orxFALSE)
+        {
+          /* Invalidates its lookups, as resource might have been created */
+          orxResource_InvalidateLocation(pstOpenInfo->pstTypeInfo, _zLocation);
+        }
       }
       else
       {
@@ -2557,13 +4510,16 @@ void orxFASTCALL orxResource_Close(orxHANDLE _hResource)
     pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
 
     /* Has pending operations (and thread hasn't been terminated)? */
-    if((pstOpenInfo->u32OpCount != 0) && (sstResource.u32RequestThreadID != orxU32_UNDEFINED))
+    if((pstOpenInfo->u32OpCount != 0) && (sstResource.u32WorkerCount != 0))
     {
       /* Adds request */
       orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_CLOSE, 0, orxNULL, orxNULL, orxNULL, pstOpenInfo);
     }
     else
     {
+      /* Releases its mapping */
+      orxResource_ReleaseMap(pstOpenInfo);
+
       /* Closes resource */
       pstOpenInfo->pstTypeInfo->pfnClose(pstOpenInfo->hResource);
 
@@ -2824,6 +4780,86 @@ orxS64 orxFASTCALL orxResource_Write(orxHANDLE _hResource, orxS64 _s64Size, cons
   return s64Result;
 }
 
+/** Maps the whole content of a resource in memory, read-only, without copying it, if supported by its type
+ * The mapping remains valid until orxResource_Unmap or orxResource_Close is called on that resource
+ * @param[in] _hResource        Concerned resource
+ * @param[out] _ps64Size        Size of the mapped content, in bytes, if not null
+ * @return Pointer to the mapped content if successful, orxNULL otherwise (caller should then use orxResource_Read)
+ */
+const void *orxFASTCALL orxResource_Map(orxHANDLE _hResource, orxS64 *_ps64Size)
+{
+  const void *pResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_Map");
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+
+    /* Gets open info */
+    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+
+    /* Checks */
+    orxASSERT(pstOpenInfo->u32OpCount == 0);
+
+    /* Not already mapped and supports mapping? */
+    if((pstOpenInfo->pMap == orxNULL) && (pstOpenInfo->pstTypeInfo->pfnMap != orxNULL))
+    {
+      orxS64 s64Size = 0;
+
+      /* Maps it */
+      pstOpenInfo->pMap = pstOpenInfo->pstTypeInfo->pfnMap(pstOpenInfo->hResource, &s64Size);
+
+      /* Success? */
+      if(pstOpenInfo->pMap != orxNULL)
+      {
+        /* Stores its size */
+        pstOpenInfo->s64MapSize = s64Size;
+      }
+    }
+
+    /* Updates result */
+    pResult = pstOpenInfo->pMap;
+
+    /* Should store size? */
+    if(_ps64Size != orxNULL)
+    {
+      /* Stores it */
+      *_ps64Size = pstOpenInfo->s64MapSize;
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return pResult;
+}
+
+/** Unmaps the content of a resource previously mapped with orxResource_Map
+ * @param[in] _hResource        Concerned resource
+ */
+void orxFASTCALL orxResource_Unmap(orxHANDLE _hResource)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    /* Releases its mapping */
+    orxResource_ReleaseMap((orxRESOURCE_OPEN_INFO *)_hResource);
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Deletes a resource, given its location
  * @param[in] _zLocation        Location of the resource to delete
  * @return orxSTATUS_SUCCESS upon success, orxSTATUS_FAILURE otherwise
@@ -2870,6 +4906,13 @@ orxSTATUS orxFASTCALL orxResource_Delete(const orxSTRING _zLocation)
       {
         /* Deletes it */
         eResult = pstType->stInfo.pfnDelete(_zLocation + u32TagLength + 1);
+
+        /* Success? */
+        if(eResult != orxSTATUS_FAILURE)
+        {
+          /* Invalidates its lookups */
+          orxResource_InvalidateLocation(&(pstType->stInfo), _zLocation);
+        }
       }
     }
     else
@@ -2883,67 +4926,290 @@ orxSTATUS orxFASTCALL orxResource_Delete(const orxSTRING _zLocation)
   orxPROFILER_POP_MARKER();
 
   /* Done! */
-  return eResult;
+  return eResult;
+}
+
+/** Gets pending operation count for a given resource
+ * @param[in] _hResource        Concerned resource
+ * @return Number of pending asynchronous operations for that resource
+ */
+orxU32 orxFASTCALL orxResource_GetPendingOpCount(const orxHANDLE _hResource)
+{
+  orxU32 u32Result = 0;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+
+    /* Gets open info */
+    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+
+    /* Updates result */
+    u32Result = pstOpenInfo->u32OpCount;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Sets the priority of the asynchronous operations that will be issued on a given resource; requests of a same resource are always processed in order
+ * @param[in] _hResource        Concerned resource
+ * @param[in] _ePriority        Priority to use for the resource's upcoming asynchronous operations, defaults to orxRESOURCE_PRIORITY_NORMAL
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxResource_SetPriority(orxHANDLE _hResource, orxRESOURCE_PRIORITY _ePriority)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+  orxASSERT(_ePriority < orxRESOURCE_PRIORITY_NUMBER);
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+
+    /* Gets open info */
+    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+
+    /* Stores priority */
+    pstOpenInfo->ePriority = _ePriority;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets the priority of the asynchronous operations issued on a given resource
+ * @param[in] _hResource        Concerned resource
+ * @return orxRESOURCE_PRIORITY
+ */
+orxRESOURCE_PRIORITY orxFASTCALL orxResource_GetPriority(const orxHANDLE _hResource)
+{
+  orxRESOURCE_PRIORITY eResult = orxRESOURCE_PRIORITY_NONE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+
+    /* Gets open info */
+    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+
+    /* Updates result */
+    eResult = pstOpenInfo->ePriority;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Cancels all the pending asynchronous read/write operations of a given resource that haven't been started yet; their callbacks will still be called, with a size of 0
+ * @param[in] _hResource        Concerned resource
+ * @return Number of cancelled operations
+ */
+orxU32 orxFASTCALL orxResource_Cancel(orxHANDLE _hResource)
+{
+  orxU32 u32Result = 0;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_Cancel");
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+
+    /* Gets open info */
+    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+
+    /* Has pending operations? */
+    if(pstOpenInfo->u32OpCount != 0)
+    {
+      orxU32 i;
+
+      /* Locks queue */
+      orxResource_LockQueue();
+
+      /* For all priorities */
+      for(i = 0; i < orxRESOURCE_PRIORITY_NUMBER; i++)
+      {
+        orxU32 u32Index;
+
+        /* For all queued requests */
+        for(u32Index = sstResource.au32QueueHeadList[i];
+            u32Index != orxU32_UNDEFINED;
+            u32Index = sstResource.astRequestList[u32Index].u32NextIndex)
+        {
+          volatile orxRESOURCE_REQUEST *pstRequest;
+
+          /* Gets request */
+          pstRequest = &(sstResource.astRequestList[u32Index]);
+
+          /* Cancellable read/write on this resource? */
+          if((pstRequest->pstResourceInfo == pstOpenInfo)
+          && ((pstRequest->eType == orxRESOURCE_REQUEST_TYPE_READ)
+           || (pstRequest->eType == orxRESOURCE_REQUEST_TYPE_WRITE))
+          && (pstRequest->bCancelled == orxFALSE))
+          {
+            /* Cancels it, it'll get skipped by workers, while preserving the resource's request order */
+            pstRequest->bCancelled = orxTRUE;
+
+            /* Updates result */
+            u32Result++;
+          }
+        }
+      }
+
+      /* Unlocks queue */
+      orxResource_UnlockQueue();
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u32Result;
 }
 
-/** Gets pending operation count for a given resource
- * @param[in] _hResource        Concerned resource
- * @return Number of pending asynchronous operations for that resource
+/** Gets total pending operation count
+ * @return Number of total pending asynchronous operations
  */
-orxU32 orxFASTCALL orxResource_GetPendingOpCount(const orxHANDLE _hResource)
+orxU32 orxFASTCALL orxResource_GetTotalPendingOpCount()
 {
   orxU32 u32Result = 0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
 
-  /* Valid? */
-  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  /* Update result */
+  u32Result = sstResource.u32RequestCount;
+
+  /* Has pending operations? */
+  if(u32Result != 0)
   {
-    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+    /* Main thread? */
+    if(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+    {
+      /* Pumps some request notifications in case caller is waiting in a closed loop */
+      orxResource_NotifyRequest(orxNULL, orxNULL);
+    }
+  }
 
-    /* Gets open info */
-    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets asynchronous request statistics for specific resource group(s)
+ * @param[in] _zGroup           Concerned resource group, orxNULL for all requests
+ * @param[out] _pstStats        Statistics
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxResource_GetStats(const orxSTRING _zGroup, orxRESOURCE_STATS *_pstStats)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstStats != orxNULL);
+
+  /* All requests? */
+  if(_zGroup == orxNULL)
+  {
+    /* Copies global stats */
+    orxMemory_Copy(_pstStats, &(sstResource.stStats), sizeof(orxRESOURCE_STATS));
 
     /* Updates result */
-    u32Result = pstOpenInfo->u32OpCount;
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    orxRESOURCE_GROUP *pstGroup;
+
+    /* Gets group */
+    pstGroup = orxResource_FindGroup(orxString_Hash(_zGroup));
+
+    /* Found? */
+    if(pstGroup != orxNULL)
+    {
+      /* Copies its stats */
+      orxMemory_Copy(_pstStats, &(pstGroup->stStats), sizeof(orxRESOURCE_STATS));
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Clears stats */
+      orxMemory_Zero(_pstStats, sizeof(orxRESOURCE_STATS));
+    }
   }
 
   /* Done! */
-  return u32Result;
+  return eResult;
 }
 
-/** Gets total pending operation count
- * @return Number of total pending asynchronous operations
+/** Resets asynchronous request statistics for specific resource group(s)
+ * @param[in] _zGroup           Concerned resource group, orxNULL for all groups
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-orxU32 orxFASTCALL orxResource_GetTotalPendingOpCount()
+orxSTATUS orxFASTCALL orxResource_ResetStats(const orxSTRING _zGroup)
 {
-  orxU32 u32InIndex, u32OutIndex;
-  orxU32 u32Result = 0;
+  orxSTRINGID         stGroupID;
+  orxRESOURCE_GROUP  *pstGroup;
+  orxSTATUS           eResult = orxSTATUS_FAILURE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
 
-  /* Gets indices */
-  u32InIndex  = sstResource.u32RequestInIndex;
-  u32OutIndex = sstResource.u32RequestOutIndex;
+  /* Gets group ID */
+  stGroupID = (_zGroup != orxNULL) ? orxString_Hash(_zGroup) : orxSTRINGID_UNDEFINED;
 
-  /* Update result */
-  u32Result = (u32InIndex >= u32OutIndex) ? u32InIndex - u32OutIndex : u32InIndex + (orxRESOURCE_KU32_REQUEST_LIST_SIZE - u32OutIndex);
+  /* All groups? */
+  if(_zGroup == orxNULL)
+  {
+    /* Clears global stats */
+    orxMemory_Zero(&(sstResource.stStats), sizeof(orxRESOURCE_STATS));
 
-  /* Has pending operations? */
-  if(u32Result != 0)
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* For all groups */
+  for(pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+      pstGroup != orxNULL;
+      pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstGroup))
   {
-    /* Main thread? */
-    if(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+    /* Matches? */
+    if((_zGroup == orxNULL)
+    || (pstGroup->stID == stGroupID))
     {
-      /* Pumps some request notifications in case caller is waiting in a closed loop */
-      orxResource_NotifyRequest(orxNULL, orxNULL);
+      /* Clears its stats */
+      orxMemory_Zero(&(pstGroup->stStats), sizeof(orxRESOURCE_STATS));
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
     }
   }
 
   /* Done! */
-  return u32Result;
+  return eResult;
 }
 
 /** Registers a new resource type
@@ -2997,6 +5263,9 @@ orxSTATUS orxFASTCALL orxResource_RegisterType(const orxRESOURCE_TYPE_INFO *_pst
       /* Adds it first */
       orxLinkList_AddStart(&(sstResource.stTypeList), &(pstType->stNode));
 
+      /* Clears all missed lookups, storage indices aren't affected by types */
+      orxResource_InvalidateMisses(orxNULL);
+
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
     }
@@ -3123,6 +5392,9 @@ orxSTATUS orxFASTCALL orxResource_Sync(const orxSTRING _zGroup)
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxResource_Sync");
 
+  /* Invalidates lookups */
+  orxResource_InvalidateLookups();
+
   /* Gets group ID */
   stGroupID = (_zGroup != orxNULL) ? orxString_Hash(_zGroup) : orxSTRINGID_UNDEFINED;
 
@@ -3137,95 +5409,42 @@ orxSTATUS orxFASTCALL orxResource_Sync(const orxSTRING _zGroup)
     {
       orxHANDLE         hIterator;
       orxRESOURCE_INFO *pstResourceInfo;
-      const orxSTRING   zGroup;
-
-      /* Gets group */
-      zGroup = orxString_GetFromID(pstGroup->stID);
 
       /* For all cached resources */
       for(hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstResourceInfo);
           hIterator != orxHANDLE_UNDEFINED;
           hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, hIterator, orxNULL, (void **)&pstResourceInfo))
       {
-        orxRESOURCE_STORAGE  *pstStorage;
-        const orxSTRING       zName;
+        orxBOOL bAdd, bMoved;
 
-        /* Gets its name */
-        zName = orxString_GetFromID(pstResourceInfo->stNameID);
+        /* Updates status */
+        bAdd = (pstResourceInfo->s64Time == 0) ? orxTRUE : orxFALSE;
 
-        /* For all storages in group */
-        for(pstStorage = (orxRESOURCE_STORAGE *)orxLinkList_GetFirst(&(pstGroup->stStorageList));
-            pstStorage != orxNULL;
-            pstStorage = (orxRESOURCE_STORAGE *)orxLinkList_GetNext(&(pstStorage->stNode)))
+        /* Found? */
+        if(orxResource_Relocate(pstGroup, pstResourceInfo, &bMoved) != orxSTATUS_FAILURE)
         {
-          orxRESOURCE_TYPE *pstType;
-
-          /* For all registered types */
-          for(pstType = (orxRESOURCE_TYPE *)orxLinkList_GetFirst(&(sstResource.stTypeList));
-              pstType != orxNULL;
-              pstType = (orxRESOURCE_TYPE *)orxLinkList_GetNext(&(pstType->stNode)))
+          /* New location? */
+          if(bMoved != orxFALSE)
           {
-            const orxSTRING zNewLocation;
-
-            /* Locates resource */
-            zNewLocation = pstType->stInfo.pfnLocate(zGroup, orxString_GetFromID(pstStorage->stID), zName, orxTRUE);
+            orxRESOURCE_EVENT_PAYLOAD stPayload;
 
-            /* Success? */
-            if(zNewLocation != orxNULL)
-            {
-              /* New location? */
-              if((&(pstType->stInfo) != pstResourceInfo->pstTypeInfo)
-              || (pstResourceInfo->s64Time == 0)
-              || (orxString_ICompare(pstResourceInfo->zLocation + orxString_GetLength(pstType->stInfo.zTag) + 1, zNewLocation) != 0))
-              {
-                orxRESOURCE_EVENT_PAYLOAD stPayload;
-                orxS32                    s32Size;
-                orxBOOL                   bAdd;
-
-                /* Updates status */
-                bAdd = (pstResourceInfo->s64Time == 0) ? orxTRUE : orxFALSE;
-
-                /* Deletes its previous location */
-                orxMemory_Free(pstResourceInfo->zLocation);
-
-                /* Updates its resource info */
-                pstResourceInfo->pstTypeInfo  = &(pstType->stInfo);
-                pstResourceInfo->s64Time      = orxRESOURCE_KU32_WATCH_TIME_UNINITIALIZED;
-                s32Size                       = orxString_GetLength(pstType->stInfo.zTag) + orxString_GetLength(zNewLocation) + 2;
-                pstResourceInfo->zLocation    = (orxSTRING)orxMemory_Allocate(s32Size, orxMEMORY_TYPE_TEXT);
-                orxASSERT(pstResourceInfo->zLocation != orxNULL);
-                orxString_NPrint(pstResourceInfo->zLocation, s32Size, "%s%c%s", pstType->stInfo.zTag, orxRESOURCE_KC_LOCATION_SEPARATOR, zNewLocation);
-                orxMEMORY_BARRIER();
-
-                /* Clears payload */
-                orxMemory_Zero(&stPayload, sizeof(orxRESOURCE_EVENT_PAYLOAD));
-
-                /* Inits payload */
-                stPayload.s64Time     = pstResourceInfo->s64Time;
-                stPayload.zLocation   = pstResourceInfo->zLocation;
-                stPayload.pstTypeInfo = pstResourceInfo->pstTypeInfo;
-                stPayload.stGroupID   = pstResourceInfo->stGroupID;
-                stPayload.stStorageID = pstResourceInfo->stStorageID;
-                stPayload.stNameID    = pstResourceInfo->stNameID;
-
-                /* Sends event */
-                orxEVENT_SEND(orxEVENT_TYPE_RESOURCE, (bAdd != orxFALSE) ? orxRESOURCE_EVENT_ADD : orxRESOURCE_EVENT_UPDATE, orxNULL, orxNULL, &stPayload);
-              }
+            /* Clears payload */
+            orxMemory_Zero(&stPayload, sizeof(orxRESOURCE_EVENT_PAYLOAD));
 
-              break;
-            }
-          }
+            /* Inits payload */
+            stPayload.s64Time     = pstResourceInfo->s64Time;
+            stPayload.zLocation   = pstResourceInfo->zLocation;
+            stPayload.pstTypeInfo = pstResourceInfo->pstTypeInfo;
+            stPayload.stGroupID   = pstResourceInfo->stGroupID;
+            stPayload.stStorageID = pstResourceInfo->stStorageID;
+            stPayload.stNameID    = pstResourceInfo->stNameID;
 
-          /* Was found? */
-          if(pstType != orxNULL)
-          {
-            /* Stops */
-            break;
+            /* Sends event */
+            orxEVENT_SEND(orxEVENT_TYPE_RESOURCE, (bAdd != orxFALSE) ? orxRESOURCE_EVENT_ADD : orxRESOURCE_EVENT_UPDATE, orxNULL, orxNULL, &stPayload);
           }
         }
-
-        /* Was not found and not already removed? */
-        if((pstStorage == orxNULL) && (pstResourceInfo->s64Time != 0))
+        /* Not already removed? */
+        else if(pstResourceInfo->s64Time != 0)
         {
           orxRESOURCE_EVENT_PAYLOAD stPayload;
 
@@ -3275,7 +5494,7 @@ orxSTATUS orxFASTCALL orxResource_ClearCache(const orxSTRING _zGroup)
   orxPROFILER_PUSH_MARKER("orxResource_ClearCache");
 
   /* Waits for all pending operations to complete */
-  while(sstResource.u32RequestProcessIndex != sstResource.u32RequestInIndex);
+  while(sstResource.u32UnprocessedCount != 0);
 
   /* Gets group ID */
   stGroupID = (_zGroup != orxNULL) ? orxString_Hash(_zGroup) : orxSTRINGID_UNDEFINED;
@@ -3304,8 +5523,9 @@ orxSTATUS orxFASTCALL orxResource_ClearCache(const orxSTRING _zGroup)
         orxBank_Free(sstResource.pstResourceInfoBank, pstResourceInfo);
       }
 
-      /* Clears cache table */
+      /* Clears cache & miss tables */
       orxHashTable_Clear(pstGroup->pstCacheTable);
+      orxHashTable_Clear(pstGroup->pstMissTable);
 
       /* Updates result */
       eResult = orxSTATUS_SUCCESS;
@@ -3489,6 +5709,31 @@ orxSTATUS orxFASTCALL orxResource_SetMemoryResource(const orxSTRING _zGroup, con
 
           /* Stores it */
           eResult = orxHashTable_Set(sstResource.pstMemoryDataTable, stNameID, pstData);
+
+          /* Success? */
+          if(eResult != orxSTATUS_FAILURE)
+          {
+            /* Has group? */
+            if(_zGroup != orxNULL)
+            {
+              orxRESOURCE_GROUP *pstGroup;
+
+              /* Gets it */
+              pstGroup = orxResource_FindGroup(orxString_Hash(_zGroup));
+
+              /* Found? */
+              if(pstGroup != orxNULL)
+              {
+                /* Clears its missed lookups, memory resources aren't indexed */
+                orxResource_InvalidateMisses(pstGroup);
+              }
+            }
+            else
+            {
+              /* Clears all missed lookups */
+              orxResource_InvalidateMisses(orxNULL);
+            }
+          }
         }
         else
         {
@@ -3523,3 +5768,294 @@ orxSTATUS orxFASTCALL orxResource_SetMemoryResource(const orxSTRING _zGroup, con
   /* Done! */
   return eResult;
 }
+
+/** Prefetches a set of resources in memory: the set is a config section where each key is a resource group and its values are the names of the resources to prefetch for that group
+ * Resources are read asynchronously with a background priority and then served as memory resources, in their original storage, until the set is released. An orxRESOURCE_EVENT_PREFETCH event is sent for every processed resource.
+ * @param[in] _zSet             Name of the config section defining the set
+ * @param[in] _pfnCallback      Function called once all the resources of the set have been processed, orxNULL to ignore
+ * @param[in] _pContext         Context that will be transmitted to the callback when called
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxResource_Prefetch(const orxSTRING _zSet, orxRESOURCE_PREFETCH_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSet != orxNULL);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_Prefetch");
+
+  /* Valid set? */
+  if((*_zSet != orxCHAR_NULL) && (orxConfig_HasSection(_zSet) != orxFALSE))
+  {
+    orxRESOURCE_PREFETCH_SET *pstSet;
+
+    /* Allocates set */
+    pstSet = (orxRESOURCE_PREFETCH_SET *)orxBank_Allocate(sstResource.pstPrefetchSetBank);
+
+    /* Success? */
+    if(pstSet != orxNULL)
+    {
+      orxU32 i, u32KeyCount;
+
+      /* Inits it */
+      orxMemory_Zero(pstSet, sizeof(orxRESOURCE_PREFETCH_SET));
+      pstSet->zSet        = orxString_Store(_zSet);
+      pstSet->pfnCallback = _pfnCallback;
+      pstSet->pContext    = _pContext;
+      pstSet->bIssuing    = orxTRUE;
+
+      /* Pushes set section */
+      orxConfig_PushSection(_zSet);
+
+      /* For all groups */
+      for(i = 0, u32KeyCount = orxConfig_GetKeyCount(); i < u32KeyCount; i++)
+      {
+        const orxSTRING zGroup;
+        orxS32          j, s32Count;
+
+        /* Gets it */
+        zGroup = orxString_Store(orxConfig_GetKey(i));
+
+        /* For all its resources */
+        for(j = 0, s32Count = orxConfig_GetListCount(zGroup); j < s32Count; j++)
+        {
+          const orxSTRING zName;
+          const orxSTRING zLocation;
+
+          /* Gets its name */
+          zName = orxString_Store(orxConfig_GetListString(zGroup, j));
+
+          /* Locates it */
+          zLocation = orxResource_Locate(zGroup, zName);
+
+          /* Success? */
+          if(zLocation != orxNULL)
+          {
+            orxRESOURCE_INFO *pstResourceInfo;
+
+            /* Gets its cached info */
+            pstResourceInfo = (orxRESOURCE_INFO *)orxHashTable_Get(orxResource_FindGroup(orxString_GetID(zGroup))->pstCacheTable, orxString_GetID(zName));
+
+            /* Checks */
+            orxASSERT(pstResourceInfo != orxNULL);
+
+            /* Not already in memory? */
+            if(orxString_Compare(pstResourceInfo->pstTypeInfo->zTag, orxRESOURCE_KZ_TYPE_TAG_MEMORY) != 0)
+            {
+              orxRESOURCE_PREFETCH_DATA  *pstData = orxNULL;
+              orxHANDLE                   hResource;
+
+              /* Opens it */
+              hResource = orxResource_Open(zLocation, orxFALSE);
+
+              /* Success? */
+              if(hResource != orxHANDLE_UNDEFINED)
+              {
+                orxS64 s64Size;
+
+                /* Gets its size */
+                s64Size = orxResource_GetSize(hResource);
+
+                /* Not empty? */
+                if(s64Size > 0)
+                {
+                  /* Allocates prefetch data */
+                  pstData = (orxRESOURCE_PREFETCH_DATA *)orxBank_Allocate(sstResource.pstPrefetchDataBank);
+
+                  /* Success? */
+                  if(pstData != orxNULL)
+                  {
+                    /* Inits it */
+                    pstData->pstSet       = pstSet;
+                    pstData->s64Size      = s64Size;
+                    pstData->stGroupID    = pstResourceInfo->stGroupID;
+                    pstData->stStorageID  = pstResourceInfo->stStorageID;
+                    pstData->stNameID     = pstResourceInfo->stNameID;
+                    pstData->pBuffer      = orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_MAIN);
+
+                    /* Couldn't allocate its content? */
+                    if(pstData->pBuffer == orxNULL)
+                    {
+                      /* Frees it */
+                      orxBank_Free(sstResource.pstPrefetchDataBank, pstData);
+                      pstData = orxNULL;
+                    }
+                  }
+                }
+
+                /* Valid? */
+                if(pstData != orxNULL)
+                {
+                  /* Updates total count */
+                  pstSet->u32TotalCount++;
+
+                  /* Doesn't compete with regular requests */
+                  orxResource_SetPriority(hResource, orxRESOURCE_PRIORITY_BACKGROUND);
+
+                  /* Reads it asynchronously */
+                  orxResource_Read(hResource, s64Size, pstData->pBuffer, orxResource_NotifyPrefetch, pstData);
+                }
+                else
+                {
+                  /* Closes it */
+                  orxResource_Close(hResource);
+                }
+              }
+
+              /* Failure? */
+              if(pstData == orxNULL)
+              {
+                /* Logs message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "[%s]: Couldn't prefetch resource <%s> from group <%s>: can't read it.", _zSet, zName, zGroup);
+              }
+            }
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "[%s]: Couldn't prefetch resource <%s> from group <%s>: can't locate it.", _zSet, zName, zGroup);
+          }
+        }
+      }
+
+      /* Pops config section */
+      orxConfig_PopSection();
+
+      /* Updates status */
+      pstSet->bIssuing = orxFALSE;
+
+      /* Already complete? */
+      if(pstSet->u32Count == pstSet->u32TotalCount)
+      {
+        /* Has callback? */
+        if(pstSet->pfnCallback != orxNULL)
+        {
+          /* Calls it */
+          pstSet->pfnCallback(pstSet->zSet, pstSet->u32LoadCount, pstSet->u32TotalCount, pstSet->pContext);
+        }
+
+        /* Frees set */
+        orxBank_Free(sstResource.pstPrefetchSetBank, pstSet);
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't prefetch resource set <%s>: config section not found.", _zSet);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Releases a set of prefetched resources: their memory is freed and their locations will point again to their original types
+ * @param[in] _zSet             Name of the config section defining the set
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE, if any of those resources is still in use
+ */
+orxSTATUS orxFASTCALL orxResource_ReleasePrefetch(const orxSTRING _zSet)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zSet != orxNULL);
+
+  /* Valid set? */
+  if((*_zSet != orxCHAR_NULL) && (orxConfig_HasSection(_zSet) != orxFALSE))
+  {
+    orxU32 i, u32KeyCount;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+
+    /* Pushes set section */
+    orxConfig_PushSection(_zSet);
+
+    /* For all groups */
+    for(i = 0, u32KeyCount = orxConfig_GetKeyCount(); i < u32KeyCount; i++)
+    {
+      const orxSTRING zGroup;
+      orxS32          j, s32Count;
+
+      /* Gets it */
+      zGroup = orxString_Store(orxConfig_GetKey(i));
+
+      /* For all its resources */
+      for(j = 0, s32Count = orxConfig_GetListCount(zGroup); j < s32Count; j++)
+      {
+        const orxSTRING zName;
+
+        /* Gets its name */
+        zName = orxString_Store(orxConfig_GetListString(zGroup, j));
+
+        /* Located? */
+        if(orxResource_Locate(zGroup, zName) != orxNULL)
+        {
+          orxRESOURCE_GROUP  *pstGroup;
+          orxRESOURCE_INFO   *pstResourceInfo;
+
+          /* Gets its group & cached info */
+          pstGroup        = orxResource_FindGroup(orxString_GetID(zGroup));
+          pstResourceInfo = (orxRESOURCE_INFO *)orxHashTable_Get(pstGroup->pstCacheTable, orxString_GetID(zName));
+
+          /* Checks */
+          orxASSERT(pstResourceInfo != orxNULL);
+
+          /* In memory? */
+          if(orxString_Compare(pstResourceInfo->pstTypeInfo->zTag, orxRESOURCE_KZ_TYPE_TAG_MEMORY) == 0)
+          {
+            orxRESOURCE_PREFETCH_DATA  *pstData;
+            const orxSTRING             zStorage;
+            orxSTRINGID                 stMemoryID;
+
+            /* Gets its memory ID */
+            zStorage    = orxString_GetFromID(pstResourceInfo->stStorageID);
+            stMemoryID  = orxResource_GetMemoryID(zGroup, zStorage, zName);
+
+            /* Gets its prefetch data */
+            pstData = (orxRESOURCE_PREFETCH_DATA *)orxHashTable_Get(sstResource.pstPrefetchTable, stMemoryID);
+
+            /* Was prefetched? */
+            if(pstData != orxNULL)
+            {
+              /* Unsets memory resource */
+              if(orxResource_SetMemoryResource(zGroup, zStorage, zName, 0, orxNULL) != orxSTATUS_FAILURE)
+              {
+                /* Removes & deletes its data */
+                orxHashTable_Remove(sstResource.pstPrefetchTable, stMemoryID);
+                orxResource_DeletePrefetchData(pstData);
+
+                /* Points it back to its original location */
+                orxResource_Relocate(pstGroup, pstResourceInfo, orxNULL);
+              }
+              else
+              {
+                /* Logs message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "[%s]: Couldn't release prefetched resource <%s> from group <%s>: still in use.", _zSet, zName, zGroup);
+
+                /* Updates result */
+                eResult = orxSTATUS_FAILURE;
+              }
+            }
+          }
+        }
+      }
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Done! */
+  return eResult;
+}
@@ -90,6 +90,8 @@
  */
 #define orxTHREAD_KU32_TASK_LIST_SIZE                 1024
 #define orxTHREAD_KU32_MAX_WORKER_NUMBER              (orxTHREAD_KU32_MAX_THREAD_NUMBER >> 1)
+#define orxTHREAD_KU32_JOB_SLOT_NUMBER                (orxTHREAD_KU32_MAX_WORKER_NUMBER + 1)
+#define orxTHREAD_KU32_JOB_CHUNK_PER_SLOT             4
 
 #define orxTHREAD_KZ_THREAD_NAME_MAIN                 "Main"
 #define orxTHREAD_KZ_THREAD_NAME_WORKER               "Task Runner"
@@ -149,6 +151,31 @@ typedef struct __orxTHREAD_WORKER_t
 
 } orxTHREAD_WORKER;
 
+/** Job slot: range of items [begin, end) owned by a participant, packed as (end << 32) | begin
+ */
+typedef struct __orxTHREAD_JOB_SLOT_t
+{
+  volatile orxU64         u64Range;
+  orxU64                  au64Padding[7];
+
+} orxTHREAD_JOB_SLOT;
+
+/** Parallel job
+ */
+typedef struct __orxTHREAD_JOB_t
+{
+  orxTHREAD_FOR_FUNCTION  pfnRun;
+  void                   *pContext;
+  orxU32                  u32Grain;
+  orxU32                  u32SlotCount;
+  volatile orxU32         u32DoneCount;
+  volatile orxU32         u32HelperCount;
+  volatile orxU32         u32Open;
+  volatile orxU32         u32Lock;
+  orxTHREAD_JOB_SLOT      astSlotList[orxTHREAD_KU32_JOB_SLOT_NUMBER];
+
+} orxTHREAD_JOB;
+
 /** Static structure
  */
 typedef struct __orxTHREAD_STATIC_t
@@ -162,6 +189,7 @@ typedef struct __orxTHREAD_STATIC_t
   orxU32                    u32CurrentWorkerID;
   volatile orxTHREAD_INFO   astThreadInfoList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
   volatile orxTHREAD_WORKER astWorkerList[orxTHREAD_KU32_MAX_WORKER_NUMBER];
+  orxTHREAD_JOB             stJob;
 
   orxU32                    u32Flags;
 
@@ -322,6 +350,132 @@ static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo,
   return;
 }
 
+static orxINLINE void orxThread_SetJobRange(orxU32 _u32Slot, orxU32 _u32Begin, orxU32 _u32End)
+{
+  orxU64 u64Range;
+
+  /* Stores range (only competing with failing steal attempts, as the slot is empty) */
+  do
+  {
+    u64Range = sstThread.stJob.astSlotList[_u32Slot].u64Range;
+  } while(orxMEMORY_ATOMIC_CAS64(&(sstThread.stJob.astSlotList[_u32Slot].u64Range), u64Range, ((orxU64)_u32End << 32) | _u32Begin) == orxFALSE);
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxBOOL orxThread_PopJobChunk(orxU32 _u32Slot, orxU32 *_pu32Begin, orxU32 *_pu32End)
+{
+  orxBOOL bResult = orxFALSE;
+
+  /* Until empty or successful */
+  for(;;)
+  {
+    orxU64 u64Range;
+    orxU32 u32Begin, u32End, u32Next;
+
+    /* Gets range */
+    u64Range  = sstThread.stJob.astSlotList[_u32Slot].u64Range;
+    u32Begin  = (orxU32)u64Range;
+    u32End    = (orxU32)(u64Range >> 32);
+
+    /* Empty? */
+    if(u32Begin >= u32End)
+    {
+      break;
+    }
+
+    /* Gets chunk end */
+    u32Next = (u32End - u32Begin > sstThread.stJob.u32Grain) ? u32Begin + sstThread.stJob.u32Grain : u32End;
+
+    /* Takes chunk from the front */
+    if(orxMEMORY_ATOMIC_CAS64(&(sstThread.stJob.astSlotList[_u32Slot].u64Range), u64Range, ((orxU64)u32End << 32) | u32Next) != orxFALSE)
+    {
+      /* Updates result */
+      *_pu32Begin = u32Begin;
+      *_pu32End   = u32Next;
+      bResult     = orxTRUE;
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static orxINLINE orxBOOL orxThread_StealJobChunk(orxU32 _u32Slot)
+{
+  orxU32  i;
+  orxBOOL bResult = orxFALSE;
+
+  /* For all other slots */
+  for(i = 1; (i < sstThread.stJob.u32SlotCount) && (bResult == orxFALSE); i++)
+  {
+    orxU32 u32Victim;
+
+    /* Gets victim */
+    u32Victim = (_u32Slot + i) % sstThread.stJob.u32SlotCount;
+
+    /* Until empty or successful */
+    for(;;)
+    {
+      orxU64 u64Range;
+      orxU32 u32Begin, u32End, u32Split;
+
+      /* Gets range */
+      u64Range  = sstThread.stJob.astSlotList[u32Victim].u64Range;
+      u32Begin  = (orxU32)u64Range;
+      u32End    = (orxU32)(u64Range >> 32);
+
+      /* Empty? */
+      if(u32Begin >= u32End)
+      {
+        break;
+      }
+
+      /* Gets split point: steals the back half, or everything if it's a single chunk */
+      u32Split = (u32End - u32Begin > sstThread.stJob.u32Grain) ? u32End - ((u32End - u32Begin) >> 1) : u32Begin;
+
+      /* Shrinks victim's range */
+      if(orxMEMORY_ATOMIC_CAS64(&(sstThread.stJob.astSlotList[u32Victim].u64Range), u64Range, ((orxU64)u32Split << 32) | u32Begin) != orxFALSE)
+      {
+        /* Stores stolen range */
+        orxThread_SetJobRange(_u32Slot, u32Split, u32End);
+
+        /* Updates result */
+        bResult = orxTRUE;
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static void orxFASTCALL orxThread_HelpJob(orxU32 _u32Slot)
+{
+  /* Until no work can be found */
+  do
+  {
+    orxU32 u32Begin, u32End;
+
+    /* While there are chunks in its slot */
+    while(orxThread_PopJobChunk(_u32Slot, &u32Begin, &u32End) != orxFALSE)
+    {
+      /* Runs it */
+      sstThread.stJob.pfnRun(u32Begin, u32End, sstThread.stJob.pContext);
+
+      /* Updates done count */
+      orxMEMORY_ATOMIC_ADD32(&(sstThread.stJob.u32DoneCount), u32End - u32Begin);
+    }
+  }
+  while(orxThread_StealJobChunk(_u32Slot) != orxFALSE);
+
+  /* Done! */
+  return;
+}
+
 static orxSTATUS orxFASTCALL orxThread_Work(void *_pContext)
 {
   orxU32    u32WorkerID;
@@ -333,6 +487,19 @@ static orxSTATUS orxFASTCALL orxThread_Work(void *_pContext)
   /* Waits for worker semaphore */
   orxThread_WaitSemaphore(sstThread.astWorkerList[u32WorkerID].pstWorkSemaphore);
 
+  /* Registers as job helper */
+  orxMEMORY_ATOMIC_INC32(&(sstThread.stJob.u32HelperCount));
+
+  /* Is a parallel job running? */
+  if(sstThread.stJob.u32Open != orxFALSE)
+  {
+    /* Helps with it */
+    orxThread_HelpJob(u32WorkerID + 1);
+  }
+
+  /* Unregisters as job helper */
+  orxMEMORY_ATOMIC_DEC32(&(sstThread.stJob.u32HelperCount));
+
   /* While there are pending requests */
   while(sstThread.astWorkerList[u32WorkerID].u32TaskProcessIndex != sstThread.astWorkerList[u32WorkerID].u32TaskInIndex)
   {
@@ -398,8 +565,35 @@ static orxSTATUS orxFASTCALL orxThread_RunTaskInternal(const orxTHREAD_FUNCTION
     }
     else
     {
+      orxU32 u32SelectedID, u32MinCount, i;
+
+      /* For all non-linear workers, starting after the last selected one */
+      for(i = 0, u32SelectedID = sstThread.u32CurrentWorkerID % (sstThread.u32WorkerCount - 1) + 1, u32MinCount = orxU32_UNDEFINED; i < sstThread.u32WorkerCount - 1; i++)
+      {
+        orxU32 u32ID, u32Count;
+
+        /* Gets its pending task count */
+        u32ID     = (sstThread.u32CurrentWorkerID + i) % (sstThread.u32WorkerCount - 1) + 1;
+        u32Count  = (sstThread.astWorkerList[u32ID].u32TaskInIndex - sstThread.astWorkerList[u32ID].u32TaskProcessIndex) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+
+        /* Less busy? */
+        if(u32Count < u32MinCount)
+        {
+          /* Selects it */
+          u32SelectedID = u32ID;
+          u32MinCount   = u32Count;
+
+          /* Idle? */
+          if(u32Count == 0)
+          {
+            /* Stops */
+            break;
+          }
+        }
+      }
+
       /* Updates current worker ID */
-      sstThread.u32CurrentWorkerID = sstThread.u32CurrentWorkerID % (sstThread.u32WorkerCount - 1) + 1;
+      sstThread.u32CurrentWorkerID = u32SelectedID;
 
       /* Gets worker */
       pstWorker = &(sstThread.astWorkerList[sstThread.u32CurrentWorkerID]);
@@ -1283,6 +1477,113 @@ orxSTATUS orxFASTCALL orxThread_RunTaskLinear(const orxTHREAD_FUNCTION _pfnRun,
   return eResult;
 }
 
+/** Runs a data-parallel job, splitting its items in chunks processed by all the workers as well as the calling thread, which blocks until all the items have been processed.
+ * Idle participants steal half of the remaining items of busy ones. Calls made from within a running parallel job are processed sequentially on the calling thread.
+ * @param[in]   _u32Count                             Number of items to process
+ * @param[in]   _u32Grain                             Max number of items processed in a single call to _pfnRun, 0 for automatic
+ * @param[in]   _pfnRun                               Function to run on each chunk, can be called concurrently from different threads
+ * @param[in]   _pContext                             Context that will be transmitted to the function when called
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxThread_ParallelFor(orxU32 _u32Count, orxU32 _u32Grain, const orxTHREAD_FOR_FUNCTION _pfnRun, void *_pContext)
+{
+  orxU32    u32SlotCount, u32Grain;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfnRun != orxNULL);
+
+  /* Gets slot count & grain */
+  u32SlotCount  = sstThread.u32WorkerCount + 1;
+  u32Grain      = (_u32Grain != 0) ? _u32Grain : orxMAX(_u32Count / (u32SlotCount * orxTHREAD_KU32_JOB_CHUNK_PER_SLOT), 1);
+
+  /* Worth splitting and no other job running? */
+  if((_u32Count > u32Grain)
+  && (orxMEMORY_ATOMIC_CAS32(&(sstThread.stJob.u32Lock), 0, 1) != orxFALSE))
+  {
+    orxU32 u32Slot, u32ThreadID, i;
+
+    /* Gets current thread */
+    u32ThreadID = orxThread_GetCurrent();
+
+    /* Gets its slot (0 unless it's a worker) */
+    for(i = 0, u32Slot = 0; i < sstThread.u32WorkerCount; i++)
+    {
+      /* Found? */
+      if(sstThread.astWorkerList[i].u32ThreadID == u32ThreadID)
+      {
+        /* Selects its slot */
+        u32Slot = i + 1;
+        break;
+      }
+    }
+
+    /* Inits job */
+    sstThread.stJob.pfnRun        = _pfnRun;
+    sstThread.stJob.pContext      = _pContext;
+    sstThread.stJob.u32Grain      = u32Grain;
+    sstThread.stJob.u32SlotCount  = u32SlotCount;
+    sstThread.stJob.u32DoneCount  = 0;
+
+    /* Splits items evenly amongst all slots */
+    for(i = 0; i < u32SlotCount; i++)
+    {
+      sstThread.stJob.astSlotList[i].u64Range = ((orxU64)(orxU32)(((orxU64)_u32Count * (i + 1)) / u32SlotCount) << 32) | (orxU32)(((orxU64)_u32Count * i) / u32SlotCount);
+    }
+
+    /* Opens job */
+    orxMEMORY_BARRIER();
+    sstThread.stJob.u32Open = orxTRUE;
+    orxMEMORY_BARRIER();
+
+    /* For all other workers */
+    for(i = 0; i < sstThread.u32WorkerCount; i++)
+    {
+      if(i + 1 != u32Slot)
+      {
+        /* Wakes it up */
+        orxThread_SignalSemaphore(sstThread.astWorkerList[i].pstWorkSemaphore);
+      }
+    }
+
+    /* Helps */
+    orxThread_HelpJob(u32Slot);
+
+    /* Waits for all chunks to be processed */
+    while(sstThread.stJob.u32DoneCount != _u32Count)
+    {
+      orxThread_Yield();
+    }
+
+    /* Closes job */
+    sstThread.stJob.u32Open = orxFALSE;
+    orxMEMORY_BARRIER();
+
+    /* Waits for all helpers to leave */
+    while(sstThread.stJob.u32HelperCount != 0)
+    {
+      orxThread_Yield();
+    }
+
+    /* Releases job */
+    orxMEMORY_BARRIER();
+    sstThread.stJob.u32Lock = 0;
+  }
+  else
+  {
+    /* Any item? */
+    if(_u32Count != 0)
+    {
+      /* Runs all of them on current thread */
+      _pfnRun(0, _u32Count, _pContext);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Gets number of pending asynchronous tasks awaiting full completion (might pump task notifications if called from main thread)
  * @return      Number of pending asynchronous tasks
  */
@@ -262,6 +262,154 @@ static orxINLINE orxSTATUS orxGraphic_SetDataInternal(orxGRAPHIC *_pstGraphic, o
   return eResult;
 }
 
+/** Processes config properties (pivot, flip, color, repeat, smoothing & blend mode) from the current config section
+ * @param[in]   _pstGraphic                   Concerned graphic
+ * @return      Status flags to set on the graphic
+ */
+static orxU32 orxFASTCALL orxGraphic_ProcessConfigProperties(orxGRAPHIC *_pstGraphic)
+{
+  const orxSTRING zFlipping;
+  orxVECTOR       vPivot;
+  orxU32          u32Flags = orxGRAPHIC_KU32_FLAG_NONE;
+
+  /* Gets pivot value */
+  if(orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_PIVOT, &vPivot) != orxNULL)
+  {
+    /* Updates it */
+    orxGraphic_SetPivot(_pstGraphic, &vPivot);
+  }
+  /* Has relative pivot point? */
+  else if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_PIVOT) != orxFALSE)
+  {
+    const orxSTRING zRelativePivot;
+
+    /* Gets it */
+    zRelativePivot = orxConfig_GetString(orxGRAPHIC_KZ_CONFIG_PIVOT);
+
+    /* Valid? */
+    if(*zRelativePivot != orxCHAR_NULL)
+    {
+      /* Applies it */
+      orxGraphic_SetRelativePivot(_pstGraphic, orxGraphic_GetAlignFlags(zRelativePivot));
+    }
+  }
+
+  /* Gets flipping value */
+  zFlipping = orxConfig_GetString(orxGRAPHIC_KZ_CONFIG_FLIP);
+
+  /* Valid? */
+  if(*zFlipping != orxCHAR_NULL)
+  {
+    /* X flipping? */
+    if(orxString_ICompare(zFlipping, orxGRAPHIC_KZ_X) == 0)
+    {
+      /* Updates flags */
+      u32Flags |= orxGRAPHIC_KU32_FLAG_FLIP_X;
+    }
+    /* Y flipping? */
+    else if(orxString_ICompare(zFlipping, orxGRAPHIC_KZ_Y) == 0)
+    {
+      /* Updates flags */
+      u32Flags |= orxGRAPHIC_KU32_FLAG_FLIP_Y;
+    }
+    /* Both flipping? */
+    else if(orxString_ICompare(zFlipping, orxGRAPHIC_KZ_BOTH) == 0)
+    {
+      /* Updates flags */
+      u32Flags |= orxGRAPHIC_KU32_FLAG_FLIP_X | orxGRAPHIC_KU32_FLAG_FLIP_Y;
+    }
+
+    /* Updates flags */
+    u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_FLIP;
+  }
+
+  /* Has color? */
+  if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_COLOR) != orxFALSE)
+  {
+    /* Gets it */
+    if(orxConfig_GetColorVector(orxGRAPHIC_KZ_CONFIG_COLOR, orxCOLORSPACE_COMPONENT, &(_pstGraphic->stColor.vRGB)) != orxNULL)
+    {
+      /* Normalizes it */
+      orxVector_Mulf(&(_pstGraphic->stColor.vRGB), &(_pstGraphic->stColor.vRGB), orxCOLOR_NORMALIZER);
+
+      /* Updates status */
+      u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_COLOR;
+    }
+  }
+  /* Has RGB values? */
+  else if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_RGB) != orxFALSE)
+  {
+    /* Gets its value */
+    orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_RGB, &(_pstGraphic->stColor.vRGB));
+
+    /* Updates status */
+    u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_COLOR;
+  }
+  /* Has HSL values? */
+  else if(orxConfig_HasValueNoCheck(orxGRAPHIC_KZ_CONFIG_HSL) != orxFALSE)
+  {
+    /* Gets its value */
+    orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_HSL, &(_pstGraphic->stColor.vHSL));
+
+    /* Stores its RGB equivalent */
+    orxColor_FromHSLToRGB(&(_pstGraphic->stColor), &(_pstGraphic->stColor));
+
+    /* Updates status */
+    u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_COLOR;
+  }
+  /* Has HSV values? */
+  else if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_HSV) != orxFALSE)
+  {
+    /* Gets its value */
+    orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_HSV, &(_pstGraphic->stColor.vHSV));
+
+    /* Stores its RGB equivalent */
+    orxColor_FromHSVToRGB(&(_pstGraphic->stColor), &(_pstGraphic->stColor));
+
+    /* Updates status */
+    u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_COLOR;
+  }
+
+  /* Has alpha? */
+  if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_ALPHA) != orxFALSE)
+  {
+    /* Applies it */
+    orxColor_SetAlpha(&(_pstGraphic->stColor), orxConfig_GetFloat(orxGRAPHIC_KZ_CONFIG_ALPHA));
+
+    /* Updates status */
+    u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_COLOR;
+  }
+
+  /* Should repeat? */
+  if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_REPEAT) != orxFALSE)
+  {
+    orxVECTOR vRepeat;
+
+    /* Gets its value */
+    orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_REPEAT, &vRepeat);
+
+    /* Stores it */
+    orxGraphic_SetRepeat(_pstGraphic, vRepeat.fX, vRepeat.fY);
+  }
+
+  /* Has smoothing value? */
+  if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_SMOOTHING) != orxFALSE)
+  {
+    /* Updates flags */
+    u32Flags |= (orxConfig_GetBool(orxGRAPHIC_KZ_CONFIG_SMOOTHING) != orxFALSE) ? orxGRAPHIC_KU32_FLAG_SMOOTHING_ON : orxGRAPHIC_KU32_FLAG_SMOOTHING_OFF;
+  }
+
+  /* Has blend mode? */
+  if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_BLEND_MODE) != orxFALSE)
+  {
+    /* Sets blend mode */
+    orxGraphic_SetBlendMode(_pstGraphic, orxDisplay_GetBlendModeFromString(orxConfig_GetString(orxGRAPHIC_KZ_CONFIG_BLEND_MODE)));
+  }
+
+  /* Done! */
+  return u32Flags;
+}
+
 /** Event handler
  * @param[in]   _pstEvent                     Sent event
  * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
@@ -383,6 +531,45 @@ static orxSTATUS orxFASTCALL orxGraphic_EventHandler(const orxEVENT *_pstEvent)
       }
     }
   }
+  /* Config */
+  else if(_pstEvent->eType == orxEVENT_TYPE_CONFIG)
+  {
+    orxCONFIG_EVENT_PAYLOAD *pstPayload;
+
+    /* Checks */
+    orxASSERT(_pstEvent->eID == orxCONFIG_EVENT_SECTION_UPDATE);
+
+    /* Gets its payload */
+    pstPayload = (orxCONFIG_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+
+    /* For all graphics */
+    for(pstGraphic = orxGRAPHIC(orxStructure_GetFirst(orxSTRUCTURE_ID_GRAPHIC));
+        pstGraphic != orxNULL;
+        pstGraphic = orxGRAPHIC(orxStructure_GetNext(pstGraphic)))
+    {
+      /* Has reference and is its section or one of its ancestors updated? */
+      if((pstGraphic->zReference != orxNULL)
+      && (pstGraphic->zReference != orxSTRING_EMPTY)
+      && (orxConfig_IsSectionAffected(pstGraphic->zReference, pstPayload->zSectionName) != orxFALSE))
+      {
+        /* Pushes its section */
+        orxConfig_PushSection(pstGraphic->zReference);
+
+        /* Resets its properties (data, origin & size are kept) */
+        orxGraphic_SetPivot(pstGraphic, orxNULL);
+        orxGraphic_ClearColor(pstGraphic);
+        orxGraphic_ClearBlendMode(pstGraphic);
+        orxGraphic_SetRepeat(pstGraphic, orxFLOAT_1, orxFLOAT_1);
+        orxStructure_SetFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_NONE, orxGRAPHIC_KU32_MASK_FLIP_BOTH | orxGRAPHIC_KU32_FLAG_HAS_FLIP | orxGRAPHIC_KU32_FLAG_SMOOTHING_ON | orxGRAPHIC_KU32_FLAG_SMOOTHING_OFF);
+
+        /* Re-processes them */
+        orxStructure_SetFlags(pstGraphic, orxGraphic_ProcessConfigProperties(pstGraphic), orxGRAPHIC_KU32_FLAG_NONE);
+
+        /* Pops section */
+        orxConfig_PopSection();
+      }
+    }
+  }
   /* Object */
   else
   {
@@ -479,6 +666,7 @@ orxSTATUS orxFASTCALL orxGraphic_Init()
     /* Registers event handler */
     eResult = orxEvent_AddHandler(orxEVENT_TYPE_LOCALE, orxGraphic_EventHandler);
     eResult = (eResult != orxSTATUS_FAILURE) ? orxEvent_AddHandler(orxEVENT_TYPE_OBJECT, orxGraphic_EventHandler) : orxSTATUS_FAILURE;
+    eResult = (eResult != orxSTATUS_FAILURE) ? orxEvent_AddHandler(orxEVENT_TYPE_CONFIG, orxGraphic_EventHandler) : orxSTATUS_FAILURE;
 
     /* Valid? */
     if(eResult != orxSTATUS_FAILURE)
@@ -486,6 +674,7 @@ orxSTATUS orxFASTCALL orxGraphic_Init()
       /* Filters relevant event IDs */
       orxEvent_SetHandlerIDFlags(orxGraphic_EventHandler, orxEVENT_TYPE_LOCALE, orxNULL, orxEVENT_GET_FLAG(orxLOCALE_EVENT_SELECT_LANGUAGE), orxEVENT_KU32_MASK_ID_ALL);
       orxEvent_SetHandlerIDFlags(orxGraphic_EventHandler, orxEVENT_TYPE_OBJECT, orxNULL, orxEVENT_GET_FLAG(orxOBJECT_EVENT_ENABLE) | orxEVENT_GET_FLAG(orxOBJECT_EVENT_DISABLE), orxEVENT_KU32_MASK_ID_ALL);
+      orxEvent_SetHandlerIDFlags(orxGraphic_EventHandler, orxEVENT_TYPE_CONFIG, orxNULL, orxEVENT_GET_FLAG(orxCONFIG_EVENT_SECTION_UPDATE), orxEVENT_KU32_MASK_ID_ALL);
 
       /* Registers structure type */
       eResult = orxSTRUCTURE_REGISTER(GRAPHIC, orxSTRUCTURE_STORAGE_TYPE_LINKLIST, orxMEMORY_TYPE_MAIN, orxGRAPHIC_KU32_BANK_SIZE, orxNULL);
@@ -501,12 +690,14 @@ orxSTATUS orxFASTCALL orxGraphic_Init()
         /* Removes event handler */
         orxEvent_RemoveHandler(orxEVENT_TYPE_LOCALE, orxGraphic_EventHandler);
         orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, orxGraphic_EventHandler);
+        orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, orxGraphic_EventHandler);
       }
     }
     else
     {
       /* Removes event handler */
       orxEvent_RemoveHandler(orxEVENT_TYPE_LOCALE, orxGraphic_EventHandler);
+      orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, orxGraphic_EventHandler);
     }
   }
   else
@@ -545,6 +736,7 @@ void orxFASTCALL orxGraphic_Exit()
     /* Removes event handler */
     orxEvent_RemoveHandler(orxEVENT_TYPE_LOCALE, orxGraphic_EventHandler);
     orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, orxGraphic_EventHandler);
+    orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, orxGraphic_EventHandler);
 
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_GRAPHIC);
@@ -961,142 +1153,8 @@ orxGRAPHIC *orxFASTCALL orxGraphic_CreateFromConfig(const orxSTRING _zConfigID)
       /* Has data? */
       if(pstResult->pstData != orxNULL)
       {
-        const orxSTRING zFlipping;
-        orxVECTOR       vPivot;
-
-        /* Gets pivot value */
-        if(orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_PIVOT, &vPivot) != orxNULL)
-        {
-          /* Updates it */
-          orxGraphic_SetPivot(pstResult, &vPivot);
-        }
-        /* Has relative pivot point? */
-        else if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_PIVOT) != orxFALSE)
-        {
-          const orxSTRING zRelativePivot;
-
-          /* Gets it */
-          zRelativePivot = orxConfig_GetString(orxGRAPHIC_KZ_CONFIG_PIVOT);
-
-          /* Valid? */
-          if(*zRelativePivot != orxCHAR_NULL)
-          {
-            /* Applies it */
-            orxGraphic_SetRelativePivot(pstResult, orxGraphic_GetAlignFlags(zRelativePivot));
-          }
-        }
-
-        /* Gets flipping value */
-        zFlipping = orxConfig_GetString(orxGRAPHIC_KZ_CONFIG_FLIP);
-
-        /* Valid? */
-        if(*zFlipping != orxCHAR_NULL)
-        {
-          /* X flipping? */
-          if(orxString_ICompare(zFlipping, orxGRAPHIC_KZ_X) == 0)
-          {
-            /* Updates flags */
-            u32Flags |= orxGRAPHIC_KU32_FLAG_FLIP_X;
-          }
-          /* Y flipping? */
-          else if(orxString_ICompare(zFlipping, orxGRAPHIC_KZ_Y) == 0)
-          {
-            /* Updates flags */
-            u32Flags |= orxGRAPHIC_KU32_FLAG_FLIP_Y;
-          }
-          /* Both flipping? */
-          else if(orxString_ICompare(zFlipping, orxGRAPHIC_KZ_BOTH) == 0)
-          {
-            /* Updates flags */
-            u32Flags |= orxGRAPHIC_KU32_FLAG_FLIP_X | orxGRAPHIC_KU32_FLAG_FLIP_Y;
-          }
-
-          /* Updates flags */
-          u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_FLIP;
-        }
-
-        /* Has color? */
-        if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_COLOR) != orxFALSE)
-        {
-          /* Gets it */
-          if(orxConfig_GetColorVector(orxGRAPHIC_KZ_CONFIG_COLOR, orxCOLORSPACE_COMPONENT, &(pstResult->stColor.vRGB)) != orxNULL)
-          {
-            /* Normalizes it */
-            orxVector_Mulf(&(pstResult->stColor.vRGB), &(pstResult->stColor.vRGB), orxCOLOR_NORMALIZER);
-
-            /* Updates status */
-            u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_COLOR;
-          }
-        }
-        /* Has RGB values? */
-        else if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_RGB) != orxFALSE)
-        {
-          /* Gets its value */
-          orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_RGB, &(pstResult->stColor.vRGB));
-
-          /* Updates status */
-          u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_COLOR;
-        }
-        /* Has HSL values? */
-        else if(orxConfig_HasValueNoCheck(orxGRAPHIC_KZ_CONFIG_HSL) != orxFALSE)
-        {
-          /* Gets its value */
-          orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_HSL, &(pstResult->stColor.vHSL));
-
-          /* Stores its RGB equivalent */
-          orxColor_FromHSLToRGB(&(pstResult->stColor), &(pstResult->stColor));
-
-          /* Updates status */
-          u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_COLOR;
-        }
-        /* Has HSV values? */
-        else if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_HSV) != orxFALSE)
-        {
-          /* Gets its value */
-          orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_HSV, &(pstResult->stColor.vHSV));
-
-          /* Stores its RGB equivalent */
-          orxColor_FromHSVToRGB(&(pstResult->stColor), &(pstResult->stColor));
-
-          /* Updates status */
-          u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_COLOR;
-        }
-
-        /* Has alpha? */
-        if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_ALPHA) != orxFALSE)
-        {
-          /* Applies it */
-          orxColor_SetAlpha(&(pstResult->stColor), orxConfig_GetFloat(orxGRAPHIC_KZ_CONFIG_ALPHA));
-
-          /* Updates status */
-          u32Flags |= orxGRAPHIC_KU32_FLAG_HAS_COLOR;
-        }
-
-        /* Should repeat? */
-        if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_REPEAT) != orxFALSE)
-        {
-          orxVECTOR vRepeat;
-
-          /* Gets its value */
-          orxConfig_GetVector(orxGRAPHIC_KZ_CONFIG_REPEAT, &vRepeat);
-
-          /* Stores it */
-          orxGraphic_SetRepeat(pstResult, vRepeat.fX, vRepeat.fY);
-        }
-
-        /* Has smoothing value? */
-        if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_SMOOTHING) != orxFALSE)
-        {
-          /* Updates flags */
-          u32Flags |= (orxConfig_GetBool(orxGRAPHIC_KZ_CONFIG_SMOOTHING) != orxFALSE) ? orxGRAPHIC_KU32_FLAG_SMOOTHING_ON : orxGRAPHIC_KU32_FLAG_SMOOTHING_OFF;
-        }
-
-        /* Has blend mode? */
-        if(orxConfig_HasValue(orxGRAPHIC_KZ_CONFIG_BLEND_MODE) != orxFALSE)
-        {
-          /* Sets blend mode */
-          orxGraphic_SetBlendMode(pstResult, orxDisplay_GetBlendModeFromString(orxConfig_GetString(orxGRAPHIC_KZ_CONFIG_BLEND_MODE)));
-        }
+        /* Processes its properties */
+        u32Flags |= orxGraphic_ProcessConfigProperties(pstResult);
 
         /* Stores its reference key */
         pstResult->zReference = orxConfig_GetCurrentSection();
@@ -1503,6 +1561,9 @@ orxSTATUS orxFASTCALL orxGraphic_SetPivot(orxGRAPHIC *_pstGraphic, const orxVECT
     orxStructure_SetFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_NONE, orxGRAPHIC_KU32_FLAG_HAS_PIVOT | orxGRAPHIC_KU32_FLAG_RELATIVE_PIVOT);
   }
 
+  /* Notifies objects */
+  orxObject_NotifyGraphicChange(_pstGraphic);
+
   /* Done! */
   return eResult;
 }
@@ -1557,6 +1618,9 @@ orxSTATUS orxFASTCALL orxGraphic_SetRelativePivot(orxGRAPHIC *_pstGraphic, orxU3
     /* Updates status */
     orxStructure_SetFlags(_pstGraphic, _u32AlignFlags | orxGRAPHIC_KU32_FLAG_HAS_PIVOT | orxGRAPHIC_KU32_FLAG_RELATIVE_PIVOT, orxGRAPHIC_KU32_MASK_ALIGN);
 
+    /* Notifies objects */
+    orxObject_NotifyGraphicChange(_pstGraphic);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -1650,6 +1714,9 @@ orxSTATUS orxFASTCALL orxGraphic_SetSize(orxGRAPHIC *_pstGraphic, const orxVECTO
     _pstGraphic->fHeight  = _pvSize->fY;
   }
 
+  /* Notifies objects */
+  orxObject_NotifyGraphicChange(_pstGraphic);
+
   /* Done! */
   return eResult;
 }
@@ -1930,12 +1997,20 @@ orxSTATUS orxFASTCALL orxGraphic_UpdateSize(orxGRAPHIC *_pstGraphic)
     eResult = orxSTATUS_FAILURE;
   }
 
-  /* Valid and has a relative pivot? */
-  if((eResult != orxSTATUS_FAILURE)
-  && (orxStructure_TestFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_RELATIVE_PIVOT)))
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
   {
-    /* Updates relative pivot */
-    orxGraphic_SetRelativePivot(_pstGraphic, orxStructure_GetFlags(_pstGraphic, orxGRAPHIC_KU32_MASK_ALIGN));
+    /* Has a relative pivot? */
+    if(orxStructure_TestFlags(_pstGraphic, orxGRAPHIC_KU32_FLAG_RELATIVE_PIVOT))
+    {
+      /* Updates relative pivot (notifies objects) */
+      orxGraphic_SetRelativePivot(_pstGraphic, orxStructure_GetFlags(_pstGraphic, orxGRAPHIC_KU32_MASK_ALIGN));
+    }
+    else
+    {
+      /* Notifies objects */
+      orxObject_NotifyGraphicChange(_pstGraphic);
+    }
   }
 
   /* Done! */
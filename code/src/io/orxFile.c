@@ -45,6 +45,7 @@
   #include <windows.h>
   #undef WIN32_LEAN_AND_MEAN
   #include <Shlobj.h>
+  #include <io.h>
 
   #ifdef __orxMSVC__
 
@@ -76,6 +77,14 @@
   #include <stdio.h>
   #include <pwd.h>
 
+  #if defined(__orxLINUX__) || defined(__orxMAC__) || defined(__orxIOS__) || defined(__orxANDROID__)
+
+    #include <sys/mman.h>
+
+    #define orxFILE_KB_MAP_SUPPORT
+
+  #endif
+
 #endif /* __orxWINDOWS__ */
 
 
@@ -1227,6 +1236,92 @@ orxS64 orxFASTCALL orxFile_GetTime(const orxFILE *_pstFile)
   return s64Result;
 }
 
+/** Maps the full content of an opened file in memory, read-only
+ * @param[in] _pstFile              Concerned file
+ * @param[in] _s64Size              Size of the file, in bytes
+ * @return Pointer to the mapped content if supported & successful, orxNULL otherwise
+ */
+const void *orxFASTCALL orxFile_Map(orxFILE *_pstFile, orxS64 _s64Size)
+{
+  const void *pResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Valid? */
+  if((_pstFile != orxNULL) && (_s64Size > 0))
+  {
+    /* Flushes any pending write */
+    fflush((FILE *)_pstFile);
+
+#if defined(__orxWINDOWS__)
+
+    {
+      HANDLE hMapping;
+
+      /* Creates mapping */
+      hMapping = CreateFileMapping((HANDLE)_get_osfhandle(_fileno((FILE *)_pstFile)), NULL, PAGE_READONLY, 0, 0, NULL);
+
+      /* Success? */
+      if(hMapping != NULL)
+      {
+        /* Maps the whole file */
+        pResult = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, (SIZE_T)_s64Size);
+
+        /* Closes mapping (the view keeps it alive) */
+        CloseHandle(hMapping);
+      }
+    }
+
+#elif defined(orxFILE_KB_MAP_SUPPORT)
+
+    {
+      void *pMap;
+
+      /* Maps the whole file */
+      pMap = mmap(NULL, (size_t)_s64Size, PROT_READ, MAP_PRIVATE, fileno((FILE *)_pstFile), 0);
+
+      /* Success? */
+      if(pMap != MAP_FAILED)
+      {
+        /* Updates result */
+        pResult = pMap;
+      }
+    }
+
+#endif
+  }
+
+  /* Done! */
+  return pResult;
+}
+
+/** Unmaps a file content previously mapped with orxFile_Map
+ * @param[in] _pMap                 Mapped content
+ * @param[in] _s64Size              Size of the mapped content, in bytes
+ */
+void orxFASTCALL orxFile_Unmap(const void *_pMap, orxS64 _s64Size)
+{
+  /* Checks */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pMap != orxNULL);
+
+#if defined(__orxWINDOWS__)
+
+  /* Unmaps it */
+  UnmapViewOfFile(_pMap);
+
+#elif defined(orxFILE_KB_MAP_SUPPORT)
+
+  /* Unmaps it */
+  munmap((void *)_pMap, (size_t)_s64Size);
+
+#endif
+
+  /* Done! */
+  return;
+}
+
 /** Prints a formatted string to a file
  * @param[in] _pstFile             Pointer to the file descriptor
  * @param[in] _zString             Formatted string
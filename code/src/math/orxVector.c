@@ -31,9 +31,21 @@
 
 
 #include "math/orxVector.h"
+#include "math/orxOBox.h"
+#include "math/orxAABox.h"
 
 #include "display/orxDisplay.h"
 
+#if defined(__orxSSE2__)
+
+  #include <emmintrin.h>
+
+#elif defined(__orxNEON__)
+
+  #include <arm_neon.h>
+
+#endif /* __orxNEON__ */
+
 
 /* *** Vector functions *** */
 
@@ -119,6 +131,544 @@ orxVECTOR *orxFASTCALL orxVector_CatmullRom(orxVECTOR *_pvRes, const orxVECTOR *
 }
 
 
+/* *** Batch helpers *** */
+
+#if defined(__orxSSE2__)
+
+  typedef __m128                              orxVECTOR_F4;
+  typedef __m128                              orxVECTOR_M4;
+
+  #define orxVector_F4Set(A, B, C, D)         _mm_setr_ps(A, B, C, D)
+  #define orxVector_F4Splat(A)                _mm_set1_ps(A)
+  #define orxVector_F4Add(A, B)               _mm_add_ps(A, B)
+  #define orxVector_F4Sub(A, B)               _mm_sub_ps(A, B)
+  #define orxVector_F4Mul(A, B)               _mm_mul_ps(A, B)
+  #define orxVector_F4Min(A, B)               _mm_min_ps(A, B)
+  #define orxVector_F4Max(A, B)               _mm_max_ps(A, B)
+  #define orxVector_F4Store(P, A)             _mm_storeu_ps(P, A)
+  #define orxVector_F4GE(A, B)                _mm_cmpge_ps(A, B)
+  #define orxVector_F4LE(A, B)                _mm_cmple_ps(A, B)
+  #define orxVector_F4GT(A, B)                _mm_cmpgt_ps(A, B)
+  #define orxVector_M4And(A, B)               _mm_and_ps(A, B)
+  #define orxVector_M4GetBits(A)              ((orxU32)_mm_movemask_ps(A))
+
+  #define orxVECTOR_KU32_BATCH_WIDTH          4
+
+#elif defined(__orxNEON__)
+
+  typedef float32x4_t                         orxVECTOR_F4;
+  typedef uint32x4_t                          orxVECTOR_M4;
+
+  #define orxVector_F4Splat(A)                vdupq_n_f32(A)
+  #define orxVector_F4Add(A, B)               vaddq_f32(A, B)
+  #define orxVector_F4Sub(A, B)               vsubq_f32(A, B)
+  #define orxVector_F4Mul(A, B)               vmulq_f32(A, B)
+  #define orxVector_F4Min(A, B)               vminq_f32(A, B)
+  #define orxVector_F4Max(A, B)               vmaxq_f32(A, B)
+  #define orxVector_F4Store(P, A)             vst1q_f32(P, A)
+  #define orxVector_F4GE(A, B)                vcgeq_f32(A, B)
+  #define orxVector_F4LE(A, B)                vcleq_f32(A, B)
+  #define orxVector_F4GT(A, B)                vcgtq_f32(A, B)
+  #define orxVector_M4And(A, B)               vandq_u32(A, B)
+
+  #define orxVECTOR_KU32_BATCH_WIDTH          4
+
+static orxINLINE orxVECTOR_F4 orxVector_F4Set(orxFLOAT _fA, orxFLOAT _fB, orxFLOAT _fC, orxFLOAT _fD)
+{
+  orxFLOAT afValue[4];
+
+  /* Gathers values */
+  afValue[0] = _fA;
+  afValue[1] = _fB;
+  afValue[2] = _fC;
+  afValue[3] = _fD;
+
+  /* Done! */
+  return vld1q_f32(afValue);
+}
+
+static orxINLINE orxU32 orxVector_M4GetBits(orxVECTOR_M4 _m4Mask)
+{
+  /* Done! */
+  return (vgetq_lane_u32(_m4Mask, 0) & 1) | (vgetq_lane_u32(_m4Mask, 1) & 2) | (vgetq_lane_u32(_m4Mask, 2) & 4) | (vgetq_lane_u32(_m4Mask, 3) & 8);
+}
+
+#endif /* __orxNEON__ */
+
+#ifdef orxVECTOR_KU32_BATCH_WIDTH
+
+/** Tests 4 pairs of 2D boxes for overlap along one of the first box axes (same operations as orxOBox_ZAlignedTestIntersection)
+ * @param[in]   _f4DX / _f4DY               Second box origin, relative to the first one
+ * @param[in]   _f4E1X / _f4E1Y             Second box first edge
+ * @param[in]   _f4E2X / _f4E2Y             Second box second edge
+ * @param[in]   _f4AX / _f4AY               First box axis
+ * @param[in]   _f4ASize                    First box axis square size
+ * @return      Overlap mask
+ */
+static orxINLINE orxVECTOR_M4 orxVector_F4TestAxis(orxVECTOR_F4 _f4DX, orxVECTOR_F4 _f4DY, orxVECTOR_F4 _f4E1X, orxVECTOR_F4 _f4E1Y, orxVECTOR_F4 _f4E2X, orxVECTOR_F4 _f4E2Y, orxVECTOR_F4 _f4AX, orxVECTOR_F4 _f4AY, orxVECTOR_F4 _f4ASize)
+{
+  orxVECTOR_F4 f4C1X, f4C1Y, f4C2X, f4C2Y, f4C3X, f4C3Y, f4P0, f4P1, f4P2, f4P3, f4Min, f4Max;
+
+  /* Gets to-corner vectors */
+  f4C1X = orxVector_F4Add(_f4DX, _f4E1X);
+  f4C1Y = orxVector_F4Add(_f4DY, _f4E1Y);
+  f4C2X = orxVector_F4Add(f4C1X, _f4E2X);
+  f4C2Y = orxVector_F4Add(f4C1Y, _f4E2Y);
+  f4C3X = orxVector_F4Add(_f4DX, _f4E2X);
+  f4C3Y = orxVector_F4Add(_f4DY, _f4E2Y);
+
+  /* Projects them */
+  f4P0  = orxVector_F4Add(orxVector_F4Mul(_f4DX, _f4AX), orxVector_F4Mul(_f4DY, _f4AY));
+  f4P1  = orxVector_F4Add(orxVector_F4Mul(f4C1X, _f4AX), orxVector_F4Mul(f4C1Y, _f4AY));
+  f4P2  = orxVector_F4Add(orxVector_F4Mul(f4C2X, _f4AX), orxVector_F4Mul(f4C2Y, _f4AY));
+  f4P3  = orxVector_F4Add(orxVector_F4Mul(f4C3X, _f4AX), orxVector_F4Mul(f4C3Y, _f4AY));
+
+  /* Gets extrema */
+  f4Min = orxVector_F4Min(orxVector_F4Min(f4P0, f4P1), orxVector_F4Min(f4P2, f4P3));
+  f4Max = orxVector_F4Max(orxVector_F4Max(f4P0, f4P1), orxVector_F4Max(f4P2, f4P3));
+
+  /* Done! */
+  return orxVector_M4And(orxVector_F4GE(f4Max, orxVector_F4Splat(orxFLOAT_0)), orxVector_F4LE(f4Min, _f4ASize));
+}
+
+/** Stores 4 test results
+ * @param[out]  _abResult                   Results
+ * @param[in]   _u32Bits                    Result bits
+ * @return      Number of positive results
+ */
+static orxINLINE orxU32 orxVector_StoreResults(orxBOOL *_abResult, orxU32 _u32Bits)
+{
+  orxU32 i, u32Result = 0;
+
+  /* For all lanes */
+  for(i = 0; i < 4; i++)
+  {
+    /* Positive? */
+    if(_u32Bits & (1 << i))
+    {
+      /* Stores it */
+      _abResult[i] = orxTRUE;
+      u32Result++;
+    }
+    else
+    {
+      /* Stores it */
+      _abResult[i] = orxFALSE;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Transforms full batches of vectors
+ * @return      Number of transformed vectors
+ */
+static orxINLINE orxU32 orxVector_2DTransformBatch(orxVECTOR *_avRes, const orxVECTOR *_avOp, orxU32 _u32Count, const orxVECTOR *_pvScale, orxFLOAT _fCos, orxFLOAT _fSin, const orxVECTOR *_pvTranslation)
+{
+  orxVECTOR_F4 f4ScaleX, f4ScaleY, f4ScaleZ, f4Cos, f4Sin, f4TX, f4TY, f4TZ;
+  orxU32       i;
+
+  /* Splats constants */
+  f4ScaleX  = orxVector_F4Splat(_pvScale->fX);
+  f4ScaleY  = orxVector_F4Splat(_pvScale->fY);
+  f4ScaleZ  = orxVector_F4Splat(_pvScale->fZ);
+  f4Cos     = orxVector_F4Splat(_fCos);
+  f4Sin     = orxVector_F4Splat(_fSin);
+  f4TX      = orxVector_F4Splat(_pvTranslation->fX);
+  f4TY      = orxVector_F4Splat(_pvTranslation->fY);
+  f4TZ      = orxVector_F4Splat(_pvTranslation->fZ);
+
+  /* For all full batches */
+  for(i = 0; i + orxVECTOR_KU32_BATCH_WIDTH <= _u32Count; i += orxVECTOR_KU32_BATCH_WIDTH)
+  {
+    orxVECTOR_F4  f4X, f4Y, f4Z;
+
+#ifdef __orxNEON__
+
+    float32x4x3_t stLanes;
+
+    /* Loads & deinterleaves vectors */
+    stLanes = vld3q_f32((const float *)&(_avOp[i]));
+    f4X     = orxVector_F4Mul(stLanes.val[0], f4ScaleX);
+    f4Y     = orxVector_F4Mul(stLanes.val[1], f4ScaleY);
+    f4Z     = orxVector_F4Mul(stLanes.val[2], f4ScaleZ);
+
+    /* Rotates & translates them */
+    stLanes.val[0] = orxVector_F4Add(orxVector_F4Sub(orxVector_F4Mul(f4Cos, f4X), orxVector_F4Mul(f4Sin, f4Y)), f4TX);
+    stLanes.val[1] = orxVector_F4Add(orxVector_F4Add(orxVector_F4Mul(f4Sin, f4X), orxVector_F4Mul(f4Cos, f4Y)), f4TY);
+    stLanes.val[2] = orxVector_F4Add(f4Z, f4TZ);
+
+    /* Interleaves & stores them */
+    vst3q_f32((float *)&(_avRes[i]), stLanes);
+
+#else /* __orxNEON__ */
+
+    orxFLOAT      afX[4], afY[4], afZ[4];
+    orxU32        j;
+
+    /* Gathers & scales vectors */
+    f4X = orxVector_F4Mul(orxVector_F4Set(_avOp[i].fX, _avOp[i + 1].fX, _avOp[i + 2].fX, _avOp[i + 3].fX), f4ScaleX);
+    f4Y = orxVector_F4Mul(orxVector_F4Set(_avOp[i].fY, _avOp[i + 1].fY, _avOp[i + 2].fY, _avOp[i + 3].fY), f4ScaleY);
+    f4Z = orxVector_F4Mul(orxVector_F4Set(_avOp[i].fZ, _avOp[i + 1].fZ, _avOp[i + 2].fZ, _avOp[i + 3].fZ), f4ScaleZ);
+
+    /* Rotates & translates them */
+    orxVector_F4Store(afX, orxVector_F4Add(orxVector_F4Sub(orxVector_F4Mul(f4Cos, f4X), orxVector_F4Mul(f4Sin, f4Y)), f4TX));
+    orxVector_F4Store(afY, orxVector_F4Add(orxVector_F4Add(orxVector_F4Mul(f4Sin, f4X), orxVector_F4Mul(f4Cos, f4Y)), f4TY));
+    orxVector_F4Store(afZ, orxVector_F4Add(f4Z, f4TZ));
+
+    /* Scatters them */
+    for(j = 0; j < 4; j++)
+    {
+      orxVector_Set(&(_avRes[i + j]), afX[j], afY[j], afZ[j]);
+    }
+
+#endif /* __orxNEON__ */
+  }
+
+  /* Done! */
+  return i;
+}
+
+/** Tests a position against full batches of 2D oriented boxes
+ * @param[out]  _pu32Result                 Number of boxes containing the position
+ * @return      Number of tested boxes
+ */
+static orxINLINE orxU32 orxOBox_2DIsInsideBatch(const orxOBOX *_astBoxList, orxU32 _u32Count, const orxVECTOR *_pvPosition, orxBOOL *_abResult, orxU32 *_pu32Result)
+{
+  orxVECTOR_F4 f4PX, f4PY, f4PZ, f4Zero;
+  orxU32       i;
+
+  /* Splats constants */
+  f4PX    = orxVector_F4Splat(_pvPosition->fX);
+  f4PY    = orxVector_F4Splat(_pvPosition->fY);
+  f4PZ    = orxVector_F4Splat(_pvPosition->fZ);
+  f4Zero  = orxVector_F4Splat(orxFLOAT_0);
+
+  /* For all full batches */
+  for(i = 0; i + orxVECTOR_KU32_BATCH_WIDTH <= _u32Count; i += orxVECTOR_KU32_BATCH_WIDTH)
+  {
+    const orxOBOX  *pstBox = &(_astBoxList[i]);
+    orxVECTOR_F4    f4TX, f4TY, f4TZ, f4AX, f4AY, f4AZ, f4Proj, f4Size;
+    orxVECTOR_M4    m4Inside;
+
+    /* Gets origin to position vectors */
+    f4TX      = orxVector_F4Sub(f4PX, orxVector_F4Set(pstBox[0].vPosition.fX - pstBox[0].vPivot.fX, pstBox[1].vPosition.fX - pstBox[1].vPivot.fX, pstBox[2].vPosition.fX - pstBox[2].vPivot.fX, pstBox[3].vPosition.fX - pstBox[3].vPivot.fX));
+    f4TY      = orxVector_F4Sub(f4PY, orxVector_F4Set(pstBox[0].vPosition.fY - pstBox[0].vPivot.fY, pstBox[1].vPosition.fY - pstBox[1].vPivot.fY, pstBox[2].vPosition.fY - pstBox[2].vPivot.fY, pstBox[3].vPosition.fY - pstBox[3].vPivot.fY));
+    f4TZ      = orxVector_F4Sub(f4PZ, orxVector_F4Set(pstBox[0].vPosition.fZ - pstBox[0].vPivot.fZ, pstBox[1].vPosition.fZ - pstBox[1].vPivot.fZ, pstBox[2].vPosition.fZ - pstBox[2].vPivot.fZ, pstBox[3].vPosition.fZ - pstBox[3].vPivot.fZ));
+
+    /* X-axis test */
+    f4AX      = orxVector_F4Set(pstBox[0].vX.fX, pstBox[1].vX.fX, pstBox[2].vX.fX, pstBox[3].vX.fX);
+    f4AY      = orxVector_F4Set(pstBox[0].vX.fY, pstBox[1].vX.fY, pstBox[2].vX.fY, pstBox[3].vX.fY);
+    f4AZ      = orxVector_F4Set(pstBox[0].vX.fZ, pstBox[1].vX.fZ, pstBox[2].vX.fZ, pstBox[3].vX.fZ);
+    f4Proj    = orxVector_F4Add(orxVector_F4Add(orxVector_F4Mul(f4TX, f4AX), orxVector_F4Mul(f4TY, f4AY)), orxVector_F4Mul(f4TZ, f4AZ));
+    f4Size    = orxVector_F4Add(orxVector_F4Add(orxVector_F4Mul(f4AX, f4AX), orxVector_F4Mul(f4AY, f4AY)), orxVector_F4Mul(f4AZ, f4AZ));
+    m4Inside  = orxVector_M4And(orxVector_M4And(orxVector_F4GE(f4Proj, f4Zero), orxVector_F4GT(f4Size, f4Zero)), orxVector_F4LE(f4Proj, f4Size));
+
+    /* Y-axis test */
+    f4AX      = orxVector_F4Set(pstBox[0].vY.fX, pstBox[1].vY.fX, pstBox[2].vY.fX, pstBox[3].vY.fX);
+    f4AY      = orxVector_F4Set(pstBox[0].vY.fY, pstBox[1].vY.fY, pstBox[2].vY.fY, pstBox[3].vY.fY);
+    f4AZ      = orxVector_F4Set(pstBox[0].vY.fZ, pstBox[1].vY.fZ, pstBox[2].vY.fZ, pstBox[3].vY.fZ);
+    f4Proj    = orxVector_F4Add(orxVector_F4Add(orxVector_F4Mul(f4TX, f4AX), orxVector_F4Mul(f4TY, f4AY)), orxVector_F4Mul(f4TZ, f4AZ));
+    f4Size    = orxVector_F4Add(orxVector_F4Add(orxVector_F4Mul(f4AX, f4AX), orxVector_F4Mul(f4AY, f4AY)), orxVector_F4Mul(f4AZ, f4AZ));
+    m4Inside  = orxVector_M4And(m4Inside, orxVector_M4And(orxVector_M4And(orxVector_F4GE(f4Proj, f4Zero), orxVector_F4GT(f4Size, f4Zero)), orxVector_F4LE(f4Proj, f4Size)));
+
+    /* Stores results */
+    *_pu32Result += orxVector_StoreResults(&(_abResult[i]), orxVector_M4GetBits(m4Inside));
+  }
+
+  /* Done! */
+  return i;
+}
+
+/** Tests an oriented box against full batches of oriented boxes
+ * @param[out]  _pu32Result                 Number of intersecting boxes
+ * @return      Number of tested boxes
+ */
+static orxINLINE orxU32 orxOBox_ZAlignedTestIntersectionBatch(const orxOBOX *_pstBox, const orxOBOX *_astBoxList, orxU32 _u32Count, orxBOOL *_abResult, orxU32 *_pu32Result)
+{
+  orxVECTOR_F4 f4OX, f4OY, f4XX, f4XY, f4YX, f4YY, f4XSize, f4YSize, f4Z, f4ZMax;
+  orxU32       i;
+
+  /* Checks */
+  orxASSERT(_pstBox->vZ.fX == orxFLOAT_0);
+  orxASSERT(_pstBox->vZ.fY == orxFLOAT_0);
+  orxASSERT(_pstBox->vZ.fZ >= orxFLOAT_0);
+
+  /* Splats tested box */
+  f4OX    = orxVector_F4Splat(_pstBox->vPosition.fX - _pstBox->vPivot.fX);
+  f4OY    = orxVector_F4Splat(_pstBox->vPosition.fY - _pstBox->vPivot.fY);
+  f4XX    = orxVector_F4Splat(_pstBox->vX.fX);
+  f4XY    = orxVector_F4Splat(_pstBox->vX.fY);
+  f4YX    = orxVector_F4Splat(_pstBox->vY.fX);
+  f4YY    = orxVector_F4Splat(_pstBox->vY.fY);
+  f4XSize = orxVector_F4Splat(orxVector_GetSquareSize(&(_pstBox->vX)));
+  f4YSize = orxVector_F4Splat(orxVector_GetSquareSize(&(_pstBox->vY)));
+  f4Z     = orxVector_F4Splat(_pstBox->vPosition.fZ);
+  f4ZMax  = orxVector_F4Splat(_pstBox->vPosition.fZ + _pstBox->vZ.fZ);
+
+  /* For all full batches */
+  for(i = 0; i + orxVECTOR_KU32_BATCH_WIDTH <= _u32Count; i += orxVECTOR_KU32_BATCH_WIDTH)
+  {
+    const orxOBOX  *pstBox = &(_astBoxList[i]);
+    orxVECTOR_F4    f4BZ, f4DX, f4DY, f4BXX, f4BXY, f4BYX, f4BYY, f4BXSize, f4BYSize, f4Zero;
+    orxVECTOR_M4    m4Overlap;
+
+    /* Gathers boxes */
+    f4BZ      = orxVector_F4Set(pstBox[0].vPosition.fZ, pstBox[1].vPosition.fZ, pstBox[2].vPosition.fZ, pstBox[3].vPosition.fZ);
+    f4DX      = orxVector_F4Sub(orxVector_F4Set(pstBox[0].vPosition.fX - pstBox[0].vPivot.fX, pstBox[1].vPosition.fX - pstBox[1].vPivot.fX, pstBox[2].vPosition.fX - pstBox[2].vPivot.fX, pstBox[3].vPosition.fX - pstBox[3].vPivot.fX), f4OX);
+    f4DY      = orxVector_F4Sub(orxVector_F4Set(pstBox[0].vPosition.fY - pstBox[0].vPivot.fY, pstBox[1].vPosition.fY - pstBox[1].vPivot.fY, pstBox[2].vPosition.fY - pstBox[2].vPivot.fY, pstBox[3].vPosition.fY - pstBox[3].vPivot.fY), f4OY);
+    f4BXX     = orxVector_F4Set(pstBox[0].vX.fX, pstBox[1].vX.fX, pstBox[2].vX.fX, pstBox[3].vX.fX);
+    f4BXY     = orxVector_F4Set(pstBox[0].vX.fY, pstBox[1].vX.fY, pstBox[2].vX.fY, pstBox[3].vX.fY);
+    f4BYX     = orxVector_F4Set(pstBox[0].vY.fX, pstBox[1].vY.fX, pstBox[2].vY.fX, pstBox[3].vY.fX);
+    f4BYY     = orxVector_F4Set(pstBox[0].vY.fY, pstBox[1].vY.fY, pstBox[2].vY.fY, pstBox[3].vY.fY);
+    f4BXSize  = orxVector_F4Set(orxVector_GetSquareSize(&(pstBox[0].vX)), orxVector_GetSquareSize(&(pstBox[1].vX)), orxVector_GetSquareSize(&(pstBox[2].vX)), orxVector_GetSquareSize(&(pstBox[3].vX)));
+    f4BYSize  = orxVector_F4Set(orxVector_GetSquareSize(&(pstBox[0].vY)), orxVector_GetSquareSize(&(pstBox[1].vY)), orxVector_GetSquareSize(&(pstBox[2].vY)), orxVector_GetSquareSize(&(pstBox[3].vY)));
+    f4Zero    = orxVector_F4Splat(orxFLOAT_0);
+
+    /* Z test */
+    m4Overlap = orxVector_M4And(orxVector_F4GE(orxVector_F4Add(f4BZ, orxVector_F4Set(pstBox[0].vZ.fZ, pstBox[1].vZ.fZ, pstBox[2].vZ.fZ, pstBox[3].vZ.fZ)), f4Z), orxVector_F4LE(f4BZ, f4ZMax));
+
+    /* Tests boxes against tested box axes */
+    m4Overlap = orxVector_M4And(m4Overlap, orxVector_F4TestAxis(f4DX, f4DY, f4BXX, f4BXY, f4BYX, f4BYY, f4XX, f4XY, f4XSize));
+    m4Overlap = orxVector_M4And(m4Overlap, orxVector_F4TestAxis(f4DX, f4DY, f4BXX, f4BXY, f4BYX, f4BYY, f4YX, f4YY, f4YSize));
+
+    /* Tests tested box against boxes axes */
+    f4DX      = orxVector_F4Sub(f4Zero, f4DX);
+    f4DY      = orxVector_F4Sub(f4Zero, f4DY);
+    m4Overlap = orxVector_M4And(m4Overlap, orxVector_F4TestAxis(f4DX, f4DY, f4XX, f4XY, f4YX, f4YY, f4BXX, f4BXY, f4BXSize));
+    m4Overlap = orxVector_M4And(m4Overlap, orxVector_F4TestAxis(f4DX, f4DY, f4XX, f4XY, f4YX, f4YY, f4BYX, f4BYY, f4BYSize));
+
+    /* Stores results */
+    *_pu32Result += orxVector_StoreResults(&(_abResult[i]), orxVector_M4GetBits(m4Overlap));
+  }
+
+  /* Done! */
+  return i;
+}
+
+/** Tests an axis aligned box against full batches of axis aligned boxes, in 2D
+ * @param[out]  _pu32Result                 Number of intersecting boxes
+ * @return      Number of tested boxes
+ */
+static orxINLINE orxU32 orxAABox_Test2DIntersectionBatch(const orxAABOX *_pstBox, const orxAABOX *_astBoxList, orxU32 _u32Count, orxBOOL *_abResult, orxU32 *_pu32Result)
+{
+  orxVECTOR_F4 f4TLX, f4TLY, f4BRX, f4BRY;
+  orxU32       i;
+
+  /* Splats tested box */
+  f4TLX = orxVector_F4Splat(_pstBox->vTL.fX);
+  f4TLY = orxVector_F4Splat(_pstBox->vTL.fY);
+  f4BRX = orxVector_F4Splat(_pstBox->vBR.fX);
+  f4BRY = orxVector_F4Splat(_pstBox->vBR.fY);
+
+  /* For all full batches */
+  for(i = 0; i + orxVECTOR_KU32_BATCH_WIDTH <= _u32Count; i += orxVECTOR_KU32_BATCH_WIDTH)
+  {
+    const orxAABOX *pstBox = &(_astBoxList[i]);
+    orxVECTOR_M4    m4Overlap;
+
+    /* X test */
+    m4Overlap = orxVector_M4And(orxVector_F4GE(orxVector_F4Set(pstBox[0].vBR.fX, pstBox[1].vBR.fX, pstBox[2].vBR.fX, pstBox[3].vBR.fX), f4TLX),
+                                orxVector_F4LE(orxVector_F4Set(pstBox[0].vTL.fX, pstBox[1].vTL.fX, pstBox[2].vTL.fX, pstBox[3].vTL.fX), f4BRX));
+
+    /* Y test */
+    m4Overlap = orxVector_M4And(m4Overlap,
+                                orxVector_M4And(orxVector_F4GE(orxVector_F4Set(pstBox[0].vBR.fY, pstBox[1].vBR.fY, pstBox[2].vBR.fY, pstBox[3].vBR.fY), f4TLY),
+                                                orxVector_F4LE(orxVector_F4Set(pstBox[0].vTL.fY, pstBox[1].vTL.fY, pstBox[2].vTL.fY, pstBox[3].vTL.fY), f4BRY)));
+
+    /* Stores results */
+    *_pu32Result += orxVector_StoreResults(&(_abResult[i]), orxVector_M4GetBits(m4Overlap));
+  }
+
+  /* Done! */
+  return i;
+}
+
+#endif /* orxVECTOR_KU32_BATCH_WIDTH */
+
+
+/* *** Batch functions *** */
+
+/** Transforms an array of vectors: scales them, rotates them in 2D (along Z-axis), then translates them, with the same results as orxVector_Mul(), orxVector_2DRotate() & orxVector_Add()
+ * @param[out]  _avRes                      Array where to store the results (can be the operand array)
+ * @param[in]   _avOp                       Array of vectors to transform
+ * @param[in]   _u32Count                   Number of vectors
+ * @param[in]   _pvScale                    Scale to apply
+ * @param[in]   _fRotation                  Rotation to apply (radians)
+ * @param[in]   _pvTranslation              Translation to apply
+ * @return      Array of transformed vectors
+ */
+orxVECTOR *orxFASTCALL orxVector_2DTransformArray(orxVECTOR *_avRes, const orxVECTOR *_avOp, orxU32 _u32Count, const orxVECTOR *_pvScale, orxFLOAT _fRotation, const orxVECTOR *_pvTranslation)
+{
+  orxU32 i = 0;
+
+  /* Checks */
+  orxASSERT((_avRes != orxNULL) || (_u32Count == 0));
+  orxASSERT((_avOp != orxNULL) || (_u32Count == 0));
+  orxASSERT(_pvScale != orxNULL);
+  orxASSERT(_pvTranslation != orxNULL);
+
+  /* Exact angle, handled without cos & sin by orxVector_2DRotate()? */
+  if((_fRotation == orxMATH_KF_PI_BY_2) || (_fRotation == -orxMATH_KF_PI_BY_2) || (_fRotation == orxMATH_KF_PI))
+  {
+    /* For all vectors */
+    for(; i < _u32Count; i++)
+    {
+      orxVECTOR vTemp;
+
+      /* Transforms it */
+      orxVector_Add(&(_avRes[i]), orxVector_2DRotate(&vTemp, orxVector_Mul(&vTemp, &(_avOp[i]), _pvScale), _fRotation), _pvTranslation);
+    }
+  }
+  else
+  {
+    orxFLOAT fCos, fSin;
+
+    /* Gets cos & sin of angle */
+    fCos = orxMath_Cos(_fRotation);
+    fSin = orxMath_Sin(_fRotation);
+
+#ifdef orxVECTOR_KU32_BATCH_WIDTH
+
+    /* Transforms full batches */
+    i = orxVector_2DTransformBatch(_avRes, _avOp, _u32Count, _pvScale, fCos, fSin, _pvTranslation);
+
+#endif /* orxVECTOR_KU32_BATCH_WIDTH */
+
+    /* For all remaining vectors */
+    for(; i < _u32Count; i++)
+    {
+      orxFLOAT fX, fY;
+
+      /* Scales it */
+      fX = _avOp[i].fX * _pvScale->fX;
+      fY = _avOp[i].fY * _pvScale->fY;
+
+      /* Rotates & translates it */
+      orxVector_Set(&(_avRes[i]), ((fCos * fX) - (fSin * fY)) + _pvTranslation->fX, ((fSin * fX) + (fCos * fY)) + _pvTranslation->fY, (_avOp[i].fZ * _pvScale->fZ) + _pvTranslation->fZ);
+    }
+  }
+
+  /* Done! */
+  return _avRes;
+}
+
+/** Tests a position against an array of 2D oriented boxes (see orxOBox_2DIsInside)
+ * @param[in]   _astBoxList                 Array of boxes to test
+ * @param[in]   _u32Count                   Number of boxes
+ * @param[in]   _pvPosition                 Position to test
+ * @param[out]  _abResult                   Per-box results: orxTRUE if the position is inside that box, orxFALSE otherwise
+ * @return      Number of boxes containing the position
+ */
+orxU32 orxFASTCALL orxOBox_2DIsInsideArray(const orxOBOX *_astBoxList, orxU32 _u32Count, const orxVECTOR *_pvPosition, orxBOOL *_abResult)
+{
+  orxU32 i = 0, u32Result = 0;
+
+  /* Checks */
+  orxASSERT((_astBoxList != orxNULL) || (_u32Count == 0));
+  orxASSERT(_pvPosition != orxNULL);
+  orxASSERT((_abResult != orxNULL) || (_u32Count == 0));
+
+#ifdef orxVECTOR_KU32_BATCH_WIDTH
+
+  /* Tests full batches */
+  i = orxOBox_2DIsInsideBatch(_astBoxList, _u32Count, _pvPosition, _abResult, &u32Result);
+
+#endif /* orxVECTOR_KU32_BATCH_WIDTH */
+
+  /* For all remaining boxes */
+  for(; i < _u32Count; i++)
+  {
+    /* Tests it */
+    if((_abResult[i] = orxOBox_2DIsInside(&(_astBoxList[i]), _pvPosition)) != orxFALSE)
+    {
+      /* Updates result */
+      u32Result++;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Tests an oriented box against an array of oriented boxes (see orxOBox_ZAlignedTestIntersection)
+ * @param[in]   _pstBox                     Box to test
+ * @param[in]   _astBoxList                 Array of boxes to test against
+ * @param[in]   _u32Count                   Number of boxes in the array
+ * @param[out]  _abResult                   Per-box results: orxTRUE if that box intersects the tested one, orxFALSE otherwise
+ * @return      Number of intersecting boxes
+ */
+orxU32 orxFASTCALL orxOBox_ZAlignedTestIntersectionArray(const orxOBOX *_pstBox, const orxOBOX *_astBoxList, orxU32 _u32Count, orxBOOL *_abResult)
+{
+  orxU32 i = 0, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(_pstBox != orxNULL);
+  orxASSERT((_astBoxList != orxNULL) || (_u32Count == 0));
+  orxASSERT((_abResult != orxNULL) || (_u32Count == 0));
+
+#ifdef orxVECTOR_KU32_BATCH_WIDTH
+
+  /* Tests full batches */
+  i = orxOBox_ZAlignedTestIntersectionBatch(_pstBox, _astBoxList, _u32Count, _abResult, &u32Result);
+
+#endif /* orxVECTOR_KU32_BATCH_WIDTH */
+
+  /* For all remaining boxes */
+  for(; i < _u32Count; i++)
+  {
+    /* Tests it */
+    if((_abResult[i] = orxOBox_ZAlignedTestIntersection(_pstBox, &(_astBoxList[i]))) != orxFALSE)
+    {
+      /* Updates result */
+      u32Result++;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Tests an axis aligned box against an array of axis aligned boxes, in 2D (see orxAABox_Test2DIntersection)
+ * @param[in]   _pstBox                     Box to test
+ * @param[in]   _astBoxList                 Array of boxes to test against
+ * @param[in]   _u32Count                   Number of boxes in the array
+ * @param[out]  _abResult                   Per-box results: orxTRUE if that box intersects the tested one in 2D, orxFALSE otherwise
+ * @return      Number of intersecting boxes
+ */
+orxU32 orxFASTCALL orxAABox_Test2DIntersectionArray(const orxAABOX *_pstBox, const orxAABOX *_astBoxList, orxU32 _u32Count, orxBOOL *_abResult)
+{
+  orxU32 i = 0, u32Result = 0;
+
+  /* Checks */
+  orxASSERT(_pstBox != orxNULL);
+  orxASSERT((_astBoxList != orxNULL) || (_u32Count == 0));
+  orxASSERT((_abResult != orxNULL) || (_u32Count == 0));
+
+#ifdef orxVECTOR_KU32_BATCH_WIDTH
+
+  /* Tests full batches */
+  i = orxAABox_Test2DIntersectionBatch(_pstBox, _astBoxList, _u32Count, _abResult, &u32Result);
+
+#endif /* orxVECTOR_KU32_BATCH_WIDTH */
+
+  /* For all remaining boxes */
+  for(; i < _u32Count; i++)
+  {
+    /* Tests it */
+    if((_abResult[i] = orxAABox_Test2DIntersection(_pstBox, &(_astBoxList[i]))) != orxFALSE)
+    {
+      /* Updates result */
+      u32Result++;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+
 /* *** Vector constants *** */
 
 const orxVECTOR orxVECTOR_X       = {{orx2F(1.0f)}, {orx2F(0.0f)}, {orx2F(0.0f)}};
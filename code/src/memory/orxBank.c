@@ -58,9 +58,13 @@ struct __orxBANK_t
   orxU32           *au32CellMap;            /**< Cell map */
   void            **apstSegmentData;        /**< Segment data */
   orxU32           *au32SegmentFree;        /**< Segment free */
+  orxU32           *au32SegmentHint;        /**< Segment hint: first cell map entry that can contain free cells, per segment */
+  orxU32           *au32SegmentMap;         /**< Segment map: one bit per segment with free cells */
+  orxU32            u32SegmentMapHint;      /**< Segment map hint: first segment map entry that can contain non-full segments */
   orxU32            u32CellSize;            /**< Cell size */
   orxU32            u32SegmentSize;         /**< Segment size */
   orxU32            u32CellCount;           /**< Allocated cells count */
+  orxU32            u32PeakCellCount;       /**< Peak allocated cells count */
   orxU32            u32SegmentCount;        /**< Segment count */
   orxU32            u32Flags;               /**< Flags set for the memory bank */
   orxMEMORY_TYPE    eMemType;               /**< Memory type that will be used by the memory allocation */
@@ -144,7 +148,7 @@ static orxINLINE orxSTATUS orxBank_AddSegment(orxBANK *_pstBank)
       /* Success? */
       if(au32NewSegmentFree != orxNULL)
       {
-        orxU32 u32DataSize;
+        orxU32 *au32NewSegmentHint;
 
         /* Stores it */
         _pstBank->au32SegmentFree = au32NewSegmentFree;
@@ -152,20 +156,67 @@ static orxINLINE orxSTATUS orxBank_AddSegment(orxBANK *_pstBank)
         /* Inits it */
         au32NewSegmentFree[_pstBank->u32SegmentCount] = _pstBank->u32SegmentSize;
 
-        /* Gets segment data size */
-        u32DataSize = _pstBank->u32SegmentSize * _pstBank->u32CellSize + sstBank.u32CacheLineSize - 1;
-
-        /* Allocates new segment data */
-        apstNewSegmentData[_pstBank->u32SegmentCount] = (void *)orxMemory_Allocate(u32DataSize, _pstBank->eMemType);
+        /* Allocates new segment hint */
+        au32NewSegmentHint = (orxU32 *)orxMemory_Reallocate(_pstBank->au32SegmentHint, u32NewSegmentCount * sizeof(orxU32), orxMEMORY_TYPE_SYSTEM);
 
         /* Success? */
-        if(apstNewSegmentData[_pstBank->u32SegmentCount] != orxNULL)
+        if(au32NewSegmentHint != orxNULL)
         {
-          /* Updates segment count */
-          _pstBank->u32SegmentCount++;
+          orxU32 *au32NewSegmentMap;
+          orxU32  u32SegmentMapSize;
 
-          /* Updates result */
-          eResult = orxSTATUS_SUCCESS;
+          /* Stores it */
+          _pstBank->au32SegmentHint = au32NewSegmentHint;
+
+          /* Inits it */
+          au32NewSegmentHint[_pstBank->u32SegmentCount] = 0;
+
+          /* Gets segment map size */
+          u32SegmentMapSize = (orxU32)orxALIGN(u32NewSegmentCount, 32) >> 5;
+
+          /* Allocates new segment map */
+          au32NewSegmentMap = (orxU32 *)orxMemory_Reallocate(_pstBank->au32SegmentMap, u32SegmentMapSize * sizeof(orxU32), orxMEMORY_TYPE_SYSTEM);
+
+          /* Success? */
+          if(au32NewSegmentMap != orxNULL)
+          {
+            orxU32 u32DataSize;
+
+            /* Stores it */
+            _pstBank->au32SegmentMap = au32NewSegmentMap;
+
+            /* New map entry? */
+            if((_pstBank->u32SegmentCount & 31) == 0)
+            {
+              /* Inits it */
+              au32NewSegmentMap[u32SegmentMapSize - 1] = 0;
+            }
+
+            /* Gets segment data size */
+            u32DataSize = _pstBank->u32SegmentSize * _pstBank->u32CellSize + sstBank.u32CacheLineSize - 1;
+
+            /* Allocates new segment data */
+            apstNewSegmentData[_pstBank->u32SegmentCount] = (void *)orxMemory_Allocate(u32DataSize, _pstBank->eMemType);
+
+            /* Success? */
+            if(apstNewSegmentData[_pstBank->u32SegmentCount] != orxNULL)
+            {
+              /* Marks it as non-full */
+              au32NewSegmentMap[_pstBank->u32SegmentCount >> 5] |= 1U << (_pstBank->u32SegmentCount & 31);
+
+              /* Updates segment map hint */
+              if((_pstBank->u32SegmentCount >> 5) < _pstBank->u32SegmentMapHint)
+              {
+                _pstBank->u32SegmentMapHint = _pstBank->u32SegmentCount >> 5;
+              }
+
+              /* Updates segment count */
+              _pstBank->u32SegmentCount++;
+
+              /* Updates result */
+              eResult = orxSTATUS_SUCCESS;
+            }
+          }
         }
       }
     }
@@ -210,6 +261,179 @@ static orxINLINE void orxBank_DeleteAll()
   return;
 }
 
+/** Shrinks a bank by removing its trailing unused segments
+ * @param[in] _pstBank        Concerned bank
+ * @param[in] _u32SpareCount  Number of trailing unused segments to keep
+ */
+static void orxFASTCALL orxBank_Shrink(orxBANK *_pstBank, orxU32 _u32SpareCount)
+{
+  orxU32 u32NewSegmentCount;
+
+  /* Finds last used segment */
+  for(u32NewSegmentCount = _pstBank->u32SegmentCount;
+      (u32NewSegmentCount > 1) && (_pstBank->au32SegmentFree[u32NewSegmentCount - 1] == _pstBank->u32SegmentSize);
+      u32NewSegmentCount--)
+    ;
+
+  /* Adds spare segments */
+  u32NewSegmentCount = orxMIN(u32NewSegmentCount + _u32SpareCount, _pstBank->u32SegmentCount);
+
+  /* Should shrink? */
+  if(u32NewSegmentCount < _pstBank->u32SegmentCount)
+  {
+    void  **apstNewSegmentData;
+    orxU32  i;
+
+    /* Frees unused segment data */
+    for(i = u32NewSegmentCount; i < _pstBank->u32SegmentCount; i++)
+    {
+      /* Frees it */
+      orxMemory_Free(_pstBank->apstSegmentData[i]);
+      _pstBank->apstSegmentData[i] = orxNULL;
+    }
+
+    /* Allocates new segment entry */
+    apstNewSegmentData = (void **)orxMemory_Reallocate(_pstBank->apstSegmentData, u32NewSegmentCount * sizeof(void *), orxMEMORY_TYPE_SYSTEM);
+
+    /* Success? */
+    if(apstNewSegmentData != orxNULL)
+    {
+      orxU32 *au32NewCellMap;
+      orxU32  u32MapSize;
+
+      /* Stores it */
+      _pstBank->apstSegmentData = apstNewSegmentData;
+
+      /* Gets segment map size */
+      u32MapSize = (orxU32)orxALIGN(_pstBank->u32SegmentSize, 32) >> 5;
+
+      /* Allocates new cell map */
+      au32NewCellMap = (orxU32 *)orxMemory_Reallocate(_pstBank->au32CellMap, u32NewSegmentCount * u32MapSize * sizeof(orxU32), orxMEMORY_TYPE_SYSTEM);
+
+      /* Success? */
+      if(au32NewCellMap != orxNULL)
+      {
+        orxU32 *au32NewSegmentFree;
+
+        /* Stores it */
+        _pstBank->au32CellMap = au32NewCellMap;
+
+        /* Allocates new segment free */
+        au32NewSegmentFree = (orxU32 *)orxMemory_Reallocate(_pstBank->au32SegmentFree, u32NewSegmentCount * sizeof(orxU32), orxMEMORY_TYPE_SYSTEM);
+
+        /* Success? */
+        if(au32NewSegmentFree != orxNULL)
+        {
+          orxU32 *au32NewSegmentHint;
+
+          /* Stores it */
+          _pstBank->au32SegmentFree = au32NewSegmentFree;
+
+          /* Allocates new segment hint */
+          au32NewSegmentHint = (orxU32 *)orxMemory_Reallocate(_pstBank->au32SegmentHint, u32NewSegmentCount * sizeof(orxU32), orxMEMORY_TYPE_SYSTEM);
+
+          /* Success? */
+          if(au32NewSegmentHint != orxNULL)
+          {
+            orxU32 *au32NewSegmentMap;
+            orxU32  u32SegmentMapSize;
+
+            /* Stores it */
+            _pstBank->au32SegmentHint = au32NewSegmentHint;
+
+            /* Gets segment map size */
+            u32SegmentMapSize = (orxU32)orxALIGN(u32NewSegmentCount, 32) >> 5;
+
+            /* Allocates new segment map */
+            au32NewSegmentMap = (orxU32 *)orxMemory_Reallocate(_pstBank->au32SegmentMap, u32SegmentMapSize * sizeof(orxU32), orxMEMORY_TYPE_SYSTEM);
+
+            /* Success? */
+            if(au32NewSegmentMap != orxNULL)
+            {
+              /* Stores it */
+              _pstBank->au32SegmentMap = au32NewSegmentMap;
+            }
+          }
+        }
+      }
+    }
+
+    /* Clears map bits of removed segments */
+    if((u32NewSegmentCount & 31) != 0)
+    {
+      _pstBank->au32SegmentMap[u32NewSegmentCount >> 5] &= (1U << (u32NewSegmentCount & 31)) - 1;
+    }
+
+    /* Updates segment map hint */
+    if(_pstBank->u32SegmentMapHint > ((u32NewSegmentCount - 1) >> 5))
+    {
+      _pstBank->u32SegmentMapHint = (u32NewSegmentCount - 1) >> 5;
+    }
+
+    /* Updates segment count */
+    _pstBank->u32SegmentCount = u32NewSegmentCount;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Frees a cell
+ * @param[in] _pstBank          Concerned bank
+ * @param[in] _u32SegmentIndex  Index of the cell's segment
+ * @param[in] _u32CellIndex     Index of the cell inside its segment
+ */
+static orxINLINE void orxBank_FreeCell(orxBANK *_pstBank, orxU32 _u32SegmentIndex, orxU32 _u32CellIndex)
+{
+  orxU32 u32MapSize;
+
+  /* Gets segment map size */
+  u32MapSize = (orxU32)orxALIGN(_pstBank->u32SegmentSize, 32) >> 5;
+
+  /* Checks */
+  orxASSERT(!(_pstBank->au32CellMap[_u32SegmentIndex * u32MapSize + (_u32CellIndex >> 5)] & (1U << (_u32CellIndex & 31))));
+
+  /* Marks cell as free */
+  _pstBank->au32CellMap[_u32SegmentIndex * u32MapSize + (_u32CellIndex >> 5)] |= 1U << (_u32CellIndex & 31);
+
+  /* Updates segment hint */
+  if((_u32CellIndex >> 5) < _pstBank->au32SegmentHint[_u32SegmentIndex])
+  {
+    _pstBank->au32SegmentHint[_u32SegmentIndex] = _u32CellIndex >> 5;
+  }
+
+  /* Was segment full? */
+  if(_pstBank->au32SegmentFree[_u32SegmentIndex] == 0)
+  {
+    /* Marks it as non-full */
+    _pstBank->au32SegmentMap[_u32SegmentIndex >> 5] |= 1U << (_u32SegmentIndex & 31);
+
+    /* Updates segment map hint */
+    if((_u32SegmentIndex >> 5) < _pstBank->u32SegmentMapHint)
+    {
+      _pstBank->u32SegmentMapHint = _u32SegmentIndex >> 5;
+    }
+  }
+
+  /* Updates segment free count */
+  _pstBank->au32SegmentFree[_u32SegmentIndex]++;
+
+  /* Updates bank count */
+  _pstBank->u32CellCount--;
+
+  /* Should release segments and segment is now empty? */
+  if(orxFLAG_TEST(_pstBank->u32Flags, orxBANK_KU32_FLAG_RELEASE_SEGMENTS)
+  && (_pstBank->au32SegmentFree[_u32SegmentIndex] == _pstBank->u32SegmentSize)
+  && (_pstBank->u32SegmentCount > 2))
+  {
+    /* Shrinks bank, keeping a spare segment to prevent thrashing */
+    orxBank_Shrink(_pstBank, 1);
+  }
+
+  /* Done! */
+  return;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -385,6 +609,12 @@ void orxFASTCALL orxBank_Delete(orxBANK *_pstBank)
   /* Frees segment free */
   orxMemory_Free(_pstBank->au32SegmentFree);
 
+  /* Frees segment hint */
+  orxMemory_Free(_pstBank->au32SegmentHint);
+
+  /* Frees segment map */
+  orxMemory_Free(_pstBank->au32SegmentMap);
+
   /* Frees bank */
   orxMemory_Free(_pstBank);
 
@@ -429,30 +659,39 @@ void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIn
   /* Has room? */
   if(_pstBank->u32CellCount < _pstBank->u32SegmentCount * _pstBank->u32SegmentSize)
   {
-    orxU32 *pu32MapEntry;
+    orxU32 *pu32MapEntry, u32SegmentMapSize;
+
+    /* Gets segment map size */
+    u32SegmentMapSize = (orxU32)orxALIGN(_pstBank->u32SegmentCount, 32) >> 5;
 
-    /* Finds non-full segment */
-    for(u32SegmentIndex = 0; (u32SegmentIndex < _pstBank->u32SegmentCount) && (_pstBank->au32SegmentFree[u32SegmentIndex] == 0); u32SegmentIndex++)
+    /* Finds first segment map entry with non-full segments */
+    for(pu32MapEntry = _pstBank->au32SegmentMap + _pstBank->u32SegmentMapHint;
+        (*pu32MapEntry == 0) && (pu32MapEntry < _pstBank->au32SegmentMap + u32SegmentMapSize - 1);
+        pu32MapEntry++)
       ;
 
+    /* Updates segment map hint */
+    _pstBank->u32SegmentMapHint = (orxU32)(pu32MapEntry - _pstBank->au32SegmentMap);
+
+    /* Gets non-full segment */
+    u32SegmentIndex = (_pstBank->u32SegmentMapHint << 5) + orxMath_GetTrailingZeroCount(*pu32MapEntry);
+
     /* Checks */
+    orxASSERT(*pu32MapEntry != 0);
     orxASSERT(u32SegmentIndex < _pstBank->u32SegmentCount);
+    orxASSERT(_pstBank->au32SegmentFree[u32SegmentIndex] != 0);
 
-    /* For all cell map entries */
-    for(u32CellIndex = 0, pu32MapEntry = _pstBank->au32CellMap + u32SegmentIndex * u32MapSize;
-        u32CellIndex < _pstBank->u32SegmentSize;
+    /* Finds first cell map entry with free cells */
+    for(u32CellIndex = _pstBank->au32SegmentHint[u32SegmentIndex] << 5, pu32MapEntry = _pstBank->au32CellMap + u32SegmentIndex * u32MapSize + _pstBank->au32SegmentHint[u32SegmentIndex];
+        (*pu32MapEntry == 0) && (u32CellIndex + 32 < _pstBank->u32SegmentSize);
         u32CellIndex += 32, pu32MapEntry++)
-    {
-      /* Found free cell? */
-      if(*pu32MapEntry != 0)
-      {
-        /* Updates cell index */
-        u32CellIndex += orxMath_GetTrailingZeroCount(*pu32MapEntry);
+      ;
 
-        /* Stops */
-        break;
-      }
-    }
+    /* Updates segment hint */
+    _pstBank->au32SegmentHint[u32SegmentIndex] = u32CellIndex >> 5;
+
+    /* Updates cell index */
+    u32CellIndex += orxMath_GetTrailingZeroCount(*pu32MapEntry);
 
     /* Checks */
     orxASSERT(u32CellIndex < _pstBank->u32SegmentSize);
@@ -493,9 +732,23 @@ void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIn
     /* Updates segment free */
     _pstBank->au32SegmentFree[u32SegmentIndex]--;
 
+    /* Is segment full? */
+    if(_pstBank->au32SegmentFree[u32SegmentIndex] == 0)
+    {
+      /* Marks it as full */
+      _pstBank->au32SegmentMap[u32SegmentIndex >> 5] &= ~(1U << (u32SegmentIndex & 31));
+    }
+
     /* Updates cell count */
     _pstBank->u32CellCount++;
 
+    /* New peak? */
+    if(_pstBank->u32CellCount > _pstBank->u32PeakCellCount)
+    {
+      /* Stores it */
+      _pstBank->u32PeakCellCount = _pstBank->u32CellCount;
+    }
+
     /* Updates item index */
     *_pu32ItemIndex = u32ItemIndex = u32SegmentIndex * _pstBank->u32SegmentSize + u32CellIndex;
 
@@ -530,7 +783,7 @@ void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIn
  */
 void orxFASTCALL orxBank_Free(orxBANK *_pstBank, void *_pCell)
 {
-  orxU32 u32SegmentIndex, u32CellIndex, u32MapSize;
+  orxU32 u32SegmentIndex, u32CellIndex;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxBank_Free");
@@ -544,20 +797,8 @@ void orxFASTCALL orxBank_Free(orxBANK *_pstBank, void *_pCell)
   u32SegmentIndex = *(orxU32 *)((orxU8 *)_pCell - orxBANK_KU32_TAG_SIZE) / _pstBank->u32SegmentSize;
   u32CellIndex    = *(orxU32 *)((orxU8 *)_pCell - orxBANK_KU32_TAG_SIZE) % _pstBank->u32SegmentSize;
 
-  /* Gets segment map size */
-  u32MapSize = (orxU32)orxALIGN(_pstBank->u32SegmentSize, 32) >> 5;
-
-  /* Checks */
-  orxASSERT(!(_pstBank->au32CellMap[u32SegmentIndex * u32MapSize + (u32CellIndex >> 5)] & (1U << (u32CellIndex & 31))));
-
-  /* Marks cell as free */
-  _pstBank->au32CellMap[u32SegmentIndex * u32MapSize + (u32CellIndex >> 5)] |= 1U << (u32CellIndex & 31);
-
-  /* Updates segment free count */
-  _pstBank->au32SegmentFree[u32SegmentIndex]++;
-
-  /* Updates bank count */
-  _pstBank->u32CellCount--;
+  /* Frees cell */
+  orxBank_FreeCell(_pstBank, u32SegmentIndex, u32CellIndex);
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -572,7 +813,7 @@ void orxFASTCALL orxBank_Free(orxBANK *_pstBank, void *_pCell)
  */
 void orxFASTCALL orxBank_FreeAtIndex(orxBANK *_pstBank, orxU32 _u32Index)
 {
-  orxU32 u32SegmentIndex, u32CellIndex, u32MapSize;
+  orxU32 u32SegmentIndex, u32CellIndex;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxBank_FreeAtIndex");
@@ -584,24 +825,12 @@ void orxFASTCALL orxBank_FreeAtIndex(orxBANK *_pstBank, orxU32 _u32Index)
   orxASSERT(_pstBank->au32SegmentFree[_u32Index / _pstBank->u32SegmentSize] < _pstBank->u32SegmentSize);
   orxASSERT(_pstBank->u32CellCount != 0);
 
-  /* Gets segment map size */
-  u32MapSize = (orxU32)orxALIGN(_pstBank->u32SegmentSize, 32) >> 5;
-
   /* Gets indices */
   u32SegmentIndex = _u32Index / _pstBank->u32SegmentSize;
   u32CellIndex    = _u32Index % _pstBank->u32SegmentSize;
 
-  /* Checks */
-  orxASSERT(!(_pstBank->au32CellMap[u32SegmentIndex * u32MapSize + (u32CellIndex >> 5)] & (1U << (u32CellIndex & 31))));
-
-  /* Marks cell as free */
-  _pstBank->au32CellMap[u32SegmentIndex * u32MapSize + (u32CellIndex >> 5)] |= 1U << (u32CellIndex & 31);
-
-  /* Updates segment free count */
-  _pstBank->au32SegmentFree[u32SegmentIndex]++;
-
-  /* Updates bank count */
-  _pstBank->u32CellCount--;
+  /* Frees cell */
+  orxBank_FreeCell(_pstBank, u32SegmentIndex, u32CellIndex);
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -632,8 +861,17 @@ void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
   {
     /* Resets its free */
     _pstBank->au32SegmentFree[i] = _pstBank->u32SegmentSize;
+
+    /* Resets its hint */
+    _pstBank->au32SegmentHint[i] = 0;
+
+    /* Marks it as non-full */
+    _pstBank->au32SegmentMap[i >> 5] |= 1U << (i & 31);
   }
 
+  /* Resets segment map hint */
+  _pstBank->u32SegmentMapHint = 0;
+
   /* Clears cell count */
   _pstBank->u32CellCount = 0;
 
@@ -646,79 +884,12 @@ void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
  */
 void orxFASTCALL orxBank_Compact(orxBANK *_pstBank)
 {
-  orxU32 u32SegmentIndex, u32LastSegmentIndex;
-
-  /* For all segments */
-  for(u32SegmentIndex = 0, u32LastSegmentIndex = 0;
-      u32SegmentIndex < _pstBank->u32SegmentCount;
-      u32SegmentIndex++)
-  {
-    /* Not empty? */
-    if(_pstBank->au32SegmentFree[u32SegmentIndex] != _pstBank->u32SegmentSize)
-    {
-      /* Updates last index */
-      u32LastSegmentIndex = u32SegmentIndex;
-    }
-  }
-
-  /* Should compact? */
-  if(u32LastSegmentIndex + 1 < _pstBank->u32SegmentCount)
-  {
-    void  **apstNewSegmentData;
-    orxU32  u32NewSegmentCount, i;
-
-    /* Gets new segment count */
-    u32NewSegmentCount = u32LastSegmentIndex + 1;
-
-    /* Frees unused segment data */
-    for(i = u32NewSegmentCount; i < _pstBank->u32SegmentCount; i++)
-    {
-      /* Frees it */
-      orxMemory_Free(_pstBank->apstSegmentData[i]);
-      _pstBank->apstSegmentData[i] = orxNULL;
-    }
-
-    /* Allocates new segment entry */
-    apstNewSegmentData = (void **)orxMemory_Reallocate(_pstBank->apstSegmentData, u32NewSegmentCount * sizeof(void *), orxMEMORY_TYPE_SYSTEM);
-
-    /* Success? */
-    if(apstNewSegmentData != orxNULL)
-    {
-      orxU32 *au32NewCellMap;
-      orxU32  u32MapSize;
-
-      /* Stores it */
-      _pstBank->apstSegmentData = apstNewSegmentData;
-
-      /* Gets segment map size */
-      u32MapSize = (orxU32)orxALIGN(_pstBank->u32SegmentSize, 32) >> 5;
-
-      /* Allocates new cell map */
-      au32NewCellMap = (orxU32 *)orxMemory_Reallocate(_pstBank->au32CellMap, u32NewSegmentCount * u32MapSize * sizeof(orxU32), orxMEMORY_TYPE_SYSTEM);
-
-      /* Success? */
-      if(au32NewCellMap != orxNULL)
-      {
-        orxU32 *au32NewSegmentFree;
-
-        /* Stores it */
-        _pstBank->au32CellMap = au32NewCellMap;
-
-        /* Allocates new segment free */
-        au32NewSegmentFree = (orxU32 *)orxMemory_Reallocate(_pstBank->au32SegmentFree, u32NewSegmentCount * sizeof(orxU32), orxMEMORY_TYPE_SYSTEM);
-
-        /* Success? */
-        if(au32NewSegmentFree != orxNULL)
-        {
-          /* Stores it */
-          _pstBank->au32SegmentFree = au32NewSegmentFree;
-        }
-      }
-    }
+  /* Checks */
+  orxASSERT(sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBank != orxNULL);
 
-    /* Updates segment count */
-    _pstBank->u32SegmentCount = u32NewSegmentCount;
-  }
+  /* Shrinks it */
+  orxBank_Shrink(_pstBank, 0);
 
   /* Done! */
   return;
@@ -898,7 +1069,7 @@ void *orxFASTCALL orxBank_GetAtIndex(const orxBANK *_pstBank, orxU32 _u32Index)
   /* Checks */
   orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBank != orxNULL);
-  orxASSERT(_pstBank->au32SegmentFree[_u32Index / _pstBank->u32SegmentSize] <= _pstBank->u32SegmentSize);
+  orxASSERT((_u32Index >= _pstBank->u32SegmentCount * _pstBank->u32SegmentSize) || (_pstBank->au32SegmentFree[_u32Index / _pstBank->u32SegmentSize] <= _pstBank->u32SegmentSize));
 
   /* Is within segment boundaries? */
   if(_u32Index < _pstBank->u32SegmentCount * _pstBank->u32SegmentSize)
@@ -938,3 +1109,65 @@ orxU32 orxFASTCALL orxBank_GetCount(const orxBANK *_pstBank)
   /* Done! */
   return _pstBank->u32CellCount;
 }
+
+/** Gets a bank stats
+ * @param[in] _pstBank    Concerned bank
+ * @param[out] _pstStats  Stats to fill
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxBank_GetStats(const orxBANK *_pstBank, orxBANK_STATS *_pstStats)
+{
+  orxU32    i, u32UsedSegmentCount;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBank != orxNULL);
+  orxASSERT(_pstStats != orxNULL);
+
+  /* For all segments */
+  for(i = 0, u32UsedSegmentCount = 0; i < _pstBank->u32SegmentCount; i++)
+  {
+    /* Is used? */
+    if(_pstBank->au32SegmentFree[i] != _pstBank->u32SegmentSize)
+    {
+      /* Updates count */
+      u32UsedSegmentCount++;
+    }
+  }
+
+  /* Stores stats */
+  _pstStats->u32CellCount         = _pstBank->u32CellCount;
+  _pstStats->u32PeakCellCount     = _pstBank->u32PeakCellCount;
+  _pstStats->u32CellSize          = _pstBank->u32CellSize;
+  _pstStats->u32SegmentSize       = _pstBank->u32SegmentSize;
+  _pstStats->u32SegmentCount      = _pstBank->u32SegmentCount;
+  _pstStats->u32UsedSegmentCount  = u32UsedSegmentCount;
+  _pstStats->u64Size              = (orxU64)_pstBank->u32SegmentCount * (orxU64)(_pstBank->u32SegmentSize * _pstBank->u32CellSize + sstBank.u32CacheLineSize - 1);
+  _pstStats->fFragmentation       = (u32UsedSegmentCount != 0)
+                                  ? orxFLOAT_1 - orxU2F(_pstBank->u32CellCount) / orxU2F(u32UsedSegmentCount * _pstBank->u32SegmentSize)
+                                  : orxFLOAT_0;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets the next bank, used to iterate over all the existing banks
+ * @param[in] _pstBank    Current bank, orxNULL to get the first one
+ * @return The next bank if found, orxNULL otherwise
+ */
+orxBANK *orxFASTCALL orxBank_GetNextBank(const orxBANK *_pstBank)
+{
+  orxBANK *pstResult;
+
+  /* Checks */
+  orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
+
+  /* Updates result */
+  pstResult = (_pstBank == orxNULL)
+            ? (orxBANK *)orxLinkList_GetFirst(&(sstBank.stBankList))
+            : (orxBANK *)orxLinkList_GetNext(&(_pstBank->stNode));
+
+  /* Done! */
+  return pstResult;
+}
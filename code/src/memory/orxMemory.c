@@ -86,6 +86,14 @@
 
 #define orxMEMORY_KU32_DEFAULT_CACHE_LINE_SIZE  64
 #define orxMEMORY_KU32_TAG_SIZE                 16
+#define orxMEMORY_KU32_FRAME_CHUNK_SIZE         262144
+#define orxMEMORY_KU32_FRAME_ALIGNMENT          16
+
+#ifdef __orxMSVC__
+  #define orxMEMORY_THREAD_LOCAL                __declspec(thread)
+#else /* __orxMSVC__ */
+  #define orxMEMORY_THREAD_LOCAL                __thread
+#endif /* __orxMSVC__ */
 
 #define orxMEMORY_KZ_LITERAL_PREFIX             "MEM_"
 
@@ -102,6 +110,22 @@ typedef struct __orxMEMORY_TRACKER_t
 
 } orxMEMORY_TRACKER;
 
+typedef struct __orxMEMORY_FRAME_CHUNK_t
+{
+  struct __orxMEMORY_FRAME_CHUNK_t *pstNext;                  /**< Next chunk */
+  orxU32                            u32Size;                  /**< Size */
+  orxU32                            u32Used;                  /**< Used size */
+
+} orxMEMORY_FRAME_CHUNK;
+
+typedef struct __orxMEMORY_FRAME_ARENA_t
+{
+  orxMEMORY_FRAME_CHUNK  *pstFirst;                           /**< First chunk */
+  orxMEMORY_FRAME_CHUNK  *pstCurrent;                         /**< Current chunk */
+  orxU32                  u32FrameCount;                      /**< Frame count of last use */
+
+} orxMEMORY_FRAME_ARENA;
+
 typedef struct __orxMEMORY_STATIC_t
 {
 #ifdef __orxPROFILER__
@@ -110,6 +134,7 @@ typedef struct __orxMEMORY_STATIC_t
 
 #endif /* __orxPROFILER__ */
 
+  volatile orxU32 u32FrameCount;  /**< Frame count, used to reset arenas lazily on each thread */
   orxU32 u32Flags;   /**< Flags set by the memory module */
 
 } orxMEMORY_STATIC;
@@ -120,6 +145,7 @@ typedef struct __orxMEMORY_STATIC_t
  ***************************************************************************/
 
 static orxMEMORY_STATIC sstMemory;
+static orxMEMORY_THREAD_LOCAL orxMEMORY_FRAME_ARENA sstFrameArena;
 
 
 /***************************************************************************
@@ -223,6 +249,95 @@ static orxINLINE orxU32 orxMemory_CacheLineSize()
 
 #endif
 
+/** Gets a frame chunk's data
+ * @param[in] _pstChunk         Concerned chunk
+ * @return Chunk's data (aligned)
+ */
+static orxINLINE orxU8 *orxMemory_GetFrameChunkData(orxMEMORY_FRAME_CHUNK *_pstChunk)
+{
+  /* Done! */
+  return (orxU8 *)orxALIGN((orxU8 *)_pstChunk + sizeof(orxMEMORY_FRAME_CHUNK), orxMEMORY_KU32_FRAME_ALIGNMENT);
+}
+
+/** Creates a frame chunk
+ * @param[in] _u32Size          Chunk's data size
+ * @return orxMEMORY_FRAME_CHUNK / orxNULL
+ */
+static orxMEMORY_FRAME_CHUNK *orxFASTCALL orxMemory_CreateFrameChunk(orxU32 _u32Size)
+{
+  orxMEMORY_FRAME_CHUNK *pstResult;
+
+  /* Allocates it */
+  pstResult = (orxMEMORY_FRAME_CHUNK *)orxMemory_Allocate(_u32Size + sizeof(orxMEMORY_FRAME_CHUNK) + orxMEMORY_KU32_FRAME_ALIGNMENT, orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits it */
+    pstResult->pstNext  = orxNULL;
+    pstResult->u32Size  = _u32Size;
+    pstResult->u32Used  = 0;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes all the current thread's frame chunks
+ */
+static void orxFASTCALL orxMemory_DeleteFrameChunks()
+{
+  orxMEMORY_FRAME_CHUNK *pstChunk;
+
+  /* For all chunks */
+  for(pstChunk = sstFrameArena.pstFirst; pstChunk != orxNULL;)
+  {
+    orxMEMORY_FRAME_CHUNK *pstNext;
+
+    /* Deletes it */
+    pstNext = pstChunk->pstNext;
+    orxMemory_Free(pstChunk);
+    pstChunk = pstNext;
+  }
+
+  /* Clears arena */
+  sstFrameArena.pstFirst = sstFrameArena.pstCurrent = orxNULL;
+
+  /* Done! */
+  return;
+}
+
+/** Rewinds the current thread's frame arena, merging all its chunks into a single one if needed
+ */
+static void orxFASTCALL orxMemory_RewindFrameArena()
+{
+  /* Has more than one chunk? */
+  if((sstFrameArena.pstFirst != orxNULL) && (sstFrameArena.pstFirst->pstNext != orxNULL))
+  {
+    orxMEMORY_FRAME_CHUNK  *pstChunk;
+    orxU32                  u32Size;
+
+    /* Gets total size */
+    for(pstChunk = sstFrameArena.pstFirst, u32Size = 0; pstChunk != orxNULL; u32Size += pstChunk->u32Size, pstChunk = pstChunk->pstNext)
+    ;
+
+    /* Deletes all chunks */
+    orxMemory_DeleteFrameChunks();
+
+    /* Creates a single one, big enough for last frame's usage */
+    sstFrameArena.pstFirst = sstFrameArena.pstCurrent = orxMemory_CreateFrameChunk(u32Size);
+  }
+  else if(sstFrameArena.pstFirst != orxNULL)
+  {
+    /* Rewinds it */
+    sstFrameArena.pstFirst->u32Used = 0;
+    sstFrameArena.pstCurrent        = sstFrameArena.pstFirst;
+  }
+
+  /* Done! */
+  return;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -288,6 +403,9 @@ void orxFASTCALL orxMemory_Exit()
   /* Module initialized ? */
   if((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY)
   {
+    /* Deletes frame memory */
+    orxMemory_DeleteFrameChunks();
+
     /* Finalizes rpmalloc */
     rpmalloc_finalize();
 
@@ -321,6 +439,9 @@ void orxFASTCALL orxMemory_ExitThread()
   /* Checks */
   orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
 
+  /* Deletes frame memory */
+  orxMemory_DeleteFrameChunks();
+
   /* Finalizes rpmalloc */
   rpmalloc_thread_finalize(1);
 
@@ -479,6 +600,100 @@ void orxFASTCALL orxMemory_Free(void *_pMem)
   return;
 }
 
+/** Allocates some frame memory from the current thread's arena: it is only valid until the end of the current core clock tick and should never be freed
+ * @param[in]  _u32Size  Size of the memory to allocate
+ * @return  returns a pointer to the memory allocated (16 bytes aligned), or orxNULL if an error has occurred
+ */
+void *orxFASTCALL orxMemory_AllocateFrame(orxU32 _u32Size)
+{
+  orxMEMORY_FRAME_CHUNK  *pstChunk;
+  orxU32                  u32Size;
+  void                   *pResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Gets aligned size */
+  u32Size = (orxU32)orxALIGN(_u32Size, orxMEMORY_KU32_FRAME_ALIGNMENT);
+
+  /* New frame since last use on this thread? */
+  if(sstFrameArena.u32FrameCount != sstMemory.u32FrameCount)
+  {
+    /* Rewinds arena */
+    orxMemory_RewindFrameArena();
+
+    /* Updates frame count */
+    sstFrameArena.u32FrameCount = sstMemory.u32FrameCount;
+  }
+
+  /* Gets current chunk */
+  pstChunk = sstFrameArena.pstCurrent;
+
+  /* Not enough room? */
+  if((pstChunk == orxNULL) || (pstChunk->u32Used + u32Size > pstChunk->u32Size))
+  {
+    /* Creates new chunk */
+    pstChunk = orxMemory_CreateFrameChunk((u32Size > orxMEMORY_KU32_FRAME_CHUNK_SIZE) ? u32Size : orxMEMORY_KU32_FRAME_CHUNK_SIZE);
+
+    /* Success? */
+    if(pstChunk != orxNULL)
+    {
+      /* Links it */
+      if(sstFrameArena.pstCurrent != orxNULL)
+      {
+        sstFrameArena.pstCurrent->pstNext = pstChunk;
+      }
+      else
+      {
+        sstFrameArena.pstFirst = pstChunk;
+      }
+      sstFrameArena.pstCurrent = pstChunk;
+    }
+  }
+
+  /* Valid? */
+  if(pstChunk != orxNULL)
+  {
+    /* Updates result */
+    pResult = orxMemory_GetFrameChunkData(pstChunk) + pstChunk->u32Used;
+
+    /* Updates chunk */
+    pstChunk->u32Used += u32Size;
+
+#ifdef __orxPROFILER__
+
+    /* Updates frame usage */
+    orxMemory_Track(orxMEMORY_TYPE_FRAME, u32Size, orxTRUE);
+
+#endif /* __orxPROFILER__ */
+  }
+
+  /* Done! */
+  return pResult;
+}
+
+/** Resets frame memory for all threads, called by the clock module at the end of each core clock tick, *do not* call it unless you know what you're doing
+ */
+void orxFASTCALL orxMemory_ResetFrame()
+{
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Updates frame count: each thread will rewind its arena upon its next frame allocation */
+  orxMEMORY_ATOMIC_INC32(&(sstMemory.u32FrameCount));
+
+#ifdef __orxPROFILER__
+
+  /* Resets frame usage (peaks are kept) */
+  sstMemory.astMemoryTrackerList[orxMEMORY_TYPE_FRAME].u64Count = 0;
+  sstMemory.astMemoryTrackerList[orxMEMORY_TYPE_FRAME].u64Size  = 0;
+
+#endif /* __orxPROFILER__ */
+
+  /* Done! */
+  return;
+}
+
 /** Gets memory type literal name
  * @param[in] _eMemType               Concerned memory type
  * @return Memory type name
@@ -505,6 +720,7 @@ const orxSTRING orxFASTCALL orxMemory_GetTypeName(orxMEMORY_TYPE _eMemType)
     orxMEMORY_DECLARE_TYPE_NAME(SYSTEM);
     orxMEMORY_DECLARE_TYPE_NAME(TEMP);
     orxMEMORY_DECLARE_TYPE_NAME(DEBUG);
+    orxMEMORY_DECLARE_TYPE_NAME(FRAME);
     default:
     {
       /* Logs message */
@@ -1211,50 +1211,78 @@ static void orxFASTCALL orxFX_ComputeSlot(const orxFX_SLOT *_pstFXSlot, orxFX_CO
  */
 static orxSTATUS orxFASTCALL orxFX_EventHandler(const orxEVENT *_pstEvent)
 {
-  orxRESOURCE_EVENT_PAYLOAD  *pstPayload;
-  orxSTATUS                   eResult = orxSTATUS_SUCCESS;
+  orxCONFIG_EVENT_PAYLOAD  *pstPayload;
+  orxFX                    *pstFX;
+  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
 
   /* Checks */
-  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_RESOURCE);
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_CONFIG);
+  orxASSERT(_pstEvent->eID == orxCONFIG_EVENT_SECTION_UPDATE);
 
   /* Gets payload */
-  pstPayload = (orxRESOURCE_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+  pstPayload = (orxCONFIG_EVENT_PAYLOAD *)_pstEvent->pstPayload;
 
-  /* Is config group? */
-  if(pstPayload->stGroupID == orxString_Hash(orxCONFIG_KZ_RESOURCE_GROUP))
+  /* For all FXs */
+  for(pstFX = orxFX(orxStructure_GetFirst(orxSTRUCTURE_ID_FX));
+      pstFX != orxNULL;
+      pstFX = orxFX(orxStructure_GetNext(pstFX)))
   {
-    orxFX *pstFX;
-
-    /* For all FXs */
-    for(pstFX = orxFX(orxStructure_GetFirst(orxSTRUCTURE_ID_FX));
-        pstFX != orxNULL;
-        pstFX = orxFX(orxStructure_GetNext(pstFX)))
+    /* Has reference? */
+    if((pstFX->zReference != orxNULL) && (pstFX->zReference != orxSTRING_EMPTY))
     {
-      /* Has reference? */
-      if((pstFX->zReference != orxNULL) && (pstFX->zReference != orxSTRING_EMPTY))
+      orxBOOL bUpdate;
+
+      /* Is its own section or one of its ancestors? */
+      if(orxConfig_IsSectionAffected(pstFX->zReference, pstPayload->zSectionName) != orxFALSE)
       {
-        /* Matches? */
-        if(orxConfig_GetOriginID(pstFX->zReference) == pstPayload->stNameID)
-        {
-          orxU32 i;
+        /* Updates status */
+        bUpdate = orxTRUE;
+      }
+      else
+      {
+        orxU32 u32SlotCount, i;
+
+        /* Pushes its config section */
+        orxConfig_PushSection(pstFX->zReference);
 
-          /* For all slots */
-          for(i = 0; i < orxFX_KU32_SLOT_NUMBER; i++)
+        /* For all its slots */
+        for(i = 0, u32SlotCount = orxConfig_GetListCount(orxFX_KZ_CONFIG_SLOT_LIST), bUpdate = orxFALSE; i < u32SlotCount; i++)
+        {
+          /* Is affected by the updated section? */
+          if(orxConfig_IsSectionAffected(orxConfig_GetListString(orxFX_KZ_CONFIG_SLOT_LIST, i), pstPayload->zSectionName) != orxFALSE)
           {
-            /* Clears it */
-            orxFLAG_SET(pstFX->astFXSlotList[i].u32Flags, orxFX_SLOT_KU32_FLAG_NONE, orxFX_SLOT_KU32_FLAG_DEFINED);
+            /* Updates status */
+            bUpdate = orxTRUE;
+
+            break;
           }
+        }
 
-          /* Resets duration & offset */
-          pstFX->fDuration  = orxFLOAT_0;
-          pstFX->fOffset    = orxFLOAT_0;
+        /* Pops config section */
+        orxConfig_PopSection();
+      }
 
-          /* Clears status */
-          orxStructure_SetFlags(pstFX, orxFX_KU32_FLAG_NONE, orxFX_KU32_FLAG_LOOP | orxFX_KU32_FLAG_STAGGERED);
+      /* Should update? */
+      if(bUpdate != orxFALSE)
+      {
+        orxU32 i;
 
-          /* Re-processes its data */
-          orxFX_ProcessData(pstFX);
+        /* For all slots */
+        for(i = 0; i < orxFX_KU32_SLOT_NUMBER; i++)
+        {
+          /* Clears it */
+          orxFLAG_SET(pstFX->astFXSlotList[i].u32Flags, orxFX_SLOT_KU32_FLAG_NONE, orxFX_SLOT_KU32_FLAG_DEFINED);
         }
+
+        /* Resets duration & offset */
+        pstFX->fDuration  = orxFLOAT_0;
+        pstFX->fOffset    = orxFLOAT_0;
+
+        /* Clears status */
+        orxStructure_SetFlags(pstFX, orxFX_KU32_FLAG_NONE, orxFX_KU32_FLAG_LOOP | orxFX_KU32_FLAG_STAGGERED);
+
+        /* Re-processes its data */
+        orxFX_ProcessData(pstFX);
       }
     }
   }
@@ -1400,8 +1428,8 @@ orxSTATUS orxFASTCALL orxFX_Init()
 #undef orxFX_REGISTER_TYPE
 
           /* Adds event handler */
-          orxEvent_AddHandler(orxEVENT_TYPE_RESOURCE, orxFX_EventHandler);
-          orxEvent_SetHandlerIDFlags(orxFX_EventHandler, orxEVENT_TYPE_RESOURCE, orxNULL, orxEVENT_GET_FLAG(orxRESOURCE_EVENT_ADD) | orxEVENT_GET_FLAG(orxRESOURCE_EVENT_UPDATE), orxEVENT_KU32_MASK_ID_ALL);
+          orxEvent_AddHandler(orxEVENT_TYPE_CONFIG, orxFX_EventHandler);
+          orxEvent_SetHandlerIDFlags(orxFX_EventHandler, orxEVENT_TYPE_CONFIG, orxNULL, orxEVENT_GET_FLAG(orxCONFIG_EVENT_SECTION_UPDATE), orxEVENT_KU32_MASK_ID_ALL);
         }
       }
       else
@@ -1429,7 +1457,7 @@ orxSTATUS orxFASTCALL orxFX_Init()
   if(eResult == orxSTATUS_FAILURE)
   {
     /* Removes event handler */
-    orxEvent_RemoveHandler(orxEVENT_TYPE_RESOURCE, orxFX_EventHandler);
+    orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, orxFX_EventHandler);
 
     /* Deletes ID table if needed */
     if(sstFX.pstIDTable != orxNULL)
@@ -1456,7 +1484,7 @@ void orxFASTCALL orxFX_Exit()
   if(sstFX.u32Flags & orxFX_KU32_STATIC_FLAG_READY)
   {
     /* Removes event handler */
-    orxEvent_RemoveHandler(orxEVENT_TYPE_RESOURCE, orxFX_EventHandler);
+    orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, orxFX_EventHandler);
 
     /* Deletes FX list */
     orxFX_DeleteAll();
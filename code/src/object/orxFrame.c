@@ -38,6 +38,8 @@
 #include "memory/orxBank.h"
 #include "object/orxStructure.h"
 #include "math/orxMath.h"
+#include "core/orxConfig.h"
+#include "core/orxThread.h"
 
 
 /** Module flags
@@ -45,7 +47,12 @@
 #define orxFRAME_KU32_STATIC_FLAG_NONE                        0x00000000  /**< No flags */
 
 #define orxFRAME_KU32_STATIC_FLAG_READY                       0x00000001  /**< Ready flag */
+#define orxFRAME_KU32_STATIC_FLAG_LAZY                        0x00000002  /**< Lazy update flag */
+#define orxFRAME_KU32_STATIC_FLAG_TRACK                       0x00000004  /**< Track moved frames flag */
+#define orxFRAME_KU32_STATIC_FLAG_PARALLEL                    0x00000008  /**< Parallel update flag */
 #define orxFRAME_KU32_STATIC_FLAG_DATA_2D                     0x00000010  /**< 2D flag */
+#define orxFRAME_KU32_STATIC_FLAG_OVERFLOW                    0x00000020  /**< Moved list overflow flag */
+#define orxFRAME_KU32_STATIC_FLAG_WORKERS                     0x00000040  /**< Processing on task workers flag */
 
 #define orxFRAME_KU32_STATIC_MASK_DEFAULT                     0x00000010  /**< Default flag */
 
@@ -56,7 +63,12 @@
  */
 #define orxFRAME_KU32_FLAG_NONE                               0x00000000  /**< No flags */
 
+#define orxFRAME_KU32_FLAG_MOVED                              0x08000000  /**< Moved flag: frame is in the moved list */
 #define orxFRAME_KU32_FLAG_DATA_2D                            0x10000000  /**< 2D ID flag */
+#define orxFRAME_KU32_FLAG_DIRTY                              0x20000000  /**< Dirty flag: global data needs to be recomputed from local data */
+#define orxFRAME_KU32_FLAG_DIRTY_CHILD                        0x40000000  /**< Dirty child flag: at least one descendant is dirty */
+
+#define orxFRAME_KU32_MASK_DIRTY                              0x60000000  /**< Dirty mask */
 
 #define orxFRAME_KU32_MASK_ALL                                0xFFFFFFFF  /**< All mask */
 
@@ -65,6 +77,12 @@
  */
 #define orxFRAME_KU32_BANK_SIZE                               2048        /**< Bank size */
 #define orxFRAME_KU32_RESULT_BUFFER_SIZE                      128
+#define orxFRAME_KU32_PROCESS_LIST_SIZE                       256         /**< Process list initial size */
+#define orxFRAME_KU32_MOVED_LIST_SIZE                         256         /**< Moved list initial size */
+
+#define orxFRAME_KZ_CONFIG_SECTION                            "Frame"
+#define orxFRAME_KZ_CONFIG_LAZY_UPDATE                        "LazyUpdate"
+#define orxFRAME_KZ_CONFIG_PARALLEL_UPDATE                    "ParallelUpdate"
 
 #define orxFRAME_KZ_NONE                                      "none"
 #define orxFRAME_KZ_ROTATION                                  "rotation"
@@ -84,18 +102,19 @@
  * Structure declaration                                                   *
  ***************************************************************************/
 
-/** Internal 2D Frame Data structure
+/** Internal 2D Frame Data structure (structure of arrays, indexed by frame bank index)
  */
 typedef struct __orxFRAME_DATA_2D_t
 {
-  orxVECTOR vGlobalPos;                                       /**< Global 2D coordinates : 12 */
-  orxFLOAT  fGlobalRotation;                                  /**< Global 2D rotation angle : 16 */
-  orxVECTOR vLocalPos;                                        /**< Local 2D coordinates : 28 */
-  orxFLOAT  fLocalRotation;                                   /**< Local 2D rotation angle : 32 */
-  orxFLOAT  fGlobalScaleX;                                    /**< Global 2D isometric X scale : 36 */
-  orxFLOAT  fGlobalScaleY;                                    /**< Global 2D isometric Y scale : 40 */
-  orxFLOAT  fLocalScaleX;                                     /**< Local 2D isometric X scale : 44 */
-  orxFLOAT  fLocalScaleY;                                     /**< Local 2D isometric Y scale : 48 */
+  orxVECTOR  *avGlobalPos;                                    /**< Global 2D coordinates */
+  orxVECTOR  *avLocalPos;                                     /**< Local 2D coordinates */
+  orxFLOAT   *afGlobalRotation;                               /**< Global 2D rotation angles */
+  orxFLOAT   *afLocalRotation;                                /**< Local 2D rotation angles */
+  orxFLOAT   *afGlobalScaleX;                                 /**< Global 2D isometric X scales */
+  orxFLOAT   *afGlobalScaleY;                                 /**< Global 2D isometric Y scales */
+  orxFLOAT   *afLocalScaleX;                                  /**< Local 2D isometric X scales */
+  orxFLOAT   *afLocalScaleY;                                  /**< Local 2D isometric Y scales */
+  orxU32      u32Size;                                        /**< Number of allocated entries */
 
 } orxFRAME_DATA_2D;
 
@@ -105,7 +124,9 @@ typedef struct __orxFRAME_DATA_2D_t
 struct __orxFRAME_t
 {
   orxSTRUCTURE      stStructure;                              /**< Public structure, first structure member : 32 */
-  orxFRAME_DATA_2D  stData;                                   /**< Frame data : 64 */
+  orxU32            u32Index;                                 /**< Frame data index : 36 */
+  orxU32            u32Stamp;                                 /**< Update count at last global data modification : 40 */
+  orxU32            u32MovedIndex;                            /**< Index in the moved list : 44 */
 };
 
 /** Static structure
@@ -114,7 +135,13 @@ typedef struct __orxFRAME_STATIC_t
 {
   orxU32    u32Flags;                                         /**< Control flags */
   orxFRAME *pstRoot;                                          /**< Frame root */
-  orxBANK  *pst2DDataBank;                                    /**< 2D Data bank */
+  orxFRAME_DATA_2D stData;                                    /**< 2D data */
+  orxU32    u32UpdateCount;                                   /**< Update count */
+  orxFRAME **apstProcessList;                                 /**< Process list (lazy update) */
+  orxU32    u32ProcessSize;                                   /**< Process list size */
+  orxFRAME **apstMovedList;                                   /**< Moved list (frames whose global data got modified since last flush) */
+  orxU32    u32MovedCount;                                    /**< Moved list count */
+  orxU32    u32MovedSize;                                     /**< Moved list size */
   orxCHAR   acResultBuffer[orxFRAME_KU32_RESULT_BUFFER_SIZE]; /**< Result buffer */
 
 } orxFRAME_STATIC;
@@ -147,12 +174,12 @@ static orxINLINE orxBOOL _orxFrame_SetPosition(orxFRAME *_pstFrame, const orxVEC
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
     /* Different? */
-    if((_pvPos->fX != _pstFrame->stData.vGlobalPos.fX)
-    || (_pvPos->fY != _pstFrame->stData.vGlobalPos.fY)
-    || (_pvPos->fZ != _pstFrame->stData.vGlobalPos.fZ))
+    if((_pvPos->fX != sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fX)
+    || (_pvPos->fY != sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fY)
+    || (_pvPos->fZ != sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fZ))
     {
       /* Stores it */
-      orxVector_Copy(&(_pstFrame->stData.vGlobalPos), _pvPos);
+      orxVector_Copy(&(sstFrame.stData.avGlobalPos[_pstFrame->u32Index]), _pvPos);
 
       /* Updates result */
       bResult = orxTRUE;
@@ -161,12 +188,12 @@ static orxINLINE orxBOOL _orxFrame_SetPosition(orxFRAME *_pstFrame, const orxVEC
   else
   {
     /* Different? */
-    if((_pvPos->fX != _pstFrame->stData.vLocalPos.fX)
-    || (_pvPos->fY != _pstFrame->stData.vLocalPos.fY)
-    || (_pvPos->fZ != _pstFrame->stData.vLocalPos.fZ))
+    if((_pvPos->fX != sstFrame.stData.avLocalPos[_pstFrame->u32Index].fX)
+    || (_pvPos->fY != sstFrame.stData.avLocalPos[_pstFrame->u32Index].fY)
+    || (_pvPos->fZ != sstFrame.stData.avLocalPos[_pstFrame->u32Index].fZ))
     {
       /* Stores it */
-      orxVector_Copy(&(_pstFrame->stData.vLocalPos), _pvPos);
+      orxVector_Copy(&(sstFrame.stData.avLocalPos[_pstFrame->u32Index]), _pvPos);
 
       /* Updates result */
       bResult = orxTRUE;
@@ -191,10 +218,10 @@ static orxINLINE orxBOOL _orxFrame_SetRotation(orxFRAME *_pstFrame, orxFLOAT _fR
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
     /* Different? */
-    if(_fRotation != _pstFrame->stData.fGlobalRotation)
+    if(_fRotation != sstFrame.stData.afGlobalRotation[_pstFrame->u32Index])
     {
       /* Stores it */
-      _pstFrame->stData.fGlobalRotation = _fRotation;
+      sstFrame.stData.afGlobalRotation[_pstFrame->u32Index] = _fRotation;
 
       /* Updates result */
       bResult = orxTRUE;
@@ -203,10 +230,10 @@ static orxINLINE orxBOOL _orxFrame_SetRotation(orxFRAME *_pstFrame, orxFLOAT _fR
   else
   {
     /* Different? */
-    if(_fRotation != _pstFrame->stData.fLocalRotation)
+    if(_fRotation != sstFrame.stData.afLocalRotation[_pstFrame->u32Index])
     {
       /* Stores it */
-      _pstFrame->stData.fLocalRotation = _fRotation;
+      sstFrame.stData.afLocalRotation[_pstFrame->u32Index] = _fRotation;
 
       /* Updates result */
       bResult = orxTRUE;
@@ -231,12 +258,12 @@ static orxINLINE orxBOOL _orxFrame_SetScale(orxFRAME *_pstFrame, const orxVECTOR
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
     /* Different? */
-    if((_pvScale->fX != _pstFrame->stData.fGlobalScaleX)
-    || (_pvScale->fY != _pstFrame->stData.fGlobalScaleY))
+    if((_pvScale->fX != sstFrame.stData.afGlobalScaleX[_pstFrame->u32Index])
+    || (_pvScale->fY != sstFrame.stData.afGlobalScaleY[_pstFrame->u32Index]))
     {
       /* Stores it */
-      _pstFrame->stData.fGlobalScaleX = _pvScale->fX;
-      _pstFrame->stData.fGlobalScaleY = _pvScale->fY;
+      sstFrame.stData.afGlobalScaleX[_pstFrame->u32Index] = _pvScale->fX;
+      sstFrame.stData.afGlobalScaleY[_pstFrame->u32Index] = _pvScale->fY;
 
       /* Updates result */
       bResult = orxTRUE;
@@ -245,12 +272,12 @@ static orxINLINE orxBOOL _orxFrame_SetScale(orxFRAME *_pstFrame, const orxVECTOR
   else
   {
     /* Different? */
-    if((_pvScale->fX != _pstFrame->stData.fLocalScaleX)
-    || (_pvScale->fY != _pstFrame->stData.fLocalScaleY))
+    if((_pvScale->fX != sstFrame.stData.afLocalScaleX[_pstFrame->u32Index])
+    || (_pvScale->fY != sstFrame.stData.afLocalScaleY[_pstFrame->u32Index]))
     {
       /* Stores it */
-      _pstFrame->stData.fLocalScaleX = _pvScale->fX;
-      _pstFrame->stData.fLocalScaleY = _pvScale->fY;
+      sstFrame.stData.afLocalScaleX[_pstFrame->u32Index] = _pvScale->fX;
+      sstFrame.stData.afLocalScaleY[_pstFrame->u32Index] = _pvScale->fY;
 
       /* Updates result */
       bResult = orxTRUE;
@@ -273,11 +300,11 @@ static orxINLINE const orxVECTOR *_orxFrame_GetPosition(const orxFRAME *_pstFram
   /* Updates result */
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
-    pvResult = &(_pstFrame->stData.vGlobalPos);
+    pvResult = &(sstFrame.stData.avGlobalPos[_pstFrame->u32Index]);
   }
   else
   {
-    pvResult = &(_pstFrame->stData.vLocalPos);
+    pvResult = &(sstFrame.stData.avLocalPos[_pstFrame->u32Index]);
   }
 
   /* Done */
@@ -296,11 +323,11 @@ static orxINLINE orxFLOAT _orxFrame_GetRotation(const orxFRAME *_pstFrame, orxFR
   /* Updates result */
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
-    fRotation = _pstFrame->stData.fGlobalRotation;
+    fRotation = sstFrame.stData.afGlobalRotation[_pstFrame->u32Index];
   }
   else
   {
-    fRotation = _pstFrame->stData.fLocalRotation;
+    fRotation = sstFrame.stData.afLocalRotation[_pstFrame->u32Index];
   }
 
   /* Done */
@@ -320,13 +347,13 @@ static orxINLINE orxVECTOR *_orxFrame_GetScale(const orxFRAME *_pstFrame, orxFRA
   /* Updates result */
   if(_eSpace == orxFRAME_SPACE_GLOBAL)
   {
-    _pvScale->fX = _pstFrame->stData.fGlobalScaleX;
-    _pvScale->fY = _pstFrame->stData.fGlobalScaleY;
+    _pvScale->fX = sstFrame.stData.afGlobalScaleX[_pstFrame->u32Index];
+    _pvScale->fY = sstFrame.stData.afGlobalScaleY[_pstFrame->u32Index];
   }
   else
   {
-    _pvScale->fX = _pstFrame->stData.fLocalScaleX;
-    _pvScale->fY = _pstFrame->stData.fLocalScaleY;
+    _pvScale->fX = sstFrame.stData.afLocalScaleX[_pstFrame->u32Index];
+    _pvScale->fY = sstFrame.stData.afLocalScaleY[_pstFrame->u32Index];
   }
 
   /* No z scale */
@@ -353,7 +380,7 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalScale(const orxFRAME *_ps
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_X|orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Z:
     {
       _pvScale->fX = orxFLOAT_1;
-      _pvScale->fY = _pstFrame->stData.fGlobalScaleY;
+      _pvScale->fY = sstFrame.stData.afGlobalScaleY[_pstFrame->u32Index];
       break;
     }
     case orxFRAME_KU32_FLAG_IGNORE_SCALE_Y:
@@ -361,7 +388,7 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalScale(const orxFRAME *_ps
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Y:
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Y|orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Z:
     {
-      _pvScale->fX = _pstFrame->stData.fGlobalScaleX;
+      _pvScale->fX = sstFrame.stData.afGlobalScaleX[_pstFrame->u32Index];
       _pvScale->fY = orxFLOAT_1;
       break;
     }
@@ -378,8 +405,8 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalScale(const orxFRAME *_ps
     case orxFRAME_KU32_FLAG_IGNORE_SCALE_Z:
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_SCALE_Z:
     {
-      _pvScale->fX = _pstFrame->stData.fGlobalScaleX;
-      _pvScale->fY = _pstFrame->stData.fGlobalScaleY;
+      _pvScale->fX = sstFrame.stData.afGlobalScaleX[_pstFrame->u32Index];
+      _pvScale->fY = sstFrame.stData.afGlobalScaleY[_pstFrame->u32Index];
       break;
     }
   }
@@ -403,21 +430,21 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalPosition(const orxFRAME *
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_X:
     {
       _pvPos->fX = orxFLOAT_0;
-      _pvPos->fY = _pstFrame->stData.vGlobalPos.fY;
-      _pvPos->fZ = _pstFrame->stData.vGlobalPos.fZ;
+      _pvPos->fY = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fY;
+      _pvPos->fZ = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fZ;
       break;
     }
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Y:
     {
-      _pvPos->fX = _pstFrame->stData.vGlobalPos.fX;
+      _pvPos->fX = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fX;
       _pvPos->fY = orxFLOAT_0;
-      _pvPos->fZ = _pstFrame->stData.vGlobalPos.fZ;
+      _pvPos->fZ = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fZ;
       break;
     }
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Z:
     {
-      _pvPos->fX = _pstFrame->stData.vGlobalPos.fX;
-      _pvPos->fY = _pstFrame->stData.vGlobalPos.fY;
+      _pvPos->fX = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fX;
+      _pvPos->fY = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fY;
       _pvPos->fZ = orxFLOAT_0;
       break;
     }
@@ -425,19 +452,19 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalPosition(const orxFRAME *
     {
       _pvPos->fX = orxFLOAT_0;
       _pvPos->fY = orxFLOAT_0;
-      _pvPos->fZ = _pstFrame->stData.vGlobalPos.fZ;
+      _pvPos->fZ = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fZ;
       break;
     }
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_X|orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Z:
     {
       _pvPos->fX = orxFLOAT_0;
-      _pvPos->fY = _pstFrame->stData.vGlobalPos.fY;
+      _pvPos->fY = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fY;
       _pvPos->fZ = orxFLOAT_0;
       break;
     }
     case orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Y|orxFRAME_KU32_FLAG_IGNORE_POSITION_POSITION_Z:
     {
-      _pvPos->fX = _pstFrame->stData.vGlobalPos.fX;
+      _pvPos->fX = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fX;
       _pvPos->fY = orxFLOAT_0;
       _pvPos->fZ = orxFLOAT_0;
       break;
@@ -451,9 +478,9 @@ static orxINLINE orxVECTOR *orxFrame_GetCorrectedGlobalPosition(const orxFRAME *
     }
     default:
     {
-      _pvPos->fX = _pstFrame->stData.vGlobalPos.fX;
-      _pvPos->fY = _pstFrame->stData.vGlobalPos.fY;
-      _pvPos->fZ = _pstFrame->stData.vGlobalPos.fZ;
+      _pvPos->fX = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fX;
+      _pvPos->fY = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fY;
+      _pvPos->fZ = sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fZ;
       break;
     }
   }
@@ -603,6 +630,130 @@ static orxINLINE orxVECTOR *orxFrame_FromGlobalToLocalScale(const orxFRAME *_pst
   return pvResult;
 }
 
+/** Reserves room in the moved list
+ * @param[in]   _u32Size        Minimal size
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFrame_ReserveMovedList(orxU32 _u32Size)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Not enough room? */
+  if(_u32Size > sstFrame.u32MovedSize)
+  {
+    orxFRAME  **apstMovedList;
+    orxU32      u32NewSize;
+
+    /* Gets new size */
+    u32NewSize = orxMAX(orxMAX(sstFrame.u32MovedSize << 1, orxFRAME_KU32_MOVED_LIST_SIZE), _u32Size);
+
+    /* Reallocates list */
+    apstMovedList = (orxFRAME **)orxMemory_Reallocate(sstFrame.apstMovedList, u32NewSize * sizeof(orxFRAME *), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(apstMovedList != orxNULL)
+    {
+      /* Stores it */
+      sstFrame.apstMovedList  = apstMovedList;
+      sstFrame.u32MovedSize   = u32NewSize;
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stamps a frame after a global data modification and adds it to the moved list, if tracked
+ * @param[in]   _pstFrame       Concerned frame
+ * @param[in]   _u32Stamp       Stamp to set
+ */
+static orxINLINE void orxFrame_SetStamp(orxFRAME *_pstFrame, orxU32 _u32Stamp)
+{
+  /* Stores stamp */
+  _pstFrame->u32Stamp = _u32Stamp;
+
+  /* Tracked and not already listed? */
+  if(orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_TRACK)
+  && !orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_MOVED))
+  {
+    orxU32 u32Index;
+
+    /* Processed on task workers? */
+    if(orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_WORKERS))
+    {
+      /* Gets a slot (room has been reserved beforehand) */
+      u32Index = orxMEMORY_ATOMIC_INC32(&(sstFrame.u32MovedCount)) - 1;
+
+      /* Checks */
+      orxASSERT(u32Index < sstFrame.u32MovedSize);
+    }
+    else
+    {
+      /* Gets a slot */
+      u32Index = sstFrame.u32MovedCount;
+
+      /* Has room? */
+      if(orxFrame_ReserveMovedList(u32Index + 1) != orxSTATUS_FAILURE)
+      {
+        /* Updates count */
+        sstFrame.u32MovedCount++;
+      }
+      else
+      {
+        /* Updates status */
+        orxFLAG_SET(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_OVERFLOW, orxFRAME_KU32_STATIC_FLAG_NONE);
+
+        /* Invalidates slot */
+        u32Index = orxU32_UNDEFINED;
+      }
+    }
+
+    /* Valid slot? */
+    if(u32Index != orxU32_UNDEFINED)
+    {
+      /* Stores frame */
+      sstFrame.apstMovedList[u32Index] = _pstFrame;
+      _pstFrame->u32MovedIndex = u32Index;
+
+      /* Updates its status */
+      orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_MOVED, orxFRAME_KU32_FLAG_NONE);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Clears the moved list
+ */
+static void orxFASTCALL orxFrame_ClearMovedList()
+{
+  orxU32 i;
+
+  /* For all listed frames */
+  for(i = 0; i < sstFrame.u32MovedCount; i++)
+  {
+    /* Still valid? */
+    if(sstFrame.apstMovedList[i] != orxNULL)
+    {
+      /* Updates its status */
+      orxStructure_SetFlags(sstFrame.apstMovedList[i], orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_FLAG_MOVED);
+    }
+  }
+
+  /* Clears list */
+  sstFrame.u32MovedCount = 0;
+  orxFLAG_SET(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_NONE, orxFRAME_KU32_STATIC_FLAG_OVERFLOW);
+
+  /* Done! */
+  return;
+}
+
 /** Updates frame global data using parent's global and frame local ones
  * @param[out]  _pstFrame       Frame to update
  * @param[in]   _pstParent Parent frame to use for update
@@ -634,6 +785,9 @@ static orxINLINE void orxFrame_UpdateData(orxFRAME *_pstFrame, const orxFRAME *_
   _orxFrame_SetScale(_pstFrame, &vScale, orxFRAME_SPACE_GLOBAL);
   _orxFrame_SetPosition(_pstFrame, &vPos, orxFRAME_SPACE_GLOBAL);
 
+  /* Updates stamp */
+  orxFrame_SetStamp(_pstFrame, sstFrame.u32UpdateCount);
+
   /* Done! */
   return;
 }
@@ -646,6 +800,9 @@ static void orxFASTCALL orxFrame_ProcessInternal(orxFRAME *_pstFrame, const orxF
 {
   orxFRAME *pstChild;
 
+  /* Cleans its dirty status */
+  orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_MASK_DIRTY);
+
   /* Updates frame's data */
   orxFrame_UpdateData(_pstFrame, _pstParent);
 
@@ -671,6 +828,9 @@ static orxINLINE void orxFrame_Process(orxFRAME *_pstFrame, const orxFRAME *_pst
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxFrame_Process");
 
+  /* Updates count */
+  sstFrame.u32UpdateCount++;
+
   /* Processes frame */
   orxFrame_ProcessInternal(_pstFrame, _pstParent);
 
@@ -681,6 +841,297 @@ static orxINLINE void orxFrame_Process(orxFRAME *_pstFrame, const orxFRAME *_pst
   return;
 }
 
+/** Marks a frame as dirty (lazy update)
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_SetDirty(orxFRAME *_pstFrame)
+{
+  orxFRAME *pstParent;
+
+  /* Marks it as dirty */
+  orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY, orxFRAME_KU32_FLAG_NONE);
+
+  /* For all its ancestors, below root, not yet aware of a dirty descendant */
+  for(pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
+      (pstParent != orxNULL) && (pstParent != sstFrame.pstRoot) && !orxStructure_TestFlags(pstParent, orxFRAME_KU32_FLAG_DIRTY_CHILD);
+      pstParent = orxFRAME(orxStructure_GetParent(pstParent)))
+  {
+    /* Marks it */
+    orxStructure_SetFlags(pstParent, orxFRAME_KU32_FLAG_DIRTY_CHILD, orxFRAME_KU32_FLAG_NONE);
+  }
+
+  /* Updates count */
+  sstFrame.u32UpdateCount++;
+
+  /* Done! */
+  return;
+}
+
+/** Resolves a frame's global data (lazy update)
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_Resolve(orxFRAME *_pstFrame)
+{
+  /* Lazy update? */
+  if(orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_LAZY))
+  {
+    orxFRAME *pstFrame, *pstDirty = orxNULL;
+
+    /* Finds top-most dirty ancestor */
+    for(pstFrame = _pstFrame;
+        (pstFrame != orxNULL) && (pstFrame != sstFrame.pstRoot);
+        pstFrame = orxFRAME(orxStructure_GetParent(pstFrame)))
+    {
+      /* Dirty? */
+      if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DIRTY))
+      {
+        /* Stores it */
+        pstDirty = pstFrame;
+      }
+    }
+
+    /* Found? */
+    if(pstDirty != orxNULL)
+    {
+      /* Updates count */
+      sstFrame.u32UpdateCount++;
+
+      /* Processes it */
+      orxFrame_ProcessInternal(pstDirty, orxFRAME(orxStructure_GetParent(pstDirty)));
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Invalidates a frame after a local change
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_Invalidate(orxFRAME *_pstFrame)
+{
+  /* Lazy update? */
+  if(orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_LAZY))
+  {
+    /* Marks it as dirty */
+    orxFrame_SetDirty(_pstFrame);
+  }
+  else
+  {
+    /* Processes frame */
+    orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Invalidates a frame's children after a global change
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_InvalidateChildren(orxFRAME *_pstFrame)
+{
+  orxFRAME *pstChild;
+
+  /* For all children */
+  for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
+      pstChild != orxNULL;
+      pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
+  {
+    /* Lazy update? */
+    if(orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_LAZY))
+    {
+      /* Marks it as dirty */
+      orxFrame_SetDirty(pstChild);
+    }
+    else
+    {
+      /* Processes it */
+      orxFrame_Process(pstChild, _pstFrame);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Processes the dirty frames of a hierarchy, parents before children
+ * @param[in]   _pstFrame       Concerned frame
+ * @param[in]   _bDirty         Is parent dirty?
+ */
+static void orxFASTCALL orxFrame_ProcessDirty(orxFRAME *_pstFrame, orxBOOL _bDirty)
+{
+  orxFRAME *pstChild;
+
+  /* Is dirty? */
+  if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DIRTY))
+  {
+    /* Updates status */
+    _bDirty = orxTRUE;
+  }
+
+  /* Cleans its dirty status */
+  orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_MASK_DIRTY);
+
+  /* Was dirty? */
+  if(_bDirty != orxFALSE)
+  {
+    /* Updates its data */
+    orxFrame_UpdateData(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
+  }
+
+  /* For all its children */
+  for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
+      pstChild != orxNULL;
+      pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
+  {
+    /* Dirty or has dirty descendants? */
+    if((_bDirty != orxFALSE) || (orxStructure_TestFlags(pstChild, orxFRAME_KU32_MASK_DIRTY)))
+    {
+      /* Processes it */
+      orxFrame_ProcessDirty(pstChild, _bDirty);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Processes a range of independent hierarchies from the process list (run on task workers)
+ * @param[in]   _u32Begin       First hierarchy
+ * @param[in]   _u32End         Last hierarchy (excluded)
+ * @param[in]   _pContext       Unused
+ */
+static void orxFASTCALL orxFrame_ProcessHierarchies(orxU32 _u32Begin, orxU32 _u32End, void *_pContext)
+{
+  orxU32 i;
+
+  /* For all hierarchies */
+  for(i = _u32Begin; i < _u32End; i++)
+  {
+    /* Processes it */
+    orxFrame_ProcessDirty(sstFrame.apstProcessList[i], orxFALSE);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Adds a frame to the process list
+ * @param[in]   _pstFrame       Concerned frame
+ * @param[in]   _u32Count       Current process list count
+ * @return      New process list count
+ */
+static orxINLINE orxU32 orxFrame_AddToProcessList(orxFRAME *_pstFrame, orxU32 _u32Count)
+{
+  orxU32 u32Result = _u32Count;
+
+  /* Is list full? */
+  if(_u32Count >= sstFrame.u32ProcessSize)
+  {
+    orxFRAME  **apstProcessList;
+    orxU32      u32NewSize;
+
+    /* Gets new size */
+    u32NewSize = orxMAX(sstFrame.u32ProcessSize << 1, orxFRAME_KU32_PROCESS_LIST_SIZE);
+
+    /* Reallocates list */
+    apstProcessList = (orxFRAME **)orxMemory_Reallocate(sstFrame.apstProcessList, u32NewSize * sizeof(orxFRAME *), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(apstProcessList != orxNULL)
+    {
+      /* Stores it */
+      sstFrame.apstProcessList  = apstProcessList;
+      sstFrame.u32ProcessSize   = u32NewSize;
+    }
+  }
+
+  /* Has room? */
+  if(_u32Count < sstFrame.u32ProcessSize)
+  {
+    /* Stores frame */
+    sstFrame.apstProcessList[_u32Count] = _pstFrame;
+
+    /* Updates result */
+    u32Result++;
+  }
+  else
+  {
+    /* Resolves it right away */
+    orxFrame_Resolve(_pstFrame);
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Reserves room for frame data up to the given index
+ * @param[in]   _u32Index       Frame data index
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFrame_ReserveData(orxU32 _u32Index)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Not enough room? */
+  if(_u32Index >= sstFrame.stData.u32Size)
+  {
+    orxFRAME_DATA_2D  stData;
+    orxU8            *pu8Buffer;
+    orxU32            u32NewSize;
+
+    /* Gets new size */
+    for(u32NewSize = orxMAX(sstFrame.stData.u32Size, orxFRAME_KU32_BANK_SIZE); u32NewSize <= _u32Index; u32NewSize <<= 1);
+
+    /* Allocates all arrays in a single block */
+    pu8Buffer = (orxU8 *)orxMemory_Allocate(u32NewSize * (2 * sizeof(orxVECTOR) + 6 * sizeof(orxFLOAT)), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(pu8Buffer != orxNULL)
+    {
+      /* Dispatches arrays, vectors first */
+      stData.avGlobalPos      = (orxVECTOR *)pu8Buffer;
+      stData.avLocalPos       = stData.avGlobalPos + u32NewSize;
+      stData.afGlobalRotation = (orxFLOAT *)(stData.avLocalPos + u32NewSize);
+      stData.afLocalRotation  = stData.afGlobalRotation + u32NewSize;
+      stData.afGlobalScaleX   = stData.afLocalRotation + u32NewSize;
+      stData.afGlobalScaleY   = stData.afGlobalScaleX + u32NewSize;
+      stData.afLocalScaleX    = stData.afGlobalScaleY + u32NewSize;
+      stData.afLocalScaleY    = stData.afLocalScaleX + u32NewSize;
+      stData.u32Size          = u32NewSize;
+
+      /* Had previous data? */
+      if(sstFrame.stData.u32Size != 0)
+      {
+        /* Copies it */
+        orxMemory_Copy(stData.avGlobalPos, sstFrame.stData.avGlobalPos, sstFrame.stData.u32Size * sizeof(orxVECTOR));
+        orxMemory_Copy(stData.avLocalPos, sstFrame.stData.avLocalPos, sstFrame.stData.u32Size * sizeof(orxVECTOR));
+        orxMemory_Copy(stData.afGlobalRotation, sstFrame.stData.afGlobalRotation, sstFrame.stData.u32Size * sizeof(orxFLOAT));
+        orxMemory_Copy(stData.afLocalRotation, sstFrame.stData.afLocalRotation, sstFrame.stData.u32Size * sizeof(orxFLOAT));
+        orxMemory_Copy(stData.afGlobalScaleX, sstFrame.stData.afGlobalScaleX, sstFrame.stData.u32Size * sizeof(orxFLOAT));
+        orxMemory_Copy(stData.afGlobalScaleY, sstFrame.stData.afGlobalScaleY, sstFrame.stData.u32Size * sizeof(orxFLOAT));
+        orxMemory_Copy(stData.afLocalScaleX, sstFrame.stData.afLocalScaleX, sstFrame.stData.u32Size * sizeof(orxFLOAT));
+        orxMemory_Copy(stData.afLocalScaleY, sstFrame.stData.afLocalScaleY, sstFrame.stData.u32Size * sizeof(orxFLOAT));
+
+        /* Frees previous block */
+        orxMemory_Free(sstFrame.stData.avGlobalPos);
+      }
+
+      /* Stores new data */
+      orxMemory_Copy(&(sstFrame.stData), &stData, sizeof(orxFRAME_DATA_2D));
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Deletes all frames
  */
 static orxINLINE void orxFrame_DeleteAll()
@@ -1015,6 +1466,8 @@ void orxFASTCALL orxFrame_Setup()
   orxModule_AddDependency(orxMODULE_ID_FRAME, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_FRAME, orxMODULE_ID_STRUCTURE);
   orxModule_AddDependency(orxMODULE_ID_FRAME, orxMODULE_ID_PROFILER);
+  orxModule_AddDependency(orxMODULE_ID_FRAME, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_FRAME, orxMODULE_ID_THREAD);
 
   /* Done! */
   return;
@@ -1036,6 +1489,26 @@ orxSTATUS orxFASTCALL orxFrame_Init()
     /* Inits flags */
     sstFrame.u32Flags = orxFRAME_KU32_STATIC_MASK_DEFAULT|orxFRAME_KU32_STATIC_FLAG_READY;
 
+    /* Pushes config section */
+    orxConfig_PushSection(orxFRAME_KZ_CONFIG_SECTION);
+
+    /* Lazy update? */
+    if(orxConfig_GetBool(orxFRAME_KZ_CONFIG_LAZY_UPDATE) != orxFALSE)
+    {
+      /* Updates flags */
+      sstFrame.u32Flags |= orxFRAME_KU32_STATIC_FLAG_LAZY;
+
+      /* Parallel update? */
+      if(orxConfig_GetBool(orxFRAME_KZ_CONFIG_PARALLEL_UPDATE) != orxFALSE)
+      {
+        /* Updates flags */
+        sstFrame.u32Flags |= orxFRAME_KU32_STATIC_FLAG_PARALLEL;
+      }
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+
     /* Registers structure type */
     eResult = orxSTRUCTURE_REGISTER(FRAME, orxSTRUCTURE_STORAGE_TYPE_TREE, orxMEMORY_TYPE_MAIN, orxFRAME_KU32_BANK_SIZE, orxNULL);
 
@@ -1093,6 +1566,33 @@ void orxFASTCALL orxFrame_Exit()
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_FRAME);
 
+    /* Has data? */
+    if(sstFrame.stData.u32Size != 0)
+    {
+      /* Deletes it */
+      orxMemory_Free(sstFrame.stData.avGlobalPos);
+      orxMemory_Zero(&(sstFrame.stData), sizeof(orxFRAME_DATA_2D));
+    }
+
+    /* Has process list? */
+    if(sstFrame.apstProcessList != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(sstFrame.apstProcessList);
+      sstFrame.apstProcessList  = orxNULL;
+      sstFrame.u32ProcessSize   = 0;
+    }
+
+    /* Has moved list? */
+    if(sstFrame.apstMovedList != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(sstFrame.apstMovedList);
+      sstFrame.apstMovedList  = orxNULL;
+      sstFrame.u32MovedCount  = 0;
+      sstFrame.u32MovedSize   = 0;
+    }
+
     /* Updates flags */
     sstFrame.u32Flags &= ~orxFRAME_KU32_STATIC_FLAG_READY;
   }
@@ -1124,27 +1624,50 @@ orxFRAME *orxFASTCALL orxFrame_Create(orxU32 _u32Flags)
   /* Valid? */
   if(pstFrame != orxNULL)
   {
-    /* Inits flags */
-    orxStructure_SetFlags(pstFrame, (_u32Flags & orxFRAME_KU32_MASK_USER_ALL) | orxFRAME_KU32_FLAG_DATA_2D, orxFRAME_KU32_MASK_ALL);
-
-    /* Checks */
-    orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_DATA_2D);
+    /* Gets its data index */
+    pstFrame->u32Index = (orxU32)((orxStructure_GetGUID(pstFrame) & orxSTRUCTURE_GUID_MASK_ITEM_ID) >> orxSTRUCTURE_GUID_SHIFT_ITEM_ID);
+    pstFrame->u32Stamp = sstFrame.u32UpdateCount;
 
-    /* Inits values */
-    pstFrame->stData.fGlobalScaleX  = orxFLOAT_1;
-    pstFrame->stData.fGlobalScaleY  = orxFLOAT_1;
-    pstFrame->stData.fLocalScaleX   = orxFLOAT_1;
-    pstFrame->stData.fLocalScaleY   = orxFLOAT_1;
-
-    /* Has already a root? */
-    if(sstFrame.pstRoot != orxNULL)
+    /* Success reserving its data? */
+    if(orxFrame_ReserveData(pstFrame->u32Index) != orxSTATUS_FAILURE)
     {
-      /* Sets frame to root */
-      orxFrame_SetParent(pstFrame, sstFrame.pstRoot);
+      /* Inits flags */
+      orxStructure_SetFlags(pstFrame, (_u32Flags & orxFRAME_KU32_MASK_USER_ALL) | orxFRAME_KU32_FLAG_DATA_2D, orxFRAME_KU32_MASK_ALL);
+
+      /* Checks */
+      orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_DATA_2D);
+
+      /* Inits values */
+      orxVector_Copy(&(sstFrame.stData.avGlobalPos[pstFrame->u32Index]), &orxVECTOR_0);
+      orxVector_Copy(&(sstFrame.stData.avLocalPos[pstFrame->u32Index]), &orxVECTOR_0);
+      sstFrame.stData.afGlobalRotation[pstFrame->u32Index] = orxFLOAT_0;
+      sstFrame.stData.afLocalRotation[pstFrame->u32Index]  = orxFLOAT_0;
+      sstFrame.stData.afGlobalScaleX[pstFrame->u32Index]   = orxFLOAT_1;
+      sstFrame.stData.afGlobalScaleY[pstFrame->u32Index]   = orxFLOAT_1;
+      sstFrame.stData.afLocalScaleX[pstFrame->u32Index]    = orxFLOAT_1;
+      sstFrame.stData.afLocalScaleY[pstFrame->u32Index]    = orxFLOAT_1;
+
+      /* Has already a root? */
+      if(sstFrame.pstRoot != orxNULL)
+      {
+        /* Sets frame to root */
+        orxFrame_SetParent(pstFrame, sstFrame.pstRoot);
+      }
+
+      /* Increases count */
+      orxStructure_IncreaseCount(pstFrame);
     }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to allocate data for frame.");
 
-    /* Increases count */
-    orxStructure_IncreaseCount(pstFrame);
+      /* Deletes it */
+      orxStructure_Delete(pstFrame);
+
+      /* Updates result */
+      pstFrame = orxNULL;
+    }
   }
   else
   {
@@ -1176,6 +1699,9 @@ orxSTATUS orxFASTCALL orxFrame_Delete(orxFRAME *_pstFrame)
   {
     orxFRAME *pstParent;
 
+    /* Resolves it */
+    orxFrame_Resolve(_pstFrame);
+
     /* Gets parent frame */
     pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
@@ -1185,12 +1711,12 @@ orxSTATUS orxFASTCALL orxFrame_Delete(orxFRAME *_pstFrame)
       orxFRAME *pstChild;
 
       /* Resets global values to parent's */
-      _pstFrame->stData.vGlobalPos.fX   = pstParent->stData.vGlobalPos.fX;
-      _pstFrame->stData.vGlobalPos.fY   = pstParent->stData.vGlobalPos.fY;
-      _pstFrame->stData.vGlobalPos.fZ   = pstParent->stData.vGlobalPos.fZ;
-      _pstFrame->stData.fGlobalRotation = pstParent->stData.fGlobalRotation;
-      _pstFrame->stData.fGlobalScaleX   = pstParent->stData.fGlobalScaleX;
-      _pstFrame->stData.fGlobalScaleY   = pstParent->stData.fGlobalScaleY;
+      sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fX   = sstFrame.stData.avGlobalPos[pstParent->u32Index].fX;
+      sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fY   = sstFrame.stData.avGlobalPos[pstParent->u32Index].fY;
+      sstFrame.stData.avGlobalPos[_pstFrame->u32Index].fZ   = sstFrame.stData.avGlobalPos[pstParent->u32Index].fZ;
+      sstFrame.stData.afGlobalRotation[_pstFrame->u32Index] = sstFrame.stData.afGlobalRotation[pstParent->u32Index];
+      sstFrame.stData.afGlobalScaleX[_pstFrame->u32Index]   = sstFrame.stData.afGlobalScaleX[pstParent->u32Index];
+      sstFrame.stData.afGlobalScaleY[_pstFrame->u32Index]   = sstFrame.stData.afGlobalScaleY[pstParent->u32Index];
 
       /* For all children */
       for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
@@ -1202,6 +1728,13 @@ orxSTATUS orxFASTCALL orxFrame_Delete(orxFRAME *_pstFrame)
       }
     }
 
+    /* In the moved list? */
+    if(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_MOVED))
+    {
+      /* Removes it */
+      sstFrame.apstMovedList[_pstFrame->u32MovedIndex] = orxNULL;
+    }
+
     /* Deletes structure */
     orxStructure_Delete(_pstFrame);
   }
@@ -1234,8 +1767,8 @@ void orxFASTCALL orxFrame_SetParent(orxFRAME *_pstFrame, orxFRAME *_pstParent)
       /* Set root as parent */
       orxStructure_SetParent(_pstFrame, sstFrame.pstRoot);
 
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, sstFrame.pstRoot);
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
@@ -1246,8 +1779,8 @@ void orxFASTCALL orxFrame_SetParent(orxFRAME *_pstFrame, orxFRAME *_pstParent)
       /* Sets parent */
       orxStructure_SetParent(_pstFrame, _pstParent);
 
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, _pstParent);
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
 
@@ -1338,6 +1871,201 @@ orxBOOL orxFASTCALL orxFrame_IsRootChild(const orxFRAME *_pstFrame)
   return bResult;
 }
 
+/** Gets frame module update count, increased every time the global data of any frame is modified
+ * @return Update count
+ */
+orxU32 orxFASTCALL orxFrame_GetUpdateCount()
+{
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstFrame.u32UpdateCount;
+}
+
+/** Gets frame update stamp: value of the module update count when the frame global data was last modified
+ * @param[in]   _pstFrame       Concerned frame
+ * @return Update stamp
+ */
+orxU32 orxFASTCALL orxFrame_GetUpdateStamp(const orxFRAME *_pstFrame)
+{
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstFrame);
+
+  /* Done! */
+  return _pstFrame->u32Stamp;
+}
+
+/** Processes all dirty frames, parents before children, in a single pass (only needed when LazyUpdate is enabled),
+ * independent root hierarchies being processed in parallel on task workers when [Frame] ParallelUpdate is enabled
+ */
+void orxFASTCALL orxFrame_ProcessAll()
+{
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+
+  /* Lazy update? */
+  if(orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_LAZY))
+  {
+    orxFRAME *pstFrame;
+    orxU32    u32Count = 0, i;
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxFrame_ProcessAll");
+
+    /* For all root children */
+    for(pstFrame = orxFRAME(orxStructure_GetChild(sstFrame.pstRoot));
+        pstFrame != orxNULL;
+        pstFrame = orxFRAME(orxStructure_GetSibling(pstFrame)))
+    {
+      /* Dirty or has dirty descendants? */
+      if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_DIRTY))
+      {
+        /* Adds it */
+        u32Count = orxFrame_AddToProcessList(pstFrame, u32Count);
+      }
+    }
+
+    /* Any frame to process? */
+    if(u32Count != 0)
+    {
+      /* Updates count */
+      sstFrame.u32UpdateCount++;
+    }
+
+    /* Parallel with independent hierarchies and, if tracked, enough room for all moves? */
+    if(orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_PARALLEL)
+    && (u32Count > 1)
+    && ((!orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_TRACK))
+     || (orxFrame_ReserveMovedList(sstFrame.u32MovedCount + orxStructure_GetCount(orxSTRUCTURE_ID_FRAME)) != orxSTATUS_FAILURE)))
+    {
+      /* Updates status */
+      orxFLAG_SET(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_WORKERS, orxFRAME_KU32_STATIC_FLAG_NONE);
+
+      /* Processes them on task workers */
+      orxThread_ParallelFor(u32Count, 0, orxFrame_ProcessHierarchies, orxNULL);
+
+      /* Updates status */
+      orxFLAG_SET(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_NONE, orxFRAME_KU32_STATIC_FLAG_WORKERS);
+
+      /* Clears list */
+      u32Count = 0;
+    }
+
+    /* For all listed frames (breadth-first: parents are always listed before their children) */
+    for(i = 0; i < u32Count; i++)
+    {
+      orxFRAME *pstChild;
+      orxBOOL   bDirty;
+
+      /* Gets frame */
+      pstFrame = sstFrame.apstProcessList[i];
+
+      /* Is dirty? */
+      bDirty = orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DIRTY);
+
+      /* Cleans its dirty status */
+      orxStructure_SetFlags(pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_MASK_DIRTY);
+
+      /* Was dirty? */
+      if(bDirty != orxFALSE)
+      {
+        /* Updates its data */
+        orxFrame_UpdateData(pstFrame, orxFRAME(orxStructure_GetParent(pstFrame)));
+      }
+
+      /* For all its children */
+      for(pstChild = orxFRAME(orxStructure_GetChild(pstFrame));
+          pstChild != orxNULL;
+          pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
+      {
+        /* Was parent dirty? */
+        if(bDirty != orxFALSE)
+        {
+          /* Marks child as dirty */
+          orxStructure_SetFlags(pstChild, orxFRAME_KU32_FLAG_DIRTY, orxFRAME_KU32_FLAG_NONE);
+        }
+
+        /* Dirty or has dirty descendants? */
+        if(orxStructure_TestFlags(pstChild, orxFRAME_KU32_MASK_DIRTY))
+        {
+          /* Adds it */
+          u32Count = orxFrame_AddToProcessList(pstChild, u32Count);
+        }
+      }
+    }
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Enables / disables moved frame tracking: when enabled, frames whose global data get modified are recorded until the next orxFrame_FlushMovedList call
+ * @param[in]   _bEnable        Enable / disable
+ */
+void orxFASTCALL orxFrame_TrackMoved(orxBOOL _bEnable)
+{
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+
+  /* Enable? */
+  if(_bEnable != orxFALSE)
+  {
+    /* Updates status */
+    orxFLAG_SET(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_TRACK, orxFRAME_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    /* Clears moved list */
+    orxFrame_ClearMovedList();
+
+    /* Updates status */
+    orxFLAG_SET(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_NONE, orxFRAME_KU32_STATIC_FLAG_TRACK);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Flushes the moved frame list (only filled when tracking is enabled with orxFrame_TrackMoved)
+ * @param[in]   _pfnCallback    Function called for every frame whose global data got modified since last flush, must not modify any frame
+ * @param[in]   _pContext       Context transmitted to the callback
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE if some moves couldn't be recorded, in which case all frames should be considered as moved
+ */
+orxSTATUS orxFASTCALL orxFrame_FlushMovedList(orxFRAME_MOVED_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxU32    i;
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* For all listed frames */
+  for(i = 0; i < sstFrame.u32MovedCount; i++)
+  {
+    /* Still valid? */
+    if(sstFrame.apstMovedList[i] != orxNULL)
+    {
+      /* Calls callback */
+      _pfnCallback(sstFrame.apstMovedList[i], _pContext);
+    }
+  }
+
+  /* Updates result */
+  eResult = orxFLAG_TEST(sstFrame.u32Flags, orxFRAME_KU32_STATIC_FLAG_OVERFLOW) ? orxSTATUS_FAILURE : orxSTATUS_SUCCESS;
+
+  /* Clears moved list */
+  orxFrame_ClearMovedList();
+
+  /* Done! */
+  return eResult;
+}
+
 /** Sets frame position
  * @param[in]   _pstFrame       Concerned frame
  * @param[in]   _eSpace         Coordinate space system to use
@@ -1356,35 +2084,33 @@ void orxFASTCALL orxFrame_SetPosition(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpac
     /* Updates coord values */
     if(_orxFrame_SetPosition(_pstFrame, _pvPos, orxFRAME_SPACE_LOCAL) != orxFALSE)
     {
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
   {
     orxVECTOR vPos;
-    orxFRAME *pstParent, *pstChild;
+    orxFRAME *pstParent;
 
     /* Checks */
     orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+    /* Resolves it */
+    orxFrame_Resolve(_pstFrame);
+
     /* Gets parent frame */
     pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
     /* Stores global position */
     _orxFrame_SetPosition(_pstFrame, _pvPos, orxFRAME_SPACE_GLOBAL);
+    orxFrame_SetStamp(_pstFrame, ++sstFrame.u32UpdateCount);
 
     /* Computes & stores local position */
     _orxFrame_SetPosition(_pstFrame, orxFrame_FromGlobalToLocalPosition(pstParent, _pvPos, &vPos, orxStructure_GetFlags(_pstFrame, orxFRAME_KU32_MASK_IGNORE_POSITION)), orxFRAME_SPACE_LOCAL);
 
-    /* For all children */
-    for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
-        pstChild != orxNULL;
-        pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
-    {
-      /* Processes it */
-      orxFrame_Process(pstChild, _pstFrame);
-    }
+    /* Invalidates its children */
+    orxFrame_InvalidateChildren(_pstFrame);
   }
 
   /* Done! */
@@ -1408,34 +2134,32 @@ void orxFASTCALL orxFrame_SetRotation(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpac
     /* Updates rotation value */
     if(_orxFrame_SetRotation(_pstFrame, _fRotation, orxFRAME_SPACE_LOCAL) != orxFALSE)
     {
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
   {
-    orxFRAME *pstParent, *pstChild;
+    orxFRAME *pstParent;
 
     /* Checks */
     orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+    /* Resolves it */
+    orxFrame_Resolve(_pstFrame);
+
     /* Gets parent frame */
     pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
     /* Stores global rotation */
     _orxFrame_SetRotation(_pstFrame, _fRotation, orxFRAME_SPACE_GLOBAL);
+    orxFrame_SetStamp(_pstFrame, ++sstFrame.u32UpdateCount);
 
     /* Computes & stores local rotation */
     _orxFrame_SetRotation(_pstFrame, orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_IGNORE_ROTATION) ? _fRotation : orxFrame_FromGlobalToLocalRotation(pstParent, _fRotation), orxFRAME_SPACE_LOCAL);
 
-    /* For all children */
-    for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
-        pstChild != orxNULL;
-        pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
-    {
-      /* Processes it */
-      orxFrame_Process(pstChild, _pstFrame);
-    }
+    /* Invalidates its children */
+    orxFrame_InvalidateChildren(_pstFrame);
   }
 
   /* Done! */
@@ -1460,35 +2184,33 @@ void orxFASTCALL orxFrame_SetScale(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpace,
     /* Updates scale value */
     if(_orxFrame_SetScale(_pstFrame, _pvScale, orxFRAME_SPACE_LOCAL) != orxFALSE)
     {
-      /* Processes frame */
-      orxFrame_Process(_pstFrame, orxFRAME(orxStructure_GetParent(_pstFrame)));
+      /* Invalidates frame */
+      orxFrame_Invalidate(_pstFrame);
     }
   }
   else
   {
     orxVECTOR vScale;
-    orxFRAME *pstParent, *pstChild;
+    orxFRAME *pstParent;
 
     /* Checks */
     orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+    /* Resolves it */
+    orxFrame_Resolve(_pstFrame);
+
     /* Gets parent frame */
     pstParent = orxFRAME(orxStructure_GetParent(_pstFrame));
 
     /* Stores global scale */
     _orxFrame_SetScale(_pstFrame, _pvScale, orxFRAME_SPACE_GLOBAL);
+    orxFrame_SetStamp(_pstFrame, ++sstFrame.u32UpdateCount);
 
     /* Computes & stores local scale */
     _orxFrame_SetScale(_pstFrame, orxFrame_FromGlobalToLocalScale(pstParent, _pvScale, &vScale, orxStructure_GetFlags(_pstFrame, orxFRAME_KU32_MASK_IGNORE_SCALE)), orxFRAME_SPACE_LOCAL);
 
-    /* For all children */
-    for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
-        pstChild != orxNULL;
-        pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
-    {
-      /* Processes it */
-      orxFrame_Process(pstChild, _pstFrame);
-    }
+    /* Invalidates its children */
+    orxFrame_InvalidateChildren(_pstFrame);
   }
 
   /* Done! */
@@ -1512,6 +2234,13 @@ orxVECTOR *orxFASTCALL orxFrame_GetPosition(orxFRAME *_pstFrame, orxFRAME_SPACE
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
   orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+  /* Global? */
+  if(_eSpace == orxFRAME_SPACE_GLOBAL)
+  {
+    /* Resolves it */
+    orxFrame_Resolve(_pstFrame);
+  }
+
   /* Updates result */
   orxVector_Copy(_pvPos, _orxFrame_GetPosition(_pstFrame, _eSpace));
   pvResult = _pvPos;
@@ -1535,6 +2264,13 @@ orxFLOAT orxFASTCALL orxFrame_GetRotation(orxFRAME *_pstFrame, orxFRAME_SPACE _e
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
   orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+  /* Global? */
+  if(_eSpace == orxFRAME_SPACE_GLOBAL)
+  {
+    /* Resolves it */
+    orxFrame_Resolve(_pstFrame);
+  }
+
   /* Updates result */
   fRotation = _orxFrame_GetRotation(_pstFrame, _eSpace);
 
@@ -1559,6 +2295,13 @@ orxVECTOR *orxFASTCALL orxFrame_GetScale(orxFRAME *_pstFrame, orxFRAME_SPACE _eS
   orxASSERT(_pvScale != orxNULL);
   orxASSERT(orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_DATA_2D));
 
+  /* Global? */
+  if(_eSpace == orxFRAME_SPACE_GLOBAL)
+  {
+    /* Resolves it */
+    orxFrame_Resolve(_pstFrame);
+  }
+
   /* Updates result */
   pvResult = _orxFrame_GetScale(_pstFrame, _eSpace, _pvScale);
 
@@ -1582,6 +2325,9 @@ orxVECTOR *orxFASTCALL orxFrame_TransformPosition(orxFRAME *_pstFrame, orxFRAME_
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
   orxASSERT(_pvPos != orxNULL);
 
+  /* Resolves it */
+  orxFrame_Resolve(_pstFrame);
+
   /* Updates result */
   pvResult = (_eSpace == orxFRAME_SPACE_LOCAL) ? orxFrame_FromLocalToGlobalPosition(_pstFrame, _pvPos, orxFRAME_KU32_FLAG_IGNORE_NONE) : orxFrame_FromGlobalToLocalPosition(_pstFrame, _pvPos, _pvPos, orxFRAME_KU32_FLAG_IGNORE_NONE);
 
@@ -1604,6 +2350,9 @@ orxFLOAT orxFASTCALL orxFrame_TransformRotation(orxFRAME *_pstFrame, orxFRAME_SP
   orxSTRUCTURE_ASSERT(_pstFrame);
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
 
+  /* Resolves it */
+  orxFrame_Resolve(_pstFrame);
+
   /* Updates result */
   fResult = (_eSpace == orxFRAME_SPACE_LOCAL) ? orxFrame_FromLocalToGlobalRotation(_pstFrame, _fRotation) : orxFrame_FromGlobalToLocalRotation(_pstFrame, _fRotation);
 
@@ -1627,6 +2376,9 @@ orxVECTOR *orxFASTCALL orxFrame_TransformScale(orxFRAME *_pstFrame, orxFRAME_SPA
   orxASSERT(_eSpace < orxFRAME_SPACE_NUMBER);
   orxASSERT(_pvScale != orxNULL);
 
+  /* Resolves it */
+  orxFrame_Resolve(_pstFrame);
+
   /* Updates result */
   pvResult = (_eSpace == orxFRAME_SPACE_LOCAL) ? orxFrame_FromLocalToGlobalScale(_pstFrame, _pvScale, orxFRAME_KU32_FLAG_IGNORE_NONE) : orxFrame_FromGlobalToLocalScale(_pstFrame, _pvScale, _pvScale, orxFRAME_KU32_FLAG_IGNORE_NONE);
 
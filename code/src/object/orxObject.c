@@ -58,6 +58,7 @@
 #define orxOBJECT_KU32_STATIC_FLAG_READY        0x00000001  /**< Ready static flag */
 #define orxOBJECT_KU32_STATIC_FLAG_CLOCK        0x00000002  /**< Clock static flag */
 #define orxOBJECT_KU32_STATIC_FLAG_AGE          0x00000004  /**< Age static flag */
+#define orxOBJECT_KU32_STATIC_FLAG_INDEX        0x00000008  /**< Spatial index static flag */
 
 #define orxOBJECT_KU32_STATIC_MASK_ALL          0xFFFFFFFF  /**< Internal static mask */
 
@@ -85,13 +86,94 @@
 #define orxOBJECT_KU32_FLAG_INTERNAL_CAMERA     0x00008000  /**< Internal camera flag */
 #define orxOBJECT_KU32_FLAG_LOCAL_UPDATE        0x00004000  /**< Local update flag */
 #define orxOBJECT_KU32_FLAG_TEMP_ENABLED        0x00002000  /**< Temporary enabled flag */
+#define orxOBJECT_KU32_FLAG_POOLED              0x00001000  /**< Pooled flag */
 
 #define orxOBJECT_KU32_MASK_STRUCTURE_LIFETIME  0x003F0000  /**< Structure lifetime mask */
 #define orxOBJECT_KU32_MASK_STRUCTURE_INTERNAL  0x00000FFF  /**< Structure internal mask */
+#define orxOBJECT_KU32_MASK_STRUCTURE_POOLED    ((1 << orxSTRUCTURE_ID_FRAME) | (1 << orxSTRUCTURE_ID_BODY)) /**< Structures kept when parked in a pool */
 
 #define orxOBJECT_KU32_MASK_ALL                 0xFFFFFFFF  /**< All mask */
 
 
+/** Template fields
+ */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_NONE      0x00000000  /**< No field */
+
+#define orxOBJECT_TEMPLATE_KU32_FIELD_POOL      0x00000001  /**< Pool size field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_FRAME     0x00000002  /**< Frame flags field (AutoScroll, DepthScale & IgnoreFromParent) */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_PARENT_SPACE 0x00000004 /**< Parent space field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_FLIP      0x00000008  /**< Flip field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_ORIGIN    0x00000010  /**< Origin field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_SIZE      0x00000020  /**< Size field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_PIVOT     0x00000040  /**< Pivot field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_SCALE     0x00000080  /**< Scale field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_GROUP     0x00000100  /**< Group field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_AGE       0x00000200  /**< Age field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_GRAPHIC   0x00000400  /**< Graphic name field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_ANIM      0x00000800  /**< Animation set name & frequency field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_BODY      0x00001000  /**< Body name field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_CLOCK     0x00002000  /**< Clock name field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_SPAWNER   0x00004000  /**< Spawner name field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_SHADER    0x00008000  /**< Shader name field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_PARENT_CAMERA 0x00010000 /**< Parent camera name field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_COLOR     0x00020000  /**< Color & alpha field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_POSITION  0x00040000  /**< Position field (incl. pivot override & spherical position) */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_ROTATION  0x00080000  /**< Rotation & angular velocity field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_SPEED     0x00100000  /**< Speed field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_DISPLAY   0x00200000  /**< Smoothing, blend mode & repeat field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_LIFETIME  0x00400000  /**< Lifetime field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_COMMAND   0x00800000  /**< OnPrepare/OnCreate/OnDelete commands field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_TRIGGER_LIST 0x01000000 /**< Trigger list field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_SOUND_LIST 0x02000000 /**< Sound list field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_FX_LIST   0x04000000  /**< FX list, recursive list & frequency field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_TRACK_LIST 0x08000000 /**< Track list field */
+#define orxOBJECT_TEMPLATE_KU32_FIELD_CHILD_LIST 0x10000000 /**< Child & child joint lists field */
+
+#define orxOBJECT_TEMPLATE_KU32_FIELD_ALL       0x1FFFFFFF  /**< All fields */
+
+
+/** Template flags
+ */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_NONE       0x00000000  /**< No flags */
+
+#define orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SPACE 0x00000001 /**< Has parent space flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_BOOL 0x00000002 /**< Parent space is a boolean flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SCALE 0x00000004 /**< Uses parent scale flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_POSITION 0x00000008 /**< Uses parent position flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_FLIP       0x00000010  /**< Has flip flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_FLIP_X     0x00000020  /**< Flip X flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_FLIP_Y     0x00000040  /**< Flip Y flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_ORIGIN     0x00000080  /**< Has origin flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_SIZE       0x00000100  /**< Has size flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT      0x00000200  /**< Has pivot flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT_VECTOR 0x00000400 /**< Pivot is a vector flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_SCALE      0x00000800  /**< Has scale flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_GROUP      0x00001000  /**< Has group flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_COLOR      0x00002000  /**< Has color flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_ALPHA      0x00004000  /**< Has alpha flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_POSITION   0x00008000  /**< Has Cartesian position flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_LITERAL 0x00010000 /**< Has literal position flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_OFFSET 0x00020000 /**< Literal position has an offset flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_OFFSET_VECTOR 0x00040000 /**< Literal position offset is a vector flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT_OVERRIDE 0x00080000 /**< Has pivot override flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT_OVERRIDE_VECTOR 0x00100000 /**< Pivot override is a vector flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_SPEED      0x00200000  /**< Has speed flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_RELATIVE_SPEED 0x00400000 /**< Speed is relative flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_REPEAT     0x00800000  /**< Has repeat flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_BLEND_MODE 0x01000000  /**< Has blend mode flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_LIFETIME   0x02000000  /**< Has lifetime flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_ANIM_FREQUENCY 0x04000000 /**< Has animation frequency flag */
+#define orxOBJECT_TEMPLATE_KU32_FLAG_FX_FREQUENCY 0x08000000 /**< Has FX frequency flag */
+
+#define orxOBJECT_TEMPLATE_KU32_MASK_PARENT_SPACE 0x0000000F /**< Parent space mask */
+#define orxOBJECT_TEMPLATE_KU32_MASK_FLIP       0x00000070  /**< Flip mask */
+#define orxOBJECT_TEMPLATE_KU32_MASK_PIVOT      0x00000600  /**< Pivot mask */
+#define orxOBJECT_TEMPLATE_KU32_MASK_COLOR      0x00006000  /**< Color mask */
+#define orxOBJECT_TEMPLATE_KU32_MASK_POSITION   0x001F8000  /**< Position mask */
+#define orxOBJECT_TEMPLATE_KU32_MASK_SPEED      0x00600000  /**< Speed mask */
+#define orxOBJECT_TEMPLATE_KU32_MASK_DISPLAY    0x01800000  /**< Display mask */
+
+
 /** Misc defines
  */
 #define orxOBJECT_KU32_NEIGHBOR_LIST_SIZE       128
@@ -102,6 +184,26 @@
 #define orxOBJECT_KU32_GROUP_BANK_SIZE          64
 #define orxOBJECT_KU32_GROUP_TABLE_SIZE         64
 
+#define orxOBJECT_KU32_POOL_BANK_SIZE           16
+#define orxOBJECT_KU32_POOL_TABLE_SIZE          16
+
+#define orxOBJECT_KU32_TEMPLATE_BANK_SIZE       64
+#define orxOBJECT_KU32_TEMPLATE_TABLE_SIZE      64
+#define orxOBJECT_KU32_TEMPLATE_LIST_SIZE       16
+
+#define orxOBJECT_KU32_INDEX_ENTRY_SIZE         64
+#define orxOBJECT_KU32_INDEX_CELL_TABLE_SIZE    256
+#define orxOBJECT_KU32_INDEX_BATCH_SIZE         16
+#define orxOBJECT_KF_INDEX_CELL_SIZE            orx2F(256.0f)
+#define orxOBJECT_KF_INDEX_CELL_RANGE           orx2F(1073741824.0f)
+
+#define orxOBJECT_KU32_INDEX_FLAG_NONE          0x00000000  /**< No flags */
+#define orxOBJECT_KU32_INDEX_FLAG_USED          0x00000001  /**< Used flag */
+#define orxOBJECT_KU32_INDEX_FLAG_DIRTY         0x00000002  /**< Dirty flag */
+#define orxOBJECT_KU32_INDEX_FLAG_LINKED        0x00000004  /**< Linked flag */
+#define orxOBJECT_KU32_INDEX_FLAG_LARGE         0x00000008  /**< Large flag */
+
+
 #define orxOBJECT_KU32_OVERRIDE_MARKER_LENGTH   2
 
 #define orxOBJECT_KU32_STACK_SIZE               64
@@ -158,6 +260,10 @@
 #define orxOBJECT_KZ_CONFIG_ON_PREPARE          "OnPrepare"
 #define orxOBJECT_KZ_CONFIG_ON_CREATE           "OnCreate"
 #define orxOBJECT_KZ_CONFIG_ON_DELETE           "OnDelete"
+#define orxOBJECT_KZ_CONFIG_POOL                "Pool"
+#define orxOBJECT_KZ_CONFIG_SECTION             "Object"
+#define orxOBJECT_KZ_CONFIG_INDEX_LIST          "IndexList"
+#define orxOBJECT_KZ_CONFIG_INDEX_CELL_SIZE     "IndexCellSize"
 #define orxOBJECT_KZ_OVERRIDE_MARKER            "->"
 #define orxOBJECT_KZ_CENTERED_PIVOT             "center"
 #define orxOBJECT_KZ_TRUNCATE_PIVOT             "truncate"
@@ -219,15 +325,222 @@ void orxFASTCALL orxObject_##FUNCTION##Recursive(orxOBJECT *_pstObject, PARAM_TY
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Config key enum
+ */
+typedef enum __orxOBJECT_KEY_t
+{
+  orxOBJECT_KEY_GRAPHIC_NAME = 0,
+  orxOBJECT_KEY_ANIMPOINTER_NAME,
+  orxOBJECT_KEY_ANIM_FREQUENCY,
+  orxOBJECT_KEY_BODY,
+  orxOBJECT_KEY_CLOCK,
+  orxOBJECT_KEY_SPAWNER,
+  orxOBJECT_KEY_AUTO_SCROLL,
+  orxOBJECT_KEY_FLIP,
+  orxOBJECT_KEY_COLOR,
+  orxOBJECT_KEY_RGB,
+  orxOBJECT_KEY_HSL,
+  orxOBJECT_KEY_HSV,
+  orxOBJECT_KEY_ALPHA,
+  orxOBJECT_KEY_DEPTH_SCALE,
+  orxOBJECT_KEY_POSITION,
+  orxOBJECT_KEY_SPHERICAL_POSITION,
+  orxOBJECT_KEY_SPEED,
+  orxOBJECT_KEY_PIVOT,
+  orxOBJECT_KEY_ROTATION,
+  orxOBJECT_KEY_ANGULAR_VELOCITY,
+  orxOBJECT_KEY_SCALE,
+  orxOBJECT_KEY_ORIGIN,
+  orxOBJECT_KEY_SIZE,
+  orxOBJECT_KEY_FX_LIST,
+  orxOBJECT_KEY_FX_RECURSIVE_LIST,
+  orxOBJECT_KEY_FX_FREQUENCY,
+  orxOBJECT_KEY_SOUND_LIST,
+  orxOBJECT_KEY_SHADER,
+  orxOBJECT_KEY_SHADER_LIST,
+  orxOBJECT_KEY_TRACK_LIST,
+  orxOBJECT_KEY_TRIGGER_LIST,
+  orxOBJECT_KEY_CHILD_LIST,
+  orxOBJECT_KEY_CHILD_JOINT_LIST,
+  orxOBJECT_KEY_SMOOTHING,
+  orxOBJECT_KEY_BLEND_MODE,
+  orxOBJECT_KEY_REPEAT,
+  orxOBJECT_KEY_LIFETIME,
+  orxOBJECT_KEY_PARENT_CAMERA,
+  orxOBJECT_KEY_USE_RELATIVE_SPEED,
+  orxOBJECT_KEY_USE_PARENT_SPACE,
+  orxOBJECT_KEY_GROUP,
+  orxOBJECT_KEY_AGE,
+  orxOBJECT_KEY_IGNORE_FROM_PARENT,
+  orxOBJECT_KEY_ON_PREPARE,
+  orxOBJECT_KEY_ON_CREATE,
+  orxOBJECT_KEY_ON_DELETE,
+  orxOBJECT_KEY_POOL,
+
+  orxOBJECT_KEY_NUMBER,
+
+  orxOBJECT_KEY_NONE = orxENUM_NONE
+
+} orxOBJECT_KEY;
+
+/** Template list enum
+ */
+typedef enum __orxOBJECT_TEMPLATE_LIST_t
+{
+  orxOBJECT_TEMPLATE_LIST_TRIGGER = 0,
+  orxOBJECT_TEMPLATE_LIST_SOUND,
+  orxOBJECT_TEMPLATE_LIST_FX,
+  orxOBJECT_TEMPLATE_LIST_TRACK,
+  orxOBJECT_TEMPLATE_LIST_CHILD,
+  orxOBJECT_TEMPLATE_LIST_CHILD_JOINT,
+
+  orxOBJECT_TEMPLATE_LIST_NUMBER,
+
+  orxOBJECT_TEMPLATE_LIST_NONE = orxENUM_NONE
+
+} orxOBJECT_TEMPLATE_LIST;
+
+/** Object index entry
+ */
+typedef struct __orxOBJECT_INDEX_ENTRY_t
+{
+  orxOBJECT        *pstObject;                  /**< Object : 4 / 8 */
+  orxAABOX          stBox;                      /**< 2D extents : 28 / 32 */
+  orxU64            u64Cell;                    /**< Cell key : 36 / 40 */
+  orxU32            u32Order;                   /**< Group order : 40 / 44 */
+  orxU32            u32Previous;                /**< Previous entry in cell : 44 / 48 */
+  orxU32            u32Next;                    /**< Next entry in cell / free list : 48 / 52 */
+  orxU32            u32Flags;                   /**< Flags : 52 / 56 */
+
+} orxOBJECT_INDEX_ENTRY;
+
+/** Object index (sparse loose grid: small entries are binned by their center in hashed cells, large ones are kept in a separate list)
+ */
+typedef struct __orxOBJECT_INDEX_t
+{
+  orxOBJECT_INDEX_ENTRY *astEntryList;          /**< Entry list, first entry being reserved */
+  orxU32           *au32DirtyList;              /**< Dirty entry list */
+  orxHASHTABLE     *pstCellTable;               /**< Occupied cells (first entry of each cell) */
+  orxFLOAT          fCellSize;                  /**< Cell size */
+  orxFLOAT          fRecCellSize;               /**< Reciprocal cell size */
+  orxU32            u32EntrySize;               /**< Entry list size */
+  orxU32            u32EntryNumber;             /**< Number of entries in use or in the free list */
+  orxU32            u32FreeEntry;               /**< First free entry */
+  orxU32            u32LargeEntry;              /**< First large entry */
+  orxU32            u32DirtyCount;              /**< Dirty entry count */
+  orxU32            u32Order;                   /**< Next group order */
+  orxU32            u32Generation;              /**< Index generation at last full refresh */
+  orxBOOL           bValid;                     /**< Valid? */
+
+} orxOBJECT_INDEX;
+
+/** Object index callback
+ */
+typedef orxBOOL (orxFASTCALL *orxOBJECT_INDEX_FUNCTION)(const orxOBJECT_INDEX *_pstIndex, orxU32 _u32Entry, void *_pContext);
+
+/** Object index pick context
+ */
+typedef struct __orxOBJECT_INDEX_PICK_CONTEXT_t
+{
+  orxOBOX           astBoxList[orxOBJECT_KU32_INDEX_BATCH_SIZE];      /**< Candidate boxes */
+  orxOBJECT        *apstObjectList[orxOBJECT_KU32_INDEX_BATCH_SIZE];  /**< Candidate objects */
+  orxFLOAT          afZList[orxOBJECT_KU32_INDEX_BATCH_SIZE];         /**< Candidate depths */
+  orxU32            au32OrderList[orxOBJECT_KU32_INDEX_BATCH_SIZE];   /**< Candidate orders */
+  const orxVECTOR  *pvPosition;
+  const orxOBOX    *pstBox;
+  orxOBJECT        *pstResult;
+  orxFLOAT          fSelectedZ;
+  orxU32            u32SelectedOrder;
+  orxU32            u32CandidateCount;
+
+} orxOBJECT_INDEX_PICK_CONTEXT;
+
+/** Object index neighbor
+ */
+typedef struct __orxOBJECT_INDEX_NEIGHBOR_t
+{
+  orxU64            u64GUID;
+  orxU32            u32Order;
+
+} orxOBJECT_INDEX_NEIGHBOR;
+
+/** Object index neighbor context
+ */
+typedef struct __orxOBJECT_INDEX_NEIGHBOR_CONTEXT_t
+{
+  orxOBJECT_INDEX_NEIGHBOR *astNeighborList;
+  orxU32            u32Count;
+  orxU32            u32Size;
+
+} orxOBJECT_INDEX_NEIGHBOR_CONTEXT;
+
 /** Object lists
  */
 typedef struct __orxOBJECT_LISTS_t
 {
   orxLINKLIST       stList;                     /**< List : 12 / 24 */
   orxLINKLIST       stEnableList;               /**< Enable list : 24 / 48 */
+  orxOBJECT_INDEX  *pstIndex;                   /**< Spatial index : 28 / 56 */
 
 } orxOBJECT_LISTS;
 
+/** Object pool
+ */
+typedef struct __orxOBJECT_POOL_t
+{
+  orxLINKLIST       stList;                     /**< Parked object list : 12 / 24 */
+  orxU32            u32Size;                    /**< Max parked object count : 16 / 28 */
+
+} orxOBJECT_POOL;
+
+/** Object template: config values resolved once per section and reused by all its instances until its section or one of its ancestors gets modified
+ */
+typedef struct __orxOBJECT_TEMPLATE_t
+{
+  orxSTRINGID       stGroupID;                  /**< Group ID : 8 */
+  orxVECTOR         vOrigin;                    /**< Origin : 20 */
+  orxVECTOR         vSize;                      /**< Size : 32 */
+  orxVECTOR         vPivot;                     /**< Pivot : 44 */
+  orxVECTOR         vScale;                     /**< Scale : 56 */
+  orxVECTOR         vPosition;                  /**< Cartesian position : 68 */
+  orxVECTOR         vPositionOffset;            /**< Literal position offset : 80 */
+  orxVECTOR         vPivotOverride;             /**< Pivot override : 92 */
+  orxVECTOR         vSpeed;                     /**< Speed : 104 */
+  orxVECTOR         vRepeat;                    /**< Repeat : 116 */
+  orxCOLOR          stColor;                    /**< Color : 132 */
+  orxFLOAT          fAge;                       /**< Age : 136 */
+  orxFLOAT          fRotation;                  /**< Rotation (radians) : 140 */
+  orxFLOAT          fAngularVelocity;           /**< Angular velocity (radians) : 144 */
+  orxFLOAT          fAnimFrequency;             /**< Animation frequency : 148 */
+  orxFLOAT          fFXFrequency;               /**< FX frequency : 152 */
+  orxFLOAT          fLifeTime;                  /**< Lifetime : 156 */
+  orxU32            u32Generation;              /**< Section generation : 160 */
+  orxU32            u32DynamicFields;           /**< Fields that need to be resolved for every instance (random, list or command values) : 164 */
+  orxU32            u32Flags;                   /**< Flags : 168 */
+  orxU32            u32FrameFlags;              /**< Frame flags : 172 */
+  orxU32            u32PivotAlignFlags;         /**< Pivot align flags : 176 */
+  orxU32            u32PositionAlignFlags;      /**< Literal position align flags : 180 */
+  orxU32            u32PivotOverrideAlignFlags; /**< Pivot override align flags : 184 */
+  orxU32            u32LifeTimeFlags;           /**< Literal lifetime flags : 188 */
+  orxU32            u32ObjectFlags;             /**< Object flags (smoothing) : 192 */
+  orxU32            u32FXRecursiveFlags;        /**< Recursive FX flags, one bit per FX : 196 */
+  orxU32            u32PoolSize;                /**< Pool size : 200 */
+  orxDISPLAY_BLEND_MODE eBlendMode;             /**< Blend mode : 204 */
+  const orxSTRING   zGraphic;                   /**< Graphic name : 208 / 216 */
+  const orxSTRING   zAnimPointer;               /**< Animation set name : 212 / 224 */
+  const orxSTRING   zBody;                      /**< Body name : 216 / 232 */
+  const orxSTRING   zClock;                     /**< Clock name : 220 / 240 */
+  const orxSTRING   zSpawner;                   /**< Spawner name : 224 / 248 */
+  const orxSTRING   zShader;                    /**< Shader name : 228 / 256 */
+  const orxSTRING   zParentCamera;              /**< Parent camera name : 232 / 264 */
+  const orxSTRING   zOnPrepare;                 /**< OnPrepare command : 236 / 272 */
+  const orxSTRING   zOnCreate;                  /**< OnCreate command : 240 / 280 */
+  const orxSTRING   zOnDelete;                  /**< OnDelete command : 244 / 288 */
+  orxS32            as32ListCountList[orxOBJECT_TEMPLATE_LIST_NUMBER]; /**< List counts, -1 for lists too long to be stored : 268 / 312 */
+  const orxSTRING   aazListValueList[orxOBJECT_TEMPLATE_LIST_NUMBER][orxOBJECT_KU32_TEMPLATE_LIST_SIZE]; /**< List values : 652 / 1080 */
+
+} orxOBJECT_TEMPLATE;
+
 /** Object context structure
  */
 typedef struct __orxOBJECT_CONTEXT_t
@@ -258,6 +571,7 @@ struct __orxOBJECT_t
   orxLINKLIST_NODE  stEnableNode;               /**< Enable node: 184 / 280 */
   orxLINKLIST_NODE  stEnableGroupNode;          /**< Enable group node: 196 / 304 */
   const orxSTRING   zOnDelete;                  /**< On Delete command : 200 / 312 */
+  orxU32            u32IndexEntry;              /**< Spatial index entry : 204 / 316 */
 };
 
 /** Static structure
@@ -268,6 +582,10 @@ typedef struct __orxOBJECT_STATIC_t
   orxBANK          *pstGroupBank;               /**< Group bank */
   orxBANK          *pstAgeBank;                 /**< Age bank */
   orxHASHTABLE     *pstGroupTable;              /**< Group table */
+  orxBANK          *pstPoolBank;                /**< Pool bank */
+  orxHASHTABLE     *pstPoolTable;               /**< Pool table */
+  orxBANK          *pstTemplateBank;            /**< Template bank */
+  orxHASHTABLE     *pstTemplateTable;           /**< Template table */
   orxOBJECT_LISTS  *pstCachedGroupLists;        /**< Cached group lists */
   orxOBJECT        *pstCurrentParent;           /**< Current parent */
   orxFRAME         *pstFrame;                   /**< Conversion frame */
@@ -275,6 +593,9 @@ typedef struct __orxOBJECT_STATIC_t
   orxSTRINGID       stDefaultGroupID;           /**< Default group ID */
   orxSTRINGID       stCurrentGroupID;           /**< Current group ID */
   orxSTRINGID       stCachedGroupID;            /**< Cached group ID */
+  orxSTRINGID       astKeyIDList[orxOBJECT_KEY_NUMBER]; /**< Pre-hashed config key IDs */
+  orxU32            u32IndexFrameCount;         /**< Frame update count at last spatial index refresh */
+  orxU32            u32IndexGeneration;         /**< Spatial index generation, increased when all entries need a refresh */
   orxU32            u32Flags;                   /**< Control flags */
 
 #ifdef __orxDEBUG__
@@ -292,6 +613,71 @@ typedef struct __orxOBJECT_STATIC_t
  */
 static orxOBJECT_STATIC sstObject;
 
+/** Config key names, matching orxOBJECT_KEY
+ */
+static const orxSTRING sazObjectKeyList[orxOBJECT_KEY_NUMBER] =
+{
+  orxOBJECT_KZ_CONFIG_GRAPHIC_NAME,
+  orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME,
+  orxOBJECT_KZ_CONFIG_ANIM_FREQUENCY,
+  orxOBJECT_KZ_CONFIG_BODY,
+  orxOBJECT_KZ_CONFIG_CLOCK,
+  orxOBJECT_KZ_CONFIG_SPAWNER,
+  orxOBJECT_KZ_CONFIG_AUTO_SCROLL,
+  orxOBJECT_KZ_CONFIG_FLIP,
+  orxOBJECT_KZ_CONFIG_COLOR,
+  orxOBJECT_KZ_CONFIG_RGB,
+  orxOBJECT_KZ_CONFIG_HSL,
+  orxOBJECT_KZ_CONFIG_HSV,
+  orxOBJECT_KZ_CONFIG_ALPHA,
+  orxOBJECT_KZ_CONFIG_DEPTH_SCALE,
+  orxOBJECT_KZ_CONFIG_POSITION,
+  orxOBJECT_KZ_CONFIG_SPHERICAL_POSITION,
+  orxOBJECT_KZ_CONFIG_SPEED,
+  orxOBJECT_KZ_CONFIG_PIVOT,
+  orxOBJECT_KZ_CONFIG_ROTATION,
+  orxOBJECT_KZ_CONFIG_ANGULAR_VELOCITY,
+  orxOBJECT_KZ_CONFIG_SCALE,
+  orxOBJECT_KZ_CONFIG_ORIGIN,
+  orxOBJECT_KZ_CONFIG_SIZE,
+  orxOBJECT_KZ_CONFIG_FX_LIST,
+  orxOBJECT_KZ_CONFIG_FX_RECURSIVE_LIST,
+  orxOBJECT_KZ_CONFIG_FX_FREQUENCY,
+  orxOBJECT_KZ_CONFIG_SOUND_LIST,
+  orxOBJECT_KZ_CONFIG_SHADER,
+  orxOBJECT_KZ_CONFIG_SHADER_LIST,
+  orxOBJECT_KZ_CONFIG_TRACK_LIST,
+  orxOBJECT_KZ_CONFIG_TRIGGER_LIST,
+  orxOBJECT_KZ_CONFIG_CHILD_LIST,
+  orxOBJECT_KZ_CONFIG_CHILD_JOINT_LIST,
+  orxOBJECT_KZ_CONFIG_SMOOTHING,
+  orxOBJECT_KZ_CONFIG_BLEND_MODE,
+  orxOBJECT_KZ_CONFIG_REPEAT,
+  orxOBJECT_KZ_CONFIG_LIFETIME,
+  orxOBJECT_KZ_CONFIG_PARENT_CAMERA,
+  orxOBJECT_KZ_CONFIG_USE_RELATIVE_SPEED,
+  orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE,
+  orxOBJECT_KZ_CONFIG_GROUP,
+  orxOBJECT_KZ_CONFIG_AGE,
+  orxOBJECT_KZ_CONFIG_IGNORE_FROM_PARENT,
+  orxOBJECT_KZ_CONFIG_ON_PREPARE,
+  orxOBJECT_KZ_CONFIG_ON_CREATE,
+  orxOBJECT_KZ_CONFIG_ON_DELETE,
+  orxOBJECT_KZ_CONFIG_POOL
+};
+
+/** Template list keys
+ */
+static const orxOBJECT_KEY saeObjectTemplateListKeyList[orxOBJECT_TEMPLATE_LIST_NUMBER] =
+{
+  orxOBJECT_KEY_TRIGGER_LIST,
+  orxOBJECT_KEY_SOUND_LIST,
+  orxOBJECT_KEY_FX_LIST,
+  orxOBJECT_KEY_TRACK_LIST,
+  orxOBJECT_KEY_CHILD_LIST,
+  orxOBJECT_KEY_CHILD_JOINT_LIST
+};
+
 
 /***************************************************************************
  * Private functions                                                       *
@@ -301,6 +687,23 @@ static orxOBJECT_STATIC sstObject;
  */
 orxVECTOR *orxFASTCALL orxConfig_ToVector(const orxSTRING _zValue, orxCOLORSPACE _eColorSpace, orxVECTOR *_pvVector);
 
+/** Inits config key ID list
+ */
+static orxINLINE void orxObject_InitKeyIDList()
+{
+  orxU32 i;
+
+  /* For all keys */
+  for(i = 0; i < orxOBJECT_KEY_NUMBER; i++)
+  {
+    /* Stores its ID */
+    sstObject.astKeyIDList[i] = orxConfig_GetKeyID(sazObjectKeyList[i]);
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Update body scale
  */
 static void orxFASTCALL orxObject_UpdateBodyScale(orxOBJECT *_pstObject)
@@ -4924,239 +5327,2621 @@ static orxINLINE orxOBJECT *orxObject_FindChildInternal(const orxOBJECT *_pstObj
   return pstResult;
 }
 
-/** Creates an empty object
+/** Gets an object pool
  */
-static orxINLINE orxOBJECT *orxObject_CreateInternal()
+static orxOBJECT_POOL *orxFASTCALL orxObject_GetPool(orxSTRINGID _stID, orxBOOL _bCreate)
 {
-  orxOBJECT *pstResult;
-
-  /* Creates object */
-  pstResult = orxOBJECT(orxStructure_Create(orxSTRUCTURE_ID_OBJECT));
+  orxOBJECT_POOL *pstResult = orxNULL;
 
-  /* Created? */
-  if(pstResult != orxNULL)
+  /* No pool table yet? */
+  if((sstObject.pstPoolTable == orxNULL) && (_bCreate != orxFALSE))
   {
-    /* Inits flags */
-    orxStructure_SetFlags(pstResult, orxOBJECT_KU32_FLAG_ENABLED, orxOBJECT_KU32_MASK_ALL);
-
-    /* Inits active time */
-    pstResult->fActiveTime = orxFLOAT_0;
-
-    /* Sets default group ID */
-    orxObject_SetGroupID(pstResult, sstObject.stDefaultGroupID);
+    /* Creates pool bank & table */
+    sstObject.pstPoolBank   = orxBank_Create(orxOBJECT_KU32_POOL_BANK_SIZE, sizeof(orxOBJECT_POOL), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstObject.pstPoolTable  = orxHashTable_Create(orxOBJECT_KU32_POOL_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
-    /* Adds it to the enable list */
-    orxLinkList_AddEnd(&(sstObject.stEnableList), &(pstResult->stEnableNode));
+    /* Failure? */
+    if((sstObject.pstPoolBank == orxNULL) || (sstObject.pstPoolTable == orxNULL))
+    {
+      /* Deletes them */
+      if(sstObject.pstPoolBank != orxNULL)
+      {
+        orxBank_Delete(sstObject.pstPoolBank);
+        sstObject.pstPoolBank = orxNULL;
+      }
+      if(sstObject.pstPoolTable != orxNULL)
+      {
+        orxHashTable_Delete(sstObject.pstPoolTable);
+        sstObject.pstPoolTable = orxNULL;
+      }
 
-    /* Increases count */
-    orxStructure_IncreaseCount(pstResult);
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't create pool table, objects won't be pooled.");
+    }
   }
-  else
+
+  /* Has pool table? */
+  if(sstObject.pstPoolTable != orxNULL)
   {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to create object.");
+    /* Gets pool */
+    pstResult = (orxOBJECT_POOL *)orxHashTable_Get(sstObject.pstPoolTable, _stID);
+
+    /* Not found and should create it? */
+    if((pstResult == orxNULL) && (_bCreate != orxFALSE))
+    {
+      /* Allocates it */
+      pstResult = (orxOBJECT_POOL *)orxBank_Allocate(sstObject.pstPoolBank);
+
+      /* Success? */
+      if(pstResult != orxNULL)
+      {
+        /* Inits it */
+        orxMemory_Zero(pstResult, sizeof(orxOBJECT_POOL));
+
+        /* Adds it to the table */
+        if(orxHashTable_Add(sstObject.pstPoolTable, _stID, pstResult) == orxSTATUS_FAILURE)
+        {
+          /* Frees it */
+          orxBank_Free(sstObject.pstPoolBank, pstResult);
+          pstResult = orxNULL;
+        }
+      }
+    }
   }
 
   /* Done! */
   return pstResult;
 }
 
-/** Deletes an object
+/** Gets the pool in which an object being deleted can be parked
  */
-static orxINLINE orxSTATUS orxObject_DeleteInternal(orxOBJECT *_pstObject, orxBOOL _bNoCommand, orxOBJECT **_ppstNextObject)
+static orxINLINE orxOBJECT_POOL *orxObject_GetParkingPool(const orxOBJECT *_pstObject)
 {
-  orxBOOL   bSelectedNext = orxFALSE;
-  orxSTATUS eResult       = orxSTATUS_FAILURE;
-
-  /* Decreases count */
-  orxStructure_DecreaseCount(_pstObject);
+  orxOBJECT_POOL *pstResult = orxNULL;
 
-  /* Not referenced? */
-  if(orxStructure_GetRefCount(_pstObject) == 0)
+  /* Is pooled? */
+  if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_POOLED))
   {
-    orxCOMMAND_VAR  stCommandResult;
-    const orxSTRING zCommand;
-
-    /* Retrieves and clear on-delete command */
-    zCommand = _pstObject->zOnDelete;
-    _pstObject->zOnDelete = orxNULL;
+    /* Gets its pool */
+    pstResult = orxObject_GetPool(orxString_GetID(_pstObject->zReference), orxFALSE);
 
-    /* Should continue? */
-    if((_bNoCommand != orxFALSE)
-    || (zCommand == orxNULL)
-    || (orxCommand_EvaluateWithGUID(zCommand, orxStructure_GetGUID(_pstObject), &stCommandResult) == orxNULL)
-    || ((stCommandResult.eType != orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.eType != orxCOMMAND_VAR_TYPE_STRING))
-    || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_STRING) && (*stCommandResult.zValue != orxNULL) && (orxString_ICompare(stCommandResult.zValue, orxSTRING_FALSE) != 0))
-    || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.bValue != orxFALSE)))
+    /* Valid? */
+    if(pstResult != orxNULL)
     {
-      orxEVENT stEvent;
-
-      /* Inits event */
-      orxEVENT_INIT(stEvent, orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_DELETE, _pstObject, orxNULL, orxNULL);
-
-      /* Sends event */
-      if(orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
+      /* Full or has external frame children/body joints that would outlive it? */
+      if((orxLinkList_GetCount(&(pstResult->stList)) >= pstResult->u32Size)
+      || ((_pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME] != orxNULL)
+       && (orxStructure_GetChild(_pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME]) != orxNULL))
+      || ((_pstObject->apstStructureList[orxSTRUCTURE_ID_BODY] != orxNULL)
+       && (orxBody_GetNextJoint(orxBODY(_pstObject->apstStructureList[orxSTRUCTURE_ID_BODY]), orxNULL) != orxNULL)))
       {
-        orxU32 i;
+        /* Can't park it */
+        pstResult = orxNULL;
+      }
+    }
+  }
 
-        /* Has trigger? */
-        if(_pstObject->apstStructureList[orxSTRUCTURE_ID_TRIGGER] != orxNULL)
-        {
-          /* Fires it */
-          orxTrigger_Fire(orxTRIGGER(_pstObject->apstStructureList[orxSTRUCTURE_ID_TRIGGER]), orxOBJECT_KZ_TRIGGER_DELETE, orxNULL, 0, orxNULL);
-        }
+  /* Done! */
+  return pstResult;
+}
 
-        /* Has frame? */
-        if(_pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME] != orxNULL)
-        {
-          /* Removes parent */
-          orxObject_SetParent(_pstObject, orxNULL);
-        }
+/** Parks an object in a pool, it needs to have been cleaned beforehand, only keeping its internal frame and body
+ */
+static orxINLINE void orxObject_Park(orxOBJECT *_pstObject, orxOBJECT_POOL *_pstPool)
+{
+  orxU32 u32Flags, i;
 
-        /* Has children? */
-        if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_HAS_CHILDREN))
-        {
-          orxOBJECT *pstChild;
+  /* Resets its transform & physics to their template state */
+  orxObject_SetPosition(_pstObject, &orxVECTOR_0);
+  orxObject_SetRotation(_pstObject, orxFLOAT_0);
+  orxObject_SetScale(_pstObject, &orxVECTOR_1);
+  orxObject_SetSpeed(_pstObject, &orxVECTOR_0);
+  orxObject_SetAngularVelocity(_pstObject, orxFLOAT_0);
+  orxObject_SetCustomGravity(_pstObject, orxNULL);
 
-          /* For all children */
-          for(pstChild = _pstObject->pstChild;
-              pstChild != orxNULL;
-              pstChild = _pstObject->pstChild)
-          {
-            /* Deletes it */
-            orxObject_DeleteInternal(pstChild, _bNoCommand, orxNULL);
-          }
-        }
+  /* Gets kept structures */
+  u32Flags = orxStructure_GetFlags(_pstObject, orxOBJECT_KU32_MASK_STRUCTURE_POOLED);
 
-        /* Unlinks all structures, frame last */
-        for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
-        {
-          if((i != orxSTRUCTURE_ID_FRAME) && (_pstObject->apstStructureList[i] != orxNULL))
-          {
-            orxObject_UnlinkStructure(_pstObject, (orxSTRUCTURE_ID)i);
-          }
-        }
-        orxObject_UnlinkStructure(_pstObject, orxSTRUCTURE_ID_FRAME);
+  /* Renews its GUID: all its previous references become invalid */
+  orxStructure_RenewGUID(_pstObject);
 
-        /* Requested next object? */
-        if(_ppstNextObject != orxNULL)
-        {
-          orxLINKLIST_NODE *pstNode;
+  /* Clears all its data but its structures, disabling it */
+  orxMemory_Zero(&(_pstObject->pUserData), (orxU32)((orxU8 *)_pstObject + sizeof(orxOBJECT) - (orxU8 *)&(_pstObject->pUserData)));
+  orxStructure_SetFlags(_pstObject, u32Flags | orxOBJECT_KU32_FLAG_POOLED, orxOBJECT_KU32_MASK_ALL);
 
-          /* Gets next enabled object */
-          pstNode = orxLinkList_GetNext(&(_pstObject->stEnableNode));
+  /* For all structures */
+  for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
+  {
+    /* Checks */
+    orxASSERT((_pstObject->apstStructureList[i] == orxNULL) || (u32Flags & (1 << i)));
 
-          /* Stores it */
-          *_ppstNextObject = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode) : orxNULL;
+    /* Kept? */
+    if(_pstObject->apstStructureList[i] != orxNULL)
+    {
+      /* Updates its owner with the new GUID */
+      orxStructure_SetOwner(_pstObject->apstStructureList[i], _pstObject);
+    }
+  }
 
-          /* Updates status */
-          bSelectedNext = orxTRUE;
-        }
+  /* Adds it to the pool */
+  orxLinkList_AddEnd(&(_pstPool->stList), &(_pstObject->stEnableNode));
 
-        /* Removes owner */
-        orxObject_SetOwner(_pstObject, orxNULL);
+  /* Hides it from structure iteration & count */
+  orxStructure_Hide(_pstObject, orxTRUE);
 
-        /* Removes object from its current group */
-        if(orxLinkList_GetList(&(_pstObject->stGroupNode)) != orxNULL)
-        {
-          orxLinkList_Remove(&(_pstObject->stGroupNode));
-        }
+  /* Done! */
+  return;
+}
 
-        /* Removes object from the enable lists */
-        if(orxLinkList_GetList(&(_pstObject->stEnableNode)) != orxNULL)
-        {
-          orxLinkList_Remove(&(_pstObject->stEnableNode));
-        }
-        if(orxLinkList_GetList(&(_pstObject->stEnableGroupNode)) != orxNULL)
-        {
-          orxLinkList_Remove(&(_pstObject->stEnableGroupNode));
-        }
+/** Gets a parked object out of its pool
+ */
+static orxINLINE orxOBJECT *orxObject_Unpark(orxOBJECT_POOL *_pstPool)
+{
+  orxLINKLIST_NODE *pstNode;
+  orxOBJECT        *pstResult;
 
-        /* Deletes structure */
-        orxStructure_Delete(_pstObject);
+  /* Gets first parked object */
+  pstNode = orxLinkList_GetFirst(&(_pstPool->stList));
+  orxASSERT(pstNode != orxNULL);
+  pstResult = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode);
 
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
-      }
-      else
-      {
-        /* Increases count */
-        orxStructure_IncreaseCount(_pstObject);
+  /* Removes it from the pool */
+  orxLinkList_Remove(pstNode);
 
-        /* Resets its active time: going undead */
-        _pstObject->fActiveTime = orxFLOAT_0;
+  /* Shows it back to structure iteration & count */
+  orxStructure_Hide(pstResult, orxFALSE);
 
-        /* Disables it */
-        orxObject_Enable(_pstObject, orxFALSE);
-      }
-    }
-    else
-    {
-      /* Increases count */
-      orxStructure_IncreaseCount(_pstObject);
-    }
-  }
+  /* Inits flags, keeping its structures */
+  orxStructure_SetFlags(pstResult, orxOBJECT_KU32_FLAG_ENABLED, orxOBJECT_KU32_FLAG_NONE);
 
-  /* Requested next object and not already selected? */
-  if((_ppstNextObject != orxNULL) && (bSelectedNext == orxFALSE))
-  {
-    orxLINKLIST_NODE *pstNode;
+  /* Sets default group ID */
+  orxObject_SetGroupID(pstResult, sstObject.stDefaultGroupID);
 
-    /* Gets next enabled object */
-    pstNode = orxLinkList_GetNext(&(_pstObject->stEnableNode));
+  /* Adds it to the enable list */
+  orxLinkList_AddEnd(&(sstObject.stEnableList), &(pstResult->stEnableNode));
 
-    /* Stores it */
-    *_ppstNextObject = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode) : orxNULL;
-  }
+  /* Increases count */
+  orxStructure_IncreaseCount(pstResult);
 
   /* Done! */
-  return eResult;
+  return pstResult;
 }
 
-/** Event handler
- * @param[in]   _pstEvent                     Sent event
- * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+/** Deletes all the pools and their parked objects
  */
-static orxSTATUS orxFASTCALL orxObject_EventHandler(const orxEVENT *_pstEvent)
+static orxINLINE void orxObject_DeletePools()
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
-
-  /* Depending on event type */
-  switch(_pstEvent->eType)
+  /* Has pool table? */
+  if(sstObject.pstPoolTable != orxNULL)
   {
-    /* Object event */
-    case orxEVENT_TYPE_OBJECT:
+    orxHANDLE       hIterator;
+    orxOBJECT_POOL *pstPool;
+
+    /* For all pools */
+    for(hIterator = orxHashTable_GetNext(sstObject.pstPoolTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstPool);
+        hIterator != orxHANDLE_UNDEFINED;
+        hIterator = orxHashTable_GetNext(sstObject.pstPoolTable, hIterator, orxNULL, (void **)&pstPool))
     {
-      /* Has current parent? */
-      if(sstObject.pstCurrentParent != orxNULL)
+      orxLINKLIST_NODE *pstNode;
+
+      /* For all parked objects */
+      while((pstNode = orxLinkList_GetFirst(&(pstPool->stList))) != orxNULL)
       {
-        /* Stores current parent as temporary parent in payload */
-        *((orxOBJECT **)_pstEvent->pstPayload) = sstObject.pstCurrentParent;
+        orxOBJECT *pstObject;
 
-        /* Sets it as owner */
-        orxObject_SetOwner(orxOBJECT(_pstEvent->hSender), sstObject.pstCurrentParent);
-      }
+        /* Gets object */
+        pstObject = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode);
 
-      break;
-    }
+        /* Removes it from the pool */
+        orxLinkList_Remove(pstNode);
 
-    /* Physics event */
-    case orxEVENT_TYPE_PHYSICS:
-    {
-      orxOBJECT  *pstSender, *pstRecipient;
-      orxTRIGGER *pstSenderTrigger, *pstRecipientTrigger;
+        /* Unlinks its structures, frame last */
+        orxObject_UnlinkStructure(pstObject, orxSTRUCTURE_ID_BODY);
+        orxObject_UnlinkStructure(pstObject, orxSTRUCTURE_ID_FRAME);
 
-      /* Gets sender & recipient objects */
-      pstSender     = orxOBJECT(_pstEvent->hSender);
-      pstRecipient  = orxOBJECT(_pstEvent->hRecipient);
+        /* Deletes it */
+        orxStructure_Delete(pstObject);
+      }
+    }
 
-      /* Gets triggers */
-      pstSenderTrigger    = orxStructure_TestFlags(pstSender, orxOBJECT_KU32_FLAG_ENABLED) ? orxOBJECT_GET_STRUCTURE(pstSender, TRIGGER) : orxNULL;
-      pstRecipientTrigger = orxStructure_TestFlags(pstRecipient, orxOBJECT_KU32_FLAG_ENABLED) ? orxOBJECT_GET_STRUCTURE(pstRecipient, TRIGGER) : orxNULL;
+    /* Deletes pool table & bank */
+    orxHashTable_Delete(sstObject.pstPoolTable);
+    orxBank_Delete(sstObject.pstPoolBank);
+    sstObject.pstPoolTable  = orxNULL;
+    sstObject.pstPoolBank   = orxNULL;
+  }
 
-      /* Should process? */
-      if((pstSenderTrigger != orxNULL)
-      || (pstRecipientTrigger != orxNULL))
+  /* Done! */
+  return;
+}
+
+/** Gets literal lifetime flags
+ * @param[in]   _zLifeTime            Literal lifetime, can be composed of multiple tags, separated by space: anim, child, fx, sound, spawner and track
+ * @return      Lifetime flags, orxOBJECT_KU32_FLAG_NONE if none were found
+ */
+static orxU32 orxFASTCALL orxObject_GetLiteralLifeTimeFlags(const orxSTRING _zLifeTime)
+{
+  orxCHAR acBuffer[128];
+  orxU32  u32Result = orxOBJECT_KU32_FLAG_NONE;
+
+  /* Gets lower case value */
+  acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
+  orxString_LowerCase(orxString_NCopy(acBuffer, _zLifeTime, sizeof(acBuffer) - 1));
+
+  /* FX? */
+  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_FX) != orxNULL)
+  {
+    /* Updates result */
+    u32Result |= orxOBJECT_KU32_FLAG_FX_LIFETIME;
+  }
+
+  /* Sound? */
+  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_SOUND) != orxNULL)
+  {
+    /* Updates result */
+    u32Result |= orxOBJECT_KU32_FLAG_SOUND_LIFETIME;
+  }
+
+  /* Spawn? */
+  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_SPAWN) != orxNULL)
+  {
+    /* Updates result */
+    u32Result |= orxOBJECT_KU32_FLAG_SPAWNER_LIFETIME;
+  }
+
+  /* Track? */
+  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_TRACK) != orxNULL)
+  {
+    /* Updates result */
+    u32Result |= orxOBJECT_KU32_FLAG_TIMELINE_LIFETIME;
+  }
+
+  /* Child? */
+  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_CHILD) != orxNULL)
+  {
+    /* Updates result */
+    u32Result |= orxOBJECT_KU32_FLAG_CHILDREN_LIFETIME;
+  }
+
+  /* Anim? */
+  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_ANIM) != orxNULL)
+  {
+    /* Updates result */
+    u32Result |= orxOBJECT_KU32_FLAG_ANIM_LIFETIME;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Stores a config string for a template
+ * @param[in]   _zValue               Concerned value
+ * @return      Stored string, that stays valid after its config value gets modified, orxSTRING_EMPTY if empty
+ */
+static orxINLINE const orxSTRING orxObject_StoreTemplateString(const orxSTRING _zValue)
+{
+  const orxSTRING zResult;
+
+  /* Updates result */
+  zResult = ((_zValue != orxNULL) && (*_zValue != orxCHAR_NULL)) ? orxString_Store(_zValue) : orxSTRING_EMPTY;
+
+  /* Done! */
+  return zResult;
+}
+
+/** Resolves a template list from the current config section
+ * @param[in]   _pstTemplate          Concerned template
+ * @param[in]   _eList                Concerned list
+ */
+static orxINLINE void orxObject_ResolveTemplateList(orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_LIST _eList)
+{
+  orxSTRINGID stKeyID;
+  orxS32      s32Count;
+
+  /* Gets its key ID */
+  stKeyID = sstObject.astKeyIDList[saeObjectTemplateListKeyList[_eList]];
+
+  /* Gets its count */
+  s32Count = orxConfig_GetListCountByID(stKeyID);
+
+  /* Can be stored? */
+  if(s32Count <= (orxS32)orxOBJECT_KU32_TEMPLATE_LIST_SIZE)
+  {
+    orxS32 i;
+
+    /* For all its values */
+    for(i = 0; i < s32Count; i++)
+    {
+      /* Stores it */
+      _pstTemplate->aazListValueList[_eList][i] = orxObject_StoreTemplateString(orxConfig_GetListStringByID(stKeyID, i));
+    }
+
+    /* Stores its count */
+    _pstTemplate->as32ListCountList[_eList] = s32Count;
+  }
+  else
+  {
+    /* Marks it as too long, it'll be read directly from config */
+    _pstTemplate->as32ListCountList[_eList] = -1;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets a template list count
+ * @param[in]   _pstTemplate          Concerned template
+ * @param[in]   _eList                Concerned list
+ * @return      List count
+ */
+static orxINLINE orxS32 orxObject_GetTemplateListCount(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_LIST _eList)
+{
+  orxS32 s32Result;
+
+  /* Updates result */
+  s32Result = (_pstTemplate->as32ListCountList[_eList] >= 0) ? _pstTemplate->as32ListCountList[_eList] : orxConfig_GetListCountByID(sstObject.astKeyIDList[saeObjectTemplateListKeyList[_eList]]);
+
+  /* Done! */
+  return s32Result;
+}
+
+/** Gets a template list value
+ * @param[in]   _pstTemplate          Concerned template
+ * @param[in]   _eList                Concerned list
+ * @param[in]   _s32Index             Index of the value
+ * @return      List value, orxSTRING_EMPTY if out of range
+ */
+static orxINLINE const orxSTRING orxObject_GetTemplateListString(const orxOBJECT_TEMPLATE *_pstTemplate, orxOBJECT_TEMPLATE_LIST _eList, orxS32 _s32Index)
+{
+  const orxSTRING zResult;
+
+  /* Too long to be stored? */
+  if(_pstTemplate->as32ListCountList[_eList] < 0)
+  {
+    /* Gets it from config */
+    zResult = orxConfig_GetListStringByID(sstObject.astKeyIDList[saeObjectTemplateListKeyList[_eList]], _s32Index);
+  }
+  else
+  {
+    /* Updates result, the template might have been recompiled in-between by a nested creation */
+    zResult = (_s32Index < _pstTemplate->as32ListCountList[_eList]) ? _pstTemplate->aazListValueList[_eList][_s32Index] : orxSTRING_EMPTY;
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+/** Is a template FX recursive?
+ * @param[in]   _pstTemplate          Concerned template
+ * @param[in]   _s32Index             Index of the FX
+ * @return      orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxObject_IsTemplateFXRecursive(const orxOBJECT_TEMPLATE *_pstTemplate, orxS32 _s32Index)
+{
+  orxBOOL bResult;
+
+  /* FX list too long to be stored? */
+  if(_pstTemplate->as32ListCountList[orxOBJECT_TEMPLATE_LIST_FX] < 0)
+  {
+    /* Gets it from config */
+    bResult = ((_s32Index < orxConfig_GetListCountByID(sstObject.astKeyIDList[orxOBJECT_KEY_FX_RECURSIVE_LIST]))
+            && (orxConfig_GetListBoolByID(sstObject.astKeyIDList[orxOBJECT_KEY_FX_RECURSIVE_LIST], _s32Index) != orxFALSE)) ? orxTRUE : orxFALSE;
+  }
+  else
+  {
+    /* Updates result */
+    bResult = ((_s32Index < (orxS32)orxOBJECT_KU32_TEMPLATE_LIST_SIZE) && (_pstTemplate->u32FXRecursiveFlags & (1 << _s32Index))) ? orxTRUE : orxFALSE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Is a config list value dynamic, ie. random or command?
+ * @param[in]   _eKey                 Concerned key
+ * @return      orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxObject_IsDynamicListValue(orxOBJECT_KEY _eKey)
+{
+  orxBOOL bResult;
+
+  /* Updates result */
+  bResult = ((orxConfig_IsRandomValue(sazObjectKeyList[_eKey]) != orxFALSE) || (orxConfig_IsCommandValue(sazObjectKeyList[_eKey]) != orxFALSE)) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Resolves template fields from the current config section
+ * @param[in]   _pstTemplate          Concerned template
+ * @param[in]   _u32Fields            Fields to resolve
+ */
+static void orxFASTCALL orxObject_ResolveTemplate(orxOBJECT_TEMPLATE *_pstTemplate, orxU32 _u32Fields)
+{
+  /* Checks */
+  orxASSERT(_pstTemplate != orxNULL);
+
+  /* Pool? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_POOL))
+  {
+    /* Gets pool size */
+    _pstTemplate->u32PoolSize = orxConfig_GetU32ByID(sstObject.astKeyIDList[orxOBJECT_KEY_POOL]);
+  }
+
+  /* Frame? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_FRAME))
+  {
+    const orxSTRING zAutoScrolling;
+    const orxSTRING zIgnoreFromParent;
+
+    /* Gets auto scrolling value */
+    zAutoScrolling = orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_AUTO_SCROLL]);
+
+    /* X auto scrolling? */
+    if(orxString_ICompare(zAutoScrolling, orxOBJECT_KZ_X) == 0)
+    {
+      /* Updates frame flags */
+      _pstTemplate->u32FrameFlags = orxFRAME_KU32_FLAG_SCROLL_X;
+    }
+    /* Y auto scrolling? */
+    else if(orxString_ICompare(zAutoScrolling, orxOBJECT_KZ_Y) == 0)
+    {
+      /* Updates frame flags */
+      _pstTemplate->u32FrameFlags = orxFRAME_KU32_FLAG_SCROLL_Y;
+    }
+    /* Both auto scrolling? */
+    else if(orxString_ICompare(zAutoScrolling, orxOBJECT_KZ_BOTH) == 0)
+    {
+      /* Updates frame flags */
+      _pstTemplate->u32FrameFlags = orxFRAME_KU32_FLAG_SCROLL_X | orxFRAME_KU32_FLAG_SCROLL_Y;
+    }
+    else
+    {
+      /* Updates frame flags */
+      _pstTemplate->u32FrameFlags = orxFRAME_KU32_FLAG_NONE;
+    }
+
+    /* Depth scaling active? */
+    if(orxConfig_GetBoolByID(sstObject.astKeyIDList[orxOBJECT_KEY_DEPTH_SCALE]) != orxFALSE)
+    {
+      /* Updates frame flags */
+      _pstTemplate->u32FrameFlags |= orxFRAME_KU32_FLAG_DEPTH_SCALE;
+    }
+
+    /* Ignore from parent? */
+    zIgnoreFromParent = orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_IGNORE_FROM_PARENT]);
+    if(*zIgnoreFromParent != orxCHAR_NULL)
+    {
+      /* Updates flags */
+      _pstTemplate->u32FrameFlags |= orxFrame_GetIgnoreFlagValues(zIgnoreFromParent);
+    }
+  }
+
+  /* Parent space? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_PARENT_SPACE))
+  {
+    const orxSTRING zUseParentSpace;
+    orxU32          u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_NONE;
+
+    /* Gets its literal version */
+    zUseParentSpace = orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_USE_PARENT_SPACE]);
+
+    /* Defined? */
+    if((zUseParentSpace != orxNULL) && (*zUseParentSpace != orxCHAR_NULL))
+    {
+      orxBOOL bUseParentSpace;
+
+      /* Scale only? */
+      if(orxString_ICompare(zUseParentSpace, orxOBJECT_KZ_SCALE) == 0)
+      {
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SPACE | orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SCALE;
+      }
+      /* Position only? */
+      else if(orxString_ICompare(zUseParentSpace, orxOBJECT_KZ_POSITION) == 0)
+      {
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SPACE | orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_POSITION;
+      }
+      /* Both? */
+      else if(orxString_ICompare(zUseParentSpace, orxOBJECT_KZ_BOTH) == 0)
+      {
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SPACE | orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SCALE | orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_POSITION;
+      }
+      /* Boolean? */
+      else if(orxString_ToBool(zUseParentSpace, &bUseParentSpace, orxNULL) != orxSTATUS_FAILURE)
+      {
+        /* Updates flags */
+        u32Flags = (bUseParentSpace != orxFALSE)
+                   ? orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SPACE | orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_BOOL | orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SCALE | orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_POSITION
+                   : orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SPACE | orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_BOOL;
+      }
+      else
+      {
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SPACE;
+      }
+    }
+
+    /* Stores them */
+    orxFLAG_SET(_pstTemplate->u32Flags, u32Flags, orxOBJECT_TEMPLATE_KU32_MASK_PARENT_SPACE);
+  }
+
+  /* Flip? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_FLIP))
+  {
+    const orxSTRING zFlip;
+    orxU32          u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_NONE;
+
+    /* Gets flip value */
+    zFlip = orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_FLIP]);
+
+    /* Valid? */
+    if(*zFlip != orxCHAR_NULL)
+    {
+      /* X flipping? */
+      if(orxString_ICompare(zFlip, orxOBJECT_KZ_X) == 0)
+      {
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_FLIP | orxOBJECT_TEMPLATE_KU32_FLAG_FLIP_X;
+      }
+      /* Y flipping? */
+      else if(orxString_ICompare(zFlip, orxOBJECT_KZ_Y) == 0)
+      {
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_FLIP | orxOBJECT_TEMPLATE_KU32_FLAG_FLIP_Y;
+      }
+      /* Both flipping? */
+      else if(orxString_ICompare(zFlip, orxOBJECT_KZ_BOTH) == 0)
+      {
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_FLIP | orxOBJECT_TEMPLATE_KU32_FLAG_FLIP_X | orxOBJECT_TEMPLATE_KU32_FLAG_FLIP_Y;
+      }
+      else
+      {
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_FLIP;
+      }
+    }
+
+    /* Stores them */
+    orxFLAG_SET(_pstTemplate->u32Flags, u32Flags, orxOBJECT_TEMPLATE_KU32_MASK_FLIP);
+  }
+
+  /* Origin? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_ORIGIN))
+  {
+    /* Updates status */
+    orxFLAG_SET(_pstTemplate->u32Flags, (orxConfig_GetVectorByID(sstObject.astKeyIDList[orxOBJECT_KEY_ORIGIN], &(_pstTemplate->vOrigin)) != orxNULL) ? orxOBJECT_TEMPLATE_KU32_FLAG_ORIGIN : orxOBJECT_TEMPLATE_KU32_FLAG_NONE, orxOBJECT_TEMPLATE_KU32_FLAG_ORIGIN);
+  }
+
+  /* Size? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_SIZE))
+  {
+    /* Updates status */
+    orxFLAG_SET(_pstTemplate->u32Flags, (orxConfig_GetVectorByID(sstObject.astKeyIDList[orxOBJECT_KEY_SIZE], &(_pstTemplate->vSize)) != orxNULL) ? orxOBJECT_TEMPLATE_KU32_FLAG_SIZE : orxOBJECT_TEMPLATE_KU32_FLAG_NONE, orxOBJECT_TEMPLATE_KU32_FLAG_SIZE);
+  }
+
+  /* Pivot? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_PIVOT))
+  {
+    const orxSTRING zPivot;
+    orxU32          u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_NONE;
+
+    /* Gets pivot */
+    zPivot = orxString_SkipWhiteSpaces(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_PIVOT]));
+
+    /* Valid? */
+    if(*zPivot != orxCHAR_NULL)
+    {
+      /* Is vector? */
+      if(orxConfig_ToVector(zPivot, orxCOLORSPACE_NONE, &(_pstTemplate->vPivot)) != orxNULL)
+      {
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT | orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT_VECTOR;
+      }
+      else
+      {
+        /* Stores align flags */
+        _pstTemplate->u32PivotAlignFlags = orxGraphic_GetAlignFlags(zPivot);
+
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT;
+      }
+    }
+
+    /* Stores them */
+    orxFLAG_SET(_pstTemplate->u32Flags, u32Flags, orxOBJECT_TEMPLATE_KU32_MASK_PIVOT);
+  }
+
+  /* Scale? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_SCALE))
+  {
+    /* Has scale? */
+    if(orxConfig_HasValueByID(sstObject.astKeyIDList[orxOBJECT_KEY_SCALE]) != orxFALSE)
+    {
+      /* Is config scale not a vector? */
+      if(orxConfig_GetVectorByID(sstObject.astKeyIDList[orxOBJECT_KEY_SCALE], &(_pstTemplate->vScale)) == orxNULL)
+      {
+        /* Gets config uniformed scale */
+        orxVector_SetAll(&(_pstTemplate->vScale), orxConfig_GetFloatByID(sstObject.astKeyIDList[orxOBJECT_KEY_SCALE]));
+      }
+
+      /* Updates status */
+      orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_SCALE, orxOBJECT_TEMPLATE_KU32_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates status */
+      orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_NONE, orxOBJECT_TEMPLATE_KU32_FLAG_SCALE);
+    }
+  }
+
+
+  /* Group? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_GROUP))
+  {
+    /* Has group? */
+    if(orxConfig_HasValueByID(sstObject.astKeyIDList[orxOBJECT_KEY_GROUP]) != orxFALSE)
+    {
+      /* Stores its ID */
+      _pstTemplate->stGroupID = orxString_GetID(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_GROUP]));
+
+      /* Updates status */
+      orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_GROUP, orxOBJECT_TEMPLATE_KU32_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates status */
+      orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_NONE, orxOBJECT_TEMPLATE_KU32_FLAG_GROUP);
+    }
+  }
+
+  /* Age? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_AGE))
+  {
+    /* Gets it */
+    _pstTemplate->fAge = orxConfig_GetFloatByID(sstObject.astKeyIDList[orxOBJECT_KEY_AGE]);
+  }
+
+  /* Graphic? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_GRAPHIC))
+  {
+    /* Gets its name */
+    _pstTemplate->zGraphic = orxObject_StoreTemplateString(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_GRAPHIC_NAME]));
+  }
+
+  /* Animation? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_ANIM))
+  {
+    /* Gets animation set name */
+    _pstTemplate->zAnimPointer = orxObject_StoreTemplateString(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_ANIMPOINTER_NAME]));
+
+    /* Has frequency? */
+    if(orxConfig_HasValueByID(sstObject.astKeyIDList[orxOBJECT_KEY_ANIM_FREQUENCY]) != orxFALSE)
+    {
+      /* Gets it */
+      _pstTemplate->fAnimFrequency = orxConfig_GetFloatByID(sstObject.astKeyIDList[orxOBJECT_KEY_ANIM_FREQUENCY]);
+
+      /* Updates status */
+      orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_ANIM_FREQUENCY, orxOBJECT_TEMPLATE_KU32_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates status */
+      orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_NONE, orxOBJECT_TEMPLATE_KU32_FLAG_ANIM_FREQUENCY);
+    }
+  }
+
+  /* Body? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_BODY))
+  {
+    /* Gets its name */
+    _pstTemplate->zBody = orxObject_StoreTemplateString(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_BODY]));
+  }
+
+  /* Clock? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_CLOCK))
+  {
+    /* Gets its name */
+    _pstTemplate->zClock = orxObject_StoreTemplateString(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_CLOCK]));
+  }
+
+  /* Spawner? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_SPAWNER))
+  {
+    /* Gets its name */
+    _pstTemplate->zSpawner = orxObject_StoreTemplateString(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_SPAWNER]));
+  }
+
+  /* Shader? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_SHADER))
+  {
+    const orxSTRING zShaderName;
+
+    /* Gets shader name */
+    zShaderName = orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_SHADER]);
+
+    /* Not found? */
+    if(*zShaderName == orxCHAR_NULL)
+    {
+      /* Gets first shader from list */
+      zShaderName = orxConfig_GetListStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_SHADER_LIST], 0);
+
+      /* Has multiple shaders? */
+      if(orxConfig_GetListCountByID(sstObject.astKeyIDList[orxOBJECT_KEY_SHADER_LIST]) > 1)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, orxANSI_KZ_COLOR_FG_GREEN "[%s]" orxANSI_KZ_COLOR_FG_DEFAULT ": deprecated property <ShaderList> contains multiple entries, only the first one will be used.", orxConfig_GetCurrentSection());
+      }
+    }
+
+    /* Stores it */
+    _pstTemplate->zShader = orxObject_StoreTemplateString(zShaderName);
+  }
+
+  /* Parent camera? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_PARENT_CAMERA))
+  {
+    /* Gets its name */
+    _pstTemplate->zParentCamera = orxObject_StoreTemplateString(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_PARENT_CAMERA]));
+  }
+
+  /* Color? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_COLOR))
+  {
+    orxU32  u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_NONE;
+    orxBOOL bTypoCheck;
+
+    /* Inits color */
+    orxColor_Set(&(_pstTemplate->stColor), &orxVECTOR_WHITE, orxFLOAT_1);
+
+    /* Disables config typo check */
+    bTypoCheck = orxConfig_IsTypoCheckEnabled();
+    orxConfig_EnableTypoCheck(orxFALSE);
+
+    /* Has color? */
+    if(orxConfig_GetColorVectorByID(sstObject.astKeyIDList[orxOBJECT_KEY_COLOR], orxCOLORSPACE_COMPONENT, &(_pstTemplate->stColor.vRGB)) != orxNULL)
+    {
+      /* Normalizes it */
+      orxVector_Mulf(&(_pstTemplate->stColor.vRGB), &(_pstTemplate->stColor.vRGB), orxCOLOR_NORMALIZER);
+
+      /* Updates flags */
+      u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_COLOR;
+    }
+    /* Has RGB values? */
+    else if(orxConfig_GetColorVectorByID(sstObject.astKeyIDList[orxOBJECT_KEY_RGB], orxCOLORSPACE_RGB, &(_pstTemplate->stColor.vRGB)) != orxNULL)
+    {
+      /* Updates flags */
+      u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_COLOR;
+    }
+    /* Has HSL values? */
+    else if(orxConfig_GetColorVectorByID(sstObject.astKeyIDList[orxOBJECT_KEY_HSL], orxCOLORSPACE_HSL, &(_pstTemplate->stColor.vHSL)) != orxNULL)
+    {
+      /* Stores its RGB equivalent */
+      orxColor_FromHSLToRGB(&(_pstTemplate->stColor), &(_pstTemplate->stColor));
+
+      /* Updates flags */
+      u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_COLOR;
+    }
+    /* Has HSV values? */
+    else if(orxConfig_GetColorVectorByID(sstObject.astKeyIDList[orxOBJECT_KEY_HSV], orxCOLORSPACE_HSV, &(_pstTemplate->stColor.vHSV)) != orxNULL)
+    {
+      /* Stores its RGB equivalent */
+      orxColor_FromHSVToRGB(&(_pstTemplate->stColor), &(_pstTemplate->stColor));
+
+      /* Updates flags */
+      u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_COLOR;
+    }
+
+    /* Restores config typo check */
+    orxConfig_EnableTypoCheck(bTypoCheck);
+
+    /* Has alpha? */
+    if(orxConfig_HasValueByID(sstObject.astKeyIDList[orxOBJECT_KEY_ALPHA]) != orxFALSE)
+    {
+      /* Stores it */
+      _pstTemplate->stColor.fAlpha = orxConfig_GetFloatByID(sstObject.astKeyIDList[orxOBJECT_KEY_ALPHA]);
+
+      /* Updates flags */
+      u32Flags |= orxOBJECT_TEMPLATE_KU32_FLAG_ALPHA;
+    }
+
+    /* Stores them */
+    orxFLAG_SET(_pstTemplate->u32Flags, u32Flags, orxOBJECT_TEMPLATE_KU32_MASK_COLOR);
+  }
+
+  /* Position? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_POSITION))
+  {
+    orxCHAR         acBuffer[128];
+    const orxSTRING zPosition;
+    orxCHAR        *pcPivotOverrideMarker;
+    orxU32          u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_NONE;
+
+    /* Gets position literals */
+    orxString_NPrint(acBuffer, sizeof(acBuffer), "%s", orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_POSITION]));
+    zPosition = acBuffer;
+
+    /* Has pivot override? */
+    if((pcPivotOverrideMarker = (orxCHAR *)orxString_SearchString(zPosition, orxOBJECT_KZ_OVERRIDE_MARKER)) != orxNULL)
+    {
+      /* Replaces override marker */
+      *pcPivotOverrideMarker = orxCHAR_NULL;
+
+      /* Is a Cartesian vector? */
+      if(orxConfig_ToVector(zPosition, orxCOLORSPACE_NONE, &(_pstTemplate->vPivotOverride)) != orxNULL)
+      {
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT_OVERRIDE | orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT_OVERRIDE_VECTOR;
+      }
+      /* Valid? */
+      else if(*zPosition != orxCHAR_NULL)
+      {
+        /* Stores its align flags */
+        _pstTemplate->u32PivotOverrideAlignFlags = orxGraphic_GetAlignFlags(zPosition);
+
+        /* Updates flags */
+        u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT_OVERRIDE;
+      }
+
+      /* Updates position */
+      zPosition = orxString_SkipWhiteSpaces(pcPivotOverrideMarker + orxOBJECT_KU32_OVERRIDE_MARKER_LENGTH);
+    }
+
+    /* Is Cartesian position? */
+    if((orxConfig_ToVector(zPosition, orxCOLORSPACE_NONE, &(_pstTemplate->vPosition)) != orxNULL)
+    || (orxVector_SetAll(&(_pstTemplate->vPosition), orxFLOAT_0), orxString_ToFloat(zPosition, &(_pstTemplate->vPosition.fZ), orxNULL) != orxSTATUS_FAILURE))
+    {
+      /* Updates flags */
+      u32Flags |= orxOBJECT_TEMPLATE_KU32_FLAG_POSITION;
+    }
+    /* Has literal position? */
+    else if(*zPosition != orxCHAR_NULL)
+    {
+      const orxCHAR *pc;
+
+      /* Stores its align flags */
+      _pstTemplate->u32PositionAlignFlags = orxGraphic_GetAlignFlags(zPosition);
+
+      /* Updates flags */
+      u32Flags |= orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_LITERAL;
+
+      /* Looks for numerical value */
+      for(pc = zPosition; *pc != orxCHAR_NULL; pc++)
+      {
+        /* Found? */
+        if(((*pc >= '0') && (*pc <= '9'))
+        || (*pc == orxSTRING_KC_VECTOR_START)
+        || (*pc == orxSTRING_KC_VECTOR_START_ALT)
+        || (*pc == '+')
+        || (*pc == '-')
+        || (*pc == '.'))
+        {
+          /* Is a vector? */
+          if(orxConfig_ToVector(pc, orxCOLORSPACE_NONE, &(_pstTemplate->vPositionOffset)) != orxNULL)
+          {
+            /* Updates flags */
+            u32Flags |= orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_OFFSET | orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_OFFSET_VECTOR;
+          }
+          else
+          {
+            /* Uses it as Z component */
+            orxVector_SetAll(&(_pstTemplate->vPositionOffset), orxFLOAT_0);
+            orxString_ToFloat(pc, &(_pstTemplate->vPositionOffset.fZ), orxNULL);
+
+            /* Updates flags */
+            u32Flags |= orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_OFFSET;
+          }
+          break;
+        }
+      }
+    }
+    /* Has spherical position? */
+    else if(orxConfig_GetVectorByID(sstObject.astKeyIDList[orxOBJECT_KEY_SPHERICAL_POSITION], &(_pstTemplate->vPosition)) != orxNULL)
+    {
+      /* Transforms it */
+      _pstTemplate->vPosition.fTheta *= orxMATH_KF_DEG_TO_RAD;
+      _pstTemplate->vPosition.fPhi   *= orxMATH_KF_DEG_TO_RAD;
+      orxVector_FromSphericalToCartesian(&(_pstTemplate->vPosition), &(_pstTemplate->vPosition));
+
+      /* Updates flags */
+      u32Flags |= orxOBJECT_TEMPLATE_KU32_FLAG_POSITION;
+    }
+
+    /* Stores them */
+    orxFLAG_SET(_pstTemplate->u32Flags, u32Flags, orxOBJECT_TEMPLATE_KU32_MASK_POSITION);
+  }
+
+  /* Rotation? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_ROTATION))
+  {
+    /* Gets rotation & angular velocity */
+    _pstTemplate->fRotation         = orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloatByID(sstObject.astKeyIDList[orxOBJECT_KEY_ROTATION]);
+    _pstTemplate->fAngularVelocity  = orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloatByID(sstObject.astKeyIDList[orxOBJECT_KEY_ANGULAR_VELOCITY]);
+  }
+
+  /* Speed? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_SPEED))
+  {
+    orxU32 u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_NONE;
+
+    /* Has speed? */
+    if(orxConfig_GetVectorByID(sstObject.astKeyIDList[orxOBJECT_KEY_SPEED], &(_pstTemplate->vSpeed)) != orxNULL)
+    {
+      /* Updates flags */
+      u32Flags = (orxConfig_GetBoolByID(sstObject.astKeyIDList[orxOBJECT_KEY_USE_RELATIVE_SPEED]) != orxFALSE)
+                 ? orxOBJECT_TEMPLATE_KU32_FLAG_SPEED | orxOBJECT_TEMPLATE_KU32_FLAG_RELATIVE_SPEED
+                 : orxOBJECT_TEMPLATE_KU32_FLAG_SPEED;
+    }
+
+    /* Stores them */
+    orxFLAG_SET(_pstTemplate->u32Flags, u32Flags, orxOBJECT_TEMPLATE_KU32_MASK_SPEED);
+  }
+
+  /* Display? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_DISPLAY))
+  {
+    orxU32 u32Flags = orxOBJECT_TEMPLATE_KU32_FLAG_NONE;
+
+    /* Has smoothing value? */
+    if(orxConfig_HasValueByID(sstObject.astKeyIDList[orxOBJECT_KEY_SMOOTHING]) != orxFALSE)
+    {
+      /* Stores object flags */
+      _pstTemplate->u32ObjectFlags = (orxConfig_GetBoolByID(sstObject.astKeyIDList[orxOBJECT_KEY_SMOOTHING]) != orxFALSE) ? orxOBJECT_KU32_FLAG_SMOOTHING_ON : orxOBJECT_KU32_FLAG_SMOOTHING_OFF;
+    }
+    else
+    {
+      /* Clears object flags */
+      _pstTemplate->u32ObjectFlags = orxOBJECT_KU32_FLAG_NONE;
+    }
+
+    /* Has blend mode? */
+    if(orxConfig_HasValueByID(sstObject.astKeyIDList[orxOBJECT_KEY_BLEND_MODE]) != orxFALSE)
+    {
+      /* Stores it */
+      _pstTemplate->eBlendMode = orxDisplay_GetBlendModeFromString(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_BLEND_MODE]));
+
+      /* Updates flags */
+      u32Flags |= orxOBJECT_TEMPLATE_KU32_FLAG_BLEND_MODE;
+    }
+
+    /* Should repeat? */
+    if(orxConfig_GetVectorByID(sstObject.astKeyIDList[orxOBJECT_KEY_REPEAT], &(_pstTemplate->vRepeat)) != orxNULL)
+    {
+      /* Updates flags */
+      u32Flags |= orxOBJECT_TEMPLATE_KU32_FLAG_REPEAT;
+    }
+
+    /* Stores them */
+    orxFLAG_SET(_pstTemplate->u32Flags, u32Flags, orxOBJECT_TEMPLATE_KU32_MASK_DISPLAY);
+  }
+
+  /* Lifetime? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_LIFETIME))
+  {
+    /* Has life time? */
+    if(orxConfig_HasValueByID(sstObject.astKeyIDList[orxOBJECT_KEY_LIFETIME]) != orxFALSE)
+    {
+      /* Gets its literal flags */
+      _pstTemplate->u32LifeTimeFlags = orxObject_GetLiteralLifeTimeFlags(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_LIFETIME]));
+
+      /* No literal? */
+      if(_pstTemplate->u32LifeTimeFlags == orxOBJECT_KU32_FLAG_NONE)
+      {
+        /* Gets its numerical value */
+        _pstTemplate->fLifeTime = orxConfig_GetFloatByID(sstObject.astKeyIDList[orxOBJECT_KEY_LIFETIME]);
+      }
+
+      /* Updates status */
+      orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_LIFETIME, orxOBJECT_TEMPLATE_KU32_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates status */
+      orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_NONE, orxOBJECT_TEMPLATE_KU32_FLAG_LIFETIME);
+    }
+  }
+
+  /* Commands? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_COMMAND))
+  {
+    /* Gets them */
+    _pstTemplate->zOnPrepare  = orxObject_StoreTemplateString(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_ON_PREPARE]));
+    _pstTemplate->zOnCreate   = orxObject_StoreTemplateString(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_ON_CREATE]));
+    _pstTemplate->zOnDelete   = orxObject_StoreTemplateString(orxConfig_GetStringByID(sstObject.astKeyIDList[orxOBJECT_KEY_ON_DELETE]));
+  }
+
+  /* Trigger list? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_TRIGGER_LIST))
+  {
+    /* Resolves it */
+    orxObject_ResolveTemplateList(_pstTemplate, orxOBJECT_TEMPLATE_LIST_TRIGGER);
+  }
+
+  /* Sound list? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_SOUND_LIST))
+  {
+    /* Resolves it */
+    orxObject_ResolveTemplateList(_pstTemplate, orxOBJECT_TEMPLATE_LIST_SOUND);
+  }
+
+  /* FX list? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_FX_LIST))
+  {
+    orxS32 i, s32RecursiveCount;
+
+    /* Resolves it */
+    orxObject_ResolveTemplateList(_pstTemplate, orxOBJECT_TEMPLATE_LIST_FX);
+
+    /* Gets number of recursive FXs */
+    s32RecursiveCount = orxMIN(orxConfig_GetListCountByID(sstObject.astKeyIDList[orxOBJECT_KEY_FX_RECURSIVE_LIST]), (orxS32)orxOBJECT_KU32_TEMPLATE_LIST_SIZE);
+
+    /* For all recursive values */
+    for(i = 0, _pstTemplate->u32FXRecursiveFlags = 0; i < s32RecursiveCount; i++)
+    {
+      /* Is recursive? */
+      if(orxConfig_GetListBoolByID(sstObject.astKeyIDList[orxOBJECT_KEY_FX_RECURSIVE_LIST], i) != orxFALSE)
+      {
+        /* Updates flags */
+        _pstTemplate->u32FXRecursiveFlags |= 1 << i;
+      }
+    }
+
+    /* Has frequency? */
+    if(orxConfig_HasValueByID(sstObject.astKeyIDList[orxOBJECT_KEY_FX_FREQUENCY]) != orxFALSE)
+    {
+      /* Gets it */
+      _pstTemplate->fFXFrequency = orxConfig_GetFloatByID(sstObject.astKeyIDList[orxOBJECT_KEY_FX_FREQUENCY]);
+
+      /* Updates status */
+      orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_FX_FREQUENCY, orxOBJECT_TEMPLATE_KU32_FLAG_NONE);
+    }
+    else
+    {
+      /* Updates status */
+      orxFLAG_SET(_pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_NONE, orxOBJECT_TEMPLATE_KU32_FLAG_FX_FREQUENCY);
+    }
+  }
+
+  /* Track list? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_TRACK_LIST))
+  {
+    /* Resolves it */
+    orxObject_ResolveTemplateList(_pstTemplate, orxOBJECT_TEMPLATE_LIST_TRACK);
+  }
+
+  /* Child list? */
+  if(orxFLAG_TEST(_u32Fields, orxOBJECT_TEMPLATE_KU32_FIELD_CHILD_LIST))
+  {
+    /* Resolves child & joint lists */
+    orxObject_ResolveTemplateList(_pstTemplate, orxOBJECT_TEMPLATE_LIST_CHILD);
+    orxObject_ResolveTemplateList(_pstTemplate, orxOBJECT_TEMPLATE_LIST_CHILD_JOINT);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Compiles a template from the current config section
+ * @param[in]   _pstTemplate          Concerned template
+ */
+static orxINLINE void orxObject_CompileTemplate(orxOBJECT_TEMPLATE *_pstTemplate)
+{
+  orxU32 u32DynamicFields = orxOBJECT_TEMPLATE_KU32_FIELD_NONE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxObject_CompileTemplate");
+
+  /* Checks */
+  orxASSERT(_pstTemplate != orxNULL);
+
+  /* Stores its section generation */
+  _pstTemplate->u32Generation = orxConfig_GetSectionGeneration(orxConfig_GetCurrentSection());
+
+  /* Finds all the fields whose values need to be resolved for every instance */
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_POOL]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_POOL;
+  }
+  if((orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_AUTO_SCROLL]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_DEPTH_SCALE]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_IGNORE_FROM_PARENT]) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_FRAME;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_USE_PARENT_SPACE]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_PARENT_SPACE;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_FLIP]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_FLIP;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_ORIGIN]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_ORIGIN;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_SIZE]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_SIZE;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_PIVOT]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_PIVOT;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_SCALE]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_SCALE;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_GROUP]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_GROUP;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_AGE]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_AGE;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_GRAPHIC_NAME]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_GRAPHIC;
+  }
+  if((orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_ANIMPOINTER_NAME]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_ANIM_FREQUENCY]) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_ANIM;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_BODY]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_BODY;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_CLOCK]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_CLOCK;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_SPAWNER]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_SPAWNER;
+  }
+  if((orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_SHADER]) != orxFALSE)
+  || (orxObject_IsDynamicListValue(orxOBJECT_KEY_SHADER_LIST) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_SHADER;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_PARENT_CAMERA]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_PARENT_CAMERA;
+  }
+  if((orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_COLOR]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_RGB]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_HSL]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_HSV]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_ALPHA]) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_COLOR;
+  }
+  if((orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_POSITION]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_SPHERICAL_POSITION]) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_POSITION;
+  }
+  if((orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_ROTATION]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_ANGULAR_VELOCITY]) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_ROTATION;
+  }
+  if((orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_SPEED]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_USE_RELATIVE_SPEED]) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_SPEED;
+  }
+  if((orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_SMOOTHING]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_BLEND_MODE]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_REPEAT]) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_DISPLAY;
+  }
+  if(orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_LIFETIME]) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_LIFETIME;
+  }
+  if((orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_ON_PREPARE]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_ON_CREATE]) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_ON_DELETE]) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_COMMAND;
+  }
+  if(orxObject_IsDynamicListValue(orxOBJECT_KEY_TRIGGER_LIST) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_TRIGGER_LIST;
+  }
+  if(orxObject_IsDynamicListValue(orxOBJECT_KEY_SOUND_LIST) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_SOUND_LIST;
+  }
+  if((orxObject_IsDynamicListValue(orxOBJECT_KEY_FX_LIST) != orxFALSE)
+  || (orxObject_IsDynamicListValue(orxOBJECT_KEY_FX_RECURSIVE_LIST) != orxFALSE)
+  || (orxConfig_IsDynamicValue(sazObjectKeyList[orxOBJECT_KEY_FX_FREQUENCY]) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_FX_LIST;
+  }
+  if(orxObject_IsDynamicListValue(orxOBJECT_KEY_TRACK_LIST) != orxFALSE)
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_TRACK_LIST;
+  }
+  if((orxObject_IsDynamicListValue(orxOBJECT_KEY_CHILD_LIST) != orxFALSE)
+  || (orxObject_IsDynamicListValue(orxOBJECT_KEY_CHILD_JOINT_LIST) != orxFALSE))
+  {
+    u32DynamicFields |= orxOBJECT_TEMPLATE_KU32_FIELD_CHILD_LIST;
+  }
+
+  /* Stores them */
+  _pstTemplate->u32DynamicFields = u32DynamicFields;
+
+  /* Resolves static fields */
+  orxObject_ResolveTemplate(_pstTemplate, orxOBJECT_TEMPLATE_KU32_FIELD_ALL & ~u32DynamicFields);
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+/** Gets the resolved template of the current config section
+ * @param[in]   _pstBuffer            Buffer used when some values have to be resolved for this instance only
+ * @return      Resolved template
+ */
+static const orxOBJECT_TEMPLATE *orxFASTCALL orxObject_GetTemplate(orxOBJECT_TEMPLATE *_pstBuffer)
+{
+  orxOBJECT_TEMPLATE *pstTemplate = orxNULL;
+  const orxOBJECT_TEMPLATE *pstResult;
+
+  /* Checks */
+  orxASSERT(_pstBuffer != orxNULL);
+
+  /* No template table yet? */
+  if(sstObject.pstTemplateTable == orxNULL)
+  {
+    /* Creates template bank & table */
+    sstObject.pstTemplateBank   = orxBank_Create(orxOBJECT_KU32_TEMPLATE_BANK_SIZE, sizeof(orxOBJECT_TEMPLATE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstObject.pstTemplateTable  = orxHashTable_Create(orxOBJECT_KU32_TEMPLATE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Failure? */
+    if((sstObject.pstTemplateBank == orxNULL) || (sstObject.pstTemplateTable == orxNULL))
+    {
+      /* Deletes them */
+      if(sstObject.pstTemplateBank != orxNULL)
+      {
+        orxBank_Delete(sstObject.pstTemplateBank);
+        sstObject.pstTemplateBank = orxNULL;
+      }
+      if(sstObject.pstTemplateTable != orxNULL)
+      {
+        orxHashTable_Delete(sstObject.pstTemplateTable);
+        sstObject.pstTemplateTable = orxNULL;
+      }
+
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't create template table, config values will be resolved for every instance.");
+    }
+  }
+
+  /* Has template table? */
+  if(sstObject.pstTemplateTable != orxNULL)
+  {
+    orxSTRINGID stID;
+
+    /* Gets section ID */
+    stID = orxString_GetID(orxConfig_GetCurrentSection());
+
+    /* Gets template */
+    pstTemplate = (orxOBJECT_TEMPLATE *)orxHashTable_Get(sstObject.pstTemplateTable, stID);
+
+    /* Found? */
+    if(pstTemplate != orxNULL)
+    {
+      /* Outdated, ie. its section or one of its ancestors has been modified? */
+      if(pstTemplate->u32Generation != orxConfig_GetSectionGeneration(orxConfig_GetCurrentSection()))
+      {
+        /* Recompiles it */
+        orxObject_CompileTemplate(pstTemplate);
+      }
+    }
+    else
+    {
+      /* Allocates it */
+      pstTemplate = (orxOBJECT_TEMPLATE *)orxBank_Allocate(sstObject.pstTemplateBank);
+
+      /* Success? */
+      if(pstTemplate != orxNULL)
+      {
+        /* Adds it to the table */
+        if(orxHashTable_Add(sstObject.pstTemplateTable, stID, pstTemplate) != orxSTATUS_FAILURE)
+        {
+          /* Inits it */
+          orxMemory_Zero(pstTemplate, sizeof(orxOBJECT_TEMPLATE));
+
+          /* Compiles it */
+          orxObject_CompileTemplate(pstTemplate);
+        }
+        else
+        {
+          /* Frees it */
+          orxBank_Free(sstObject.pstTemplateBank, pstTemplate);
+          pstTemplate = orxNULL;
+        }
+      }
+    }
+  }
+
+  /* Has template? */
+  if(pstTemplate != orxNULL)
+  {
+    /* No dynamic fields? */
+    if(pstTemplate->u32DynamicFields == orxOBJECT_TEMPLATE_KU32_FIELD_NONE)
+    {
+      /* Updates result */
+      pstResult = pstTemplate;
+    }
+    else
+    {
+      /* Copies it */
+      orxMemory_Copy(_pstBuffer, pstTemplate, sizeof(orxOBJECT_TEMPLATE));
+
+      /* Resolves its dynamic fields */
+      orxObject_ResolveTemplate(_pstBuffer, pstTemplate->u32DynamicFields);
+
+      /* Updates result */
+      pstResult = _pstBuffer;
+    }
+  }
+  else
+  {
+    /* Resolves all fields */
+    orxMemory_Zero(_pstBuffer, sizeof(orxOBJECT_TEMPLATE));
+    orxObject_ResolveTemplate(_pstBuffer, orxOBJECT_TEMPLATE_KU32_FIELD_ALL);
+
+    /* Updates result */
+    pstResult = _pstBuffer;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets the 2D axis-aligned extents of an oriented box
+ */
+static orxINLINE void orxObject_GetBoxExtents(const orxOBOX *_pstBox, orxAABOX *_pstExtents)
+{
+  orxVECTOR vOrigin;
+
+  /* Gets origin */
+  orxVector_Sub(&vOrigin, &(_pstBox->vPosition), &(_pstBox->vPivot));
+
+  /* Updates extents */
+  orxVector_Set(&(_pstExtents->vTL), vOrigin.fX + orxMIN(_pstBox->vX.fX, orxFLOAT_0) + orxMIN(_pstBox->vY.fX, orxFLOAT_0), vOrigin.fY + orxMIN(_pstBox->vX.fY, orxFLOAT_0) + orxMIN(_pstBox->vY.fY, orxFLOAT_0), orxFLOAT_0);
+  orxVector_Set(&(_pstExtents->vBR), vOrigin.fX + orxMAX(_pstBox->vX.fX, orxFLOAT_0) + orxMAX(_pstBox->vY.fX, orxFLOAT_0), vOrigin.fY + orxMAX(_pstBox->vX.fY, orxFLOAT_0) + orxMAX(_pstBox->vY.fY, orxFLOAT_0), orxFLOAT_0);
+
+  /* Done! */
+  return;
+}
+
+/** Gets the key of an index cell
+ */
+static orxINLINE orxU64 orxObject_GetIndexCellKey(orxS32 _s32X, orxS32 _s32Y)
+{
+  /* Done! */
+  return ((orxU64)(orxU32)_s32X << 32) | (orxU64)(orxU32)_s32Y;
+}
+
+/** Links an index entry to its cell, or to the large entry list
+ */
+static orxINLINE void orxObject_LinkIndexEntry(orxOBJECT_INDEX *_pstIndex, orxU32 _u32Entry, orxBOOL _bLarge)
+{
+  orxOBJECT_INDEX_ENTRY *pstEntry;
+
+  /* Gets entry */
+  pstEntry = &(_pstIndex->astEntryList[_u32Entry]);
+
+  /* Small? */
+  if(_bLarge == orxFALSE)
+  {
+    orxU32 u32Head;
+
+    /* Gets current cell head */
+    u32Head = (orxU32)(orxUPTR)orxHashTable_Get(_pstIndex->pstCellTable, pstEntry->u64Cell);
+
+    /* Becomes new cell head? */
+    if(orxHashTable_Set(_pstIndex->pstCellTable, pstEntry->u64Cell, (void *)(orxUPTR)_u32Entry) != orxSTATUS_FAILURE)
+    {
+      /* Links it */
+      pstEntry->u32Next = u32Head;
+      if(u32Head != 0)
+      {
+        _pstIndex->astEntryList[u32Head].u32Previous = _u32Entry;
+      }
+    }
+    else
+    {
+      /* Uses large entry list instead */
+      _bLarge = orxTRUE;
+    }
+  }
+
+  /* Large? */
+  if(_bLarge != orxFALSE)
+  {
+    /* Links it */
+    pstEntry->u32Next = _pstIndex->u32LargeEntry;
+    if(_pstIndex->u32LargeEntry != 0)
+    {
+      _pstIndex->astEntryList[_pstIndex->u32LargeEntry].u32Previous = _u32Entry;
+    }
+    _pstIndex->u32LargeEntry = _u32Entry;
+
+    /* Updates flags */
+    orxFLAG_SET(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_LARGE, orxOBJECT_KU32_INDEX_FLAG_NONE);
+  }
+
+  /* Updates entry */
+  pstEntry->u32Previous = 0;
+  orxFLAG_SET(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_LINKED, orxOBJECT_KU32_INDEX_FLAG_NONE);
+
+  /* Done! */
+  return;
+}
+
+/** Unlinks an index entry from its cell or from the large entry list
+ */
+static orxINLINE void orxObject_UnlinkIndexEntry(orxOBJECT_INDEX *_pstIndex, orxU32 _u32Entry)
+{
+  orxOBJECT_INDEX_ENTRY *pstEntry;
+
+  /* Gets entry */
+  pstEntry = &(_pstIndex->astEntryList[_u32Entry]);
+
+  /* Linked? */
+  if(orxFLAG_TEST(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_LINKED))
+  {
+    /* Has next? */
+    if(pstEntry->u32Next != 0)
+    {
+      /* Updates it */
+      _pstIndex->astEntryList[pstEntry->u32Next].u32Previous = pstEntry->u32Previous;
+    }
+
+    /* Has previous? */
+    if(pstEntry->u32Previous != 0)
+    {
+      /* Updates it */
+      _pstIndex->astEntryList[pstEntry->u32Previous].u32Next = pstEntry->u32Next;
+    }
+    /* Large? */
+    else if(orxFLAG_TEST(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_LARGE))
+    {
+      /* Updates large entry list */
+      _pstIndex->u32LargeEntry = pstEntry->u32Next;
+    }
+    /* Has next? */
+    else if(pstEntry->u32Next != 0)
+    {
+      /* Updates cell head */
+      orxHashTable_Set(_pstIndex->pstCellTable, pstEntry->u64Cell, (void *)(orxUPTR)pstEntry->u32Next);
+    }
+    else
+    {
+      /* Removes cell */
+      orxHashTable_Remove(_pstIndex->pstCellTable, pstEntry->u64Cell);
+    }
+
+    /* Updates entry */
+    pstEntry->u32Previous = pstEntry->u32Next = 0;
+    orxFLAG_SET(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_NONE, orxOBJECT_KU32_INDEX_FLAG_LINKED | orxOBJECT_KU32_INDEX_FLAG_LARGE);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Updates an index entry from its object and moves it to its new cell, if needed
+ */
+static void orxFASTCALL orxObject_UpdateIndexEntry(orxOBJECT_INDEX *_pstIndex, orxU32 _u32Entry)
+{
+  orxOBJECT_INDEX_ENTRY  *pstEntry;
+  orxOBOX                 stBox;
+
+  /* Gets entry */
+  pstEntry = &(_pstIndex->astEntryList[_u32Entry]);
+
+  /* Has bounding box? */
+  if(orxObject_GetBoundingBox(pstEntry->pstObject, &stBox) != orxNULL)
+  {
+    orxFLOAT  fX, fY;
+    orxU64    u64Cell = 0;
+    orxBOOL   bLarge;
+
+    /* Updates its extents */
+    orxObject_GetBoxExtents(&stBox, &(pstEntry->stBox));
+
+    /* Gets its cell coordinates, from its center */
+    fX = orxMath_Floor(orx2F(0.5f) * (pstEntry->stBox.vTL.fX + pstEntry->stBox.vBR.fX) * _pstIndex->fRecCellSize);
+    fY = orxMath_Floor(orx2F(0.5f) * (pstEntry->stBox.vTL.fY + pstEntry->stBox.vBR.fY) * _pstIndex->fRecCellSize);
+
+    /* Is larger than a cell or out of grid range? */
+    bLarge = ((pstEntry->stBox.vBR.fX - pstEntry->stBox.vTL.fX > _pstIndex->fCellSize)
+           || (pstEntry->stBox.vBR.fY - pstEntry->stBox.vTL.fY > _pstIndex->fCellSize)
+           || !(orxMath_Abs(fX) < orxOBJECT_KF_INDEX_CELL_RANGE)
+           || !(orxMath_Abs(fY) < orxOBJECT_KF_INDEX_CELL_RANGE)) ? orxTRUE : orxFALSE;
+
+    /* Small? */
+    if(bLarge == orxFALSE)
+    {
+      /* Gets its cell */
+      u64Cell = orxObject_GetIndexCellKey(orxF2S(fX), orxF2S(fY));
+    }
+
+    /* Not linked or cell changed? */
+    if(!orxFLAG_TEST(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_LINKED)
+    || (bLarge != (orxFLAG_TEST(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_LARGE) ? orxTRUE : orxFALSE))
+    || ((bLarge == orxFALSE) && (u64Cell != pstEntry->u64Cell)))
+    {
+      /* Moves it */
+      orxObject_UnlinkIndexEntry(_pstIndex, _u32Entry);
+      pstEntry->u64Cell = u64Cell;
+      orxObject_LinkIndexEntry(_pstIndex, _u32Entry, bLarge);
+    }
+  }
+  else
+  {
+    /* Unlinks it */
+    orxObject_UnlinkIndexEntry(_pstIndex, _u32Entry);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Marks an index entry as dirty
+ */
+static orxINLINE void orxObject_MarkIndexEntry(orxOBJECT_INDEX *_pstIndex, orxU32 _u32Entry)
+{
+  orxOBJECT_INDEX_ENTRY *pstEntry;
+
+  /* Gets entry */
+  pstEntry = &(_pstIndex->astEntryList[_u32Entry]);
+
+  /* Not already dirty? */
+  if(!orxFLAG_TEST(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_DIRTY))
+  {
+    /* Checks */
+    orxASSERT(_pstIndex->u32DirtyCount < _pstIndex->u32EntrySize);
+
+    /* Adds it to the dirty list */
+    _pstIndex->au32DirtyList[_pstIndex->u32DirtyCount++] = _u32Entry;
+
+    /* Updates flags */
+    orxFLAG_SET(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_DIRTY, orxOBJECT_KU32_INDEX_FLAG_NONE);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Adds an object to its group spatial index, if any
+ */
+static void orxFASTCALL orxObject_AddToIndex(orxOBJECT_LISTS *_pstGroupLists, orxOBJECT *_pstObject)
+{
+  orxOBJECT_INDEX *pstIndex;
+
+  /* Checks */
+  orxASSERT(_pstGroupLists != orxNULL);
+  orxASSERT(_pstObject->u32IndexEntry == 0);
+
+  /* Gets index */
+  pstIndex = _pstGroupLists->pstIndex;
+
+  /* Valid? */
+  if((pstIndex != orxNULL) && (pstIndex->bValid != orxFALSE))
+  {
+    orxU32 u32Entry = 0;
+
+    /* Has free entry? */
+    if(pstIndex->u32FreeEntry != 0)
+    {
+      /* Uses it */
+      u32Entry                = pstIndex->u32FreeEntry;
+      pstIndex->u32FreeEntry  = pstIndex->astEntryList[u32Entry].u32Next;
+    }
+    else
+    {
+      /* Is list full? */
+      if(pstIndex->u32EntryNumber >= pstIndex->u32EntrySize)
+      {
+        orxOBJECT_INDEX_ENTRY  *astEntryList;
+        orxU32                 *au32DirtyList;
+        orxU32                  u32NewSize;
+
+        /* Gets new size */
+        u32NewSize = orxMAX(pstIndex->u32EntrySize << 1, orxOBJECT_KU32_INDEX_ENTRY_SIZE);
+
+        /* Reallocates lists */
+        astEntryList  = (orxOBJECT_INDEX_ENTRY *)orxMemory_Reallocate(pstIndex->astEntryList, u32NewSize * sizeof(orxOBJECT_INDEX_ENTRY), orxMEMORY_TYPE_MAIN);
+        pstIndex->astEntryList = (astEntryList != orxNULL) ? astEntryList : pstIndex->astEntryList;
+        au32DirtyList = (orxU32 *)orxMemory_Reallocate(pstIndex->au32DirtyList, u32NewSize * sizeof(orxU32), orxMEMORY_TYPE_MAIN);
+        pstIndex->au32DirtyList = (au32DirtyList != orxNULL) ? au32DirtyList : pstIndex->au32DirtyList;
+
+        /* Success? */
+        if((astEntryList != orxNULL) && (au32DirtyList != orxNULL))
+        {
+          /* Updates size */
+          pstIndex->u32EntrySize = u32NewSize;
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't grow spatial index of group <%s> to <%u> entries, using linear search instead.", orxString_GetFromID(_pstObject->stGroupID), u32NewSize);
+
+          /* Invalidates index */
+          pstIndex->bValid = orxFALSE;
+        }
+      }
+
+      /* Valid? */
+      if(pstIndex->bValid != orxFALSE)
+      {
+        /* Gets new entry */
+        u32Entry = pstIndex->u32EntryNumber++;
+        pstIndex->astEntryList[u32Entry].u32Flags = orxOBJECT_KU32_INDEX_FLAG_NONE;
+      }
+    }
+
+    /* Valid? */
+    if(u32Entry != 0)
+    {
+      orxOBJECT_INDEX_ENTRY *pstEntry;
+
+      /* Gets it */
+      pstEntry = &(pstIndex->astEntryList[u32Entry]);
+
+      /* Inits it (a reused entry can still be in the dirty list) */
+      pstEntry->pstObject   = _pstObject;
+      pstEntry->u32Order    = pstIndex->u32Order++;
+      pstEntry->u32Previous = pstEntry->u32Next = 0;
+      orxFLAG_SET(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_USED, orxOBJECT_KU32_INDEX_FLAG_LINKED | orxOBJECT_KU32_INDEX_FLAG_LARGE);
+
+      /* Stores it */
+      _pstObject->u32IndexEntry = u32Entry;
+
+      /* Marks it as dirty */
+      orxObject_MarkIndexEntry(pstIndex, u32Entry);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets the spatial index of an indexed object
+ */
+static orxINLINE orxOBJECT_INDEX *orxObject_GetObjectIndex(const orxOBJECT *_pstObject)
+{
+  orxOBJECT_LISTS *pstGroupLists;
+
+  /* Checks */
+  orxASSERT(_pstObject->u32IndexEntry != 0);
+
+  /* Gets group lists */
+  pstGroupLists = ((sstObject.pstCachedGroupLists != orxNULL) && (sstObject.stCachedGroupID == _pstObject->stGroupID))
+                ? sstObject.pstCachedGroupLists
+                : (orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _pstObject->stGroupID);
+
+  /* Checks */
+  orxASSERT((pstGroupLists != orxNULL) && (pstGroupLists->pstIndex != orxNULL));
+
+  /* Done! */
+  return pstGroupLists->pstIndex;
+}
+
+/** Removes an object from its group spatial index, if indexed
+ */
+static void orxFASTCALL orxObject_RemoveFromIndex(orxOBJECT *_pstObject)
+{
+  /* Indexed? */
+  if(_pstObject->u32IndexEntry != 0)
+  {
+    orxOBJECT_INDEX *pstIndex;
+
+    /* Gets its index */
+    pstIndex = orxObject_GetObjectIndex(_pstObject);
+
+    /* Valid? */
+    if(pstIndex->bValid != orxFALSE)
+    {
+      orxOBJECT_INDEX_ENTRY *pstEntry;
+
+      /* Unlinks its entry */
+      orxObject_UnlinkIndexEntry(pstIndex, _pstObject->u32IndexEntry);
+
+      /* Gets it */
+      pstEntry = &(pstIndex->astEntryList[_pstObject->u32IndexEntry]);
+
+      /* Adds it to the free list */
+      pstEntry->pstObject     = orxNULL;
+      pstEntry->u32Next       = pstIndex->u32FreeEntry;
+      pstIndex->u32FreeEntry  = _pstObject->u32IndexEntry;
+      orxFLAG_SET(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_NONE, orxOBJECT_KU32_INDEX_FLAG_USED);
+    }
+
+    /* Clears it */
+    _pstObject->u32IndexEntry = 0;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Invalidates the spatial index entry of an object (bounding box or frame change), if indexed
+ */
+static void orxFASTCALL orxObject_InvalidateIndex(const orxOBJECT *_pstObject)
+{
+  /* Indexed? */
+  if(_pstObject->u32IndexEntry != 0)
+  {
+    orxOBJECT_INDEX *pstIndex;
+
+    /* Gets its index */
+    pstIndex = orxObject_GetObjectIndex(_pstObject);
+
+    /* Valid? */
+    if(pstIndex->bValid != orxFALSE)
+    {
+      /* Marks its entry as dirty */
+      orxObject_MarkIndexEntry(pstIndex, _pstObject->u32IndexEntry);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Creates a group spatial index, if requested in config
+ */
+static orxOBJECT_INDEX *orxFASTCALL orxObject_CreateIndex(orxSTRINGID _stGroupID)
+{
+  orxS32            i, s32Count;
+  orxOBJECT_INDEX  *pstResult = orxNULL;
+
+  /* Pushes config section */
+  orxConfig_PushSection(orxOBJECT_KZ_CONFIG_SECTION);
+
+  /* For all indexed groups */
+  for(i = 0, s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_INDEX_LIST); i < s32Count; i++)
+  {
+    /* Found? */
+    if(orxString_Hash(orxConfig_GetListString(orxOBJECT_KZ_CONFIG_INDEX_LIST, i)) == _stGroupID)
+    {
+      /* Allocates index */
+      pstResult = (orxOBJECT_INDEX *)orxMemory_Allocate(sizeof(orxOBJECT_INDEX), orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(pstResult != orxNULL)
+      {
+        /* Inits it */
+        orxMemory_Zero(pstResult, sizeof(orxOBJECT_INDEX));
+        pstResult->fCellSize      = (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_INDEX_CELL_SIZE) != orxFALSE) ? orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_INDEX_CELL_SIZE) : orxOBJECT_KF_INDEX_CELL_SIZE;
+        pstResult->u32EntryNumber = 1;
+        pstResult->u32Generation  = sstObject.u32IndexGeneration;
+
+        /* Invalid cell size? */
+        if(!(pstResult->fCellSize > orxFLOAT_0))
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Invalid index cell size <%g> for group <%s>, using default value <%g> instead.", pstResult->fCellSize, orxString_GetFromID(_stGroupID), orxOBJECT_KF_INDEX_CELL_SIZE);
+
+          /* Uses default one */
+          pstResult->fCellSize = orxOBJECT_KF_INDEX_CELL_SIZE;
+        }
+
+        /* Gets reciprocal cell size */
+        pstResult->fRecCellSize = orxFLOAT_1 / pstResult->fCellSize;
+
+        /* Creates cell table */
+        pstResult->pstCellTable = orxHashTable_Create(orxOBJECT_KU32_INDEX_CELL_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+        /* Success? */
+        if(pstResult->pstCellTable != orxNULL)
+        {
+          /* Updates status */
+          pstResult->bValid = orxTRUE;
+
+          /* First index? */
+          if(!orxFLAG_TEST(sstObject.u32Flags, orxOBJECT_KU32_STATIC_FLAG_INDEX))
+          {
+            /* Tracks moved frames */
+            orxFrame_TrackMoved(orxTRUE);
+            sstObject.u32IndexFrameCount = orxFrame_GetUpdateCount();
+
+            /* Updates status */
+            orxFLAG_SET(sstObject.u32Flags, orxOBJECT_KU32_STATIC_FLAG_INDEX, orxOBJECT_KU32_STATIC_FLAG_NONE);
+          }
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't create spatial index cell table for group <%s>.", orxString_GetFromID(_stGroupID));
+
+          /* Frees index */
+          orxMemory_Free(pstResult);
+          pstResult = orxNULL;
+        }
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't allocate spatial index for group <%s>.", orxString_GetFromID(_stGroupID));
+      }
+
+      break;
+    }
+  }
+
+  /* Pops config section */
+  orxConfig_PopSection();
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes a group spatial index
+ */
+static void orxFASTCALL orxObject_DeleteIndex(orxOBJECT_INDEX *_pstIndex)
+{
+  /* Checks */
+  orxASSERT(_pstIndex != orxNULL);
+
+  /* Frees its lists */
+  if(_pstIndex->astEntryList != orxNULL)
+  {
+    orxMemory_Free(_pstIndex->astEntryList);
+  }
+  if(_pstIndex->au32DirtyList != orxNULL)
+  {
+    orxMemory_Free(_pstIndex->au32DirtyList);
+  }
+
+  /* Deletes its cell table */
+  orxHashTable_Delete(_pstIndex->pstCellTable);
+
+  /* Frees it */
+  orxMemory_Free(_pstIndex);
+
+  /* Done! */
+  return;
+}
+
+/** Marks the spatial index entry of the object owning a moved frame as dirty
+ */
+static void orxFASTCALL orxObject_InvalidateMovedFrame(orxFRAME *_pstFrame, void *_pContext)
+{
+  orxOBJECT *pstObject;
+
+  /* Gets owner object */
+  pstObject = orxOBJECT(orxStructure_GetOwner(_pstFrame));
+
+  /* Valid and using this frame? */
+  if((pstObject != orxNULL) && (orxOBJECT_GET_STRUCTURE(pstObject, FRAME) == _pstFrame))
+  {
+    /* Invalidates its index entry */
+    orxObject_InvalidateIndex(pstObject);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Refreshes a group spatial index: only dirty entries, including the ones of objects whose frame moved since last refresh, are updated
+ */
+static void orxFASTCALL orxObject_RefreshIndex(orxOBJECT_INDEX *_pstIndex)
+{
+  /* Checks */
+  orxASSERT(_pstIndex != orxNULL);
+  orxASSERT(_pstIndex->bValid != orxFALSE);
+
+  /* Frames got updated since last refresh? */
+  if(orxFrame_GetUpdateCount() != sstObject.u32IndexFrameCount)
+  {
+    /* Processes pending frames */
+    orxFrame_ProcessAll();
+
+    /* Marks entries of moved objects as dirty, in all indices */
+    if(orxFrame_FlushMovedList(orxObject_InvalidateMovedFrame, orxNULL) == orxSTATUS_FAILURE)
+    {
+      /* Some moves got lost: all entries need a refresh */
+      sstObject.u32IndexGeneration++;
+    }
+
+    /* Stores frame update count */
+    sstObject.u32IndexFrameCount = orxFrame_GetUpdateCount();
+  }
+
+  /* Outdated? */
+  if((_pstIndex->u32DirtyCount != 0) || (_pstIndex->u32Generation != sstObject.u32IndexGeneration))
+  {
+    orxU32 i;
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxObject_RefreshIndex");
+
+    /* Full refresh? */
+    if(_pstIndex->u32Generation != sstObject.u32IndexGeneration)
+    {
+      /* For all entries */
+      for(i = 1; i < _pstIndex->u32EntryNumber; i++)
+      {
+        orxOBJECT_INDEX_ENTRY *pstEntry;
+
+        /* Gets it */
+        pstEntry = &(_pstIndex->astEntryList[i]);
+
+        /* Updates flags */
+        orxFLAG_SET(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_NONE, orxOBJECT_KU32_INDEX_FLAG_DIRTY);
+
+        /* Used? */
+        if(orxFLAG_TEST(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_USED))
+        {
+          /* Updates it */
+          orxObject_UpdateIndexEntry(_pstIndex, i);
+        }
+      }
+
+      /* Stores generation */
+      _pstIndex->u32Generation = sstObject.u32IndexGeneration;
+    }
+    else
+    {
+      /* For all dirty entries */
+      for(i = 0; i < _pstIndex->u32DirtyCount; i++)
+      {
+        orxOBJECT_INDEX_ENTRY  *pstEntry;
+        orxU32                  u32Entry;
+
+        /* Gets it */
+        u32Entry = _pstIndex->au32DirtyList[i];
+        pstEntry = &(_pstIndex->astEntryList[u32Entry]);
+
+        /* Updates flags */
+        orxFLAG_SET(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_NONE, orxOBJECT_KU32_INDEX_FLAG_DIRTY);
+
+        /* Used? */
+        if(orxFLAG_TEST(pstEntry->u32Flags, orxOBJECT_KU32_INDEX_FLAG_USED))
+        {
+          /* Updates it */
+          orxObject_UpdateIndexEntry(_pstIndex, u32Entry);
+        }
+      }
+    }
+
+    /* Clears dirty list */
+    _pstIndex->u32DirtyCount = 0;
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets an up-to-date group spatial index
+ */
+static orxOBJECT_INDEX *orxFASTCALL orxObject_GetIndex(orxSTRINGID _stGroupID)
+{
+  orxOBJECT_INDEX *pstResult = orxNULL;
+
+  /* Valid group? */
+  if(_stGroupID != orxSTRINGID_UNDEFINED)
+  {
+    orxOBJECT_LISTS *pstGroupLists;
+
+    /* Gets group lists */
+    pstGroupLists = (orxOBJECT_LISTS *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID);
+
+    /* Has valid index? */
+    if((pstGroupLists != orxNULL) && (pstGroupLists->pstIndex != orxNULL) && (pstGroupLists->pstIndex->bValid != orxFALSE))
+    {
+      /* Refreshes it */
+      orxObject_RefreshIndex(pstGroupLists->pstIndex);
+
+      /* Updates result */
+      pstResult = pstGroupLists->pstIndex;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Runs a callback for all the entries of an index cell whose extents intersect the given ones
+ */
+static orxINLINE orxBOOL orxObject_QueryIndexCell(const orxOBJECT_INDEX *_pstIndex, orxU32 _u32Entry, const orxAABOX *_pstExtents, orxOBJECT_INDEX_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxAABOX  astBoxList[orxOBJECT_KU32_INDEX_BATCH_SIZE];
+  orxU32    au32EntryList[orxOBJECT_KU32_INDEX_BATCH_SIZE];
+  orxBOOL   abOverlapList[orxOBJECT_KU32_INDEX_BATCH_SIZE];
+  orxU32    u32Entry;
+  orxBOOL   bResult = orxTRUE;
+
+  /* For all entries in cell, by batches */
+  for(u32Entry = _u32Entry; (u32Entry != 0) && (bResult != orxFALSE);)
+  {
+    orxU32 u32Count, i;
+
+    /* Gathers next batch */
+    for(u32Count = 0; (u32Entry != 0) && (u32Count < orxOBJECT_KU32_INDEX_BATCH_SIZE); u32Count++, u32Entry = _pstIndex->astEntryList[u32Entry].u32Next)
+    {
+      au32EntryList[u32Count] = u32Entry;
+      orxAABox_Copy(&(astBoxList[u32Count]), &(_pstIndex->astEntryList[u32Entry].stBox));
+    }
+
+    /* Any overlap? */
+    if(orxAABox_Test2DIntersectionArray(_pstExtents, astBoxList, u32Count, abOverlapList) != 0)
+    {
+      /* For all overlapping entries */
+      for(i = 0; (i < u32Count) && (bResult != orxFALSE); i++)
+      {
+        if(abOverlapList[i] != orxFALSE)
+        {
+          /* Runs callback */
+          bResult = _pfnCallback(_pstIndex, au32EntryList[i], _pContext);
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Runs a callback for all the index entries whose extents intersect the given ones, in no particular order
+ */
+static orxBOOL orxFASTCALL orxObject_QueryIndex(const orxOBJECT_INDEX *_pstIndex, const orxAABOX *_pstExtents, orxOBJECT_INDEX_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxFLOAT  fHalfSize, fMinX, fMinY, fMaxX, fMaxY;
+  orxBOOL   bResult = orxTRUE;
+
+  /* Checks */
+  orxASSERT(_pstIndex != orxNULL);
+  orxASSERT(_pstExtents != orxNULL);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* Gets cell range, extended by half a cell as small entries are binned by their center, and clamped to grid range */
+  fHalfSize = orx2F(0.5f) * _pstIndex->fCellSize;
+  fMinX     = orxMAX(orxMath_Floor((_pstExtents->vTL.fX - fHalfSize) * _pstIndex->fRecCellSize), -orxOBJECT_KF_INDEX_CELL_RANGE);
+  fMinY     = orxMAX(orxMath_Floor((_pstExtents->vTL.fY - fHalfSize) * _pstIndex->fRecCellSize), -orxOBJECT_KF_INDEX_CELL_RANGE);
+  fMaxX     = orxMIN(orxMath_Floor((_pstExtents->vBR.fX + fHalfSize) * _pstIndex->fRecCellSize), orxOBJECT_KF_INDEX_CELL_RANGE);
+  fMaxY     = orxMIN(orxMath_Floor((_pstExtents->vBR.fY + fHalfSize) * _pstIndex->fRecCellSize), orxOBJECT_KF_INDEX_CELL_RANGE);
+
+  /* Valid range? */
+  if((fMinX <= fMaxX) && (fMinY <= fMaxY))
+  {
+    /* Fewer cells in range than occupied ones? */
+    if((fMaxX - fMinX + orxFLOAT_1) * (fMaxY - fMinY + orxFLOAT_1) <= orxU2F(orxHashTable_GetCount(_pstIndex->pstCellTable)))
+    {
+      orxS32 s32X, s32Y, s32MaxX, s32MaxY;
+
+      /* For all cells in range */
+      for(s32Y = orxF2S(fMinY), s32MaxX = orxF2S(fMaxX), s32MaxY = orxF2S(fMaxY); (s32Y <= s32MaxY) && (bResult != orxFALSE); s32Y++)
+      {
+        for(s32X = orxF2S(fMinX); (s32X <= s32MaxX) && (bResult != orxFALSE); s32X++)
+        {
+          /* Queries it */
+          bResult = orxObject_QueryIndexCell(_pstIndex, (orxU32)(orxUPTR)orxHashTable_Get(_pstIndex->pstCellTable, orxObject_GetIndexCellKey(s32X, s32Y)), _pstExtents, _pfnCallback, _pContext);
+        }
+      }
+    }
+    else
+    {
+      orxHANDLE hIterator;
+      orxU64    u64Cell;
+      void     *pCell;
+
+      /* For all occupied cells */
+      for(hIterator = orxHashTable_GetNext(_pstIndex->pstCellTable, orxHANDLE_UNDEFINED, &u64Cell, &pCell);
+          (hIterator != orxHANDLE_UNDEFINED) && (bResult != orxFALSE);
+          hIterator = orxHashTable_GetNext(_pstIndex->pstCellTable, hIterator, &u64Cell, &pCell))
+      {
+        orxFLOAT fX, fY;
+
+        /* Gets cell coordinates */
+        fX = orxS2F((orxS32)(orxU32)(u64Cell >> 32));
+        fY = orxS2F((orxS32)(orxU32)u64Cell);
+
+        /* In range? */
+        if((fX >= fMinX) && (fX <= fMaxX) && (fY >= fMinY) && (fY <= fMaxY))
+        {
+          /* Queries it */
+          bResult = orxObject_QueryIndexCell(_pstIndex, (orxU32)(orxUPTR)pCell, _pstExtents, _pfnCallback, _pContext);
+        }
+      }
+    }
+  }
+
+  /* Should continue? */
+  if(bResult != orxFALSE)
+  {
+    /* Queries large entries */
+    bResult = orxObject_QueryIndexCell(_pstIndex, _pstIndex->u32LargeEntry, _pstExtents, _pfnCallback, _pContext);
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Tests all pending pick candidates at once and updates selection
+ */
+static void orxFASTCALL orxObject_FlushPickCandidates(orxOBJECT_INDEX_PICK_CONTEXT *_pstContext)
+{
+  orxBOOL abHitList[orxOBJECT_KU32_INDEX_BATCH_SIZE];
+
+  /* Has candidates? */
+  if(_pstContext->u32CandidateCount != 0)
+  {
+    /* Is position in 2D boxes or intersecting with box? */
+    if(((_pstContext->pvPosition != orxNULL)
+      ? orxOBox_2DIsInsideArray(_pstContext->astBoxList, _pstContext->u32CandidateCount, _pstContext->pvPosition, abHitList)
+      : orxOBox_ZAlignedTestIntersectionArray(_pstContext->pstBox, _pstContext->astBoxList, _pstContext->u32CandidateCount, abHitList)) != 0)
+    {
+      orxU32 i;
+
+      /* For all candidates, in query order */
+      for(i = 0; i < _pstContext->u32CandidateCount; i++)
+      {
+        /* Hit and no selection, above it or same depth but later in group? */
+        if((abHitList[i] != orxFALSE)
+        && ((_pstContext->pstResult == orxNULL)
+         || (_pstContext->afZList[i] < _pstContext->fSelectedZ)
+         || ((_pstContext->afZList[i] == _pstContext->fSelectedZ) && (_pstContext->au32OrderList[i] > _pstContext->u32SelectedOrder))))
+        {
+          /* Updates selection */
+          _pstContext->pstResult        = _pstContext->apstObjectList[i];
+          _pstContext->fSelectedZ       = _pstContext->afZList[i];
+          _pstContext->u32SelectedOrder = _pstContext->au32OrderList[i];
+        }
+      }
+    }
+
+    /* Clears candidates */
+    _pstContext->u32CandidateCount = 0;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Index pick callback
+ */
+static orxBOOL orxFASTCALL orxObject_PickIndexEntry(const orxOBJECT_INDEX *_pstIndex, orxU32 _u32Entry, void *_pContext)
+{
+  orxOBJECT_INDEX_PICK_CONTEXT *pstContext;
+  orxOBJECT                    *pstObject;
+  orxVECTOR                     vObjectPos;
+
+  /* Gets context */
+  pstContext = (orxOBJECT_INDEX_PICK_CONTEXT *)_pContext;
+
+  /* Gets object */
+  pstObject = _pstIndex->astEntryList[_u32Entry].pstObject;
+
+  /* Gets object position */
+  if(orxObject_GetWorldPosition(pstObject, &vObjectPos) != orxNULL)
+  {
+    /* Is under position (or box pick)? */
+    if((pstContext->pvPosition == orxNULL) || (vObjectPos.fZ >= pstContext->pvPosition->fZ))
+    {
+      /* No selection, above it or same depth but later in group? */
+      if((pstContext->pstResult == orxNULL)
+      || (vObjectPos.fZ < pstContext->fSelectedZ)
+      || ((vObjectPos.fZ == pstContext->fSelectedZ) && (_pstIndex->astEntryList[_u32Entry].u32Order > pstContext->u32SelectedOrder)))
+      {
+        orxU32 u32Candidate;
+
+        /* Gets candidate slot */
+        u32Candidate = pstContext->u32CandidateCount;
+
+        /* Gets its bounding box */
+        if(orxObject_GetBoundingBox(pstObject, &(pstContext->astBoxList[u32Candidate])) != orxNULL)
+        {
+          /* Stores candidate, its box being tested with the next batch */
+          pstContext->apstObjectList[u32Candidate]  = pstObject;
+          pstContext->afZList[u32Candidate]         = vObjectPos.fZ;
+          pstContext->au32OrderList[u32Candidate]   = _pstIndex->astEntryList[_u32Entry].u32Order;
+
+          /* Batch full? */
+          if(++pstContext->u32CandidateCount == orxOBJECT_KU32_INDEX_BATCH_SIZE)
+          {
+            /* Tests it */
+            orxObject_FlushPickCandidates(pstContext);
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return orxTRUE;
+}
+
+/** Index neighbor callback
+ */
+static orxBOOL orxFASTCALL orxObject_GatherIndexEntry(const orxOBJECT_INDEX *_pstIndex, orxU32 _u32Entry, void *_pContext)
+{
+  orxOBJECT_INDEX_NEIGHBOR_CONTEXT *pstContext;
+  orxBOOL                           bResult = orxTRUE;
+
+  /* Gets context */
+  pstContext = (orxOBJECT_INDEX_NEIGHBOR_CONTEXT *)_pContext;
+
+  /* Needs to grow? */
+  if(pstContext->u32Count == pstContext->u32Size)
+  {
+    orxOBJECT_INDEX_NEIGHBOR *astNeighborList;
+
+    /* Allocates new list (frame memory, never freed) */
+    astNeighborList = (orxOBJECT_INDEX_NEIGHBOR *)orxMemory_AllocateFrame((pstContext->u32Size << 1) * sizeof(orxOBJECT_INDEX_NEIGHBOR));
+
+    /* Success? */
+    if(astNeighborList != orxNULL)
+    {
+      /* Copies current content */
+      orxMemory_Copy(astNeighborList, pstContext->astNeighborList, pstContext->u32Count * sizeof(orxOBJECT_INDEX_NEIGHBOR));
+
+      /* Stores new list */
+      pstContext->astNeighborList = astNeighborList;
+      pstContext->u32Size       <<= 1;
+    }
+    else
+    {
+      /* Updates result */
+      bResult = orxFALSE;
+    }
+  }
+
+  /* Valid? */
+  if(bResult != orxFALSE)
+  {
+    /* Stores neighbor */
+    pstContext->astNeighborList[pstContext->u32Count].u64GUID   = orxStructure_GetGUID(_pstIndex->astEntryList[_u32Entry].pstObject);
+    pstContext->astNeighborList[pstContext->u32Count].u32Order  = _pstIndex->astEntryList[_u32Entry].u32Order;
+    pstContext->u32Count++;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Sifts down a neighbor heap
+ */
+static orxINLINE void orxObject_SiftNeighbors(orxOBJECT_INDEX_NEIGHBOR *_astNeighborList, orxU32 _u32Root, orxU32 _u32Count)
+{
+  orxOBJECT_INDEX_NEIGHBOR  stRoot;
+  orxU32                    u32Child;
+
+  /* Backups root */
+  orxMemory_Copy(&stRoot, &(_astNeighborList[_u32Root]), sizeof(orxOBJECT_INDEX_NEIGHBOR));
+
+  /* While there are children */
+  for(u32Child = (_u32Root << 1) + 1; u32Child < _u32Count; _u32Root = u32Child, u32Child = (_u32Root << 1) + 1)
+  {
+    /* Selects largest child */
+    if((u32Child + 1 < _u32Count) && (_astNeighborList[u32Child + 1].u32Order > _astNeighborList[u32Child].u32Order))
+    {
+      u32Child++;
+    }
+
+    /* Heap property restored? */
+    if(_astNeighborList[u32Child].u32Order <= stRoot.u32Order)
+    {
+      break;
+    }
+
+    /* Moves child up */
+    orxMemory_Copy(&(_astNeighborList[_u32Root]), &(_astNeighborList[u32Child]), sizeof(orxOBJECT_INDEX_NEIGHBOR));
+  }
+
+  /* Stores root */
+  orxMemory_Copy(&(_astNeighborList[_u32Root]), &stRoot, sizeof(orxOBJECT_INDEX_NEIGHBOR));
+
+  /* Done! */
+  return;
+}
+
+/** Sorts neighbors in group order (heap sort)
+ */
+static void orxFASTCALL orxObject_SortNeighbors(orxOBJECT_INDEX_NEIGHBOR *_astNeighborList, orxU32 _u32Count)
+{
+  orxU32 i;
+
+  /* Builds heap */
+  for(i = _u32Count >> 1; i > 0; i--)
+  {
+    orxObject_SiftNeighbors(_astNeighborList, i - 1, _u32Count);
+  }
+
+  /* For all entries */
+  for(i = _u32Count; i > 1; i--)
+  {
+    orxOBJECT_INDEX_NEIGHBOR stTemp;
+
+    /* Moves largest to the end */
+    orxMemory_Copy(&stTemp, &(_astNeighborList[0]), sizeof(orxOBJECT_INDEX_NEIGHBOR));
+    orxMemory_Copy(&(_astNeighborList[0]), &(_astNeighborList[i - 1]), sizeof(orxOBJECT_INDEX_NEIGHBOR));
+    orxMemory_Copy(&(_astNeighborList[i - 1]), &stTemp, sizeof(orxOBJECT_INDEX_NEIGHBOR));
+
+    /* Restores heap */
+    orxObject_SiftNeighbors(_astNeighborList, 0, i - 1);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Creates an empty object
+ */
+static orxINLINE orxOBJECT *orxObject_CreateInternal()
+{
+  orxOBJECT *pstResult;
+
+  /* Creates object */
+  pstResult = orxOBJECT(orxStructure_Create(orxSTRUCTURE_ID_OBJECT));
+
+  /* Created? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits flags */
+    orxStructure_SetFlags(pstResult, orxOBJECT_KU32_FLAG_ENABLED, orxOBJECT_KU32_MASK_ALL);
+
+    /* Inits active time */
+    pstResult->fActiveTime = orxFLOAT_0;
+
+    /* Sets default group ID */
+    orxObject_SetGroupID(pstResult, sstObject.stDefaultGroupID);
+
+    /* Adds it to the enable list */
+    orxLinkList_AddEnd(&(sstObject.stEnableList), &(pstResult->stEnableNode));
+
+    /* Increases count */
+    orxStructure_IncreaseCount(pstResult);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Failed to create object.");
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes an object
+ */
+static orxINLINE orxSTATUS orxObject_DeleteInternal(orxOBJECT *_pstObject, orxBOOL _bNoCommand, orxOBJECT **_ppstNextObject)
+{
+  orxBOOL   bSelectedNext = orxFALSE;
+  orxSTATUS eResult       = orxSTATUS_FAILURE;
+
+  /* Decreases count */
+  orxStructure_DecreaseCount(_pstObject);
+
+  /* Not referenced? */
+  if(orxStructure_GetRefCount(_pstObject) == 0)
+  {
+    orxCOMMAND_VAR  stCommandResult;
+    const orxSTRING zCommand;
+
+    /* Retrieves and clear on-delete command */
+    zCommand = _pstObject->zOnDelete;
+    _pstObject->zOnDelete = orxNULL;
+
+    /* Should continue? */
+    if((_bNoCommand != orxFALSE)
+    || (zCommand == orxNULL)
+    || (orxCommand_EvaluateWithGUID(zCommand, orxStructure_GetGUID(_pstObject), &stCommandResult) == orxNULL)
+    || ((stCommandResult.eType != orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.eType != orxCOMMAND_VAR_TYPE_STRING))
+    || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_STRING) && (*stCommandResult.zValue != orxNULL) && (orxString_ICompare(stCommandResult.zValue, orxSTRING_FALSE) != 0))
+    || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.bValue != orxFALSE)))
+    {
+      orxEVENT stEvent;
+
+      /* Inits event */
+      orxEVENT_INIT(stEvent, orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_DELETE, _pstObject, orxNULL, orxNULL);
+
+      /* Sends event */
+      if(orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
+      {
+        orxOBJECT_POOL *pstPool;
+        orxU32          u32KeepFlags, i;
+
+        /* Has trigger? */
+        if(_pstObject->apstStructureList[orxSTRUCTURE_ID_TRIGGER] != orxNULL)
+        {
+          /* Fires it */
+          orxTrigger_Fire(orxTRIGGER(_pstObject->apstStructureList[orxSTRUCTURE_ID_TRIGGER]), orxOBJECT_KZ_TRIGGER_DELETE, orxNULL, 0, orxNULL);
+        }
+
+        /* Has frame? */
+        if(_pstObject->apstStructureList[orxSTRUCTURE_ID_FRAME] != orxNULL)
+        {
+          /* Removes parent */
+          orxObject_SetParent(_pstObject, orxNULL);
+        }
+
+        /* Has children? */
+        if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_HAS_CHILDREN))
+        {
+          orxOBJECT *pstChild;
+
+          /* For all children */
+          for(pstChild = _pstObject->pstChild;
+              pstChild != orxNULL;
+              pstChild = _pstObject->pstChild)
+          {
+            /* Deletes it */
+            orxObject_DeleteInternal(pstChild, _bNoCommand, orxNULL);
+          }
+        }
+
+        /* Gets pool in which it can be parked */
+        pstPool = orxObject_GetParkingPool(_pstObject);
+
+        /* Gets structures to keep */
+        u32KeepFlags = (pstPool != orxNULL) ? orxStructure_GetFlags(_pstObject, orxOBJECT_KU32_MASK_STRUCTURE_POOLED) : orxOBJECT_KU32_FLAG_NONE;
+
+        /* Unlinks all structures but kept ones, frame last */
+        for(i = 0; i < orxSTRUCTURE_ID_LINKABLE_NUMBER; i++)
+        {
+          if((i != orxSTRUCTURE_ID_FRAME) && (_pstObject->apstStructureList[i] != orxNULL) && !(u32KeepFlags & (1 << i)))
+          {
+            orxObject_UnlinkStructure(_pstObject, (orxSTRUCTURE_ID)i);
+          }
+        }
+        if(!(u32KeepFlags & (1 << orxSTRUCTURE_ID_FRAME)))
+        {
+          orxObject_UnlinkStructure(_pstObject, orxSTRUCTURE_ID_FRAME);
+        }
+
+        /* Requested next object? */
+        if(_ppstNextObject != orxNULL)
+        {
+          orxLINKLIST_NODE *pstNode;
+
+          /* Gets next enabled object */
+          pstNode = orxLinkList_GetNext(&(_pstObject->stEnableNode));
+
+          /* Stores it */
+          *_ppstNextObject = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode) : orxNULL;
+
+          /* Updates status */
+          bSelectedNext = orxTRUE;
+        }
+
+        /* Removes owner */
+        orxObject_SetOwner(_pstObject, orxNULL);
+
+        /* Removes object from its current group */
+        if(orxLinkList_GetList(&(_pstObject->stGroupNode)) != orxNULL)
+        {
+          orxLinkList_Remove(&(_pstObject->stGroupNode));
+        }
+
+        /* Removes object from the enable lists */
+        if(orxLinkList_GetList(&(_pstObject->stEnableNode)) != orxNULL)
+        {
+          orxLinkList_Remove(&(_pstObject->stEnableNode));
+        }
+        if(orxLinkList_GetList(&(_pstObject->stEnableGroupNode)) != orxNULL)
+        {
+          orxLinkList_Remove(&(_pstObject->stEnableGroupNode));
+
+          /* Removes it from spatial index */
+          orxObject_RemoveFromIndex(_pstObject);
+        }
+
+        /* Has pool? */
+        if(pstPool != orxNULL)
+        {
+          /* Parks it */
+          orxObject_Park(_pstObject, pstPool);
+        }
+        else
+        {
+          /* Deletes structure */
+          orxStructure_Delete(_pstObject);
+        }
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Increases count */
+        orxStructure_IncreaseCount(_pstObject);
+
+        /* Resets its active time: going undead */
+        _pstObject->fActiveTime = orxFLOAT_0;
+
+        /* Disables it */
+        orxObject_Enable(_pstObject, orxFALSE);
+      }
+    }
+    else
+    {
+      /* Increases count */
+      orxStructure_IncreaseCount(_pstObject);
+    }
+  }
+
+  /* Requested next object and not already selected? */
+  if((_ppstNextObject != orxNULL) && (bSelectedNext == orxFALSE))
+  {
+    orxLINKLIST_NODE *pstNode;
+
+    /* Gets next enabled object */
+    pstNode = orxLinkList_GetNext(&(_pstObject->stEnableNode));
+
+    /* Stores it */
+    *_ppstNextObject = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stEnableNode, pstNode) : orxNULL;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Event handler
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxObject_EventHandler(const orxEVENT *_pstEvent)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Depending on event type */
+  switch(_pstEvent->eType)
+  {
+    /* Object event */
+    case orxEVENT_TYPE_OBJECT:
+    {
+      /* Has current parent? */
+      if(sstObject.pstCurrentParent != orxNULL)
+      {
+        /* Stores current parent as temporary parent in payload */
+        *((orxOBJECT **)_pstEvent->pstPayload) = sstObject.pstCurrentParent;
+
+        /* Sets it as owner */
+        orxObject_SetOwner(orxOBJECT(_pstEvent->hSender), sstObject.pstCurrentParent);
+      }
+
+      break;
+    }
+
+    /* Physics event */
+    case orxEVENT_TYPE_PHYSICS:
+    {
+      orxOBJECT  *pstSender, *pstRecipient;
+      orxTRIGGER *pstSenderTrigger, *pstRecipientTrigger;
+
+      /* Gets sender & recipient objects */
+      pstSender     = orxOBJECT(_pstEvent->hSender);
+      pstRecipient  = orxOBJECT(_pstEvent->hRecipient);
+
+      /* Gets triggers */
+      pstSenderTrigger    = orxStructure_TestFlags(pstSender, orxOBJECT_KU32_FLAG_ENABLED) ? orxOBJECT_GET_STRUCTURE(pstSender, TRIGGER) : orxNULL;
+      pstRecipientTrigger = orxStructure_TestFlags(pstRecipient, orxOBJECT_KU32_FLAG_ENABLED) ? orxOBJECT_GET_STRUCTURE(pstRecipient, TRIGGER) : orxNULL;
+
+      /* Should process? */
+      if((pstSenderTrigger != orxNULL)
+      || (pstRecipientTrigger != orxNULL))
       {
         orxPHYSICS_EVENT_PAYLOAD *pstPayload;
         const orxSTRING           azRefinementList[4];
@@ -5333,6 +8118,9 @@ static orxINLINE void orxObject_DeleteAll()
 {
   orxOBJECT *pstObject;
 
+  /* Deletes all pools, no object will get parked from now on */
+  orxObject_DeletePools();
+
   /* Gets first object */
   pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
 
@@ -5580,6 +8368,9 @@ static void orxFASTCALL orxObject_UpdateAll(const orxCLOCK_INFO *_pstClockInfo,
     pstObject = orxObject_UpdateInternal(pstObject, _pstClockInfo);
   }
 
+  /* Processes dirty frames */
+  orxFrame_ProcessAll();
+
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
@@ -5676,7 +8467,7 @@ orxSTATUS orxFASTCALL orxObject_Init()
             if((sstObject.pstGroupBank != orxNULL) && (sstObject.pstAgeBank != orxNULL))
             {
               /* Creates group table */
-              sstObject.pstGroupTable = orxHashTable_Create(orxOBJECT_KU32_GROUP_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+              sstObject.pstGroupTable = orxHashTable_Create(orxOBJECT_KU32_GROUP_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, orxMEMORY_TYPE_MAIN);
 
               /* Success? */
               if(sstObject.pstGroupTable != orxNULL)
@@ -5694,6 +8485,9 @@ orxSTATUS orxFASTCALL orxObject_Init()
                   sstObject.stDefaultGroupID  = orxString_GetID(orxOBJECT_KZ_DEFAULT_GROUP);
                   sstObject.stCurrentGroupID  = sstObject.stDefaultGroupID;
 
+                  /* Pre-hashes config keys */
+                  orxObject_InitKeyIDList();
+
                   /* Inits Flags */
                   sstObject.u32Flags = orxOBJECT_KU32_STATIC_FLAG_READY | orxOBJECT_KU32_STATIC_FLAG_CLOCK;
                 }
@@ -5815,6 +8609,9 @@ orxSTATUS orxFASTCALL orxObject_Init()
  */
 void orxFASTCALL orxObject_Exit()
 {
+  orxHANDLE         hIterator;
+  orxOBJECT_LISTS  *pstGroupLists;
+
   /* Initialized? */
   if(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY)
   {
@@ -5844,6 +8641,29 @@ void orxFASTCALL orxObject_Exit()
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_OBJECT);
 
+    /* For all groups */
+    for(hIterator = orxHashTable_GetNext(sstObject.pstGroupTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstGroupLists);
+        hIterator != orxHANDLE_UNDEFINED;
+        hIterator = orxHashTable_GetNext(sstObject.pstGroupTable, hIterator, orxNULL, (void **)&pstGroupLists))
+    {
+      /* Has spatial index? */
+      if(pstGroupLists->pstIndex != orxNULL)
+      {
+        /* Deletes it */
+        orxObject_DeleteIndex(pstGroupLists->pstIndex);
+      }
+    }
+
+    /* Had spatial indices? */
+    if(orxFLAG_TEST(sstObject.u32Flags, orxOBJECT_KU32_STATIC_FLAG_INDEX))
+    {
+      /* Stops tracking moved frames */
+      orxFrame_TrackMoved(orxFALSE);
+
+      /* Updates status */
+      orxFLAG_SET(sstObject.u32Flags, orxOBJECT_KU32_STATIC_FLAG_NONE, orxOBJECT_KU32_STATIC_FLAG_INDEX);
+    }
+
     /* Deletes group table */
     orxHashTable_Delete(sstObject.pstGroupTable);
 
@@ -5854,6 +8674,16 @@ void orxFASTCALL orxObject_Exit()
     /* Deletes conversion frame */
     orxFrame_Delete(sstObject.pstFrame);
 
+    /* Has template table? */
+    if(sstObject.pstTemplateTable != orxNULL)
+    {
+      /* Deletes template table & bank */
+      orxHashTable_Delete(sstObject.pstTemplateTable);
+      orxBank_Delete(sstObject.pstTemplateBank);
+      sstObject.pstTemplateTable  = orxNULL;
+      sstObject.pstTemplateBank   = orxNULL;
+    }
+
     /* Updates flags */
     sstObject.u32Flags &= ~orxOBJECT_KU32_STATIC_FLAG_READY;
   }
@@ -5951,8 +8781,65 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
   if((orxConfig_HasSection(_zConfigID) != orxFALSE)
   && (orxConfig_PushSection(_zConfigID) != orxSTATUS_FAILURE))
   {
-    /* Creates object */
-    pstResult = orxObject_CreateInternal();
+    const orxOBJECT_TEMPLATE *pstTemplate;
+    orxOBJECT_TEMPLATE        stTemplateBuffer;
+    orxOBJECT_POOL           *pstPool = orxNULL;
+
+    /* Gets template */
+    pstTemplate = orxObject_GetTemplate(&stTemplateBuffer);
+
+    /* Pooled? */
+    if(pstTemplate->u32PoolSize != 0)
+    {
+      /* Gets its pool */
+      pstPool = orxObject_GetPool(orxString_GetID(orxConfig_GetCurrentSection()), orxTRUE);
+
+      /* Valid? */
+      if(pstPool != orxNULL)
+      {
+        /* Updates its size */
+        pstPool->u32Size = pstTemplate->u32PoolSize;
+      }
+    }
+
+    /* Has a parked object? */
+    if((pstPool != orxNULL) && (orxLinkList_GetCount(&(pstPool->stList)) != 0))
+    {
+      /* Profiles */
+      orxPROFILER_PUSH_MARKER("orxObject_PoolHit");
+
+      /* Reuses it */
+      pstResult = orxObject_Unpark(pstPool);
+
+      /* Profiles */
+      orxPROFILER_POP_MARKER();
+    }
+    else
+    {
+      /* Pooled? */
+      if(pstPool != orxNULL)
+      {
+        /* Profiles */
+        orxPROFILER_PUSH_MARKER("orxObject_PoolMiss");
+      }
+
+      /* Creates object */
+      pstResult = orxObject_CreateInternal();
+
+      /* Pooled? */
+      if(pstPool != orxNULL)
+      {
+        /* Valid? */
+        if(pstResult != orxNULL)
+        {
+          /* Updates status */
+          orxStructure_SetFlags(pstResult, orxOBJECT_KU32_FLAG_POOLED, orxOBJECT_KU32_FLAG_NONE);
+        }
+
+        /* Profiles */
+        orxPROFILER_POP_MARKER();
+      }
+    }
 
     /* Valid? */
     if(pstResult != orxNULL)
@@ -6011,35 +8898,23 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
 
       /* Should continue? */
       if((orxEvent_Send(&stEvent) != orxSTATUS_FAILURE)
-      && (((zCommand = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_PREPARE)) == orxSTRING_EMPTY)
+      && (((zCommand = pstTemplate->zOnPrepare) == orxSTRING_EMPTY)
        || (orxCommand_EvaluateWithGUID(zCommand, orxStructure_GetGUID(pstResult), &stCommandResult) == orxNULL)
        || ((stCommandResult.eType != orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.eType != orxCOMMAND_VAR_TYPE_STRING))
        || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_STRING) && (*stCommandResult.zValue != orxNULL) && (orxString_ICompare(stCommandResult.zValue, orxSTRING_FALSE) != 0))
        || ((stCommandResult.eType == orxCOMMAND_VAR_TYPE_BOOL) && (stCommandResult.bValue != orxFALSE))))
       {
-        orxVECTOR       vValue, vParentSize, vPosition, vScale, vPivotOverride;
+        orxVECTOR       vParentSize, vPosition, vScale, vPivotOverride;
         orxAABOX        stParentBox;
-        const orxSTRING zAutoScrolling;
-        const orxSTRING zFlip;
         const orxSTRING zBodyName;
-        const orxSTRING zClockName;
-        const orxSTRING zSpawnerName;
-        const orxSTRING zShaderName;
         const orxSTRING zParentName;
-        const orxSTRING zIgnoreFromParent;
-        const orxSTRING zPosition;
-        const orxSTRING zPivot;
-        const orxSTRING zPivotOverride;
-        orxCHAR        *pcPivotOverrideMarker;
         orxFRAME       *pstFrame;
         orxBODY        *pstBody;
         orxOBJECT      *pstPreviousObject;
-        orxFLOAT        fAge, fRotation;
-        orxU32          u32FrameFlags, u32Flags = orxOBJECT_KU32_FLAG_NONE;
+        orxFLOAT        fAge;
+        orxU32          u32Flags;
         orxS32          s32Count;
-        orxCOLOR        stColor;
-        orxBOOL         bUseParentScale = orxFALSE, bUseParentPosition = orxFALSE, bHasColor = orxFALSE, bUseParentSpace = orxFALSE, bHasPosition = orxFALSE, bTypoCheck;
-        orxCHAR         acPositionBuffer[128];
+        orxBOOL         bUseParentScale = orxFALSE, bUseParentPosition = orxFALSE, bUseParentSpace = orxFALSE, bHasPosition = orxFALSE;
 
         /* Backups current parent */
         pstPreviousObject = sstObject.pstCurrentParent;
@@ -6047,8 +8922,11 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* Clears current parent */
         sstObject.pstCurrentParent = orxNULL;
 
+        /* Inits flags */
+        u32Flags = pstTemplate->u32ObjectFlags;
+
         /* Gets age */
-        fAge = orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_AGE);
+        fAge = pstTemplate->fAge;
 
         /* Valid? */
         if(fAge > orxFLOAT_0)
@@ -6070,10 +8948,10 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         }
 
         /* Has group? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_GROUP) != orxFALSE)
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_GROUP))
         {
           /* Sets it */
-          orxObject_SetGroupID(pstResult, orxString_GetID(orxConfig_GetString(orxOBJECT_KZ_CONFIG_GROUP)));
+          orxObject_SetGroupID(pstResult, pstTemplate->stGroupID);
         }
         /* Has current group ID? */
         else if(sstObject.stCurrentGroupID != sstObject.stDefaultGroupID)
@@ -6082,79 +8960,23 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           orxObject_SetGroupID(pstResult, sstObject.stCurrentGroupID);
         }
 
-        /* Gets position literals */
-        orxString_NPrint(acPositionBuffer, sizeof(acPositionBuffer), "%s", orxConfig_GetString(orxOBJECT_KZ_CONFIG_POSITION));
-        zPosition = acPositionBuffer;
-
-        /* Has pivot override? */
-        if((pcPivotOverrideMarker = (orxCHAR *)orxString_SearchString(zPosition, orxOBJECT_KZ_OVERRIDE_MARKER)) != orxNULL)
-        {
-          /* Replaces override marker */
-          *pcPivotOverrideMarker = orxCHAR_NULL;
-
-          /* Stores pivot override */
-          zPivotOverride = zPosition;
-
-          /* Updates position */
-          zPosition = orxString_SkipWhiteSpaces(pcPivotOverrideMarker + orxOBJECT_KU32_OVERRIDE_MARKER_LENGTH);
-        }
-
-        /* Is Cartesian position? */
-        if((orxConfig_ToVector(zPosition, orxCOLORSPACE_NONE, &vPosition) != orxNULL)
-        || (orxVector_SetAll(&vPosition, orxFLOAT_0), orxString_ToFloat(zPosition, &vPosition.fZ, orxNULL) != orxSTATUS_FAILURE))
-        {
-          /* Updates status */
-          bHasPosition  = orxTRUE;
-          zPosition     = orxSTRING_EMPTY;
-        }
-
         /* *** Frame *** */
 
-        /* Gets auto scrolling value */
-        zAutoScrolling = orxConfig_GetString(orxOBJECT_KZ_CONFIG_AUTO_SCROLL);
-
-        /* X auto scrolling? */
-        if(orxString_ICompare(zAutoScrolling, orxOBJECT_KZ_X) == 0)
+        /* Kept from a pool? */
+        if(pstResult->apstStructureList[orxSTRUCTURE_ID_FRAME] != orxNULL)
         {
-          /* Updates frame flags */
-          u32FrameFlags = orxFRAME_KU32_FLAG_SCROLL_X;
-        }
-        /* Y auto scrolling? */
-        else if(orxString_ICompare(zAutoScrolling, orxOBJECT_KZ_Y) == 0)
-        {
-          /* Updates frame flags */
-          u32FrameFlags = orxFRAME_KU32_FLAG_SCROLL_Y;
-        }
-        /* Both auto scrolling? */
-        else if(orxString_ICompare(zAutoScrolling, orxOBJECT_KZ_BOTH) == 0)
-        {
-          /* Updates frame flags */
-          u32FrameFlags = orxFRAME_KU32_FLAG_SCROLL_X | orxFRAME_KU32_FLAG_SCROLL_Y;
-        }
-        else
-        {
-          /* Updates frame flags */
-          u32FrameFlags = orxFRAME_KU32_FLAG_NONE;
-        }
+          /* Restores its flags, they might have been modified at runtime */
+          orxStructure_SetFlags(pstResult->apstStructureList[orxSTRUCTURE_ID_FRAME], pstTemplate->u32FrameFlags, orxFRAME_KU32_MASK_USER_ALL);
 
-        /* Depth scaling active? */
-        if(orxConfig_GetBool(orxOBJECT_KZ_CONFIG_DEPTH_SCALE) != orxFALSE)
-        {
-          /* Updates frame flags */
-          u32FrameFlags  |= orxFRAME_KU32_FLAG_DEPTH_SCALE;
+          /* Doesn't need a new frame */
+          pstFrame = orxNULL;
         }
-
-        /* Ignore from parent? */
-        zIgnoreFromParent = orxConfig_GetString(orxOBJECT_KZ_CONFIG_IGNORE_FROM_PARENT);
-        if(*zIgnoreFromParent != orxCHAR_NULL)
+        else
         {
-          /* Updates flags */
-          u32FrameFlags |= orxFrame_GetIgnoreFlagValues(zIgnoreFromParent);
+          /* Creates frame */
+          pstFrame = orxFrame_Create(pstTemplate->u32FrameFlags);
         }
 
-        /* Creates frame */
-        pstFrame = orxFrame_Create(u32FrameFlags);
-
         /* Valid? */
         if(pstFrame != orxNULL)
         {
@@ -6181,7 +9003,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         orxMemory_Zero(&stParentBox, sizeof(orxAABOX));
 
         /* Gets camera file name */
-        zParentName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_PARENT_CAMERA);
+        zParentName = pstTemplate->zParentCamera;
 
         /* Valid? */
         if((zParentName != orxNULL) && (*zParentName != orxCHAR_NULL))
@@ -6223,7 +9045,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           if(pstParent != orxNULL)
           {
             /* Updates parent space status */
-            bUseParentSpace = orxConfig_HasValue(orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE);
+            bUseParentSpace = orxConfig_HasValueByID(sstObject.astKeyIDList[orxOBJECT_KEY_USE_PARENT_SPACE]);
 
             /* Is parent an object? */
             if(orxStructure_GetID(pstParent) == orxSTRUCTURE_ID_OBJECT)
@@ -6233,7 +9055,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             }
 
             /* Has parent space or position literals? */
-            if((bUseParentSpace != orxFALSE) || (*zPosition != orxCHAR_NULL))
+            if((bUseParentSpace != orxFALSE) || (orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_LITERAL)))
             {
               /* Depending on parent type */
               switch(orxStructure_GetID(pstParent))
@@ -6265,7 +9087,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
                   zParentName = orxObject_GetName(orxOBJECT(pstParent));
 
                   /* New object has position literals? */
-                  if(*zPosition != orxCHAR_NULL)
+                  if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_LITERAL))
                   {
                     orxVECTOR vPivot;
 
@@ -6293,50 +9115,18 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* Has parent space? */
         if(bUseParentSpace != orxFALSE)
         {
-          const orxSTRING zUseParentSpace;
-
-          /* Gets its literal version */
-          zUseParentSpace = orxConfig_GetString(orxOBJECT_KZ_CONFIG_USE_PARENT_SPACE);
-
           /* Defined? */
-          if((zUseParentSpace != orxNULL) && (*zUseParentSpace != orxCHAR_NULL))
+          if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SPACE))
           {
-            /* Scale only? */
-            if(orxString_ICompare(zUseParentSpace, orxOBJECT_KZ_SCALE) == 0)
-            {
-              /* Updates status */
-              bUseParentScale     = orxTRUE;
-              bUseParentPosition  = orxFALSE;
-            }
-            /* Position only? */
-            else if(orxString_ICompare(zUseParentSpace, orxOBJECT_KZ_POSITION) == 0)
-            {
-              /* Updates status */
-              bUseParentScale     = orxFALSE;
-              bUseParentPosition  = orxTRUE;
-            }
-            /* Both? */
-            else if(orxString_ICompare(zUseParentSpace, orxOBJECT_KZ_BOTH) == 0)
+            /* Updates status */
+            bUseParentScale     = orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_SCALE) ? orxTRUE : orxFALSE;
+            bUseParentPosition  = orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_POSITION) ? orxTRUE : orxFALSE;
+
+            /* Boolean value? */
+            if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_PARENT_BOOL))
             {
               /* Updates status */
-              bUseParentScale     = orxTRUE;
-              bUseParentPosition  = orxTRUE;
-            }
-            else
-            {
-              /* Gets boolean value */
-              if(orxString_ToBool(zUseParentSpace, &bUseParentSpace, orxNULL) != orxSTATUS_FAILURE)
-              {
-                /* Updates status */
-                bUseParentScale     = bUseParentSpace;
-                bUseParentPosition  = bUseParentSpace;
-              }
-              else
-              {
-                /* Updates status */
-                bUseParentScale     = orxFALSE;
-                bUseParentPosition  = orxFALSE;
-              }
+              bUseParentSpace   = bUseParentScale;
             }
           }
         }
@@ -6344,7 +9134,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Trigger *** */
 
         /* Has triggers? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_TRIGGER_LIST)) > 0)
+        if((s32Count = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_LIST_TRIGGER)) > 0)
         {
           orxS32 i;
 
@@ -6354,7 +9144,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             const orxSTRING zTrigger;
 
             /* Gets its name */
-            zTrigger = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_TRIGGER_LIST, i);
+            zTrigger = orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_LIST_TRIGGER, i);
 
             /* Valid? */
             if(*zTrigger != orxCHAR_NULL)
@@ -6373,7 +9163,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           const orxSTRING zGraphicName;
 
           /* Gets graphic file name */
-          zGraphicName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_GRAPHIC_NAME);
+          zGraphicName = pstTemplate->zGraphic;
 
           /* Valid? */
           if((zGraphicName != orxNULL) && (*zGraphicName != orxCHAR_NULL))
@@ -6412,7 +9202,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           const orxSTRING zAnimPointerName;
 
           /* Gets animation set name */
-          zAnimPointerName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME);
+          zAnimPointerName = pstTemplate->zAnimPointer;
 
           /* Valid? */
           if((zAnimPointerName != orxNULL) && (*zAnimPointerName != orxCHAR_NULL))
@@ -6435,10 +9225,10 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
                 orxStructure_SetOwner(pstAnimPointer, pstResult);
 
                 /* Has frequency? */
-                if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_ANIM_FREQUENCY) != orxFALSE)
+                if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_ANIM_FREQUENCY))
                 {
                   /* Updates animation pointer frequency */
-                  orxObject_SetAnimFrequency(pstResult, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ANIM_FREQUENCY));
+                  orxObject_SetAnimFrequency(pstResult, pstTemplate->fAnimFrequency);
                 }
 
                 /* Doesn't have a graphic? */
@@ -6488,87 +9278,50 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
 
         /* *** Flip/Origin/Size/Pivot *** */
 
-        /* Gets flip value */
-        zFlip = orxConfig_GetString(orxOBJECT_KZ_CONFIG_FLIP);
-
-        /* Valid? */
-        if(*zFlip != orxCHAR_NULL)
+        /* Has flip? */
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_FLIP))
         {
-          orxBOOL bFlipX = orxFALSE, bFlipY = orxFALSE;
-
-          /* X flipping? */
-          if(orxString_ICompare(zFlip, orxOBJECT_KZ_X) == 0)
-          {
-            /* Updates status */
-            bFlipX = orxTRUE;
-          }
-          /* Y flipping? */
-          else if(orxString_ICompare(zFlip, orxOBJECT_KZ_Y) == 0)
-          {
-            /* Updates status */
-            bFlipY = orxTRUE;
-          }
-          /* Both flipping? */
-          else if(orxString_ICompare(zFlip, orxOBJECT_KZ_BOTH) == 0)
-          {
-            /* Updates status */
-            bFlipX = orxTRUE;
-            bFlipY = orxTRUE;
-          }
-
           /* Updates object flip */
-          orxObject_SetFlip(pstResult, bFlipX, bFlipY);
+          orxObject_SetFlip(pstResult, orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_FLIP_X) ? orxTRUE : orxFALSE, orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_FLIP_Y) ? orxTRUE : orxFALSE);
         }
 
         /* Has origin? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_ORIGIN, &vValue) != orxNULL)
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_ORIGIN))
         {
           /* Updates object origin */
-          orxObject_SetOrigin(pstResult, &vValue);
+          orxObject_SetOrigin(pstResult, &(pstTemplate->vOrigin));
         }
 
         /* Has size? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SIZE, &vValue) != orxNULL)
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_SIZE))
         {
           /* Updates object size */
-          orxObject_SetSize(pstResult, &vValue);
+          orxObject_SetSize(pstResult, &(pstTemplate->vSize));
         }
 
-        /* Gets pivot */
-        zPivot = orxString_SkipWhiteSpaces(orxConfig_GetString(orxOBJECT_KZ_CONFIG_PIVOT));
-
-        /* Valid? */
-        if(*zPivot != orxCHAR_NULL)
+        /* Has pivot? */
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT))
         {
           /* Is vector? */
-          if(orxConfig_ToVector(zPivot, orxCOLORSPACE_NONE, &vValue) != orxNULL)
+          if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT_VECTOR))
           {
             /* Updates object pivot */
-            orxObject_SetPivot(pstResult, &vValue);
+            orxObject_SetPivot(pstResult, &(pstTemplate->vPivot));
           }
           else
           {
             /* Sets relative pivot */
-            orxObject_SetRelativePivot(pstResult, orxGraphic_GetAlignFlags(zPivot));
+            orxObject_SetRelativePivot(pstResult, pstTemplate->u32PivotAlignFlags);
           }
         }
 
         /* *** Scale *** */
 
         /* Has scale? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_SCALE) != orxFALSE)
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_SCALE))
         {
-          /* Is config scale not a vector? */
-          if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SCALE, &vScale) == orxNULL)
-          {
-            orxFLOAT fScale;
-
-            /* Gets config uniformed scale */
-            fScale = orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_SCALE);
-
-            /* Updates vector */
-            orxVector_SetAll(&vScale, fScale);
-          }
+          /* Gets it */
+          orxVector_Copy(&vScale, &(pstTemplate->vScale));
 
           /* Uses parent's scale? */
           if(bUseParentScale != orxFALSE)
@@ -6618,58 +9371,24 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
 
         /* *** Color *** */
 
-        /* Inits color */
-        orxColor_Set(&stColor, &orxVECTOR_WHITE, orxFLOAT_1);
-
-        /* Disables config typo check */
-        bTypoCheck = orxConfig_IsTypoCheckEnabled();
-        orxConfig_EnableTypoCheck(orxFALSE);
-
-        /* Has color? */
-        if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_COLOR, orxCOLORSPACE_COMPONENT, &(stColor.vRGB)) != orxNULL)
-        {
-          /* Normalizes it */
-          orxVector_Mulf(&(stColor.vRGB), &(stColor.vRGB), orxCOLOR_NORMALIZER);
-
-          /* Updates status */
-          bHasColor = orxTRUE;
-        }
-        /* Has RGB values? */
-        else if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_RGB, orxCOLORSPACE_RGB, &(stColor.vRGB)) != orxNULL)
-        {
-          /* Updates status */
-          bHasColor = orxTRUE;
-        }
-        /* Has HSL values? */
-        else if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_HSL, orxCOLORSPACE_HSL, &(stColor.vHSL)) != orxNULL)
-        {
-          /* Stores its RGB equivalent */
-          orxColor_FromHSLToRGB(&stColor, &stColor);
-
-          /* Updates status */
-          bHasColor = orxTRUE;
-        }
-        /* Has HSV values? */
-        else if(orxConfig_GetColorVector(orxOBJECT_KZ_CONFIG_HSV, orxCOLORSPACE_HSV, &(stColor.vHSV)) != orxNULL)
-        {
-          /* Stores its RGB equivalent */
-          orxColor_FromHSVToRGB(&stColor, &stColor);
-
-          /* Updates status */
-          bHasColor = orxTRUE;
-        }
-
-        /* Restores config typo check */
-        orxConfig_EnableTypoCheck(bTypoCheck);
-
         /* Has alpha? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_ALPHA) != orxFALSE)
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_ALPHA))
         {
-          /* Doesn't have any color? */
-          if(bHasColor == orxFALSE)
+          orxCOLOR stColor;
+
+          /* Has color? */
+          if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_COLOR))
+          {
+            /* Gets it */
+            orxColor_Copy(&stColor, &(pstTemplate->stColor));
+          }
+          else
           {
             orxGRAPHIC* pstGraphic;
 
+            /* Inits color */
+            orxColor_Set(&stColor, &orxVECTOR_WHITE, orxFLOAT_1);
+
             /* Gets current graphic */
             pstGraphic = orxObject_GetWorkingGraphic(pstResult);
 
@@ -6685,39 +9404,65 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             }
           }
 
-          /* Applies it */
-          orxColor_SetAlpha(&stColor, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ALPHA));
+          /* Applies alpha */
+          orxColor_SetAlpha(&stColor, pstTemplate->stColor.fAlpha);
 
           /* Updates color */
           orxObject_SetColor(pstResult, &stColor);
         }
         /* Should apply color? */
-        else if(bHasColor != orxFALSE)
+        else if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_COLOR))
         {
           /* Updates color */
-          orxObject_SetColor(pstResult, &stColor);
+          orxObject_SetColor(pstResult, &(pstTemplate->stColor));
         }
 
         /* *** Body *** */
 
         /* Gets body name */
-        zBodyName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_BODY);
+        zBodyName = pstTemplate->zBody;
+
+        /* Kept from a pool? */
+        if(pstResult->apstStructureList[orxSTRUCTURE_ID_BODY] != orxNULL)
+        {
+          /* Gets it */
+          pstBody = orxBODY(pstResult->apstStructureList[orxSTRUCTURE_ID_BODY]);
+
+          /* Same config? */
+          if((zBodyName != orxNULL) && (orxString_Compare(orxBody_GetName(pstBody), zBodyName) == 0))
+          {
+            /* Resets it, its properties and parts might have been modified at runtime */
+            orxBody_ResetFromConfig(pstBody);
+          }
+          else
+          {
+            /* Removes it */
+            orxObject_UnlinkStructure(pstResult, orxSTRUCTURE_ID_BODY);
+            pstBody = orxNULL;
+          }
+        }
+        else
+        {
+          /* Clears it */
+          pstBody = orxNULL;
+        }
 
-        /* Sets it */
-        pstBody = ((zBodyName != orxNULL) && (*zBodyName != orxCHAR_NULL)) ? orxObject_SetBodyFromConfig(pstResult, zBodyName) : orxNULL;
+        /* No body yet and valid name? */
+        if((pstBody == orxNULL) && (zBodyName != orxNULL) && (*zBodyName != orxCHAR_NULL))
+        {
+          /* Sets it */
+          pstBody = orxObject_SetBodyFromConfig(pstResult, zBodyName);
+        }
 
         /* *** Clock *** */
 
-        /* Gets clock name */
-        zClockName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_CLOCK);
-
-        /* Valid? */
-        if((zClockName != orxNULL) && (*zClockName != orxCHAR_NULL))
+        /* Valid clock name? */
+        if(*(pstTemplate->zClock) != orxCHAR_NULL)
         {
           orxCLOCK *pstClock;
 
           /* Creates clock */
-          pstClock = orxClock_CreateFromConfig(zClockName);
+          pstClock = orxClock_CreateFromConfig(pstTemplate->zClock);
 
           /* Valid? */
           if(pstClock != orxNULL)
@@ -6743,52 +9488,43 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Rotation & position */
 
         /* Updates object rotation */
-        fRotation = orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ROTATION);
-        orxObject_SetRotation(pstResult, fRotation);
+        orxObject_SetRotation(pstResult, pstTemplate->fRotation);
 
         /* Clears pivot override */
         orxVector_SetAll(&vPivotOverride, orxFLOAT_0);
 
         /* Has pivot override? */
-        if(pcPivotOverrideMarker != orxNULL)
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT_OVERRIDE))
         {
-          orxU32  u32AlignFlags;
           orxBOOL bValid = orxFALSE;
 
           /* Is a Cartesian vector? */
-          if(orxConfig_ToVector(zPivotOverride, orxCOLORSPACE_NONE, &vPivotOverride) != orxNULL)
+          if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_PIVOT_OVERRIDE_VECTOR))
           {
+            /* Gets it */
+            orxVector_Copy(&vPivotOverride, &(pstTemplate->vPivotOverride));
+
             /* Updates status */
             bValid = orxTRUE;
           }
           else
           {
-            /* Valid ? */
-            if(*zPivotOverride != orxCHAR_NULL)
-            {
-              orxAABOX stBox;
-
-              /* Gets align flags */
-              u32AlignFlags = orxGraphic_GetAlignFlags(zPivotOverride);
+            orxAABOX stBox;
 
-              /* Valid size? */
-              if(orxObject_GetSize(pstResult, &(stBox.vBR)) != orxNULL)
-              {
-                /* Inits box top left corner */
-                orxVector_SetAll(&(stBox.vTL), orxFLOAT_0);
+            /* Valid size? */
+            if(orxObject_GetSize(pstResult, &(stBox.vBR)) != orxNULL)
+            {
+              /* Inits box top left corner */
+              orxVector_SetAll(&(stBox.vTL), orxFLOAT_0);
 
-                /* Updates pivot override */
-                orxGraphic_AlignVector(u32AlignFlags, &stBox, &vPivotOverride);
+              /* Updates pivot override */
+              orxGraphic_AlignVector(pstTemplate->u32PivotOverrideAlignFlags, &stBox, &vPivotOverride);
 
-                /* Updates status */
-                bValid = orxTRUE;
-              }
+              /* Updates status */
+              bValid = orxTRUE;
             }
           }
 
-          /* Restores override marker */
-          *pcPivotOverrideMarker = *orxOBJECT_KZ_OVERRIDE_MARKER;
-
           /* Valid? */
           if(bValid != orxFALSE)
           {
@@ -6826,108 +9562,91 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             else
             {
               /* Applies local rotation and scale to pivot override */
-              orxVector_2DRotate(&vPivotOverride, orxVector_Mul(&vPivotOverride, &vPivotOverride, &vScale), fRotation);
+              orxVector_2DRotate(&vPivotOverride, orxVector_Mul(&vPivotOverride, &vPivotOverride, &vScale), pstTemplate->fRotation);
             }
           }
         }
 
-        /* Doesn't have Cartesian position? */
-        if(bHasPosition == orxFALSE)
+        /* Has Cartesian position? */
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_POSITION))
         {
-          /* Has literal position? */
-          if(*zPosition != orxCHAR_NULL)
-          {
-            const orxCHAR  *pc;
-            orxU32          u32IgnoreFlags, u32AlignFlags;
+          /* Gets it */
+          orxVector_Copy(&vPosition, &(pstTemplate->vPosition));
 
-            /* Gets align flags */
-            u32AlignFlags = orxGraphic_GetAlignFlags(zPosition);
+          /* Updates status */
+          bHasPosition = orxTRUE;
+        }
+        /* Has literal position? */
+        else if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_LITERAL))
+        {
+          orxU32 u32IgnoreFlags;
 
-            /* Updates position */
-            orxGraphic_AlignVector(u32AlignFlags, &stParentBox, &vPosition);
+          /* Updates position */
+          orxGraphic_AlignVector(pstTemplate->u32PositionAlignFlags, &stParentBox, &vPosition);
 
-            /* Has parent and position ignore flags? */
-            if((pstParent != orxNULL)
-            && (orxStructure_GetID(pstParent) == orxSTRUCTURE_ID_OBJECT)
-            && ((u32IgnoreFlags = orxObject_GetIgnoreFlags(pstResult)) != orxFRAME_KU32_FLAG_IGNORE_NONE)
-            && (orxFLAG_TEST(u32IgnoreFlags, orxFRAME_KU32_MASK_IGNORE_POSITION)))
-            {
-              /* Sets position in parent's space */
-              orxStructure_SetFlags(sstObject.pstFrame, orxFRAME_KU32_FLAG_IGNORE_NONE, orxFRAME_KU32_MASK_IGNORE_ALL);
-              orxFrame_SetParent(sstObject.pstFrame, orxOBJECT_GET_STRUCTURE(orxOBJECT(pstParent), FRAME));
-              orxFrame_SetPosition(sstObject.pstFrame, orxFRAME_SPACE_LOCAL, &vPosition);
+          /* Has parent and position ignore flags? */
+          if((pstParent != orxNULL)
+          && (orxStructure_GetID(pstParent) == orxSTRUCTURE_ID_OBJECT)
+          && ((u32IgnoreFlags = orxObject_GetIgnoreFlags(pstResult)) != orxFRAME_KU32_FLAG_IGNORE_NONE)
+          && (orxFLAG_TEST(u32IgnoreFlags, orxFRAME_KU32_MASK_IGNORE_POSITION)))
+          {
+            /* Sets position in parent's space */
+            orxStructure_SetFlags(sstObject.pstFrame, orxFRAME_KU32_FLAG_IGNORE_NONE, orxFRAME_KU32_MASK_IGNORE_ALL);
+            orxFrame_SetParent(sstObject.pstFrame, orxOBJECT_GET_STRUCTURE(orxOBJECT(pstParent), FRAME));
+            orxFrame_SetPosition(sstObject.pstFrame, orxFRAME_SPACE_LOCAL, &vPosition);
 
-              /* Retrieves it in global space */
-              orxFrame_GetPosition(sstObject.pstFrame, orxFRAME_SPACE_GLOBAL, &vPosition);
+            /* Retrieves it in global space */
+            orxFrame_GetPosition(sstObject.pstFrame, orxFRAME_SPACE_GLOBAL, &vPosition);
 
-              /* Converts it to local space */
-              orxStructure_SetFlags(sstObject.pstFrame, u32IgnoreFlags, orxFRAME_KU32_MASK_IGNORE_ALL);
-              orxFrame_SetPosition(sstObject.pstFrame, orxFRAME_SPACE_GLOBAL, &vPosition);
-              orxFrame_GetPosition(sstObject.pstFrame, orxFRAME_SPACE_LOCAL, &vPosition);
+            /* Converts it to local space */
+            orxStructure_SetFlags(sstObject.pstFrame, u32IgnoreFlags, orxFRAME_KU32_MASK_IGNORE_ALL);
+            orxFrame_SetPosition(sstObject.pstFrame, orxFRAME_SPACE_GLOBAL, &vPosition);
+            orxFrame_GetPosition(sstObject.pstFrame, orxFRAME_SPACE_LOCAL, &vPosition);
 
-              /* Removes conversion frame */
-              orxFrame_SetParent(sstObject.pstFrame, orxNULL);
-            }
+            /* Removes conversion frame */
+            orxFrame_SetParent(sstObject.pstFrame, orxNULL);
+          }
 
-            /* Looks for numerical value */
-            for(pc = zPosition; *pc != orxCHAR_NULL; pc++)
+          /* Has offset? */
+          if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_OFFSET))
+          {
+            /* Is a vector? */
+            if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_POSITION_OFFSET_VECTOR))
             {
-              /* Found? */
-              if(((*pc >= '0') && (*pc <= '9'))
-              || (*pc == orxSTRING_KC_VECTOR_START)
-              || (*pc == orxSTRING_KC_VECTOR_START_ALT)
-              || (*pc == '+')
-              || (*pc == '-')
-              || (*pc == '.'))
-              {
-                orxVECTOR vOffset;
-
-                /* Is a vector? */
-                if(orxConfig_ToVector(pc, orxCOLORSPACE_NONE, &vOffset) != orxNULL)
-                {
-                  /* Uses parent's position? */
-                  if(bUseParentPosition != orxFALSE)
-                  {
-                    /* Gets world space values */
-                    orxVector_Mul(&vOffset, &vOffset, &vParentSize);
-                  }
+              orxVECTOR vOffset;
 
-                  /* Updates position */
-                  orxVector_Add(&vPosition, &vPosition, &vOffset);
-                }
-                else
-                {
-                  /* Uses it as Z component */
-                  orxString_ToFloat(pc, &vPosition.fZ, orxNULL);
+              /* Gets it */
+              orxVector_Copy(&vOffset, &(pstTemplate->vPositionOffset));
 
-                  /* Uses parent's position? */
-                  if(bUseParentPosition != orxFALSE)
-                  {
-                    /* Gets world space values */
-                    vPosition.fZ *= vParentSize.fZ;
-                  }
-                }
-                break;
+              /* Uses parent's position? */
+              if(bUseParentPosition != orxFALSE)
+              {
+                /* Gets world space values */
+                orxVector_Mul(&vOffset, &vOffset, &vParentSize);
               }
-            }
 
-            /* Ignores parent position */
-            bUseParentPosition = orxFALSE;
+              /* Updates position */
+              orxVector_Add(&vPosition, &vPosition, &vOffset);
+            }
+            else
+            {
+              /* Uses it as Z component */
+              vPosition.fZ = pstTemplate->vPositionOffset.fZ;
 
-            /* Updates status */
-            bHasPosition = orxTRUE;
+              /* Uses parent's position? */
+              if(bUseParentPosition != orxFALSE)
+              {
+                /* Gets world space values */
+                vPosition.fZ *= vParentSize.fZ;
+              }
+            }
           }
-          /* Has spherical position? */
-          else if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SPHERICAL_POSITION, &vPosition) != orxNULL)
-          {
-            /* Transforms it */
-            vPosition.fTheta *= orxMATH_KF_DEG_TO_RAD;
-            vPosition.fPhi   *= orxMATH_KF_DEG_TO_RAD;
-            orxVector_FromSphericalToCartesian(&vPosition, &vPosition);
 
-            /* Updates status */
-            bHasPosition = orxTRUE;
-          }
+          /* Ignores parent position */
+          bUseParentPosition = orxFALSE;
+
+          /* Updates status */
+          bHasPosition = orxTRUE;
         }
 
         /* Has position? */
@@ -6950,7 +9669,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Children *** */
 
         /* Has child list? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_CHILD_LIST)) > 0)
+        if((s32Count = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_LIST_CHILD)) > 0)
         {
           orxS32      i, s32JointNumber;
           orxOBJECT  *pstLastChild;
@@ -6959,7 +9678,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           sstObject.pstCurrentParent = pstResult;
 
           /* Gets child joint list number */
-          s32JointNumber = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_CHILD_JOINT_LIST);
+          s32JointNumber = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_LIST_CHILD_JOINT);
 
           /* For all defined objects */
           for(i = 0, pstLastChild = orxNULL; i < s32Count; i++)
@@ -6967,7 +9686,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             const orxSTRING zChild;
 
             /* Gets its name */
-            zChild = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_CHILD_LIST, i);
+            zChild = orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_LIST_CHILD, i);
 
             /* Valid? */
             if(*zChild != orxCHAR_NULL)
@@ -7019,7 +9738,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
                   /* Valid joint can be added? */
                   if((pstBody != orxNULL)
                   && (i < s32JointNumber)
-                  && (orxBody_AddJointFromConfig(pstBody, pstChildBody, orxConfig_GetListString(orxOBJECT_KZ_CONFIG_CHILD_JOINT_LIST, i)) != orxNULL))
+                  && (orxBody_AddJointFromConfig(pstBody, pstChildBody, orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_LIST_CHILD_JOINT, i)) != orxNULL))
                   {
                     /* Marks it as a joint child */
                     orxStructure_SetFlags(pstChild, orxOBJECT_KU32_FLAG_IS_JOINT_CHILD | orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD, orxOBJECT_KU32_FLAG_NONE);
@@ -7046,30 +9765,30 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** Speed *** */
 
         /* Has speed? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_SPEED, &vValue) != orxNULL)
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_SPEED))
         {
           /* Uses relative speed? */
-          if(orxConfig_GetBool(orxOBJECT_KZ_CONFIG_USE_RELATIVE_SPEED) != orxFALSE)
+          if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_RELATIVE_SPEED))
           {
             /* Updates object relative speed */
-            orxObject_SetRelativeSpeed(pstResult, &vValue);
+            orxObject_SetRelativeSpeed(pstResult, &(pstTemplate->vSpeed));
           }
           else
           {
             /* Updates object speed */
-            orxObject_SetSpeed(pstResult, &vValue);
+            orxObject_SetSpeed(pstResult, &(pstTemplate->vSpeed));
           }
         }
 
         /* *** Angular velocity *** */
 
         /* Sets angular velocity? */
-        orxObject_SetAngularVelocity(pstResult, orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_ANGULAR_VELOCITY));
+        orxObject_SetAngularVelocity(pstResult, pstTemplate->fAngularVelocity);
 
         /* *** Sound *** */
 
         /* Has sound? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_SOUND_LIST)) > 0)
+        if((s32Count = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_LIST_SOUND)) > 0)
         {
           orxS32 i;
 
@@ -7079,7 +9798,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             const orxSTRING zSound;
 
             /* Gets its name */
-            zSound = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_SOUND_LIST, i);
+            zSound = orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_LIST_SOUND, i);
 
             /* Valid? */
             if(*zSound != orxCHAR_NULL)
@@ -7093,28 +9812,25 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* *** FX *** */
 
         /* Has FX? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_FX_LIST)) > 0)
+        if((s32Count = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_LIST_FX)) > 0)
         {
           orxCLOCK_INFO stClockInfo;
-          orxS32        i, s32RecursiveCount;
+          orxS32        i;
           orxBOOL       bRecursive = orxFALSE;
 
-          /* Gets number of recursive FXs */
-          s32RecursiveCount = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_FX_RECURSIVE_LIST);
-
           /* For all defined FXs */
           for(i = 0; i < s32Count; i++)
           {
             const orxSTRING zFX;
 
             /* Gets its name */
-            zFX = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_FX_LIST, i);
+            zFX = orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_LIST_FX, i);
 
             /* Valid? */
             if(*zFX != orxCHAR_NULL)
             {
               /* Is recursive? */
-              if((i < s32RecursiveCount) && (orxConfig_GetListBool(orxOBJECT_KZ_CONFIG_FX_RECURSIVE_LIST, i) != orxFALSE))
+              if(orxObject_IsTemplateFXRecursive(pstTemplate, i) != orxFALSE)
               {
                 /* Adds it */
                 orxObject_AddFXRecursive(pstResult, zFX, orxFLOAT_0);
@@ -7131,10 +9847,10 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
           }
 
           /* Has frequency? */
-          if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_FX_FREQUENCY) != orxFALSE)
+          if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_FX_FREQUENCY))
           {
             /* Updates FX pointer frequency */
-            orxObject_SetFXFrequency(pstResult, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_FX_FREQUENCY));
+            orxObject_SetFXFrequency(pstResult, pstTemplate->fFXFrequency);
           }
 
           /* Inits clock info */
@@ -7160,16 +9876,13 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
 
         /* *** Spawner *** */
 
-        /* Gets spawner name */
-        zSpawnerName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_SPAWNER);
-
-        /* Valid? */
-        if((zSpawnerName != orxNULL) && (*zSpawnerName != orxCHAR_NULL))
+        /* Valid spawner name? */
+        if(*(pstTemplate->zSpawner) != orxCHAR_NULL)
         {
           orxSPAWNER *pstSpawner;
 
           /* Creates spawner */
-          pstSpawner = orxSpawner_CreateFromConfig(zSpawnerName);
+          pstSpawner = orxSpawner_CreateFromConfig(pstTemplate->zSpawner);
 
           /* Valid? */
           if(pstSpawner != orxNULL)
@@ -7197,34 +9910,17 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
 
         /* *** Shader *** */
 
-        /* Gets shader name */
-        zShaderName = orxConfig_GetString(orxOBJECT_KZ_CONFIG_SHADER);
-
-        /* Not found? */
-        if(*zShaderName == orxCHAR_NULL)
-        {
-          /* Gets first shader from list */
-          zShaderName = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_SHADER_LIST, 0);
-
-          /* Has multiple shaders? */
-          if(orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_SHADER_LIST) > 1)
-          {
-            /* Logs message */
-            orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, orxANSI_KZ_COLOR_FG_GREEN "[%s]" orxANSI_KZ_COLOR_FG_DEFAULT ": deprecated property <ShaderList> contains multiple entries, only the first one will be used.", _zConfigID);
-          }
-        }
-
         /* Has shader? */
-        if(*zShaderName != orxCHAR_NULL)
+        if(*(pstTemplate->zShader) != orxCHAR_NULL)
         {
           /* Sets it */
-          orxObject_SetShaderFromConfig(pstResult, zShaderName);
+          orxObject_SetShaderFromConfig(pstResult, pstTemplate->zShader);
         }
 
         /* *** Timeline *** */
 
         /* Has TimeLine tracks? */
-        if((s32Count = orxConfig_GetListCount(orxOBJECT_KZ_CONFIG_TRACK_LIST)) > 0)
+        if((s32Count = orxObject_GetTemplateListCount(pstTemplate, orxOBJECT_TEMPLATE_LIST_TRACK)) > 0)
         {
           orxS32 i;
 
@@ -7234,7 +9930,7 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
             const orxSTRING zTrack;
 
             /* Gets its name */
-            zTrack = orxConfig_GetListString(orxOBJECT_KZ_CONFIG_TRACK_LIST, i);
+            zTrack = orxObject_GetTemplateListString(pstTemplate, orxOBJECT_TEMPLATE_LIST_TRACK, i);
 
             /* Valid? */
             if(*zTrack != orxCHAR_NULL)
@@ -7247,58 +9943,51 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
 
         /* *** Misc *** */
 
-        /* Has smoothing value? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_SMOOTHING) != orxFALSE)
-        {
-          /* Updates flags */
-          u32Flags |= (orxConfig_GetBool(orxOBJECT_KZ_CONFIG_SMOOTHING) != orxFALSE) ? orxOBJECT_KU32_FLAG_SMOOTHING_ON : orxOBJECT_KU32_FLAG_SMOOTHING_OFF;
-        }
-
         /* Has blend mode? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_BLEND_MODE) != orxFALSE)
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_BLEND_MODE))
         {
-          const orxSTRING zBlendMode;
-
-          /* Gets blend mode value */
-          zBlendMode = orxConfig_GetString(orxOBJECT_KZ_CONFIG_BLEND_MODE);
-
           /* Updates object's blend mode */
-          orxObject_SetBlendMode(pstResult, orxDisplay_GetBlendModeFromString(zBlendMode));
+          orxObject_SetBlendMode(pstResult, pstTemplate->eBlendMode);
         }
 
         /* Should repeat? */
-        if(orxConfig_GetVector(orxOBJECT_KZ_CONFIG_REPEAT, &vValue) != orxNULL)
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_REPEAT))
         {
           /* Stores it */
-          orxObject_SetRepeat(pstResult, vValue.fX, vValue.fY);
+          orxObject_SetRepeat(pstResult, pstTemplate->vRepeat.fX, pstTemplate->vRepeat.fY);
         }
 
         /* Has life time? */
-        if(orxConfig_HasValue(orxOBJECT_KZ_CONFIG_LIFETIME) != orxFALSE)
+        if(orxFLAG_TEST(pstTemplate->u32Flags, orxOBJECT_TEMPLATE_KU32_FLAG_LIFETIME))
         {
-          /* Sets literal lifetime? */
-          if(orxObject_SetLiteralLifeTime(pstResult, orxConfig_GetString(orxOBJECT_KZ_CONFIG_LIFETIME)) == orxSTATUS_FAILURE)
+          /* Literal? */
+          if(pstTemplate->u32LifeTimeFlags != orxOBJECT_KU32_FLAG_NONE)
+          {
+            /* Clears previous lifetime */
+            orxObject_SetLifeTime(pstResult, -orxFLOAT_1);
+
+            /* Applies literal flags */
+            orxStructure_SetFlags(pstResult, pstTemplate->u32LifeTimeFlags, orxOBJECT_KU32_MASK_STRUCTURE_LIFETIME);
+          }
+          else
           {
             /* Stores lifetime's numerical value */
-            orxObject_SetLifeTime(pstResult, orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_LIFETIME));
+            orxObject_SetLifeTime(pstResult, pstTemplate->fLifeTime);
           }
         }
 
         /* Updates flags */
         orxStructure_SetFlags(pstResult, u32Flags, orxOBJECT_KU32_FLAG_NONE);
 
-        /* Gets on-delete command? */
-        zCommand = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_DELETE);
-
-        /* Valid? */
-        if(zCommand != orxSTRING_EMPTY)
+        /* Has on-delete command? */
+        if(pstTemplate->zOnDelete != orxSTRING_EMPTY)
         {
           /* Stores it */
-          pstResult->zOnDelete = orxString_Store(zCommand);
+          pstResult->zOnDelete = pstTemplate->zOnDelete;
         }
 
         /* Gets on-create command */
-        zCommand = orxConfig_GetString(orxOBJECT_KZ_CONFIG_ON_CREATE);
+        zCommand = pstTemplate->zOnCreate;
 
         /* Valid? */
         if(zCommand != orxSTRING_EMPTY)
@@ -7508,6 +10197,9 @@ orxSTATUS orxFASTCALL orxObject_LinkStructure(orxOBJECT *_pstObject, orxSTRUCTUR
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Invalidates spatial index */
+  orxObject_InvalidateIndex(_pstObject);
+
   /* Done! */
   return eResult;
 }
@@ -7627,6 +10319,9 @@ void orxFASTCALL orxObject_UnlinkStructure(orxOBJECT *_pstObject, orxSTRUCTURE_I
     _pstObject->apstStructureList[_eStructureID] = orxNULL;
   }
 
+  /* Invalidates spatial index */
+  orxObject_InvalidateIndex(_pstObject);
+
   /* Done! */
   return;
 }
@@ -7725,6 +10420,9 @@ orxSTATUS orxFASTCALL orxObject_Enable(orxOBJECT *_pstObject, orxBOOL _bEnable)
 
           /* Adds object to enable group list */
           orxLinkList_AddEnd(&(pstGroupLists->stEnableList), &(_pstObject->stEnableGroupNode));
+
+          /* Adds it to spatial index */
+          orxObject_AddToIndex(pstGroupLists, _pstObject);
         }
 
         /* Has trigger? */
@@ -7773,6 +10471,9 @@ orxSTATUS orxFASTCALL orxObject_Enable(orxOBJECT *_pstObject, orxBOOL _bEnable)
           /* Removes it from enable lists */
           orxLinkList_Remove(&(_pstObject->stEnableNode));
           orxLinkList_Remove(&(_pstObject->stEnableGroupNode));
+
+          /* Removes it from spatial index */
+          orxObject_RemoveFromIndex(_pstObject);
         }
 
         /* Had enabled trigger? */
@@ -8405,6 +11106,9 @@ orxSTATUS orxFASTCALL orxObject_SetPivot(orxOBJECT *_pstObject, const orxVECTOR
     eResult = orxSTATUS_SUCCESS;
   }
 
+  /* Invalidates spatial index */
+  orxObject_InvalidateIndex(_pstObject);
+
   /* Done! */
   return eResult;
 }
@@ -8455,6 +11159,9 @@ orxSTATUS orxFASTCALL orxObject_SetRelativePivot(orxOBJECT *_pstObject, orxU32 _
     }
   }
 
+  /* Invalidates spatial index */
+  orxObject_InvalidateIndex(_pstObject);
+
   /* Done! */
   return eResult;
 }
@@ -8491,6 +11198,9 @@ orxSTATUS orxFASTCALL orxObject_SetOrigin(orxOBJECT *_pstObject, const orxVECTOR
     eResult = orxSTATUS_FAILURE;
   }
 
+  /* Invalidates spatial index */
+  orxObject_InvalidateIndex(_pstObject);
+
   /* Done! */
   return eResult;
 }
@@ -8535,6 +11245,9 @@ orxSTATUS orxFASTCALL orxObject_SetSize(orxOBJECT *_pstObject, const orxVECTOR *
     eResult = orxSTATUS_SUCCESS;
   }
 
+  /* Invalidates spatial index */
+  orxObject_InvalidateIndex(_pstObject);
+
   /* Done! */
   return eResult;
 }
@@ -10969,6 +13682,9 @@ orxSTATUS orxFASTCALL orxObject_SetTextString(orxOBJECT *_pstObject, const orxST
       {
         /* Updates graphic */
         orxGraphic_UpdateSize(pstGraphic);
+
+        /* Invalidates spatial index */
+        orxObject_InvalidateIndex(_pstObject);
       }
     }
   }
@@ -11050,6 +13766,56 @@ orxOBOX *orxFASTCALL orxObject_GetBoundingBox(const orxOBJECT *_pstObject, orxOB
   return pstResult;
 }
 
+/** Notifies that a graphic's size or pivot changed, so as to refresh the bounding box of the objects using it, in group spatial indices.
+ * @param[in]   _pstGraphic     Concerned graphic
+ */
+void orxFASTCALL orxObject_NotifyGraphicChange(const orxGRAPHIC *_pstGraphic)
+{
+  /* Checks */
+  orxSTRUCTURE_ASSERT(_pstGraphic);
+
+  /* Ready and has spatial indices? */
+  if((sstObject.u32Flags & (orxOBJECT_KU32_STATIC_FLAG_READY | orxOBJECT_KU32_STATIC_FLAG_INDEX)) == (orxOBJECT_KU32_STATIC_FLAG_READY | orxOBJECT_KU32_STATIC_FLAG_INDEX))
+  {
+    orxSTRUCTURE *pstOwner;
+
+    /* Gets its owner */
+    pstOwner = orxStructure_GetOwner(_pstGraphic);
+
+    /* Owned by an object? */
+    if(orxOBJECT(pstOwner) != orxNULL)
+    {
+      /* Using this graphic? */
+      if(orxOBJECT_GET_STRUCTURE(orxOBJECT(pstOwner), GRAPHIC) == _pstGraphic)
+      {
+        /* Invalidates its index entry */
+        orxObject_InvalidateIndex(orxOBJECT(pstOwner));
+      }
+    }
+    /* Not owned and linked by others (orxObject_LinkStructure)? */
+    else if((pstOwner == orxNULL) && (orxStructure_GetRefCount(_pstGraphic) > 1))
+    {
+      orxOBJECT *pstObject;
+
+      /* For all objects */
+      for(pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+          pstObject != orxNULL;
+          pstObject = orxOBJECT(orxStructure_GetNext(pstObject)))
+      {
+        /* Using this graphic? */
+        if(orxOBJECT_GET_STRUCTURE(pstObject, GRAPHIC) == _pstGraphic)
+        {
+          /* Invalidates its index entry */
+          orxObject_InvalidateIndex(pstObject);
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Adds an FX using its config ID.
  * @param[in]   _pstObject      Concerned object
  * @param[in]   _zFXConfigID    Config ID of the FX to add
@@ -12368,7 +15134,9 @@ const orxSTRING orxFASTCALL orxObject_GetName(const orxOBJECT *_pstObject)
 orxSTATUS orxFASTCALL orxObject_ForAllNeighbors(const orxOBJECT_NEIGHBOR_FUNCTION _pfnNeighborCallback, const orxOBOX *_pstCheckBox, orxSTRINGID _stGroupID, orxBOOL _bEnabled, void *_pContext)
 {
   orxOBJECT *(orxFASTCALL  *pfnGet)(const orxOBJECT *_pstObject, orxSTRINGID _stGroupID);
+  orxOBJECT_INDEX          *pstIndex;
   orxOBJECT                *pstObject;
+  orxBOOL                   bDone = orxFALSE;
   orxSTATUS                 eResult = orxSTATUS_SUCCESS;
 
   /* Profiles */
@@ -12378,27 +15146,90 @@ orxSTATUS orxFASTCALL orxObject_ForAllNeighbors(const orxOBJECT_NEIGHBOR_FUNCTIO
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pfnNeighborCallback != orxNULL);
 
-  /* Selects get function */
-  pfnGet = (_bEnabled != orxFALSE) ? orxObject_GetNextEnabled : orxObject_GetNext;
+  /* Gets spatial index, if applicable */
+  pstIndex = ((_pstCheckBox != orxNULL) && (_bEnabled != orxFALSE)) ? orxObject_GetIndex(_stGroupID) : orxNULL;
 
-  /* For all objects */
-  for(pstObject = pfnGet(orxNULL, _stGroupID);
-      pstObject != orxNULL;
-      pstObject = pfnGet(pstObject, _stGroupID))
+  /* Valid? */
+  if(pstIndex != orxNULL)
+  {
+    orxOBJECT_INDEX_NEIGHBOR_CONTEXT  stContext;
+    orxOBJECT_INDEX_NEIGHBOR          astNeighborList[orxOBJECT_KU32_NEIGHBOR_LIST_SIZE];
+    orxAABOX                          stExtents;
+
+    /* Inits context */
+    stContext.astNeighborList = astNeighborList;
+    stContext.u32Count        = 0;
+    stContext.u32Size         = orxOBJECT_KU32_NEIGHBOR_LIST_SIZE;
+
+    /* Gets box extents */
+    orxObject_GetBoxExtents(_pstCheckBox, &stExtents);
+
+    /* Gathers candidates */
+    if(orxObject_QueryIndex(pstIndex, &stExtents, orxObject_GatherIndexEntry, &stContext) != orxFALSE)
+    {
+      orxU32 i;
+
+      /* Sorts them in group order */
+      orxObject_SortNeighbors(stContext.astNeighborList, stContext.u32Count);
+
+      /* For all candidates */
+      for(i = 0; i < stContext.u32Count; i++)
+      {
+        /* Gets object (it might have been deleted or modified by a previous callback) */
+        pstObject = orxOBJECT(orxStructure_Get(stContext.astNeighborList[i].u64GUID));
+
+        /* Still valid, enabled and in group? */
+        if((pstObject != orxNULL)
+        && (orxStructure_TestFlags(pstObject, orxOBJECT_KU32_FLAG_ENABLED))
+        && (pstObject->stGroupID == _stGroupID))
+        {
+          orxOBOX stObjectBox;
+
+          /* Is intersecting? */
+          if((orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
+          && (orxOBox_ZAlignedTestIntersection(_pstCheckBox, &stObjectBox) != orxFALSE))
+          {
+            /* Runs callback */
+            if(_pfnNeighborCallback(pstObject, _pContext) == orxFALSE)
+            {
+              /* Updates result */
+              eResult = orxSTATUS_FAILURE;
+              break;
+            }
+          }
+        }
+      }
+
+      /* Updates status */
+      bDone = orxTRUE;
+    }
+  }
+
+  /* Not done? */
+  if(bDone == orxFALSE)
   {
-    orxOBOX stObjectBox;
+    /* Selects get function */
+    pfnGet = (_bEnabled != orxFALSE) ? orxObject_GetNextEnabled : orxObject_GetNext;
 
-    /* No box or is intersecting? */
-    if((_pstCheckBox == orxNULL)
-    || ((orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
-     && (orxOBox_ZAlignedTestIntersection(_pstCheckBox, &stObjectBox) != orxFALSE)))
+    /* For all objects */
+    for(pstObject = pfnGet(orxNULL, _stGroupID);
+        pstObject != orxNULL;
+        pstObject = pfnGet(pstObject, _stGroupID))
     {
-      /* Runs callback */
-      if(_pfnNeighborCallback(pstObject, _pContext) == orxFALSE)
+      orxOBOX stObjectBox;
+
+      /* No box or is intersecting? */
+      if((_pstCheckBox == orxNULL)
+      || ((orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
+       && (orxOBox_ZAlignedTestIntersection(_pstCheckBox, &stObjectBox) != orxFALSE)))
       {
-        /* Updates result */
-        eResult = orxSTATUS_FAILURE;
-        break;
+        /* Runs callback */
+        if(_pfnNeighborCallback(pstObject, _pContext) == orxFALSE)
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+          break;
+        }
       }
     }
   }
@@ -13041,59 +15872,15 @@ orxDISPLAY_BLEND_MODE orxFASTCALL orxObject_GetBlendMode(const orxOBJECT *_pstOb
  */
 orxSTATUS orxFASTCALL orxObject_SetLiteralLifeTime(orxOBJECT *_pstObject, const orxSTRING _zLifeTime)
 {
-  orxCHAR   acBuffer[128];
-  orxU32    u32Flags = orxOBJECT_KU32_FLAG_NONE;
+  orxU32    u32Flags;
   orxSTATUS eResult;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxSTRUCTURE_ASSERT(_pstObject);
 
-  /* Gets lower case value */
-  acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
-  orxString_LowerCase(orxString_NCopy(acBuffer, _zLifeTime, sizeof(acBuffer) - 1));
-
-  /* FX? */
-  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_FX) != orxNULL)
-  {
-    /* Updates flags */
-    u32Flags |= orxOBJECT_KU32_FLAG_FX_LIFETIME;
-  }
-
-  /* Sound? */
-  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_SOUND) != orxNULL)
-  {
-    /* Updates flags */
-    u32Flags |= orxOBJECT_KU32_FLAG_SOUND_LIFETIME;
-  }
-
-  /* Spawn? */
-  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_SPAWN) != orxNULL)
-  {
-    /* Updates flags */
-    u32Flags |= orxOBJECT_KU32_FLAG_SPAWNER_LIFETIME;
-  }
-
-  /* Track? */
-  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_TRACK) != orxNULL)
-  {
-    /* Updates flags */
-    u32Flags |= orxOBJECT_KU32_FLAG_TIMELINE_LIFETIME;
-  }
-
-  /* Child? */
-  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_CHILD) != orxNULL)
-  {
-    /* Updates flags */
-    u32Flags |= orxOBJECT_KU32_FLAG_CHILDREN_LIFETIME;
-  }
-
-  /* Anim? */
-  if(orxString_SearchString(acBuffer, orxOBJECT_KZ_ANIM) != orxNULL)
-  {
-    /* Updates flags */
-    u32Flags |= orxOBJECT_KU32_FLAG_ANIM_LIFETIME;
-  }
+  /* Gets literal flags */
+  u32Flags = orxObject_GetLiteralLifeTimeFlags(_zLifeTime);
 
   /* Has flags? */
   if(orxFLAG_TEST(u32Flags, orxOBJECT_KU32_MASK_STRUCTURE_LIFETIME))
@@ -13177,6 +15964,9 @@ orxSTATUS orxFASTCALL orxObject_SetLifeTime(orxOBJECT *_pstObject, orxFLOAT _fLi
 
       /* Adds object to enable group list */
       orxLinkList_AddEnd(&(pstGroupLists->stEnableList), &(_pstObject->stEnableGroupNode));
+
+      /* Adds it to spatial index */
+      orxObject_AddToIndex(pstGroupLists, _pstObject);
     }
   }
   else
@@ -13188,6 +15978,9 @@ orxSTATUS orxFASTCALL orxObject_SetLifeTime(orxOBJECT *_pstObject, orxFLOAT _fLi
       /* Removes it from enable lists */
       orxLinkList_Remove(&(_pstObject->stEnableNode));
       orxLinkList_Remove(&(_pstObject->stEnableGroupNode));
+
+      /* Removes it from spatial index */
+      orxObject_RemoveFromIndex(_pstObject);
     }
   }
 
@@ -13342,6 +16135,9 @@ orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObject, orxSTRINGID _s
   if(orxLinkList_GetList(&(_pstObject->stEnableGroupNode)) != orxNULL)
   {
     orxLinkList_Remove(&(_pstObject->stEnableGroupNode));
+
+    /* Removes it from spatial index */
+    orxObject_RemoveFromIndex(_pstObject);
   }
 
   /* Gets group list bucker*/
@@ -13362,8 +16158,11 @@ orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObject, orxSTRINGID _s
     /* Clears it */
     orxMemory_Zero(pstGroupLists, sizeof(orxOBJECT_LISTS));
 
-    /* Stores it */
+    /* Stores it (before any other hashtable insertion, as the bucket could be invalidated) */
     *ppstBucket = pstGroupLists;
+
+    /* Creates its spatial index, if requested */
+    pstGroupLists->pstIndex = orxObject_CreateIndex(_stGroupID);
   }
   else
   {
@@ -13379,6 +16178,9 @@ orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObject, orxSTRINGID _s
   {
     /* Adds object to end of enable group list */
     orxLinkList_AddEnd(&(pstGroupLists->stEnableList), &(_pstObject->stEnableGroupNode));
+
+    /* Adds it to spatial index */
+    orxObject_AddToIndex(pstGroupLists, _pstObject);
   }
 
   /* Stores group ID */
@@ -13558,42 +16360,72 @@ orxOBJECT *orxFASTCALL orxObject_GetNextEnabled(const orxOBJECT *_pstObject, orx
  */
 orxOBJECT *orxFASTCALL orxObject_Pick(const orxVECTOR *_pvPosition, orxSTRINGID _stGroupID)
 {
-  orxFLOAT    fSelectedZ;
-  orxOBJECT  *pstResult = orxNULL, *pstObject;
+  orxOBJECT_INDEX  *pstIndex;
+  orxFLOAT          fSelectedZ;
+  orxOBJECT        *pstResult = orxNULL, *pstObject;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pvPosition != orxNULL);
 
-  /* For all objects */
-  for(pstObject = orxObject_GetNextEnabled(orxNULL, _stGroupID), fSelectedZ = _pvPosition->fZ;
-      pstObject != orxNULL;
-      pstObject = orxObject_GetNextEnabled(pstObject, _stGroupID))
+  /* Gets spatial index */
+  pstIndex = orxObject_GetIndex(_stGroupID);
+
+  /* Valid? */
+  if(pstIndex != orxNULL)
   {
-    orxVECTOR vObjectPos;
+    orxOBJECT_INDEX_PICK_CONTEXT  stContext;
+    orxAABOX                      stExtents;
 
-    /* Gets object position */
-    if(orxObject_GetWorldPosition(pstObject, &vObjectPos) != orxNULL)
+    /* Inits context */
+    orxMemory_Zero(&stContext, sizeof(orxOBJECT_INDEX_PICK_CONTEXT));
+    stContext.pvPosition = _pvPosition;
+
+    /* Inits extents */
+    orxVector_Copy(&(stExtents.vTL), _pvPosition);
+    orxVector_Copy(&(stExtents.vBR), _pvPosition);
+
+    /* Queries index */
+    orxObject_QueryIndex(pstIndex, &stExtents, orxObject_PickIndexEntry, &stContext);
+
+    /* Tests remaining candidates */
+    orxObject_FlushPickCandidates(&stContext);
+
+    /* Updates result */
+    pstResult = stContext.pstResult;
+  }
+  else
+  {
+    /* For all objects */
+    for(pstObject = orxObject_GetNextEnabled(orxNULL, _stGroupID), fSelectedZ = _pvPosition->fZ;
+        pstObject != orxNULL;
+        pstObject = orxObject_GetNextEnabled(pstObject, _stGroupID))
     {
-      /* Is under position? */
-      if(vObjectPos.fZ >= _pvPosition->fZ)
+      orxVECTOR vObjectPos;
+
+      /* Gets object position */
+      if(orxObject_GetWorldPosition(pstObject, &vObjectPos) != orxNULL)
       {
-        /* No selection or above it? */
-        if((pstResult == orxNULL) || (vObjectPos.fZ <= fSelectedZ))
+        /* Is under position? */
+        if(vObjectPos.fZ >= _pvPosition->fZ)
         {
-          orxOBOX stObjectBox;
-
-          /* Gets its bounding box */
-          if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
+          /* No selection or above it? */
+          if((pstResult == orxNULL) || (vObjectPos.fZ <= fSelectedZ))
           {
-            /* Is position in 2D box? */
-            if(orxOBox_2DIsInside(&stObjectBox, _pvPosition) != orxFALSE)
+            orxOBOX stObjectBox;
+
+            /* Gets its bounding box */
+            if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
             {
-              /* Updates result */
-              pstResult = pstObject;
+              /* Is position in 2D box? */
+              if(orxOBox_2DIsInside(&stObjectBox, _pvPosition) != orxFALSE)
+              {
+                /* Updates result */
+                pstResult = pstObject;
 
-              /* Updates selected position */
-              fSelectedZ = vObjectPos.fZ;
+                /* Updates selected position */
+                fSelectedZ = vObjectPos.fZ;
+              }
             }
           }
         }
@@ -13613,39 +16445,68 @@ orxOBJECT *orxFASTCALL orxObject_Pick(const orxVECTOR *_pvPosition, orxSTRINGID
  */
 orxOBJECT *orxFASTCALL orxObject_BoxPick(const orxOBOX *_pstBox, orxSTRINGID _stGroupID)
 {
-  orxFLOAT    fSelectedZ;
-  orxOBJECT  *pstResult = orxNULL, *pstObject;
+  orxOBJECT_INDEX  *pstIndex;
+  orxFLOAT          fSelectedZ;
+  orxOBJECT        *pstResult = orxNULL, *pstObject;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBox != orxNULL);
 
-  /* For all objects */
-  for(pstObject = orxObject_GetNextEnabled(orxNULL, _stGroupID), fSelectedZ = _pstBox->vPosition.fZ;
-      pstObject != orxNULL;
-      pstObject = orxObject_GetNextEnabled(pstObject, _stGroupID))
+  /* Gets spatial index */
+  pstIndex = orxObject_GetIndex(_stGroupID);
+
+  /* Valid? */
+  if(pstIndex != orxNULL)
   {
-    orxVECTOR vObjectPos;
+    orxOBJECT_INDEX_PICK_CONTEXT  stContext;
+    orxAABOX                      stExtents;
 
-    /* Gets object position */
-    if(orxObject_GetWorldPosition(pstObject, &vObjectPos) != orxNULL)
+    /* Inits context */
+    orxMemory_Zero(&stContext, sizeof(orxOBJECT_INDEX_PICK_CONTEXT));
+    stContext.pstBox = _pstBox;
+
+    /* Gets box extents */
+    orxObject_GetBoxExtents(_pstBox, &stExtents);
+
+    /* Queries index */
+    orxObject_QueryIndex(pstIndex, &stExtents, orxObject_PickIndexEntry, &stContext);
+
+    /* Tests remaining candidates */
+    orxObject_FlushPickCandidates(&stContext);
+
+    /* Updates result */
+    pstResult = stContext.pstResult;
+  }
+  else
+  {
+    /* For all objects */
+    for(pstObject = orxObject_GetNextEnabled(orxNULL, _stGroupID), fSelectedZ = _pstBox->vPosition.fZ;
+        pstObject != orxNULL;
+        pstObject = orxObject_GetNextEnabled(pstObject, _stGroupID))
     {
-      /* No selection or above it? */
-      if((pstResult == orxNULL) || (vObjectPos.fZ <= fSelectedZ))
-      {
-        orxOBOX stObjectBox;
+      orxVECTOR vObjectPos;
 
-        /* Gets its bounding box */
-        if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
+      /* Gets object position */
+      if(orxObject_GetWorldPosition(pstObject, &vObjectPos) != orxNULL)
+      {
+        /* No selection or above it? */
+        if((pstResult == orxNULL) || (vObjectPos.fZ <= fSelectedZ))
         {
-          /* Does it intersect with box? */
-          if(orxOBox_ZAlignedTestIntersection(_pstBox, &stObjectBox) != orxFALSE)
+          orxOBOX stObjectBox;
+
+          /* Gets its bounding box */
+          if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
           {
-            /* Updates result */
-            pstResult = pstObject;
+            /* Does it intersect with box? */
+            if(orxOBox_ZAlignedTestIntersection(_pstBox, &stObjectBox) != orxFALSE)
+            {
+              /* Updates result */
+              pstResult = pstObject;
 
-            /* Updates selected position */
-            fSelectedZ = vObjectPos.fZ;
+              /* Updates selected position */
+              fSelectedZ = vObjectPos.fZ;
+            }
           }
         }
       }
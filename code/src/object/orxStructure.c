@@ -473,7 +473,7 @@ orxSTATUS orxFASTCALL orxStructure_Register(orxSTRUCTURE_ID _eStructureID, orxST
   if(sstStructure.astInfo[_eStructureID].u32Size == 0)
   {
     /* Creates associated bank */
-    sstStructure.astStorage[_eStructureID].pstStructureBank = orxBank_Create(_u32BankSize, _u32Size, orxBANK_KU32_FLAG_NONE, _eMemoryType);
+    sstStructure.astStorage[_eStructureID].pstStructureBank = orxBank_Create(_u32BankSize, _u32Size, orxBANK_KU32_FLAG_RELEASE_SEGMENTS, _eMemoryType);
 
     /* Valid? */
     if(sstStructure.astStorage[_eStructureID].pstStructureBank != orxNULL)
@@ -573,8 +573,8 @@ orxSTRUCTURE *orxFASTCALL orxStructure_Create(orxSTRUCTURE_ID _eStructureID)
       {
         case orxSTRUCTURE_STORAGE_TYPE_LINKLIST:
         {
-          /* Has a previous element? */
-          if(pstPrevious != orxNULL)
+          /* Has a previous element that isn't hidden? */
+          if((pstPrevious != orxNULL) && (orxLinkList_GetList(&(pstPrevious->stStorage.stLinkListNode)) != orxNULL))
           {
             /* Adds it to list */
             eResult = orxLinkList_AddAfter(&(pstPrevious->stStorage.stLinkListNode), &(pstStructure->stStorage.stLinkListNode));
@@ -688,8 +688,12 @@ orxSTATUS orxFASTCALL orxStructure_Delete(void *_pStructure)
   {
     case orxSTRUCTURE_STORAGE_TYPE_LINKLIST:
     {
-      /* Removes node from list */
-      orxLinkList_Remove(&(pstStructure->stStorage.stLinkListNode));
+      /* Not hidden? */
+      if(orxLinkList_GetList(&(pstStructure->stStorage.stLinkListNode)) != orxNULL)
+      {
+        /* Removes node from list */
+        orxLinkList_Remove(&(pstStructure->stStorage.stLinkListNode));
+      }
 
       break;
     }
@@ -725,6 +729,100 @@ orxSTATUS orxFASTCALL orxStructure_Delete(void *_pStructure)
   return orxSTATUS_SUCCESS;
 }
 
+/** Renews a structure's GUID, all the GUIDs previously retrieved for this structure will become invalid
+ * @param[in]   _pStructure    Concerned structure
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxStructure_RenewGUID(void *_pStructure)
+{
+  orxSTRUCTURE_ID eStructureID;
+  orxSTRUCTURE   *pstStructure;
+
+  /* Checks */
+  orxASSERT(sstStructure.u32Flags & orxSTRUCTURE_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pStructure);
+
+  /* Gets structure */
+  pstStructure = orxSTRUCTURE(_pStructure);
+
+  /* Gets structure ID */
+  eStructureID = orxStructure_GetID(pstStructure);
+
+  /* Updates instance ID */
+  sstStructure.au32InstanceCount[eStructureID] = (sstStructure.au32InstanceCount[eStructureID] + 1) & (orxSTRUCTURE_GUID_MASK_INSTANCE_ID >> orxSTRUCTURE_GUID_SHIFT_INSTANCE_ID);
+
+  /* Stores new GUID, keeping structure & item IDs */
+  pstStructure->u64GUID = (pstStructure->u64GUID & ~orxSTRUCTURE_GUID_MASK_INSTANCE_ID)
+                        | ((orxU64)sstStructure.au32InstanceCount[eStructureID] << orxSTRUCTURE_GUID_SHIFT_INSTANCE_ID);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Hides a structure from its storage or shows it back: hidden structures are skipped by orxStructure_GetFirst/GetLast/GetNext/GetPrevious and aren't counted by orxStructure_GetCount, only works with link list storage
+ * @param[in]   _pStructure    Concerned structure
+ * @param[in]   _bHide         Hide / show it back
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxStructure_Hide(void *_pStructure, orxBOOL _bHide)
+{
+  orxSTRUCTURE_ID eStructureID;
+  orxSTRUCTURE   *pstStructure;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstStructure.u32Flags & orxSTRUCTURE_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pStructure);
+
+  /* Gets structure */
+  pstStructure = orxSTRUCTURE(_pStructure);
+
+  /* Gets structure ID */
+  eStructureID = orxStructure_GetID(pstStructure);
+
+  /* Link list storage? */
+  if(sstStructure.astStorage[eStructureID].eType == orxSTRUCTURE_STORAGE_TYPE_LINKLIST)
+  {
+    /* Hide? */
+    if(_bHide != orxFALSE)
+    {
+      /* Not already hidden? */
+      if(orxLinkList_GetList(&(pstStructure->stStorage.stLinkListNode)) != orxNULL)
+      {
+        /* Removes node from list */
+        eResult = orxLinkList_Remove(&(pstStructure->stStorage.stLinkListNode));
+      }
+      else
+      {
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+    }
+    else
+    {
+      /* Hidden? */
+      if(orxLinkList_GetList(&(pstStructure->stStorage.stLinkListNode)) == orxNULL)
+      {
+        /* Adds it back to list */
+        eResult = orxLinkList_AddStart(&(sstStructure.astStorage[eStructureID].stLinkList), &(pstStructure->stStorage.stLinkListNode));
+      }
+      else
+      {
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Can't hide structure: only link list storage is supported.");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Gets structure storage type
  * @param[in]   _eStructureID   Concerned structure ID
  * @return      orxSTRUCTURE_STORAGE_TYPE
@@ -676,6 +676,131 @@ orxSTATUS orxFASTCALL orxBody_Delete(orxBODY *_pstBody)
   return eResult;
 }
 
+/** Resets a body created from config to its config state (dynamic, fixed rotation, allow moving, damping, custom gravity & parts), speeds are cleared. Parts are kept and get their properties restored, unless the config part list changed
+ * @param[in]   _pstBody        Concerned body
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxBody_ResetFromConfig(orxBODY *_pstBody)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(sstBody.u32Flags & orxBODY_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstBody);
+
+  /* Has reference and pushes its section? */
+  if((_pstBody->zReference != orxNULL)
+  && (orxConfig_PushSection(_pstBody->zReference) != orxSTATUS_FAILURE))
+  {
+    orxBODY_PART *pstBodyPart;
+    orxVECTOR     vGravity;
+    orxU32        i, u32SlotCount;
+    orxBOOL       bKeepParts;
+
+    /* Restores its properties */
+    orxBody_SetDynamic(_pstBody, orxConfig_GetBool(orxBODY_KZ_CONFIG_DYNAMIC));
+    orxBody_SetFixedRotation(_pstBody, orxConfig_GetBool(orxBODY_KZ_CONFIG_FIXED_ROTATION));
+    orxBody_SetAllowMoving(_pstBody, ((orxConfig_HasValue(orxBODY_KZ_CONFIG_ALLOW_MOVING) == orxFALSE) || (orxConfig_GetBool(orxBODY_KZ_CONFIG_ALLOW_MOVING) != orxFALSE)) ? orxTRUE : orxFALSE);
+    orxBody_SetLinearDamping(_pstBody, orxConfig_GetFloat(orxBODY_KZ_CONFIG_LINEAR_DAMPING));
+    orxBody_SetAngularDamping(_pstBody, orxConfig_GetFloat(orxBODY_KZ_CONFIG_ANGULAR_DAMPING));
+    orxBody_SetCustomGravity(_pstBody, (orxConfig_HasValue(orxBODY_KZ_CONFIG_CUSTOM_GRAVITY) != orxFALSE) ? orxConfig_GetVector(orxBODY_KZ_CONFIG_CUSTOM_GRAVITY, &vGravity) : orxNULL);
+    orxBody_SetSpeed(_pstBody, &orxVECTOR_0);
+    orxBody_SetAngularVelocity(_pstBody, orxFLOAT_0);
+
+    /* Gets number of declared slots */
+    u32SlotCount = orxConfig_GetListCount(orxBODY_KZ_CONFIG_PART_LIST);
+
+    /* For all current parts */
+    for(pstBodyPart = orxBody_GetNextPart(_pstBody, orxNULL), i = 0, bKeepParts = orxTRUE;
+        (pstBodyPart != orxNULL) && (bKeepParts != orxFALSE);
+        pstBodyPart = orxBody_GetNextPart(_pstBody, pstBodyPart), i++)
+    {
+      /* Doesn't match its slot anymore? */
+      if((i >= u32SlotCount)
+      || (orxString_Compare(orxBody_GetPartName(pstBodyPart), orxConfig_GetListString(orxBODY_KZ_CONFIG_PART_LIST, i)) != 0))
+      {
+        /* Updates status */
+        bKeepParts = orxFALSE;
+      }
+    }
+
+    /* Has missing parts? */
+    if((i < u32SlotCount) && (*orxConfig_GetListString(orxBODY_KZ_CONFIG_PART_LIST, i) != orxCHAR_NULL))
+    {
+      /* Updates status */
+      bKeepParts = orxFALSE;
+    }
+
+    /* Can keep parts? */
+    if(bKeepParts != orxFALSE)
+    {
+      /* For all parts */
+      for(pstBodyPart = orxBody_GetNextPart(_pstBody, orxNULL);
+          pstBodyPart != orxNULL;
+          pstBodyPart = orxBody_GetNextPart(_pstBody, pstBodyPart))
+      {
+        /* Pushes its section */
+        orxConfig_PushSection(orxBody_GetPartName(pstBodyPart));
+
+        /* Restores its properties, they may have been modified at runtime */
+        orxBody_SetPartFriction(pstBodyPart, orxConfig_GetFloat(orxBODY_KZ_CONFIG_FRICTION));
+        orxBody_SetPartRestitution(pstBodyPart, orxConfig_GetFloat(orxBODY_KZ_CONFIG_RESTITUTION));
+        orxBody_SetPartDensity(pstBodyPart, (orxConfig_HasValue(orxBODY_KZ_CONFIG_DENSITY) != orxFALSE) ? orxConfig_GetFloat(orxBODY_KZ_CONFIG_DENSITY) : orxFLOAT_1);
+        orxBody_SetPartSelfFlags(pstBodyPart, orxBody_GetCollisionFlag(orxBODY_KZ_CONFIG_SELF_FLAGS));
+        orxBody_SetPartCheckMask(pstBodyPart, orxBody_GetCollisionFlag(orxBODY_KZ_CONFIG_CHECK_MASK));
+        orxBody_SetPartSolid(pstBodyPart, orxConfig_GetBool(orxBODY_KZ_CONFIG_SOLID));
+
+        /* Pops previous section */
+        orxConfig_PopSection();
+      }
+    }
+    else
+    {
+      /* For all parts */
+      for(pstBodyPart = (orxBODY_PART *)orxLinkList_GetFirst(&(_pstBody->stPartList));
+          pstBodyPart != orxNULL;
+          pstBodyPart = (orxBODY_PART *)orxLinkList_GetFirst(&(_pstBody->stPartList)))
+      {
+        /* Removes it: part list doesn't match config anymore */
+        orxBody_RemovePart(pstBodyPart);
+      }
+
+      /* For all parts */
+      for(i = 0; i < u32SlotCount; i++)
+      {
+        const orxSTRING zPartName;
+
+        /* Gets its name */
+        zPartName = orxConfig_GetListString(orxBODY_KZ_CONFIG_PART_LIST, i);
+
+        /* Valid? */
+        if((zPartName != orxNULL) && (zPartName != orxSTRING_EMPTY))
+        {
+          /* Adds part */
+          if(orxBody_AddPartFromConfig(_pstBody, zPartName) == orxNULL)
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_PHYSICS, "[%s]: Couldn't add part <%s> for this body: too many parts or invalid part.", _pstBody->zReference, zPartName);
+          }
+        }
+        else
+        {
+          break;
+        }
+      }
+    }
+
+    /* Pops previous section */
+    orxConfig_PopSection();
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Gets body config name
  * @param[in]   _pstBody        Concerned body
  * @return      orxSTRING / orxSTRING_EMPTY
@@ -863,87 +863,94 @@ static orxSTATUS orxFASTCALL orxSound_EventHandler(const orxEVENT *_pstEvent)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
 
-  /* Resource event? */
-  if(_pstEvent->eType == orxEVENT_TYPE_RESOURCE)
+  /* Config event? */
+  if(_pstEvent->eType == orxEVENT_TYPE_CONFIG)
   {
-    orxRESOURCE_EVENT_PAYLOAD *pstPayload;
+    orxCONFIG_EVENT_PAYLOAD  *pstPayload;
+    orxSOUND                 *pstSound;
+
+    /* Checks */
+    orxASSERT(_pstEvent->eID == orxCONFIG_EVENT_SECTION_UPDATE);
 
     /* Gets payload */
-    pstPayload = (orxRESOURCE_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+    pstPayload = (orxCONFIG_EVENT_PAYLOAD *)_pstEvent->pstPayload;
 
-    /* Is config group? */
-    if(pstPayload->stGroupID == orxString_Hash(orxCONFIG_KZ_RESOURCE_GROUP))
+    /* For all sounds */
+    for(pstSound = orxSOUND(orxStructure_GetFirst(orxSTRUCTURE_ID_SOUND));
+        pstSound != orxNULL;
+        pstSound = orxSOUND(orxStructure_GetNext(pstSound)))
     {
-      orxSOUND *pstSound;
-
-      /* For all sounds */
-      for(pstSound = orxSOUND(orxStructure_GetFirst(orxSTRUCTURE_ID_SOUND));
-          pstSound != orxNULL;
-          pstSound = orxSOUND(orxStructure_GetNext(pstSound)))
+      /* Has reference? */
+      if((pstSound->zReference != orxNULL) && (pstSound->zReference != orxSTRING_EMPTY))
       {
-        /* Has reference? */
-        if((pstSound->zReference != orxNULL) && (pstSound->zReference != orxSTRING_EMPTY))
+        /* Is its section or one of its ancestors updated? */
+        if(orxConfig_IsSectionAffected(pstSound->zReference, pstPayload->zSectionName) != orxFALSE)
         {
-          /* Matches? */
-          if(orxConfig_GetOriginID(pstSound->zReference) == pstPayload->stNameID)
-          {
-            orxSOUND_STATUS eStatus;
-            orxFLOAT        fTime;
+          orxSOUND_STATUS eStatus;
+          orxFLOAT        fTime;
 
-            /* Gets current status */
-            eStatus = orxSound_GetStatus(pstSound);
+          /* Gets current status */
+          eStatus = orxSound_GetStatus(pstSound);
 
-            /* Gets current time */
-            fTime = orxSound_GetTime(pstSound);
+          /* Gets current time */
+          fTime = orxSound_GetTime(pstSound);
 
-            /* Stops sound */
-            orxSound_Stop(pstSound);
+          /* Stops sound */
+          orxSound_Stop(pstSound);
 
-            /* Re-processes its config data */
-            orxSound_ProcessConfigData(pstSound, orxFALSE);
+          /* Re-processes its config data */
+          orxSound_ProcessConfigData(pstSound, orxFALSE);
 
-            /* Has stream? */
-            if(orxStructure_TestFlags(pstSound, orxSOUND_KU32_FLAG_HAS_STREAM))
-            {
-              /* Restores time */
-              orxSound_SetTime(pstSound, fTime);
-            }
+          /* Has stream? */
+          if(orxStructure_TestFlags(pstSound, orxSOUND_KU32_FLAG_HAS_STREAM))
+          {
+            /* Restores time */
+            orxSound_SetTime(pstSound, fTime);
+          }
 
-            /* Depending on previous status */
-            switch(eStatus)
+          /* Depending on previous status */
+          switch(eStatus)
+          {
+            case orxSOUND_STATUS_PLAY:
             {
-              case orxSOUND_STATUS_PLAY:
-              {
-                /* Updates sound */
-                orxSound_Play(pstSound);
+              /* Updates sound */
+              orxSound_Play(pstSound);
 
-                break;
-              }
+              break;
+            }
 
-              case orxSOUND_STATUS_PAUSE:
-              {
-                /* Updates sound */
-                orxSound_Play(pstSound);
-                orxSound_Pause(pstSound);
+            case orxSOUND_STATUS_PAUSE:
+            {
+              /* Updates sound */
+              orxSound_Play(pstSound);
+              orxSound_Pause(pstSound);
 
-                break;
-              }
+              break;
+            }
 
-              case orxSOUND_STATUS_STOP:
-              default:
-              {
-                /* Updates sound */
-                orxSound_Stop(pstSound);
+            case orxSOUND_STATUS_STOP:
+            default:
+            {
+              /* Updates sound */
+              orxSound_Stop(pstSound);
 
-                break;
-              }
+              break;
             }
           }
         }
       }
     }
+  }
+  /* Resource event? */
+  else if(_pstEvent->eType == orxEVENT_TYPE_RESOURCE)
+  {
+    orxRESOURCE_EVENT_PAYLOAD *pstPayload;
+
+    /* Gets payload */
+    pstPayload = (orxRESOURCE_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+
     /* Is sound group? */
-    else if(pstPayload->stGroupID == orxString_Hash(orxSOUND_KZ_RESOURCE_GROUP))
+    if(pstPayload->stGroupID == orxString_Hash(orxSOUND_KZ_RESOURCE_GROUP))
     {
       orxHANDLE         hIterator;
       orxSOUND_SAMPLE  *pstSample;
@@ -2084,8 +2091,10 @@ orxSTATUS orxFASTCALL orxSound_Init()
               /* Adds event handlers */
               orxEvent_AddHandler(orxEVENT_TYPE_LOCALE, orxSound_EventHandler);
               orxEvent_AddHandler(orxEVENT_TYPE_RESOURCE, orxSound_EventHandler);
+              orxEvent_AddHandler(orxEVENT_TYPE_CONFIG, orxSound_EventHandler);
               orxEvent_SetHandlerIDFlags(orxSound_EventHandler, orxEVENT_TYPE_LOCALE, orxNULL, orxEVENT_GET_FLAG(orxLOCALE_EVENT_SELECT_LANGUAGE), orxEVENT_KU32_MASK_ID_ALL);
               orxEvent_SetHandlerIDFlags(orxSound_EventHandler, orxEVENT_TYPE_RESOURCE, orxNULL, orxEVENT_GET_FLAG(orxRESOURCE_EVENT_ADD) | orxEVENT_GET_FLAG(orxRESOURCE_EVENT_UPDATE), orxEVENT_KU32_MASK_ID_ALL);
+              orxEvent_SetHandlerIDFlags(orxSound_EventHandler, orxEVENT_TYPE_CONFIG, orxNULL, orxEVENT_GET_FLAG(orxCONFIG_EVENT_SECTION_UPDATE), orxEVENT_KU32_MASK_ID_ALL);
 
               /* Inits Flags */
               orxFLAG_SET(sstSound.u32Flags, orxSOUND_KU32_STATIC_FLAG_READY, orxSOUND_KU32_STATIC_FLAG_NONE);
@@ -2177,6 +2186,7 @@ void orxFASTCALL orxSound_Exit()
     orxSound_UnregisterCommands();
 
     /* Removes event handlers */
+    orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, orxSound_EventHandler);
     orxEvent_RemoveHandler(orxEVENT_TYPE_RESOURCE, orxSound_EventHandler);
     orxEvent_RemoveHandler(orxEVENT_TYPE_LOCALE, orxSound_EventHandler);
 
@@ -37,6 +37,21 @@
 #include "debug/orxProfiler.h"
 #include "utils/orxString.h"
 
+#ifdef __orxSSE2__
+
+  #include <emmintrin.h>
+
+#endif /* __orxSSE2__ */
+
+
+/** Misc defines
+ */
+#define orxHASHTABLE_KU32_GROUP_SIZE            16          /**< Open addressing probe group size */
+
+#define orxHASHTABLE_KU8_CONTROL_EMPTY          0x80        /**< Empty slot control byte */
+#define orxHASHTABLE_KU8_CONTROL_DELETED        0xFE        /**< Deleted slot control byte */
+#define orxHASHTABLE_KU8_CONTROL_MASK_HASH      0x7F        /**< Control byte hash mask */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -51,6 +66,14 @@ typedef struct __orxHASHTABLE_CELL_t
 
 } orxHASHTABLE_CELL;
 
+/** Hash table slot definition (open addressing) */
+typedef struct __orxHASHTABLE_SLOT_t
+{
+  orxU64                        u64Key;                       /**< Key element of a hash table : 8 / 8 */
+  void                         *pData;                        /**< Address of data : 12 / 16 */
+
+} orxHASHTABLE_SLOT;
+
 /** Hash Table */
 #ifdef __orxMSVC__
   #pragma warning(push)
@@ -60,8 +83,13 @@ typedef struct __orxHASHTABLE_CELL_t
 struct __orxHASHTABLE_t
 {
   orxBANK            *pstBank;                                /**< Bank where are stored cells : 4 / 8 */
-  orxU32              u32Count;                               /**< Hashtable item count : 8 / 12 */
-  orxU32              u32Size;                                /**< Hashtable size : 12 / 16 */
+  orxHASHTABLE_SLOT  *astSlot;                                /**< Slots (open addressing) : 8 / 16 */
+  orxU8              *au8Control;                             /**< Slot control bytes (open addressing) : 12 / 24 */
+  orxU32              u32Count;                               /**< Hashtable item count : 16 / 28 */
+  orxU32              u32Size;                                /**< Hashtable size : 20 / 32 */
+  orxU32              u32DeletedCount;                        /**< Deleted slot count (open addressing) : 24 / 36 */
+  orxU32              u32Flags;                               /**< Flags : 28 / 40 */
+  orxMEMORY_TYPE      eMemType;                               /**< Memory type : 32 / 44 */
   orxHASHTABLE_CELL  *apstCell[0];                            /**< Hash table */
 };
 
@@ -92,6 +120,294 @@ static orxINLINE orxU32 orxHashTable_FindIndex(const orxHASHTABLE *_pstHashTable
   return((orxU32)_u64Key & (_pstHashTable->u32Size - 1));
 }
 
+/** Mixes a key (open addressing): low 7 bits are stored in control bytes, the remaining ones select the probe group
+ * @param[in] _u64Key           Key to mix
+ * @return Mixed key
+ */
+static orxINLINE orxU64 orxHashTable_MixKey(orxU64 _u64Key)
+{
+  orxU64 u64Result;
+
+  /* Mixes bits (fmix64) */
+  u64Result   = _u64Key ^ (_u64Key >> 33);
+  u64Result  *= 0xFF51AFD7ED558CCDULL;
+  u64Result  ^= u64Result >> 33;
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Matches a probe group's control bytes against a value
+ * @param[in] _au8Control       Group control bytes
+ * @param[in] _u8Value          Value to match
+ * @return Bit mask of matching slots
+ */
+static orxINLINE orxU32 orxHashTable_MatchGroup(const orxU8 *_au8Control, orxU8 _u8Value)
+{
+  orxU32 u32Result;
+
+#ifdef __orxSSE2__
+
+  /* Compares all bytes at once */
+  u32Result = (orxU32)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)_au8Control), _mm_set1_epi8((char)_u8Value)));
+
+#else /* __orxSSE2__ */
+
+  orxU32 i;
+
+  /* For all bytes */
+  for(i = 0, u32Result = 0; i < orxHASHTABLE_KU32_GROUP_SIZE; i++)
+  {
+    /* Match? */
+    if(_au8Control[i] == _u8Value)
+    {
+      /* Updates result */
+      u32Result |= 1 << i;
+    }
+  }
+
+#endif /* __orxSSE2__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Matches a probe group's free slots (empty or deleted)
+ * @param[in] _au8Control       Group control bytes
+ * @return Bit mask of free slots
+ */
+static orxINLINE orxU32 orxHashTable_MatchGroupFree(const orxU8 *_au8Control)
+{
+  orxU32 u32Result;
+
+#ifdef __orxSSE2__
+
+  /* Gets all high bits at once */
+  u32Result = (orxU32)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)_au8Control));
+
+#else /* __orxSSE2__ */
+
+  orxU32 i;
+
+  /* For all bytes */
+  for(i = 0, u32Result = 0; i < orxHASHTABLE_KU32_GROUP_SIZE; i++)
+  {
+    /* Free? */
+    if(_au8Control[i] & orxHASHTABLE_KU8_CONTROL_EMPTY)
+    {
+      /* Updates result */
+      u32Result |= 1 << i;
+    }
+  }
+
+#endif /* __orxSSE2__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Finds a key's slot (open addressing)
+ * @param[in] _pstHashTable     Concerned hash table
+ * @param[in] _u64Key           Key to find
+ * @return Slot index if found, orxU32_UNDEFINED otherwise
+ */
+static orxINLINE orxU32 orxHashTable_FindSlot(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
+{
+  orxU64  u64Hash;
+  orxU32  u32GroupMask, u32Group, i, u32Result = orxU32_UNDEFINED;
+  orxU8   u8Hash;
+
+  /* Gets hash */
+  u64Hash       = orxHashTable_MixKey(_u64Key);
+  u8Hash        = (orxU8)(u64Hash & orxHASHTABLE_KU8_CONTROL_MASK_HASH);
+  u32GroupMask  = (_pstHashTable->u32Size / orxHASHTABLE_KU32_GROUP_SIZE) - 1;
+  u32Group      = (orxU32)(u64Hash >> 7) & u32GroupMask;
+
+  /* For all groups in probe sequence (triangular, visits all groups) */
+  for(i = 0; i <= u32GroupMask; i++, u32Group = (u32Group + i) & u32GroupMask)
+  {
+    const orxU8  *au8Control;
+    orxU32        u32Match;
+
+    /* Gets group control bytes */
+    au8Control = _pstHashTable->au8Control + (u32Group * orxHASHTABLE_KU32_GROUP_SIZE);
+
+    /* For all hash matches */
+    for(u32Match = orxHashTable_MatchGroup(au8Control, u8Hash); u32Match != 0; u32Match &= u32Match - 1)
+    {
+      orxU32 u32Slot;
+
+      /* Gets slot */
+      u32Slot = (u32Group * orxHASHTABLE_KU32_GROUP_SIZE) + orxMath_GetTrailingZeroCount(u32Match);
+
+      /* Found? */
+      if(_pstHashTable->astSlot[u32Slot].u64Key == _u64Key)
+      {
+        /* Updates result */
+        u32Result = u32Slot;
+        break;
+      }
+    }
+
+    /* Found or group has an empty slot (end of probe sequence)? */
+    if((u32Result != orxU32_UNDEFINED)
+    || (orxHashTable_MatchGroup(au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY) != 0))
+    {
+      break;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Inserts a key that isn't present yet in the slots (open addressing, no resize)
+ * @param[in] _pstHashTable     Concerned hash table
+ * @param[in] _u64Key           Key to insert
+ * @param[in] _pData            Data to insert
+ * @return Slot index
+ */
+static orxINLINE orxU32 orxHashTable_InsertSlot(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
+{
+  orxU64  u64Hash;
+  orxU32  u32GroupMask, u32Group, u32Match, u32Result;
+
+  /* Gets hash */
+  u64Hash       = orxHashTable_MixKey(_u64Key);
+  u32GroupMask  = (_pstHashTable->u32Size / orxHASHTABLE_KU32_GROUP_SIZE) - 1;
+  u32Group      = (orxU32)(u64Hash >> 7) & u32GroupMask;
+
+  /* Finds first group with a free slot (there's always one as load is capped) */
+  for(u32Match = orxHashTable_MatchGroupFree(_pstHashTable->au8Control + (u32Group * orxHASHTABLE_KU32_GROUP_SIZE)), u32Result = 1;
+      u32Match == 0;
+      u32Group = (u32Group + u32Result++) & u32GroupMask, u32Match = orxHashTable_MatchGroupFree(_pstHashTable->au8Control + (u32Group * orxHASHTABLE_KU32_GROUP_SIZE)))
+  ;
+
+  /* Gets slot */
+  u32Result = (u32Group * orxHASHTABLE_KU32_GROUP_SIZE) + orxMath_GetTrailingZeroCount(u32Match);
+
+  /* Was deleted? */
+  if(_pstHashTable->au8Control[u32Result] == orxHASHTABLE_KU8_CONTROL_DELETED)
+  {
+    /* Updates deleted count */
+    _pstHashTable->u32DeletedCount--;
+  }
+
+  /* Stores it */
+  _pstHashTable->au8Control[u32Result]        = (orxU8)(u64Hash & orxHASHTABLE_KU8_CONTROL_MASK_HASH);
+  _pstHashTable->astSlot[u32Result].u64Key    = _u64Key;
+  _pstHashTable->astSlot[u32Result].pData     = _pData;
+
+  /* Updates count */
+  _pstHashTable->u32Count++;
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Resizes slots (open addressing), also purges deleted slots
+ * @param[in] _pstHashTable     Concerned hash table
+ * @param[in] _u32Size          New size (power of two, multiple of group size)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_ResizeSlots(orxHASHTABLE *_pstHashTable, orxU32 _u32Size)
+{
+  orxHASHTABLE_SLOT  *astSlot;
+  orxSTATUS           eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxMath_IsPowerOfTwo(_u32Size) != orxFALSE);
+  orxASSERT(_u32Size >= orxHASHTABLE_KU32_GROUP_SIZE);
+
+  /* Allocates slots & control bytes */
+  astSlot = (orxHASHTABLE_SLOT *)orxMemory_Allocate(_u32Size * (sizeof(orxHASHTABLE_SLOT) + sizeof(orxU8)), _pstHashTable->eMemType);
+
+  /* Success? */
+  if(astSlot != orxNULL)
+  {
+    orxHASHTABLE_SLOT  *astOldSlot;
+    orxU8              *au8OldControl;
+    orxU32              u32OldSize, i;
+
+    /* Backups old slots */
+    astOldSlot    = _pstHashTable->astSlot;
+    au8OldControl = _pstHashTable->au8Control;
+    u32OldSize    = _pstHashTable->u32Size;
+
+    /* Stores new slots */
+    _pstHashTable->astSlot          = astSlot;
+    _pstHashTable->au8Control       = (orxU8 *)(astSlot + _u32Size);
+    _pstHashTable->u32Size          = _u32Size;
+    _pstHashTable->u32Count         = 0;
+    _pstHashTable->u32DeletedCount  = 0;
+
+    /* Clears control bytes */
+    orxMemory_Set(_pstHashTable->au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY, _u32Size);
+
+    /* Had old slots? */
+    if(astOldSlot != orxNULL)
+    {
+      /* For all old slots */
+      for(i = 0; i < u32OldSize; i++)
+      {
+        /* Used? */
+        if(!(au8OldControl[i] & orxHASHTABLE_KU8_CONTROL_EMPTY))
+        {
+          /* Reinserts it */
+          orxHashTable_InsertSlot(_pstHashTable, astOldSlot[i].u64Key, astOldSlot[i].pData);
+        }
+      }
+
+      /* Frees them */
+      orxMemory_Free(astOldSlot);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds a key that isn't present yet (open addressing), growing slots if needed
+ * @param[in] _pstHashTable     Concerned hash table
+ * @param[in] _u64Key           Key to add
+ * @param[in] _pData            Data to add
+ * @return Slot index if added, orxU32_UNDEFINED otherwise
+ */
+static orxU32 orxFASTCALL orxHashTable_AddSlot(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
+{
+  orxU32 u32Result = orxU32_UNDEFINED;
+
+  /* Above max load (7/8)? */
+  if((_pstHashTable->u32Count + _pstHashTable->u32DeletedCount + 1) * 8 > _pstHashTable->u32Size * 7)
+  {
+    /* Mostly deleted slots? */
+    if((_pstHashTable->u32Count + 1) * 16 <= _pstHashTable->u32Size * 7)
+    {
+      /* Purges them */
+      orxHashTable_ResizeSlots(_pstHashTable, _pstHashTable->u32Size);
+    }
+    /* Expandable? */
+    else if(!orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE))
+    {
+      /* Grows */
+      orxHashTable_ResizeSlots(_pstHashTable, _pstHashTable->u32Size << 1);
+    }
+  }
+
+  /* Has room? */
+  if((_pstHashTable->u32Count + _pstHashTable->u32DeletedCount + 1) * 8 <= _pstHashTable->u32Size * 7)
+  {
+    /* Inserts it */
+    u32Result = orxHashTable_InsertSlot(_pstHashTable, _u64Key, _pData);
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
 /***************************************************************************
  * Public functions                                                        *
  ***************************************************************************/
@@ -107,50 +423,79 @@ static orxINLINE orxU32 orxHashTable_FindIndex(const orxHASHTABLE *_pstHashTable
 orxHASHTABLE *orxFASTCALL orxHashTable_Create(orxU32 _u32NbKey, orxU32 _u32Flags, orxMEMORY_TYPE _eMemType)
 {
   orxHASHTABLE *pstHashTable;
-  orxU32        u32Size;
+  orxU32        u32Size, u32CellNumber;
 
   /* Checks */
   orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
   orxASSERT(_u32NbKey > 0);
 
-  /* Gets Power of Two size */
-  u32Size = orxMath_GetNextPowerOfTwo(_u32NbKey);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Gets Power of Two size, keeping load under 7/8 */
+    u32Size       = orxMAX(orxMath_GetNextPowerOfTwo(_u32NbKey + (_u32NbKey / 7) + 1), orxHASHTABLE_KU32_GROUP_SIZE);
+    u32CellNumber = 0;
+  }
+  else
+  {
+    /* Gets Power of Two size */
+    u32Size       = orxMath_GetNextPowerOfTwo(_u32NbKey);
+    u32CellNumber = u32Size;
+  }
 
   /* Allocate memory for a hash table */
-  pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)), _eMemType);
+  pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE) + (u32CellNumber * sizeof(orxHASHTABLE_CELL *)), _eMemType);
 
   /* Enough memory ? */
   if(pstHashTable != orxNULL)
   {
-    orxU32 u32Flags;
+    /* Clean values */
+    orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE) + (u32CellNumber * sizeof(orxHASHTABLE_CELL *)));
+
+    /* Stores flags & memory type */
+    pstHashTable->u32Flags  = _u32Flags;
+    pstHashTable->eMemType  = _eMemType;
 
-    /* Set flags */
-    if(_u32Flags == orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE)
+    /* Open addressing? */
+    if(orxFLAG_TEST(_u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
     {
-      u32Flags = orxBANK_KU32_FLAG_NOT_EXPANDABLE;
+      /* Can't allocate slots? */
+      if(orxHashTable_ResizeSlots(pstHashTable, u32Size) == orxSTATUS_FAILURE)
+      {
+        /* Allocation problem, returns orxNULL */
+        orxMemory_Free(pstHashTable);
+        pstHashTable = orxNULL;
+      }
     }
     else
     {
-      u32Flags = orxBANK_KU32_FLAG_NONE;
-    }
+      orxU32 u32Flags;
 
-    /* Clean values */
-    orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)));
+      /* Set flags */
+      if(orxFLAG_TEST(_u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE))
+      {
+        u32Flags = orxBANK_KU32_FLAG_NOT_EXPANDABLE;
+      }
+      else
+      {
+        u32Flags = orxBANK_KU32_FLAG_NONE;
+      }
 
-    /* Allocate bank for cells */
-    pstHashTable->pstBank = orxBank_Create(u32Size, sizeof(orxHASHTABLE_CELL), u32Flags, _eMemType);
+      /* Allocate bank for cells */
+      pstHashTable->pstBank = orxBank_Create(u32Size, sizeof(orxHASHTABLE_CELL), u32Flags, _eMemType);
 
-    /* Correct bank allocation ? */
-    if(pstHashTable->pstBank != orxNULL)
-    {
-      /* Stores its size */
-      pstHashTable->u32Size = u32Size;
-    }
-    else
-    {
-      /* Allocation problem, returns orxNULL */
-      orxMemory_Free(pstHashTable);
-      pstHashTable = orxNULL;
+      /* Correct bank allocation ? */
+      if(pstHashTable->pstBank != orxNULL)
+      {
+        /* Stores its size */
+        pstHashTable->u32Size = u32Size;
+      }
+      else
+      {
+        /* Allocation problem, returns orxNULL */
+        orxMemory_Free(pstHashTable);
+        pstHashTable = orxNULL;
+      }
     }
   }
 
@@ -166,11 +511,20 @@ orxSTATUS orxFASTCALL orxHashTable_Delete(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear hash table (unallocate cells) */
-  orxHashTable_Clear(_pstHashTable);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Frees slots */
+    orxMemory_Free(_pstHashTable->astSlot);
+  }
+  else
+  {
+    /* Clear hash table (unallocate cells) */
+    orxHashTable_Clear(_pstHashTable);
 
-  /* Free bank */
-  orxBank_Delete(_pstHashTable->pstBank);
+    /* Free bank */
+    orxBank_Delete(_pstHashTable->pstBank);
+  }
 
   /* Unallocate memory */
   orxMemory_Free(_pstHashTable);
@@ -188,11 +542,23 @@ orxSTATUS orxFASTCALL orxHashTable_Clear(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear the memory bank */
-  orxBank_Clear(_pstHashTable->pstBank);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Clears control bytes */
+    orxMemory_Set(_pstHashTable->au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY, _pstHashTable->u32Size);
 
-  /* Clear the hash */
-  orxMemory_Zero(_pstHashTable->apstCell, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CELL *));
+    /* Clears deleted count */
+    _pstHashTable->u32DeletedCount = 0;
+  }
+  else
+  {
+    /* Clear the memory bank */
+    orxBank_Clear(_pstHashTable->pstBank);
+
+    /* Clear the hash */
+    orxMemory_Zero(_pstHashTable->apstCell, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CELL *));
+  }
 
   /* Clears count */
   _pstHashTable->u32Count = 0;
@@ -228,8 +594,7 @@ orxU32 orxFASTCALL orxHashTable_GetCount(const orxHASHTABLE *_pstHashTable)
  */
 void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell = orxNULL;
+  void *pResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Get");
@@ -237,20 +602,40 @@ void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxU32 u32Slot;
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Finds the corresponding slot */
+    u32Slot = orxHashTable_FindSlot(_pstHashTable, _u64Key);
+
+    /* Updates result */
+    pResult = (u32Slot != orxU32_UNDEFINED) ? _pstHashTable->astSlot[u32Slot].pData : orxNULL;
+  }
+  else
+  {
+    orxU32              u32Index;
+    orxHASHTABLE_CELL  *pstCell = orxNULL;
+
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
+
+    /* Updates result */
+    pResult = (pstCell != orxNULL) ? pstCell->pData : orxNULL;
+  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
   /* Done! */
-  return (pstCell != orxNULL) ? pstCell->pData : orxNULL;
+  return pResult;
 }
 
 /** Retrieves the bucket of an item in a hash table, if the item wasn't present, a new bucket will be created.
@@ -260,9 +645,7 @@ void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u6
  */
 void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
-  void              **ppResult;
+  void **ppResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Retrieve");
@@ -270,49 +653,73 @@ void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxU32 u32Slot;
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Finds the corresponding slot */
+    u32Slot = orxHashTable_FindSlot(_pstHashTable, _u64Key);
+
+    /* Not found? */
+    if(u32Slot == orxU32_UNDEFINED)
+    {
+      /* Adds it */
+      u32Slot = orxHashTable_AddSlot(_pstHashTable, _u64Key, orxNULL);
+    }
 
-  /* Not found ? */
-  if(pstCell == orxNULL)
+    /* Updates result */
+    ppResult = (u32Slot != orxU32_UNDEFINED) ? &(_pstHashTable->astSlot[u32Slot].pData) : orxNULL;
+  }
+  else
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+    orxU32              u32Index;
+    orxHASHTABLE_CELL  *pstCell;
 
-    /* Success? */
-    if(pstCell != orxNULL)
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
+
+    /* Not found ? */
+    if(pstCell == orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = orxNULL;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
+      /* Creates a new cell */
+      pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
 
-      /* Updates count */
-      _pstHashTable->u32Count++;
+      /* Success? */
+      if(pstCell != orxNULL)
+      {
+        /* Inits cell */
+        pstCell->u64Key   = _u64Key;
+        pstCell->pData    = orxNULL;
+        pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+        /* Updates count */
+        _pstHashTable->u32Count++;
 
-      /* Updates result */
-      ppResult = &(pstCell->pData);
+        /* Inserts it */
+        _pstHashTable->apstCell[u32Index] = pstCell;
+
+        /* Updates result */
+        ppResult = &(pstCell->pData);
+      }
+      else
+      {
+        /* Updates result */
+        ppResult = orxNULL;
+      }
     }
     else
     {
       /* Updates result */
-      ppResult = orxNULL;
+      ppResult = &(pstCell->pData);
     }
   }
-  else
-  {
-    /* Updates result */
-    ppResult = &(pstCell->pData);
-  }
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -329,9 +736,6 @@ void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u6
  */
 orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
-
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Set");
 
@@ -339,39 +743,65 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   orxASSERT(_pstHashTable != orxNULL);
   orxASSERT(_pData != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxU32 u32Slot;
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Finds the corresponding slot */
+    u32Slot = orxHashTable_FindSlot(_pstHashTable, _u64Key);
 
-  /* Found ? */
-  if(pstCell != orxNULL)
-  {
-    /* Stores data */
-    pstCell->pData = _pData;
+    /* Found? */
+    if(u32Slot != orxU32_UNDEFINED)
+    {
+      /* Stores data */
+      _pstHashTable->astSlot[u32Slot].pData = _pData;
+    }
+    else
+    {
+      /* Adds it */
+      orxHashTable_AddSlot(_pstHashTable, _u64Key, _pData);
+    }
   }
   else
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+    orxU32              u32Index;
+    orxHASHTABLE_CELL  *pstCell;
 
-    /* Success? */
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
+
+    /* Found ? */
     if(pstCell != orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = _pData;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
+      /* Stores data */
+      pstCell->pData = _pData;
+    }
+    else
+    {
+      /* Creates a new cell */
+      pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
 
-      /* Updates count */
-      _pstHashTable->u32Count++;
+      /* Success? */
+      if(pstCell != orxNULL)
+      {
+        /* Inits cell */
+        pstCell->u64Key   = _u64Key;
+        pstCell->pData    = _pData;
+        pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
+
+        /* Updates count */
+        _pstHashTable->u32Count++;
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+        /* Inserts it */
+        _pstHashTable->apstCell[u32Index] = pstCell;
+      }
     }
   }
 
@@ -391,9 +821,7 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
  */
 orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
-  orxSTATUS           eStatus = orxSTATUS_FAILURE;
+  orxSTATUS eStatus = orxSTATUS_FAILURE;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Add");
@@ -402,37 +830,54 @@ orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   orxASSERT(_pstHashTable != orxNULL);
   orxASSERT(_pData != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Not found and successfully added? */
+    if((orxHashTable_FindSlot(_pstHashTable, _u64Key) == orxU32_UNDEFINED)
+    && (orxHashTable_AddSlot(_pstHashTable, _u64Key, _pData) != orxU32_UNDEFINED))
+    {
+      /* Updates result */
+      eStatus = orxSTATUS_SUCCESS;
+    }
+  }
+  else
+  {
+    orxU32              u32Index;
+    orxHASHTABLE_CELL  *pstCell;
 
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+    /* Gets the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
 
-  /* Not found? */
-  if(pstCell == orxNULL)
-  {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
+    /* Finds the corresponding cell */
+    for(pstCell = _pstHashTable->apstCell[u32Index];
+        (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+        pstCell = pstCell->pstNext)
+    ;
 
-    /* Success? */
-    if(pstCell != orxNULL)
+    /* Not found? */
+    if(pstCell == orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = _pData;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
+      /* Creates a new cell */
+      pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+      /* Success? */
+      if(pstCell != orxNULL)
+      {
+        /* Inits cell */
+        pstCell->u64Key   = _u64Key;
+        pstCell->pData    = _pData;
+        pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
 
-      /* Updates count */
-      _pstHashTable->u32Count++;
+        /* Inserts it */
+        _pstHashTable->apstCell[u32Index] = pstCell;
 
-      /* Updates result */
-      eStatus = orxSTATUS_SUCCESS;
+        /* Updates count */
+        _pstHashTable->u32Count++;
+
+        /* Updates result */
+        eStatus = orxSTATUS_SUCCESS;
+      }
     }
   }
 
@@ -450,8 +895,6 @@ orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64K
  */
 orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32 u32Index;                        /* Hash table index */
-  orxHASHTABLE_CELL *pstCell;             /* Cell used to traverse */
   orxSTATUS eStatus = orxSTATUS_FAILURE;  /* Status to return */
 
   /* Profiles */
@@ -460,46 +903,80 @@ orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Get the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    orxU32 u32Slot;
 
-  pstCell = _pstHashTable->apstCell[u32Index];
+    /* Finds the corresponding slot */
+    u32Slot = orxHashTable_FindSlot(_pstHashTable, _u64Key);
 
-  /* Is the first key is the key to remove ? */
-  if(pstCell != orxNULL)
-  {
-    if(pstCell->u64Key == _u64Key)
+    /* Found? */
+    if(u32Slot != orxU32_UNDEFINED)
     {
-      /* The first cell has to be removed */
-      _pstHashTable->apstCell[u32Index] = pstCell->pstNext;
-      orxBank_Free(_pstHashTable->pstBank, pstCell);
+      /* Does its group already have an empty slot? (no probe sequence can go past it) */
+      if(orxHashTable_MatchGroup(_pstHashTable->au8Control + (u32Slot & ~(orxHASHTABLE_KU32_GROUP_SIZE - 1)), orxHASHTABLE_KU8_CONTROL_EMPTY) != 0)
+      {
+        /* Marks it as empty */
+        _pstHashTable->au8Control[u32Slot] = orxHASHTABLE_KU8_CONTROL_EMPTY;
+      }
+      else
+      {
+        /* Marks it as deleted */
+        _pstHashTable->au8Control[u32Slot] = orxHASHTABLE_KU8_CONTROL_DELETED;
+        _pstHashTable->u32DeletedCount++;
+      }
 
       /* Operation succeed */
       eStatus = orxSTATUS_SUCCESS;
     }
-    else
+  }
+  else
+  {
+    orxU32 u32Index;                        /* Hash table index */
+    orxHASHTABLE_CELL *pstCell;             /* Cell used to traverse */
+
+    /* Get the index from the key */
+    u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
+
+    pstCell = _pstHashTable->apstCell[u32Index];
+
+    /* Is the first key is the key to remove ? */
+    if(pstCell != orxNULL)
     {
-      /* Traverse to find the key */
-      while(pstCell->pstNext != orxNULL && pstCell->pstNext->u64Key != _u64Key)
+      if(pstCell->u64Key == _u64Key)
       {
-        /* Try with next cell */
-        pstCell = pstCell->pstNext;
-      }
+        /* The first cell has to be removed */
+        _pstHashTable->apstCell[u32Index] = pstCell->pstNext;
+        orxBank_Free(_pstHashTable->pstBank, pstCell);
 
-      /* Cell found ? (key should be on the next cell) */
-      if(pstCell->pstNext != orxNULL)
+        /* Operation succeed */
+        eStatus = orxSTATUS_SUCCESS;
+      }
+      else
       {
-        orxHASHTABLE_CELL *pstRemoveCell;
+        /* Traverse to find the key */
+        while(pstCell->pstNext != orxNULL && pstCell->pstNext->u64Key != _u64Key)
+        {
+          /* Try with next cell */
+          pstCell = pstCell->pstNext;
+        }
 
-        /* We found it, remove this cell */
-        pstRemoveCell = pstCell->pstNext;
-        pstCell->pstNext = pstRemoveCell->pstNext;
+        /* Cell found ? (key should be on the next cell) */
+        if(pstCell->pstNext != orxNULL)
+        {
+          orxHASHTABLE_CELL *pstRemoveCell;
 
-        /* Free cell from bank */
-        orxBank_Free(_pstHashTable->pstBank, pstRemoveCell);
+          /* We found it, remove this cell */
+          pstRemoveCell = pstCell->pstNext;
+          pstCell->pstNext = pstRemoveCell->pstNext;
 
-        /* Operation succeed */
-        eStatus = orxSTATUS_SUCCESS;
+          /* Free cell from bank */
+          orxBank_Free(_pstHashTable->pstBank, pstRemoveCell);
+
+          /* Operation succeed */
+          eStatus = orxSTATUS_SUCCESS;
+        }
       }
     }
   }
@@ -531,60 +1008,92 @@ orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u
  */
 orxHANDLE orxFASTCALL orxHashTable_GetNext(const orxHASHTABLE *_pstHashTable, orxHANDLE _hIterator, orxU64 *_pu64Key, void **_ppData)
 {
-  orxHASHTABLE_CELL  *pstCell;
-  orxU32              u32Index;
-  orxHANDLE           hResult;
+  orxU64    u64Key = 0;
+  void     *pData = orxNULL;
+  orxHANDLE hResult = orxHANDLE_UNDEFINED;
 
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Has iterator? */
-  if((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED))
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
   {
-    /* Gets current cell */
-    pstCell = (orxHASHTABLE_CELL *)_hIterator;
+    orxU32 u32Index;
 
-    /* Gets start index */
-    u32Index = orxHashTable_FindIndex(_pstHashTable, pstCell->u64Key) + 1;
+    /* Gets start index (iterators store slot index + 1) */
+    u32Index = ((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED)) ? (orxU32)(orxUPTR)_hIterator : 0;
 
-    /* Updates temporary result */
-    pstCell = pstCell->pstNext;
+    /* Finds next used slot */
+    for(; (u32Index < _pstHashTable->u32Size) && (_pstHashTable->au8Control[u32Index] & orxHASHTABLE_KU8_CONTROL_EMPTY); u32Index++)
+    ;
+
+    /* Found? */
+    if(u32Index < _pstHashTable->u32Size)
+    {
+      /* Gets its content */
+      u64Key  = _pstHashTable->astSlot[u32Index].u64Key;
+      pData   = _pstHashTable->astSlot[u32Index].pData;
+
+      /* Updates result */
+      hResult = (orxHANDLE)(orxUPTR)(u32Index + 1);
+    }
   }
   else
   {
-    /* Starts a new search */
-    u32Index  = 0;
-    pstCell   = orxNULL;
-  }
+    orxHASHTABLE_CELL  *pstCell;
+    orxU32              u32Index;
 
-  /* Finds next head cell if needed */
-  for(; (pstCell == orxNULL) && (u32Index < _pstHashTable->u32Size); pstCell = _pstHashTable->apstCell[u32Index++])
-  ;
+    /* Has iterator? */
+    if((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED))
+    {
+      /* Gets current cell */
+      pstCell = (orxHASHTABLE_CELL *)_hIterator;
+
+      /* Gets start index */
+      u32Index = orxHashTable_FindIndex(_pstHashTable, pstCell->u64Key) + 1;
+
+      /* Updates temporary result */
+      pstCell = pstCell->pstNext;
+    }
+    else
+    {
+      /* Starts a new search */
+      u32Index  = 0;
+      pstCell   = orxNULL;
+    }
+
+    /* Finds next head cell if needed */
+    for(; (pstCell == orxNULL) && (u32Index < _pstHashTable->u32Size); pstCell = _pstHashTable->apstCell[u32Index++])
+    ;
+
+    /* Found? */
+    if(pstCell != orxNULL)
+    {
+      /* Gets its content */
+      u64Key  = pstCell->u64Key;
+      pData   = pstCell->pData;
+
+      /* Updates result */
+      hResult = (orxHANDLE)pstCell;
+    }
+  }
 
   /* Found? */
-  if(pstCell != orxNULL)
+  if(hResult != orxHANDLE_UNDEFINED)
   {
     /* Asked for key? */
     if(_pu64Key != orxNULL)
     {
       /* Updates it */
-      *_pu64Key = pstCell->u64Key;
+      *_pu64Key = u64Key;
     }
 
     /* Asked for data? */
     if(_ppData != orxNULL)
     {
       /* Updates it */
-      *_ppData = pstCell->pData;
+      *_ppData = pData;
     }
-
-    /* Updates result */
-    hResult = (orxHANDLE)pstCell;
-  }
-  else
-  {
-    /* Updates result */
-    hResult = orxHANDLE_UNDEFINED;
   }
 
   /* Done! */
@@ -602,8 +1111,18 @@ orxSTATUS orxFASTCALL orxHashTable_Optimize(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
+  /* Open addressing? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING))
+  {
+    /* Has deleted slots? */
+    if(_pstHashTable->u32DeletedCount > 0)
+    {
+      /* Rehashes in place, purging them */
+      eResult = orxHashTable_ResizeSlots(_pstHashTable, _pstHashTable->u32Size);
+    }
+  }
   /* Has elements? */
-  if(_pstHashTable->u32Count > 0)
+  else if(_pstHashTable->u32Count > 0)
   {
     orxHASHTABLE_CELL *astWorkBuffer;
 
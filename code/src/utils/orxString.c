@@ -35,7 +35,6 @@
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
 #include "memory/orxMemory.h"
-#include "utils/orxHashTable.h"
 
 #define XXH_INLINE_ALL
 #include "xxhash.h"
@@ -57,17 +56,85 @@
 /** Defines
  */
 #define orxSTRING_KU32_ID_TABLE_SIZE                      16384
+#define orxSTRING_KU32_SHARD_NUMBER                       16
+#define orxSTRING_KU32_SHARD_SHIFT                        60
+#define orxSTRING_KU32_ARENA_SIZE                         65536
+#define orxSTRING_KU32_FREE_LIST_NUMBER                   16
+#define orxSTRING_KU32_FREE_LIST_SIZE                     16
+#define orxSTRING_KU32_LOCK_MAX_BACKOFF                   64
 
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+#ifdef __orxMSVC__
+  #pragma warning(push)
+  #pragma warning(disable : 4200)
+#endif /* __orxMSVC__ */
+
+/** String table entry
+ */
+typedef struct __orxSTRING_ENTRY_t
+{
+  volatile orxU64                 u64ID;                  /**< String ID, 0 if free */
+  const orxCHAR *volatile         zString;                /**< Stored string, orxNULL if erased */
+
+} orxSTRING_ENTRY;
+
+/** String table (linear probing, never shrinks, retired tables are kept for concurrent readers until exit)
+ */
+typedef struct __orxSTRING_TABLE_t
+{
+  struct __orxSTRING_TABLE_t     *pstPrevious;            /**< Previous (retired) table */
+  orxU32                          u32Size;                /**< Size (power of two) */
+  orxU32                          u32Count;               /**< Used entry count (including erased ones) */
+  orxSTRING_ENTRY                 astEntry[0];            /**< Entries */
+
+} orxSTRING_TABLE;
+
+/** String arena (append-only storage, erased blocks are recycled through the shard free lists)
+ */
+typedef struct __orxSTRING_ARENA_t
+{
+  struct __orxSTRING_ARENA_t     *pstPrevious;            /**< Previous arena */
+  orxU32                          u32Size;                /**< Size */
+  orxU32                          u32Used;                /**< Used size */
+  orxCHAR                         acData[0];              /**< Data */
+
+} orxSTRING_ARENA;
+
+#ifdef __orxMSVC__
+  #pragma warning(pop)
+#endif /* __orxMSVC__ */
+
+/** String free list: storage of erased strings, ready to be reused
+ */
+typedef struct __orxSTRING_FREE_LIST_t
+{
+  orxCHAR                       **azBlockList;            /**< Erased string storage blocks */
+  orxU32                          u32Count;               /**< Block count */
+  orxU32                          u32Size;                /**< Block list size */
+
+} orxSTRING_FREE_LIST;
+
+/** String shard: lookups are lock-free, insertions/erasures are serialized per shard
+ */
+typedef struct __orxSTRING_SHARD_t
+{
+  orxSTRING_TABLE *volatile       pstTable;               /**< Current table */
+  orxSTRING_ARENA                *pstArena;               /**< Current arena */
+  orxSTRING_FREE_LIST             astFreeList[orxSTRING_KU32_FREE_LIST_NUMBER]; /**< Erased storage, by size class (log2 of the block size) */
+  volatile orxU32                 u32Lock;                /**< Insertion lock */
+
+} orxSTRING_SHARD;
+
 /** Static structure
  */
 typedef struct __orxSTRING_STATIC_t
 {
-  orxHASHTABLE *pstIDTable;                               /** String ID table */
+  orxSTRING_SHARD astShard[orxSTRING_KU32_SHARD_NUMBER];  /**< String ID shards */
+  const orxCHAR *volatile zNullIDString;                  /**< String whose ID is 0 (can't be stored in tables) */
   orxU32        u32Flags;                                 /**< Control flags */
 
 } orxSTRING_STATIC;
@@ -86,6 +153,466 @@ static orxSTRING_STATIC sstString;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Locks a shard
+ * @param[in]   _pstShard       Concerned shard
+ */
+static orxINLINE void orxString_LockShard(orxSTRING_SHARD *_pstShard)
+{
+  orxU32 u32Backoff = 1;
+
+  /* Waits for lock */
+  while(orxMEMORY_ATOMIC_CAS32(&(_pstShard->u32Lock), 0, 1) == orxFALSE)
+  {
+    orxU32 i;
+
+    /* Backs off, then waits for the lock to look free before trying again */
+    for(i = 0; i < u32Backoff; i++)
+    {
+      orxMEMORY_PAUSE();
+    }
+    while(_pstShard->u32Lock != 0)
+    {
+      orxMEMORY_PAUSE();
+    }
+
+    /* Updates backoff */
+    u32Backoff = orxMIN(u32Backoff << 1, orxSTRING_KU32_LOCK_MAX_BACKOFF);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Unlocks a shard
+ * @param[in]   _pstShard       Concerned shard
+ */
+static orxINLINE void orxString_UnlockShard(orxSTRING_SHARD *_pstShard)
+{
+  /* Releases lock */
+  orxMEMORY_BARRIER();
+  _pstShard->u32Lock = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Gets the shard of a string ID
+ * @param[in]   _stID           Concerned string ID
+ * @return      orxSTRING_SHARD
+ */
+static orxINLINE orxSTRING_SHARD *orxString_GetShard(orxSTRINGID _stID)
+{
+  /* Done! */
+  return &(sstString.astShard[_stID >> orxSTRING_KU32_SHARD_SHIFT]);
+}
+
+/** Finds a string ID's entry in a table
+ * @param[in]   _pstTable       Concerned table
+ * @param[in]   _stID           Concerned string ID
+ * @return      orxSTRING_ENTRY if found, orxNULL otherwise
+ */
+static orxINLINE orxSTRING_ENTRY *orxString_FindEntry(orxSTRING_TABLE *_pstTable, orxSTRINGID _stID)
+{
+  orxU32            u32Mask, i;
+  orxSTRING_ENTRY  *pstResult = orxNULL;
+
+  /* For all entries in probe sequence */
+  for(u32Mask = _pstTable->u32Size - 1, i = (orxU32)_stID & u32Mask;; i = (i + 1) & u32Mask)
+  {
+    orxU64 u64ID;
+
+    /* Gets its ID */
+    u64ID = _pstTable->astEntry[i].u64ID;
+
+    /* Found? */
+    if(u64ID == _stID)
+    {
+      /* Updates result */
+      pstResult = &(_pstTable->astEntry[i]);
+      break;
+    }
+    /* Free? */
+    else if(u64ID == 0)
+    {
+      /* Stops */
+      break;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets a stored string without locking: entries are only published once their string is fully written,
+ * a missed lookup has to be confirmed with the shard locked as the entry might be in the process of being published
+ * @param[in]   _stID           Concerned string ID
+ * @return      Stored string if found, orxNULL otherwise
+ */
+static orxINLINE const orxSTRING orxString_Find(orxSTRINGID _stID)
+{
+  const orxSTRING zResult;
+
+  /* Valid ID? */
+  if(_stID != 0)
+  {
+    orxSTRING_ENTRY *pstEntry;
+
+    /* Finds its entry */
+    pstEntry = orxString_FindEntry(orxString_GetShard(_stID)->pstTable, _stID);
+
+    /* Updates result */
+    zResult = (pstEntry != orxNULL) ? pstEntry->zString : orxNULL;
+  }
+  else
+  {
+    /* Updates result */
+    zResult = sstString.zNullIDString;
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+/** Creates a string table, copying the content of a previous one (which gets retired)
+ * @param[in]   _u32Size        Size (power of two)
+ * @param[in]   _pstPrevious    Previous table, orxNULL if none
+ * @return      orxSTRING_TABLE / orxNULL
+ */
+static orxSTRING_TABLE *orxFASTCALL orxString_CreateTable(orxU32 _u32Size, orxSTRING_TABLE *_pstPrevious)
+{
+  orxSTRING_TABLE *pstResult;
+
+  /* Checks */
+  orxASSERT(orxMath_IsPowerOfTwo(_u32Size) != orxFALSE);
+
+  /* Allocates it */
+  pstResult = (orxSTRING_TABLE *)orxMemory_Allocate(sizeof(orxSTRING_TABLE) + _u32Size * sizeof(orxSTRING_ENTRY), orxMEMORY_TYPE_TEXT);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits it */
+    orxMemory_Zero(pstResult, sizeof(orxSTRING_TABLE) + _u32Size * sizeof(orxSTRING_ENTRY));
+    pstResult->pstPrevious  = _pstPrevious;
+    pstResult->u32Size      = _u32Size;
+
+    /* Has previous table? */
+    if(_pstPrevious != orxNULL)
+    {
+      orxU32 i, u32Mask;
+
+      /* For all previous entries */
+      for(i = 0, u32Mask = _u32Size - 1; i < _pstPrevious->u32Size; i++)
+      {
+        /* Not erased? */
+        if(_pstPrevious->astEntry[i].zString != orxNULL)
+        {
+          orxU32 j;
+
+          /* Finds free entry */
+          for(j = (orxU32)_pstPrevious->astEntry[i].u64ID & u32Mask; pstResult->astEntry[j].u64ID != 0; j = (j + 1) & u32Mask)
+          ;
+
+          /* Copies it */
+          pstResult->astEntry[j].u64ID    = _pstPrevious->astEntry[i].u64ID;
+          pstResult->astEntry[j].zString  = _pstPrevious->astEntry[i].zString;
+          pstResult->u32Count++;
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Releases the storage of an erased string to its shard's free lists, has to be called with the shard locked
+ * @param[in]   _pstShard       Concerned shard
+ * @param[in]   _zString        Erased string
+ */
+static void orxFASTCALL orxString_ReleaseToArena(orxSTRING_SHARD *_pstShard, const orxSTRING _zString)
+{
+  orxSTRING_FREE_LIST  *pstFreeList;
+  orxU32                u32Class;
+
+  /* Gets its size class (floor of log2 of its block size) */
+  u32Class    = orxMIN(orxMath_GetTrailingZeroCount(orxMath_GetNextPowerOfTwo(orxString_GetLength(_zString) + 2)) - 1, orxSTRING_KU32_FREE_LIST_NUMBER - 1);
+  pstFreeList = &(_pstShard->astFreeList[u32Class]);
+
+  /* Is list full? */
+  if(pstFreeList->u32Count == pstFreeList->u32Size)
+  {
+    orxCHAR **azBlockList;
+    orxU32    u32NewSize;
+
+    /* Gets new size */
+    u32NewSize  = orxMAX(pstFreeList->u32Size << 1, orxSTRING_KU32_FREE_LIST_SIZE);
+
+    /* Grows it */
+    azBlockList = (orxCHAR **)orxMemory_Reallocate(pstFreeList->azBlockList, u32NewSize * sizeof(orxCHAR *), orxMEMORY_TYPE_TEXT);
+
+    /* Success? */
+    if(azBlockList != orxNULL)
+    {
+      /* Updates list */
+      pstFreeList->azBlockList  = azBlockList;
+      pstFreeList->u32Size      = u32NewSize;
+    }
+  }
+
+  /* Has room? */
+  if(pstFreeList->u32Count < pstFreeList->u32Size)
+  {
+    /* Stores block (its content remains untouched until reused, as lock-free readers might still be using it) */
+    pstFreeList->azBlockList[pstFreeList->u32Count++] = (orxCHAR *)_zString;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Copies a string into a shard's arena, reusing the storage of an erased string when possible
+ * @param[in]   _pstShard       Concerned shard
+ * @param[in]   _zString        String to copy
+ * @return      Copied string / orxNULL
+ */
+static const orxSTRING orxFASTCALL orxString_CopyToArena(orxSTRING_SHARD *_pstShard, const orxSTRING _zString)
+{
+  orxSTRING_ARENA  *pstArena;
+  orxU32            u32Size, i;
+  orxCHAR          *zResult = orxNULL;
+
+  /* Gets size */
+  u32Size = orxString_GetLength(_zString) + 1;
+
+  /* For all size classes that can hold it */
+  for(i = orxMIN(orxMath_GetTrailingZeroCount(orxMath_GetNextPowerOfTwo(u32Size)), orxSTRING_KU32_FREE_LIST_NUMBER - 1); i < orxSTRING_KU32_FREE_LIST_NUMBER; i++)
+  {
+    orxSTRING_FREE_LIST *pstFreeList;
+
+    /* Gets its free list */
+    pstFreeList = &(_pstShard->astFreeList[i]);
+
+    /* Has a large enough block (only needs to be checked for the last, unbounded, class)? */
+    if((pstFreeList->u32Count != 0)
+    && ((i < orxSTRING_KU32_FREE_LIST_NUMBER - 1) || (orxString_GetLength(pstFreeList->azBlockList[pstFreeList->u32Count - 1]) + 1 >= u32Size)))
+    {
+      /* Reuses it */
+      zResult = pstFreeList->azBlockList[--pstFreeList->u32Count];
+      orxMemory_Copy(zResult, _zString, u32Size);
+
+      break;
+    }
+  }
+
+  /* Not reused? */
+  if(zResult == orxNULL)
+  {
+    /* Gets current arena */
+    pstArena = _pstShard->pstArena;
+
+    /* Not enough room? */
+    if((pstArena == orxNULL) || (pstArena->u32Used + u32Size > pstArena->u32Size))
+    {
+      orxU32 u32ArenaSize;
+
+      /* Gets arena size (large strings get their own one) */
+      u32ArenaSize = (u32Size > (orxSTRING_KU32_ARENA_SIZE >> 2)) ? u32Size : orxSTRING_KU32_ARENA_SIZE;
+
+      /* Allocates new arena */
+      pstArena = (orxSTRING_ARENA *)orxMemory_Allocate(sizeof(orxSTRING_ARENA) + u32ArenaSize, orxMEMORY_TYPE_TEXT);
+
+      /* Success? */
+      if(pstArena != orxNULL)
+      {
+        /* Inits it */
+        pstArena->u32Size = u32ArenaSize;
+        pstArena->u32Used = 0;
+
+        /* Dedicated to this string and has a current arena? */
+        if((u32ArenaSize == u32Size) && (_pstShard->pstArena != orxNULL))
+        {
+          /* Links it behind current one */
+          pstArena->pstPrevious               = _pstShard->pstArena->pstPrevious;
+          _pstShard->pstArena->pstPrevious    = pstArena;
+        }
+        else
+        {
+          /* Makes it current */
+          pstArena->pstPrevious               = _pstShard->pstArena;
+          _pstShard->pstArena                 = pstArena;
+        }
+      }
+    }
+
+    /* Valid? */
+    if(pstArena != orxNULL)
+    {
+      /* Copies string */
+      zResult = pstArena->acData + pstArena->u32Used;
+      orxMemory_Copy(zResult, _zString, u32Size);
+
+      /* Updates arena */
+      pstArena->u32Used += u32Size;
+    }
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+/** Stores a string in its shard, has to be called with the shard locked
+ * @param[in]   _pstShard       Concerned shard
+ * @param[in]   _stID           String ID
+ * @param[in]   _zString        String to store
+ * @return      Stored string / orxNULL
+ */
+static const orxSTRING orxFASTCALL orxString_StoreInShard(orxSTRING_SHARD *_pstShard, orxSTRINGID _stID, const orxSTRING _zString)
+{
+  orxSTRING_TABLE  *pstTable;
+  orxSTRING_ENTRY  *pstEntry;
+  const orxSTRING   zResult;
+
+  /* Gets current table */
+  pstTable = _pstShard->pstTable;
+
+  /* Finds entry */
+  pstEntry = orxString_FindEntry(pstTable, _stID);
+
+  /* Not already stored? */
+  if((pstEntry == orxNULL) || (pstEntry->zString == orxNULL))
+  {
+    /* Copies string */
+    zResult = orxString_CopyToArena(_pstShard, _zString);
+
+    /* Success? */
+    if(zResult != orxNULL)
+    {
+      /* Makes sure string content is visible before publishing it */
+      orxMEMORY_BARRIER();
+
+      /* Erased entry? */
+      if(pstEntry != orxNULL)
+      {
+        /* Publishes string */
+        pstEntry->zString = zResult;
+      }
+      else
+      {
+        orxU32 u32Mask, i;
+
+        /* Above max load (3/4)? */
+        if((pstTable->u32Count + 1) * 4 > pstTable->u32Size * 3)
+        {
+          orxSTRING_TABLE *pstNewTable;
+
+          /* Creates bigger table */
+          pstNewTable = orxString_CreateTable(pstTable->u32Size << 1, pstTable);
+
+          /* Success? */
+          if(pstNewTable != orxNULL)
+          {
+            /* Publishes it, previous one is kept for concurrent readers */
+            orxMEMORY_BARRIER();
+            _pstShard->pstTable = pstNewTable;
+            pstTable            = pstNewTable;
+          }
+        }
+
+        /* Finds free entry (there's always one as load is capped) */
+        for(u32Mask = pstTable->u32Size - 1, i = (orxU32)_stID & u32Mask; pstTable->astEntry[i].u64ID != 0; i = (i + 1) & u32Mask)
+        ;
+
+        /* Publishes string, then ID */
+        pstTable->astEntry[i].zString = zResult;
+        orxMEMORY_BARRIER();
+        pstTable->astEntry[i].u64ID   = _stID;
+        pstTable->u32Count++;
+      }
+    }
+  }
+  else
+  {
+    /* Updates result */
+    zResult = pstEntry->zString;
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+/** Interns a string
+ * @param[in]   _zString        Concerned string
+ * @param[out]  _pstID          String's ID
+ * @return      Stored string
+ */
+static orxINLINE const orxSTRING orxString_Intern(const orxSTRING _zString, orxSTRINGID *_pstID)
+{
+  const orxSTRING zResult;
+  orxSTRINGID     stID;
+
+  /* Checks */
+  orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zString != orxNULL);
+
+  /* Gets its ID */
+  stID = orxString_Hash(_zString);
+
+  /* Not found? */
+  if((zResult = orxString_Find(stID)) == orxNULL)
+  {
+    orxSTRING_SHARD *pstShard;
+
+    /* Gets its shard */
+    pstShard = orxString_GetShard(stID);
+
+    /* Locks it */
+    orxString_LockShard(pstShard);
+
+    /* Valid ID? */
+    if(stID != 0)
+    {
+      /* Stores it */
+      zResult = orxString_StoreInShard(pstShard, stID, _zString);
+    }
+    else
+    {
+      /* Not already stored? */
+      if(sstString.zNullIDString == orxNULL)
+      {
+        /* Stores it */
+        sstString.zNullIDString = orxString_CopyToArena(pstShard, _zString);
+      }
+
+      /* Updates result */
+      zResult = sstString.zNullIDString;
+    }
+
+    /* Unlocks it */
+    orxString_UnlockShard(pstShard);
+
+    /* Checks */
+    orxASSERT(zResult != orxNULL);
+  }
+#ifdef __orxDEBUG__
+  else
+  {
+    /* Different strings? */
+    if(orxString_Compare(_zString, zResult) != 0)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", zResult, _zString);
+    }
+  }
+#endif /* __orxDEBUG__ */
+
+  /* Stores ID */
+  *_pstID = stID;
+
+  /* Done! */
+  return zResult;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -114,29 +641,48 @@ orxSTATUS orxFASTCALL orxString_Init()
   /* Not already Initialized? */
   if(!(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY))
   {
+    orxU32 i;
+
     /* Cleans static controller */
     orxMemory_Zero(&sstString, sizeof(orxSTRING_STATIC));
 
-    /* Creates ID table */
-    sstString.pstIDTable = orxHashTable_Create(orxSTRING_KU32_ID_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEXT);
+    /* For all shards */
+    for(i = 0; i < orxSTRING_KU32_SHARD_NUMBER; i++)
+    {
+      /* Creates its table */
+      sstString.astShard[i].pstTable = orxString_CreateTable(orxSTRING_KU32_ID_TABLE_SIZE / orxSTRING_KU32_SHARD_NUMBER, orxNULL);
+
+      /* Failure? */
+      if(sstString.astShard[i].pstTable == orxNULL)
+      {
+        break;
+      }
+    }
 
     /* Success? */
-    if(sstString.pstIDTable != orxNULL)
+    if(i == orxSTRING_KU32_SHARD_NUMBER)
     {
       /* Resets default locale in case it was modified by an external component, such as GTK */
       setlocale(LC_ALL, "C");
 
       /* Inits Flags */
       sstString.u32Flags = orxSTRING_KU32_STATIC_FLAG_READY;
+
+      /* Everything's ok */
+      eResult = orxSTATUS_SUCCESS;
     }
     else
     {
       /* Logs message */
       orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't create StringID table.");
-    }
 
-    /* Everything's ok */
-    eResult = orxSTATUS_SUCCESS;
+      /* For all created tables */
+      while(i > 0)
+      {
+        /* Deletes it */
+        orxMemory_Free(sstString.astShard[--i].pstTable);
+      }
+    }
   }
   else
   {
@@ -158,21 +704,49 @@ void orxFASTCALL orxString_Exit()
   /* Initialized? */
   if(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY)
   {
-    orxHANDLE hIterator;
-    orxSTRING zString;
+    orxU32 i;
 
-    /* For all string IDs */
-    for(hIterator = orxHashTable_GetNext(sstString.pstIDTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&zString);
-        hIterator != orxHANDLE_UNDEFINED;
-        hIterator = orxHashTable_GetNext(sstString.pstIDTable, hIterator, orxNULL, (void **)&zString))
+    /* For all shards */
+    for(i = 0; i < orxSTRING_KU32_SHARD_NUMBER; i++)
     {
-      /* Deletes its string */
-      orxString_Delete(zString);
+      orxSTRING_TABLE *pstTable;
+      orxSTRING_ARENA *pstArena;
+      orxU32           j;
+
+      /* For all its tables */
+      for(pstTable = sstString.astShard[i].pstTable; pstTable != orxNULL;)
+      {
+        orxSTRING_TABLE *pstPrevious;
+
+        /* Deletes it */
+        pstPrevious = pstTable->pstPrevious;
+        orxMemory_Free(pstTable);
+        pstTable    = pstPrevious;
+      }
+
+      /* For all its arenas */
+      for(pstArena = sstString.astShard[i].pstArena; pstArena != orxNULL;)
+      {
+        orxSTRING_ARENA *pstPrevious;
+
+        /* Deletes it */
+        pstPrevious = pstArena->pstPrevious;
+        orxMemory_Free(pstArena);
+        pstArena    = pstPrevious;
+      }
+
+      /* For all its free lists */
+      for(j = 0; j < orxSTRING_KU32_FREE_LIST_NUMBER; j++)
+      {
+        /* Has storage? */
+        if(sstString.astShard[i].astFreeList[j].azBlockList != orxNULL)
+        {
+          /* Deletes it */
+          orxMemory_Free(sstString.astShard[i].astFreeList[j].azBlockList);
+        }
+      }
     }
 
-    /* Deletes ID table */
-    orxHashTable_Delete(sstString.pstIDTable);
-
     /* Updates flags */
     sstString.u32Flags &= ~orxSTRING_KU32_STATIC_FLAG_READY;
   }
@@ -192,42 +766,13 @@ void orxFASTCALL orxString_Exit()
  */
 orxSTRINGID orxFASTCALL orxString_GetID(const orxSTRING _zString)
 {
-  const orxSTRING  *pzBucket;
-  orxSTRINGID       stResult = 0;
+  orxSTRINGID stResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_GetID");
 
-  /* Checks */
-  orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
-  orxASSERT(_zString != orxNULL);
-
-  /* Gets its ID */
-  stResult = orxString_Hash(_zString);
-
-  /* Gets stored string bucket */
-  pzBucket = (const orxSTRING *)orxHashTable_Retrieve(sstString.pstIDTable, stResult);
-
-  /* Checks */
-  orxASSERT(pzBucket != orxNULL);
-
-  /* Not already stored? */
-  if(*pzBucket == orxNULL)
-  {
-    /* Adds it */
-    *pzBucket = orxString_Duplicate(_zString);
-  }
-#ifdef __orxDEBUG__
-  else
-  {
-    /* Different strings? */
-    if(orxString_Compare(_zString, *pzBucket) != 0)
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", *pzBucket, _zString);
-    }
-  }
-#endif /* __orxDEBUG__ */
+  /* Interns it */
+  orxString_Intern(_zString, &stResult);
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -247,14 +792,28 @@ const orxSTRING orxFASTCALL orxString_GetFromID(orxSTRINGID _stID)
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_GetFromID");
 
-  /* Gets string from table */
-  zResult = (const orxSTRING)orxHashTable_Get(sstString.pstIDTable, _stID);
+  /* Checks */
+  orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
 
-  /* Invalid? */
-  if(zResult == orxNULL)
+  /* Not found? */
+  if((zResult = orxString_Find(_stID)) == orxNULL)
   {
-    /* Updates result */
-    zResult = orxSTRING_EMPTY;
+    orxSTRING_SHARD *pstShard;
+
+    /* Gets its shard */
+    pstShard = orxString_GetShard(_stID);
+
+    /* Confirms with shard locked */
+    orxString_LockShard(pstShard);
+    zResult = orxString_Find(_stID);
+    orxString_UnlockShard(pstShard);
+
+    /* Invalid? */
+    if(zResult == orxNULL)
+    {
+      /* Updates result */
+      zResult = orxSTRING_EMPTY;
+    }
   }
 
   /* Profiles */
@@ -295,49 +854,14 @@ orxSTRINGID orxFASTCALL orxString_Hash(const orxSTRING _zString)
  */
 const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
 {
-  const orxSTRING  *pzBucket;
-  const orxSTRING   zResult;
-  orxSTRINGID       stID;
+  const orxSTRING zResult;
+  orxSTRINGID     stID;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_Store");
 
-  /* Checks */
-  orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
-  orxASSERT(_zString != orxNULL);
-
-  /* Gets its ID */
-  stID = orxString_Hash(_zString);
-
-  /* Gets stored string bucket */
-  pzBucket = (const orxSTRING *)orxHashTable_Retrieve(sstString.pstIDTable, stID);
-
-  /* Checks */
-  orxASSERT(pzBucket != orxNULL);
-
-  /* Not already stored? */
-  if(*pzBucket == orxNULL)
-  {
-    /* Updates result */
-    zResult = orxString_Duplicate(_zString);
-
-    /* Adds it to table */
-    *pzBucket = zResult;
-  }
-  else
-  {
-    /* Gets it */
-    zResult = *pzBucket;
-
-#ifdef __orxDEBUG__
-    /* Different strings? */
-    if(orxString_Compare(_zString, zResult) != 0)
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", zResult, _zString);
-    }
-#endif /* __orxDEBUG__ */
-  }
+  /* Interns it */
+  zResult = orxString_Intern(_zString, &stID);
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -352,25 +876,58 @@ const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
  */
 orxSTATUS orxFASTCALL orxString_Erase(orxSTRINGID _stID)
 {
-  orxSTRING zString;
-  orxSTATUS eResult = orxSTATUS_FAILURE;
+  orxSTRING_SHARD  *pstShard;
+  orxSTATUS         eResult = orxSTATUS_FAILURE;
 
   /* Checks */
   orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
 
-  /* Gets it from table */
-  zString = (orxSTRING)orxHashTable_Get(sstString.pstIDTable, _stID);
+  /* Gets its shard */
+  pstShard = orxString_GetShard(_stID);
+
+  /* Locks it */
+  orxString_LockShard(pstShard);
+
+  /* Valid ID? */
+  if(_stID != 0)
+  {
+    orxSTRING_ENTRY *pstEntry;
+
+    /* Finds its entry */
+    pstEntry = orxString_FindEntry(pstShard->pstTable, _stID);
+
+    /* Found? */
+    if((pstEntry != orxNULL) && (pstEntry->zString != orxNULL))
+    {
+      /* Releases its storage */
+      orxString_ReleaseToArena(pstShard, pstEntry->zString);
+
+      /* Erases it */
+      pstEntry->zString = orxNULL;
 
-  /* Found? */
-  if(zString != orxNULL)
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+  }
+  else
   {
-    /* Deletes it */
-    orxString_Delete(zString);
+    /* Was stored? */
+    if(sstString.zNullIDString != orxNULL)
+    {
+      /* Releases its storage */
+      orxString_ReleaseToArena(pstShard, sstString.zNullIDString);
+
+      /* Erases it */
+      sstString.zNullIDString = orxNULL;
 
-    /* Erases it */
-    eResult = orxHashTable_Remove(sstString.pstIDTable, _stID);
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
   }
 
+  /* Unlocks it */
+  orxString_UnlockShard(pstShard);
+
   /* Done! */
   return eResult;
 }
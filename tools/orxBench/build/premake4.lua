@@ -0,0 +1,281 @@
+-- This premake script should be used with orx-customized version of premake4.
+-- Its Hg repository can be found at https://bitbucket.org/orx/premake-stable.
+-- A copy, including binaries, can also be found in the extern/premake folder.
+
+--
+-- Globals
+--
+
+function initconfigurations ()
+    return
+    {
+        "Debug",
+        "Profile",
+        "Release"
+    }
+end
+
+function initplatforms ()
+    if os.is ("windows")
+    or os.is ("linux") then
+        if os.is64bit () then
+            return
+            {
+                "x64",
+                "x32"
+            }
+        else
+            return
+            {
+                "x32",
+                "x64"
+            }
+        end
+    elseif os.is ("macosx") then
+        return
+        {
+            "universal64",
+            "x64"
+        }
+    end
+end
+
+function defaultaction (name, action)
+   if os.is (name) then
+      _ACTION = _ACTION or action
+   end
+end
+
+defaultaction ("windows", "vs2022")
+defaultaction ("linux", "gmake")
+defaultaction ("macosx", "gmake")
+
+newoption
+{
+    trigger = "to",
+    value   = "path",
+    description = "Set the output location for the generated files"
+}
+
+if os.is ("macosx") then
+    osname = "mac"
+else
+    osname = os.get()
+end
+
+destination = _OPTIONS["to"] or "./" .. osname .. "/" .. _ACTION
+copybase = path.rebase ("..", os.getcwd (), os.getcwd () .. "/" .. destination)
+
+
+--
+-- Solution: orx
+--
+
+solution "orxBench"
+
+    language ("C")
+
+    location (destination)
+
+    kind ("ConsoleApp")
+
+    configurations
+    {
+        initconfigurations ()
+    }
+
+    platforms
+    {
+        initplatforms ()
+    }
+
+    includedirs
+    {
+        "../include",
+        "../../../code/include",
+        "$(ORX)/include"
+    }
+
+    configuration {"not macosx"}
+        libdirs
+        {
+            "../lib",
+            "../../../code/lib/static",
+            "$(ORX)/lib/static"
+        }
+
+    configuration {"macosx"}
+        libdirs
+        {
+            "../../../code/lib/dynamic",
+            "$(ORX)/lib/dynamic"
+        }
+
+    configuration {}
+
+    targetdir ("../bin/")
+
+    flags
+    {
+        "NoPCH",
+        "NoManifest",
+        "FloatFast",
+        "NoNativeWChar",
+        "NoExceptions",
+        "Symbols",
+        "StaticRuntime"
+    }
+
+    configuration {"x32"}
+        flags {"EnableSSE2"}
+
+    configuration {"not windows"}
+        flags {"Unicode"}
+
+    configuration {"*Debug*"}
+        defines {"__orxDEBUG__"}
+        links {"orxd"}
+
+    configuration {"*Profile*"}
+        defines {"__orxPROFILER__"}
+        flags {"Optimize", "NoRTTI"}
+        links {"orxp"}
+
+    configuration {"*Release*"}
+        flags {"Optimize", "NoRTTI"}
+        links {"orx"}
+
+    configuration {}
+        defines {"__orxSTATIC__"}
+
+
+-- Linux
+
+    configuration {"linux"}
+        buildoptions {"-Wno-unused-function"}
+
+    -- This prevents an optimization bug from happening with some versions of gcc on linux
+    configuration {"linux", "not *Debug*"}
+        buildoptions {"-fschedule-insns"}
+
+
+-- Mac OS X
+
+    configuration {"macosx"}
+        buildoptions
+        {
+            "-stdlib=libc++",
+            "-gdwarf-2",
+            "-Wno-unused-function",
+            "-Wno-write-strings"
+        }
+        linkoptions
+        {
+            "-stdlib=libc++",
+            "-dead_strip"
+        }
+        postbuildcommands {"$(shell cp -f " .. copybase .. "/../../code/lib/dynamic/liborx*.dylib " .. copybase .. "/bin 2>/dev/null || true)"}
+
+    configuration {"macosx", "x32"}
+        buildoptions
+        {
+            "-mfix-and-continue"
+        }
+
+
+-- Windows
+
+    configuration {"windows", "vs*"}
+        buildoptions
+        {
+            "/MP"
+        }
+
+    configuration {"windows", "gmake", "x32"}
+        prebuildcommands
+        {
+            "$(eval CC := i686-w64-mingw32-gcc)",
+            "$(eval CXX := i686-w64-mingw32-g++)",
+            "$(eval AR := i686-w64-mingw32-gcc-ar)"
+        }
+
+    configuration {"windows", "gmake", "x64"}
+        prebuildcommands
+        {
+            "$(eval CC := x86_64-w64-mingw32-gcc)",
+            "$(eval CXX := x86_64-w64-mingw32-g++)",
+            "$(eval AR := x86_64-w64-mingw32-gcc-ar)"
+        }
+
+    configuration {"windows", "codelite or codeblocks", "x32"}
+        envs
+        {
+            "CC=i686-w64-mingw32-gcc",
+            "CXX=i686-w64-mingw32-g++",
+            "AR=i686-w64-mingw32-gcc-ar"
+        }
+
+    configuration {"windows", "codelite or codeblocks", "x64"}
+        envs
+        {
+            "CC=x86_64-w64-mingw32-gcc",
+            "CXX=x86_64-w64-mingw32-g++",
+            "AR=x86_64-w64-mingw32-gcc-ar"
+        }
+
+
+--
+-- Project: orxBench
+--
+
+project "orxBench"
+
+    files {"../src/orxBench.c"}
+    targetname ("orxbench")
+
+
+-- Linux
+
+    configuration {"linux"}
+        links
+        {
+            "dl",
+            "m",
+            "rt",
+            "pthread"
+        }
+
+
+-- Mac OS X
+
+    configuration {"macosx", "not codelite", "not codeblocks"}
+        links
+        {
+            "Foundation.framework",
+            "AppKit.framework"
+        }
+
+    configuration {"macosx", "codelite or codeblocks"}
+        linkoptions
+        {
+            "-framework Foundation",
+            "-framework AppKit"
+        }
+
+    configuration {"macosx"}
+        links
+        {
+            "pthread"
+        }
+
+
+-- Windows
+
+    configuration {"windows", "vs*", "*Debug*"}
+        linkoptions {"/NODEFAULTLIB:LIBCMT"}
+
+    configuration {"windows"}
+        links
+        {
+            "winmm"
+        }
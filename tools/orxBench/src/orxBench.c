@@ -0,0 +1,765 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008- Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBench.c
+ * @date 18/10/2026
+ * @author iarwain@orx-project.org
+ *
+ */
+
+
+#include "orx.h"
+
+
+/** Defines
+ */
+#define orxBENCH_KZ_LOG_TAG_LENGTH                "10"
+
+#define orxBENCH_KU32_MATH_COUNT                  4099
+#define orxBENCH_KU32_MATH_LOOP                   1000
+
+#define orxBENCH_KU32_HASHTABLE_OPS               1000000
+#define orxBENCH_KU32_HASHTABLE_INITIAL_SIZE      1024
+#define orxBENCH_KU64_HASHTABLE_HIT_SEED          0x9E3779B97F4A7C15ULL
+#define orxBENCH_KU64_HASHTABLE_MISS_SEED         0xC2B2AE3D27D4EB4FULL
+
+#define orxBENCH_KU32_CONFIG_SECTIONS             5000
+#define orxBENCH_KU32_CONFIG_LOOP                 10
+#define orxBENCH_KZ_CONFIG_TEXT_FILE              "orxbench.ini"
+#define orxBENCH_KZ_CONFIG_BINARY_FILE            "orxbench.bin"
+
+#define orxBENCH_KU32_CLOCK_TIMERS                100000
+#define orxBENCH_KU32_CLOCK_TICKS                 600
+#define orxBENCH_KU32_CLOCK_REMOVALS              1000
+#define orxBENCH_KF_CLOCK_DT                      orx2F(1.0f / 60.0f)
+#define orxBENCH_KF_CLOCK_MAX_DELAY               orx2F(10.0f)
+
+#define orxBENCH_KU32_OBJECT_COUNT                10000
+#define orxBENCH_KZ_OBJECT_SECTION                "BenchObject"
+#define orxBENCH_KZ_OBJECT_CHILD_SECTION          "BenchChild"
+
+#ifdef __orxVA_LEGACY__
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#else // __orxVA_LEGACY__
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#endif //__orxVA_LEGACY__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Bench function
+ */
+typedef void (orxFASTCALL *orxBENCH_FUNCTION)();
+
+/** Bench
+ */
+typedef struct __orxBENCH_t
+{
+  const orxSTRING   zName;
+  orxBENCH_FUNCTION pfnRun;
+
+} orxBENCH;
+
+/** Static structure
+ */
+typedef struct __orxBENCH_STATIC_t
+{
+  orxU32      u32Selection;
+  orxU32      u32TimerCount;
+
+} orxBENCH_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxBENCH_STATIC sstBench;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static void orxFASTCALL LogResult(const orxSTRING _zName, orxDOUBLE _dReference, orxDOUBLE _dTime, orxU32 _u32Count, orxBOOL _bMatch)
+{
+  // Logs it
+  orxBENCH_LOG(RESULT, "%-36.36s %10.3f ns -> %10.3f ns per item (x%.2f)%s", _zName, (_dReference * 1.0e9) / (orxDOUBLE)_u32Count, (_dTime * 1.0e9) / (orxDOUBLE)_u32Count, (_dTime > 0.0) ? _dReference / _dTime : 0.0, (_bMatch != orxFALSE) ? orxSTRING_EMPTY : " MISMATCH");
+}
+
+static void orxFASTCALL RandomizeOBox(orxOBOX *_pstBox)
+{
+  orxFLOAT fAngle, fCos, fSin, fWidth, fHeight;
+
+  // Gets random orientation & size
+  fAngle  = orxMath_GetRandomFloat(-orxMATH_KF_PI, orxMATH_KF_PI);
+  fCos    = orxMath_Cos(fAngle);
+  fSin    = orxMath_Sin(fAngle);
+  fWidth  = orxMath_GetRandomFloat(orx2F(1.0f), orx2F(64.0f));
+  fHeight = orxMath_GetRandomFloat(orx2F(1.0f), orx2F(64.0f));
+
+  // Sets box
+  orxVector_Set(&(_pstBox->vPosition), orxMath_GetRandomFloat(orx2F(-512.0f), orx2F(512.0f)), orxMath_GetRandomFloat(orx2F(-512.0f), orx2F(512.0f)), orxMath_GetRandomFloat(orx2F(0.0f), orx2F(1.0f)));
+  orxVector_Set(&(_pstBox->vPivot), orxMath_GetRandomFloat(orx2F(0.0f), orx2F(32.0f)), orxMath_GetRandomFloat(orx2F(0.0f), orx2F(32.0f)), orxFLOAT_0);
+  orxVector_Set(&(_pstBox->vX), fCos * fWidth, fSin * fWidth, orxFLOAT_0);
+  orxVector_Set(&(_pstBox->vY), -fSin * fHeight, fCos * fHeight, orxFLOAT_0);
+  orxVector_Set(&(_pstBox->vZ), orxFLOAT_0, orxFLOAT_0, orxMath_GetRandomFloat(orx2F(0.0f), orx2F(1.0f)));
+}
+
+static void orxFASTCALL BenchMath()
+{
+  orxOBOX    *astBoxList;
+  orxAABOX   *astAABoxList;
+  orxVECTOR  *avVectorList, *avReferenceList, *avResultList;
+  orxBOOL    *abReferenceList, *abResultList;
+  orxOBOX     stBox;
+  orxAABOX    stAABox;
+  orxVECTOR   vPosition, vScale, vTranslation;
+  orxFLOAT    fRotation;
+  orxDOUBLE   dReference, dTime;
+  orxU32      i, j, u32Count;
+
+  // Allocates data
+  astBoxList      = (orxOBOX *)orxMemory_Allocate(orxBENCH_KU32_MATH_COUNT * sizeof(orxOBOX), orxMEMORY_TYPE_TEMP);
+  astAABoxList    = (orxAABOX *)orxMemory_Allocate(orxBENCH_KU32_MATH_COUNT * sizeof(orxAABOX), orxMEMORY_TYPE_TEMP);
+  avVectorList    = (orxVECTOR *)orxMemory_Allocate(orxBENCH_KU32_MATH_COUNT * sizeof(orxVECTOR), orxMEMORY_TYPE_TEMP);
+  avReferenceList = (orxVECTOR *)orxMemory_Allocate(orxBENCH_KU32_MATH_COUNT * sizeof(orxVECTOR), orxMEMORY_TYPE_TEMP);
+  avResultList    = (orxVECTOR *)orxMemory_Allocate(orxBENCH_KU32_MATH_COUNT * sizeof(orxVECTOR), orxMEMORY_TYPE_TEMP);
+  abReferenceList = (orxBOOL *)orxMemory_Allocate(orxBENCH_KU32_MATH_COUNT * sizeof(orxBOOL), orxMEMORY_TYPE_TEMP);
+  abResultList    = (orxBOOL *)orxMemory_Allocate(orxBENCH_KU32_MATH_COUNT * sizeof(orxBOOL), orxMEMORY_TYPE_TEMP);
+
+  // Checks
+  orxASSERT(astBoxList && astAABoxList && avVectorList && avReferenceList && avResultList && abReferenceList && abResultList);
+
+  // Inits data
+  orxMath_InitRandom(0x0DDBA11);
+  for(i = 0; i < orxBENCH_KU32_MATH_COUNT; i++)
+  {
+    RandomizeOBox(&astBoxList[i]);
+    orxVector_Set(&(astAABoxList[i].vTL), orxMath_GetRandomFloat(orx2F(-512.0f), orx2F(512.0f)), orxMath_GetRandomFloat(orx2F(-512.0f), orx2F(512.0f)), orxFLOAT_0);
+    orxVector_Set(&(astAABoxList[i].vBR), astAABoxList[i].vTL.fX + orxMath_GetRandomFloat(orx2F(1.0f), orx2F(64.0f)), astAABoxList[i].vTL.fY + orxMath_GetRandomFloat(orx2F(1.0f), orx2F(64.0f)), orxFLOAT_0);
+    orxVector_Set(&avVectorList[i], orxMath_GetRandomFloat(orx2F(-64.0f), orx2F(64.0f)), orxMath_GetRandomFloat(orx2F(-64.0f), orx2F(64.0f)), orxMath_GetRandomFloat(orx2F(0.0f), orx2F(1.0f)));
+  }
+  RandomizeOBox(&stBox);
+  orxVector_Set(&(stBox.vX), stBox.vX.fX * orx2F(4.0f), stBox.vX.fY * orx2F(4.0f), orxFLOAT_0);
+  orxVector_Set(&(stBox.vY), stBox.vY.fX * orx2F(4.0f), stBox.vY.fY * orx2F(4.0f), orxFLOAT_0);
+  orxVector_Set(&(stBox.vZ), orxFLOAT_0, orxFLOAT_0, orxFLOAT_1);
+  orxVector_Set(&(stAABox.vTL), orx2F(-128.0f), orx2F(-128.0f), orxFLOAT_0);
+  orxVector_Set(&(stAABox.vBR), orx2F(128.0f), orx2F(128.0f), orxFLOAT_0);
+  orxVector_Set(&vPosition, orx2F(16.0f), orx2F(16.0f), orx2F(0.5f));
+  orxVector_Set(&vScale, orx2F(2.0f), orx2F(0.5f), orxFLOAT_1);
+  orxVector_Set(&vTranslation, orx2F(100.0f), orx2F(-50.0f), orx2F(0.25f));
+  fRotation = orx2F(0.7f);
+
+  // Gets total count
+  u32Count = orxBENCH_KU32_MATH_COUNT * orxBENCH_KU32_MATH_LOOP;
+
+  // Vector transform
+  dReference = orxSystem_GetTime();
+  for(j = 0; j < orxBENCH_KU32_MATH_LOOP; j++)
+  {
+    for(i = 0; i < orxBENCH_KU32_MATH_COUNT; i++)
+    {
+      orxVector_Add(&avReferenceList[i], orxVector_2DRotate(&avReferenceList[i], orxVector_Mul(&avReferenceList[i], &avVectorList[i], &vScale), fRotation), &vTranslation);
+    }
+  }
+  dReference = orxSystem_GetTime() - dReference;
+  dTime = orxSystem_GetTime();
+  for(j = 0; j < orxBENCH_KU32_MATH_LOOP; j++)
+  {
+    orxVector_2DTransformArray(avResultList, avVectorList, orxBENCH_KU32_MATH_COUNT, &vScale, fRotation, &vTranslation);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+  LogResult("orxVector_2DTransformArray", dReference, dTime, u32Count, (orxMemory_Compare(avReferenceList, avResultList, orxBENCH_KU32_MATH_COUNT * sizeof(orxVECTOR)) == 0) ? orxTRUE : orxFALSE);
+
+  // Point in oriented box
+  dReference = orxSystem_GetTime();
+  for(j = 0; j < orxBENCH_KU32_MATH_LOOP; j++)
+  {
+    for(i = 0; i < orxBENCH_KU32_MATH_COUNT; i++)
+    {
+      abReferenceList[i] = orxOBox_2DIsInside(&astBoxList[i], &vPosition);
+    }
+  }
+  dReference = orxSystem_GetTime() - dReference;
+  dTime = orxSystem_GetTime();
+  for(j = 0; j < orxBENCH_KU32_MATH_LOOP; j++)
+  {
+    orxOBox_2DIsInsideArray(astBoxList, orxBENCH_KU32_MATH_COUNT, &vPosition, abResultList);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+  LogResult("orxOBox_2DIsInsideArray", dReference, dTime, u32Count, (orxMemory_Compare(abReferenceList, abResultList, orxBENCH_KU32_MATH_COUNT * sizeof(orxBOOL)) == 0) ? orxTRUE : orxFALSE);
+
+  // Oriented box intersection
+  dReference = orxSystem_GetTime();
+  for(j = 0; j < orxBENCH_KU32_MATH_LOOP; j++)
+  {
+    for(i = 0; i < orxBENCH_KU32_MATH_COUNT; i++)
+    {
+      abReferenceList[i] = orxOBox_ZAlignedTestIntersection(&stBox, &astBoxList[i]);
+    }
+  }
+  dReference = orxSystem_GetTime() - dReference;
+  dTime = orxSystem_GetTime();
+  for(j = 0; j < orxBENCH_KU32_MATH_LOOP; j++)
+  {
+    orxOBox_ZAlignedTestIntersectionArray(&stBox, astBoxList, orxBENCH_KU32_MATH_COUNT, abResultList);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+  LogResult("orxOBox_ZAlignedTestIntersectionArray", dReference, dTime, u32Count, (orxMemory_Compare(abReferenceList, abResultList, orxBENCH_KU32_MATH_COUNT * sizeof(orxBOOL)) == 0) ? orxTRUE : orxFALSE);
+
+  // Axis aligned box intersection
+  dReference = orxSystem_GetTime();
+  for(j = 0; j < orxBENCH_KU32_MATH_LOOP; j++)
+  {
+    for(i = 0; i < orxBENCH_KU32_MATH_COUNT; i++)
+    {
+      abReferenceList[i] = orxAABox_Test2DIntersection(&stAABox, &astAABoxList[i]);
+    }
+  }
+  dReference = orxSystem_GetTime() - dReference;
+  dTime = orxSystem_GetTime();
+  for(j = 0; j < orxBENCH_KU32_MATH_LOOP; j++)
+  {
+    orxAABox_Test2DIntersectionArray(&stAABox, astAABoxList, orxBENCH_KU32_MATH_COUNT, abResultList);
+  }
+  dTime = orxSystem_GetTime() - dTime;
+  LogResult("orxAABox_Test2DIntersectionArray", dReference, dTime, u32Count, (orxMemory_Compare(abReferenceList, abResultList, orxBENCH_KU32_MATH_COUNT * sizeof(orxBOOL)) == 0) ? orxTRUE : orxFALSE);
+
+  // Frees data
+  orxMemory_Free(astBoxList);
+  orxMemory_Free(astAABoxList);
+  orxMemory_Free(avVectorList);
+  orxMemory_Free(avReferenceList);
+  orxMemory_Free(avResultList);
+  orxMemory_Free(abReferenceList);
+  orxMemory_Free(abResultList);
+}
+
+static orxDOUBLE orxFASTCALL TimeHashTable(orxU32 _u32Flags, orxU32 _u32Count, orxDOUBLE *_pdHit, orxDOUBLE *_pdMiss, orxU64 *_pu64Checksum)
+{
+  orxDOUBLE dResult = 0.0;
+  orxU32    i, j, u32Loop;
+
+  // Gets loop count
+  u32Loop = orxMAX(orxBENCH_KU32_HASHTABLE_OPS / _u32Count, 1);
+
+  // Clears outputs
+  *_pdHit         = 0.0;
+  *_pdMiss        = 0.0;
+  *_pu64Checksum  = 0;
+
+  // For all loops
+  for(j = 0; j < u32Loop; j++)
+  {
+    orxHASHTABLE *pstTable;
+    orxDOUBLE     dTime;
+
+    // Creates table
+    pstTable = orxHashTable_Create(orxBENCH_KU32_HASHTABLE_INITIAL_SIZE, _u32Flags, orxMEMORY_TYPE_TEMP);
+
+    // Checks
+    orxASSERT(pstTable != orxNULL);
+
+    // Inserts all keys
+    dTime = orxSystem_GetTime();
+    for(i = 1; i <= _u32Count; i++)
+    {
+      orxHashTable_Add(pstTable, (orxU64)i * orxBENCH_KU64_HASHTABLE_HIT_SEED, (void *)(orxUPTR)i);
+    }
+    dResult += orxSystem_GetTime() - dTime;
+
+    // Looks up all keys
+    dTime = orxSystem_GetTime();
+    for(i = 1; i <= _u32Count; i++)
+    {
+      *_pu64Checksum += (orxU64)(orxUPTR)orxHashTable_Get(pstTable, (orxU64)i * orxBENCH_KU64_HASHTABLE_HIT_SEED);
+    }
+    *_pdHit += orxSystem_GetTime() - dTime;
+
+    // Looks up missing keys
+    dTime = orxSystem_GetTime();
+    for(i = 1; i <= _u32Count; i++)
+    {
+      *_pu64Checksum += (orxU64)(orxUPTR)orxHashTable_Get(pstTable, (orxU64)i * orxBENCH_KU64_HASHTABLE_MISS_SEED);
+    }
+    *_pdMiss += orxSystem_GetTime() - dTime;
+
+    // Deletes table
+    orxHashTable_Delete(pstTable);
+  }
+
+  // Done!
+  return dResult;
+}
+
+static void orxFASTCALL BenchHashTable()
+{
+  static const orxU32 sau32CountList[] = {1000, 100000, 1000000};
+  orxU32              i;
+
+  // Logs message
+  orxBENCH_LOG(BENCH, "Chained -> open addressing, initial size %u", orxBENCH_KU32_HASHTABLE_INITIAL_SIZE);
+
+  // For all key counts
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sau32CountList); i++)
+  {
+    orxDOUBLE dInsert, dHit, dMiss, dOpenInsert, dOpenHit, dOpenMiss;
+    orxU64    u64Checksum, u64OpenChecksum;
+    orxU32    u32Total;
+    orxCHAR   acBuffer[64];
+
+    // Runs both modes
+    dInsert     = TimeHashTable(orxHASHTABLE_KU32_FLAG_NONE, sau32CountList[i], &dHit, &dMiss, &u64Checksum);
+    dOpenInsert = TimeHashTable(orxHASHTABLE_KU32_FLAG_OPEN_ADDRESSING, sau32CountList[i], &dOpenHit, &dOpenMiss, &u64OpenChecksum);
+
+    // Gets total operation count
+    u32Total    = orxMAX(orxBENCH_KU32_HASHTABLE_OPS / sau32CountList[i], 1) * sau32CountList[i];
+
+    // Logs results
+    orxString_NPrint(acBuffer, sizeof(acBuffer), "Insert      %7u keys", sau32CountList[i]);
+    LogResult(acBuffer, dInsert, dOpenInsert, u32Total, orxTRUE);
+    orxString_NPrint(acBuffer, sizeof(acBuffer), "Lookup hit  %7u keys", sau32CountList[i]);
+    LogResult(acBuffer, dHit, dOpenHit, u32Total, (u64Checksum == u64OpenChecksum) ? orxTRUE : orxFALSE);
+    orxString_NPrint(acBuffer, sizeof(acBuffer), "Lookup miss %7u keys", sau32CountList[i]);
+    LogResult(acBuffer, dMiss, dOpenMiss, u32Total, (u64Checksum == u64OpenChecksum) ? orxTRUE : orxFALSE);
+  }
+}
+
+static void orxFASTCALL BenchConfig()
+{
+  orxDOUBLE dText = 0.0, dBinary = 0.0;
+  orxU32    i, u32TextCount = 0, u32BinaryCount = 0;
+  orxBOOL   bSuccess = orxTRUE;
+
+  // Generates config content
+  for(i = 0; i < orxBENCH_KU32_CONFIG_SECTIONS; i++)
+  {
+    orxCHAR   acName[32], acParent[32];
+    orxVECTOR vValue;
+    orxSTRING azList[4];
+
+    // Pushes section
+    orxString_NPrint(acName, sizeof(acName), "Object%u", i);
+    orxConfig_PushSection(acName);
+
+    // Sets parent
+    if(i % 4 != 0)
+    {
+      orxString_NPrint(acParent, sizeof(acParent), "Object%u", i - (i % 4));
+      orxConfig_SetParent(acName, acParent);
+    }
+
+    // Sets values
+    orxString_NPrint(acParent, sizeof(acParent), "Graphic%u", i);
+    orxConfig_SetString("Graphic", acParent);
+    orxConfig_SetVector("Position", orxVector_Set(&vValue, orxU2F(i), orxU2F(i * 2), orx2F(0.5f)));
+    orxConfig_SetVector("Scale", orxVector_Set(&vValue, orx2F(2.0f), orx2F(2.0f), orxFLOAT_1));
+    orxConfig_SetFloat("Rotation", orxU2F(i % 360));
+    orxConfig_SetFloat("Alpha", orx2F(0.75f));
+    orxConfig_SetU32("Age", i);
+    orxConfig_SetString("Color", "(255, 128, 0)");
+    azList[0] = "FX1";
+    azList[1] = "FX2";
+    azList[2] = "Sound1";
+    azList[3] = "Track1";
+    orxConfig_SetListString("ChildList", (const orxSTRING *)azList, 4);
+
+    // Pops section
+    orxConfig_PopSection();
+  }
+
+  // Saves both formats
+  if((orxConfig_Save(orxBENCH_KZ_CONFIG_TEXT_FILE, orxFALSE, orxNULL) != orxSTATUS_FAILURE)
+  && (orxConfig_SaveBinary(orxBENCH_KZ_CONFIG_BINARY_FILE, orxFALSE, orxNULL) != orxSTATUS_FAILURE))
+  {
+    // For all loops
+    for(i = 0; (i < orxBENCH_KU32_CONFIG_LOOP) && (bSuccess != orxFALSE); i++)
+    {
+      orxDOUBLE dTime;
+
+      // Loads text file
+      orxConfig_Clear(orxNULL);
+      dTime     = orxSystem_GetTime();
+      bSuccess  = (orxConfig_Load(orxBENCH_KZ_CONFIG_TEXT_FILE) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+      dText    += orxSystem_GetTime() - dTime;
+      u32TextCount = orxConfig_GetSectionCount();
+
+      // Loads binary file
+      orxConfig_Clear(orxNULL);
+      dTime     = orxSystem_GetTime();
+      bSuccess &= (orxConfig_Load(orxBENCH_KZ_CONFIG_BINARY_FILE) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+      dBinary  += orxSystem_GetTime() - dTime;
+      u32BinaryCount = orxConfig_GetSectionCount();
+    }
+
+    // Logs results
+    orxBENCH_LOG(BENCH, "Text -> binary, %u sections, %u loads", u32TextCount, orxBENCH_KU32_CONFIG_LOOP);
+    LogResult("orxConfig_Load", dText, dBinary, orxBENCH_KU32_CONFIG_LOOP, ((bSuccess != orxFALSE) && (u32TextCount == u32BinaryCount)) ? orxTRUE : orxFALSE);
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(BENCH, "Couldn't save config files, aborting");
+  }
+
+  // Cleans up
+  orxConfig_Clear(orxNULL);
+  orxFile_Delete(orxBENCH_KZ_CONFIG_TEXT_FILE);
+  orxFile_Delete(orxBENCH_KZ_CONFIG_BINARY_FILE);
+}
+
+static void orxFASTCALL TimerCallback(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  // Updates count
+  sstBench.u32TimerCount++;
+}
+
+static void orxFASTCALL BenchClock()
+{
+  // Inits clock module
+  if(orxModule_Init(orxMODULE_ID_CLOCK) != orxSTATUS_FAILURE)
+  {
+    orxCLOCK *pstClock;
+
+    // Creates a clock ticking on every update, with a fixed DT, so as to never wait for real time
+    pstClock = orxClock_Create(orxFLOAT_0);
+
+    // Success?
+    if(pstClock != orxNULL)
+    {
+      orxDOUBLE dTime;
+      orxU32    i;
+
+      // Sets its DT
+      orxClock_SetModifier(pstClock, orxCLOCK_MODIFIER_FIXED, orxBENCH_KF_CLOCK_DT);
+
+      // Adds all timers
+      orxMath_InitRandom(0x0DDBA11);
+      dTime = orxSystem_GetTime();
+      for(i = 1; i <= orxBENCH_KU32_CLOCK_TIMERS; i++)
+      {
+        orxClock_AddTimer(pstClock, TimerCallback, orxMath_GetRandomFloat(orxBENCH_KF_CLOCK_DT, orxBENCH_KF_CLOCK_MAX_DELAY), -1, (void *)(orxUPTR)i);
+      }
+      dTime = orxSystem_GetTime() - dTime;
+      orxBENCH_LOG(RESULT, "%-36.36s %10.3f ns per timer", "orxClock_AddTimer", (dTime * 1.0e9) / (orxDOUBLE)orxBENCH_KU32_CLOCK_TIMERS);
+
+      // Ticks clock
+      sstBench.u32TimerCount = 0;
+      dTime = orxSystem_GetTime();
+      for(i = 0; i < orxBENCH_KU32_CLOCK_TICKS; i++)
+      {
+        orxClock_Update();
+      }
+      dTime = orxSystem_GetTime() - dTime;
+      orxBENCH_LOG(RESULT, "%-36.36s %10.3f us per tick, %u timers, %u calls per tick", "orxClock_Update", (dTime * 1.0e6) / (orxDOUBLE)orxBENCH_KU32_CLOCK_TICKS, orxBENCH_KU32_CLOCK_TIMERS, sstBench.u32TimerCount / orxBENCH_KU32_CLOCK_TICKS);
+
+      // Removes some timers by context
+      dTime = orxSystem_GetTime();
+      for(i = 1; i <= orxBENCH_KU32_CLOCK_REMOVALS; i++)
+      {
+        orxClock_RemoveTimer(pstClock, TimerCallback, -orxFLOAT_1, (void *)(orxUPTR)(i * (orxBENCH_KU32_CLOCK_TIMERS / orxBENCH_KU32_CLOCK_REMOVALS)));
+      }
+      dTime = orxSystem_GetTime() - dTime;
+      orxBENCH_LOG(RESULT, "%-36.36s %10.3f us per timer", "orxClock_RemoveTimer", (dTime * 1.0e6) / (orxDOUBLE)orxBENCH_KU32_CLOCK_REMOVALS);
+
+      // Removes all remaining timers
+      dTime = orxSystem_GetTime();
+      orxClock_RemoveTimer(pstClock, orxNULL, -orxFLOAT_1, orxNULL);
+      dTime = orxSystem_GetTime() - dTime;
+      orxBENCH_LOG(RESULT, "%-36.36s %10.3f ms", "orxClock_RemoveTimer (all)", dTime * 1.0e3);
+
+      // Deletes clock
+      orxClock_Delete(pstClock);
+    }
+    else
+    {
+      // Logs message
+      orxBENCH_LOG(BENCH, "Couldn't create clock, aborting");
+    }
+
+    // Exits from clock module
+    orxModule_Exit(orxMODULE_ID_CLOCK);
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(BENCH, "Couldn't init clock module, aborting");
+  }
+}
+
+static void orxFASTCALL BenchObject()
+{
+  // Inits object module
+  if(orxModule_Init(orxMODULE_ID_OBJECT) != orxSTATUS_FAILURE)
+  {
+    orxOBJECT **apstObjectList;
+    orxVECTOR   vValue;
+    orxDOUBLE   dCached, dCompiled;
+    orxU32      i, u32CachedCount = 0, u32CompiledCount = 0;
+    orxSTRING   azList[2];
+
+    // Generates child section
+    orxConfig_PushSection(orxBENCH_KZ_OBJECT_CHILD_SECTION);
+    orxConfig_SetString("Position", "top left -> center");
+    orxConfig_SetFloat("Alpha", orx2F(0.5f));
+    orxConfig_SetString("Speed", "(10, 20, 0)");
+    orxConfig_SetBool("UseRelativeSpeed", orxTRUE);
+    orxConfig_PopSection();
+
+    // Generates object section, without graphic nor body so as to not depend on display/physics
+    orxConfig_PushSection(orxBENCH_KZ_OBJECT_SECTION);
+    orxConfig_SetVector("Position", orxVector_Set(&vValue, orx2F(100.0f), orx2F(50.0f), orx2F(0.5f)));
+    orxConfig_SetVector("Scale", orxVector_Set(&vValue, orx2F(2.0f), orx2F(2.0f), orxFLOAT_1));
+    orxConfig_SetVector("Speed", orxVector_Set(&vValue, orx2F(5.0f), orxFLOAT_0, orxFLOAT_0));
+    orxConfig_SetString("Color", "(255, 128, 0)");
+    orxConfig_SetFloat("Alpha", orx2F(0.75f));
+    orxConfig_SetFloat("Rotation", orx2F(45.0f));
+    orxConfig_SetFloat("AngularVelocity", orx2F(90.0f));
+    orxConfig_SetString("Group", "BenchGroup");
+    orxConfig_SetString("Smoothing", "true");
+    orxConfig_SetString("BlendMode", "add");
+    orxConfig_SetFloat("LifeTime", orx2F(10.0f));
+    azList[0] = orxBENCH_KZ_OBJECT_CHILD_SECTION;
+    azList[1] = orxBENCH_KZ_OBJECT_CHILD_SECTION;
+    orxConfig_SetListString("ChildList", (const orxSTRING *)azList, 2);
+    orxConfig_PopSection();
+
+    // Allocates object list
+    apstObjectList = (orxOBJECT **)orxMemory_Allocate(orxBENCH_KU32_OBJECT_COUNT * sizeof(orxOBJECT *), orxMEMORY_TYPE_TEMP);
+
+    // Creates objects, template recompiled before each creation
+    dCompiled = orxSystem_GetTime();
+    for(i = 0; i < orxBENCH_KU32_OBJECT_COUNT; i++)
+    {
+      // Touches section (bumps its generation, the cost of a single config write is included)
+      orxConfig_PushSection(orxBENCH_KZ_OBJECT_SECTION);
+      orxConfig_SetFloat("Rotation", orx2F(45.0f));
+      orxConfig_PopSection();
+
+      // Creates object
+      apstObjectList[i] = orxObject_CreateFromConfig(orxBENCH_KZ_OBJECT_SECTION);
+      u32CompiledCount += (apstObjectList[i] != orxNULL) ? 1 : 0;
+    }
+    dCompiled = orxSystem_GetTime() - dCompiled;
+
+    // Deletes them
+    for(i = 0; i < orxBENCH_KU32_OBJECT_COUNT; i++)
+    {
+      if(apstObjectList[i] != orxNULL)
+      {
+        orxObject_Delete(apstObjectList[i]);
+      }
+    }
+
+    // Creates objects, cached template
+    dCached = orxSystem_GetTime();
+    for(i = 0; i < orxBENCH_KU32_OBJECT_COUNT; i++)
+    {
+      // Creates object
+      apstObjectList[i] = orxObject_CreateFromConfig(orxBENCH_KZ_OBJECT_SECTION);
+      u32CachedCount += (apstObjectList[i] != orxNULL) ? 1 : 0;
+    }
+    dCached = orxSystem_GetTime() - dCached;
+
+    // Deletes them
+    for(i = 0; i < orxBENCH_KU32_OBJECT_COUNT; i++)
+    {
+      if(apstObjectList[i] != orxNULL)
+      {
+        orxObject_Delete(apstObjectList[i]);
+      }
+    }
+
+    // Logs results (each object comes with 2 children)
+    orxBENCH_LOG(RESULT, "%-36.36s %10.3f us per object (recompiled template)", "orxObject_CreateFromConfig", (dCompiled * 1.0e6) / (orxDOUBLE)orxBENCH_KU32_OBJECT_COUNT);
+    orxBENCH_LOG(RESULT, "%-36.36s %10.3f us per object (cached template), x%.2f", "orxObject_CreateFromConfig", (dCached * 1.0e6) / (orxDOUBLE)orxBENCH_KU32_OBJECT_COUNT, (dCached > 0.0) ? dCompiled / dCached : 0.0);
+
+    // Failures?
+    if((u32CompiledCount != orxBENCH_KU32_OBJECT_COUNT) || (u32CachedCount != orxBENCH_KU32_OBJECT_COUNT))
+    {
+      // Logs message
+      orxBENCH_LOG(BENCH, "Only created %u/%u objects (recompiled) and %u/%u objects (cached)", u32CompiledCount, orxBENCH_KU32_OBJECT_COUNT, u32CachedCount, orxBENCH_KU32_OBJECT_COUNT);
+    }
+
+    // Frees object list
+    orxMemory_Free(apstObjectList);
+
+    // Clears sections
+    orxConfig_ClearSection(orxBENCH_KZ_OBJECT_SECTION);
+    orxConfig_ClearSection(orxBENCH_KZ_OBJECT_CHILD_SECTION);
+
+    // Exits from object module
+    orxModule_Exit(orxMODULE_ID_OBJECT);
+  }
+  else
+  {
+    // Logs message
+    orxBENCH_LOG(BENCH, "Couldn't init object module, aborting");
+  }
+}
+
+/** Bench list
+ */
+static const orxBENCH sastBenchList[] =
+{
+  {"math", &BenchMath},
+  {"hashtable", &BenchHashTable},
+  {"config", &BenchConfig},
+  {"clock", &BenchClock},
+  {"object", &BenchObject}
+};
+
+static orxSTATUS orxFASTCALL ProcessBenchParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // For all names
+  for(i = 1; (i < _u32ParamCount) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    orxU32 j;
+
+    // Finds bench
+    for(j = 0; (j < orxARRAY_GET_ITEM_COUNT(sastBenchList)) && orxString_ICompare(_azParams[i], sastBenchList[j].zName); j++);
+
+    // Found?
+    if(j < orxARRAY_GET_ITEM_COUNT(sastBenchList))
+    {
+      // Selects it
+      sstBench.u32Selection |= 1 << j;
+    }
+    else
+    {
+      // Logs message
+      orxBENCH_LOG(BENCH, "Unknown bench [%s], aborting", _azParams[i]);
+
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Setup()
+{
+  // Adds module dependencies
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PARAM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_SYSTEM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_CONFIG);
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxBENCH_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxBENCH_DECLARE_PARAM("b", "bench", "Bench list", "List of benches to run, among: math, hashtable, config, clock, object. All of them are run if none is provided", ProcessBenchParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstBench, sizeof(orxBENCH_STATIC));
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+}
+
+static void Run()
+{
+  orxU32 i;
+
+  // For all benches
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sastBenchList); i++)
+  {
+    // Selected?
+    if((sstBench.u32Selection == 0) || (sstBench.u32Selection & (1 << i)))
+    {
+      // Logs message
+      orxBENCH_LOG(BENCH, "==== %s", sastBenchList[i].zName);
+
+      // Runs it
+      sastBenchList[i].pfnRun();
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  // Inits the Debug System
+  orxDEBUG_INIT();
+
+  // Sets debug flags
+  orxDEBUG_SET_FLAGS(orxDEBUG_KU32_STATIC_FLAG_TIMESTAMP, orxDEBUG_KU32_STATIC_FLAG_FULL_TIMESTAMP | orxDEBUG_KU32_STATIC_FLAG_TYPE | orxDEBUG_KU32_STATIC_FLAG_TAGGED);
+
+  // Registers main module
+  orxModule_Register(orxMODULE_ID_MAIN, "MAIN", Setup, Init, Exit);
+
+  // Sends the command line arguments to orxParam module
+  if(orxParam_SetArgs(argc, argv) != orxSTATUS_FAILURE)
+  {
+    // Inits the engine
+    if(orxModule_Init(orxMODULE_ID_MAIN) != orxSTATUS_FAILURE)
+    {
+      // Runs
+      Run();
+
+      // Exits from engine
+      orxModule_Exit(orxMODULE_ID_MAIN);
+    }
+
+    // Clears params
+    orxParam_SetArgs(0, orxNULL);
+  }
+
+  // Exits from the Debug system
+  orxDEBUG_EXIT();
+
+  // Done!
+  return EXIT_SUCCESS;
+}